@@ -0,0 +1,236 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::ADC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_ADC_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_ADC_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/dma.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/adc.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 ADC facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::ADC {
+
+/**
+ * \brief Load the ADC peripheral's factory linearity and bias calibration values from the
+ *        NVM software calibration area.
+ *
+ * \param[in] adc The ADC peripheral.
+ */
+void load_calibration( Peripheral::ADC & adc ) noexcept;
+
+/**
+ * \brief Conversion trigger.
+ */
+enum class Trigger : std::uint_fast8_t {
+    EVENT,        ///< Each start conversion event starts a conversion.
+    FREE_RUNNING, ///< Each conversion is started when the previous conversion completes.
+};
+
+/**
+ * \brief Block callback.
+ */
+using Block_Callback =
+    void ( * )( void * context, std::uint16_t const * block, std::uint16_t size );
+
+/**
+ * \brief DMA double buffered ADC streaming driver.
+ *
+ * Conversions are started by start conversion events (e.g. a TC or TCC peripheral
+ * overflow routed to the ADC peripheral's start conversion event user), or continuously
+ * in free running mode. If more than one input is scanned, each conversion converts the
+ * next input in the scan. If more than one sample is collected per conversion, the ADC
+ * peripheral's hardware averaging is used.
+ *
+ * Each result is copied into a caller-owned double buffer by a DMAC channel allocated
+ * from a picolibrary::Microchip::SAM::D21DA1::DMA::Controller. When one half of the
+ * buffer (a block) has been filled, the DMAC channel continues with the other half, and
+ * the block callback is called (from the DMAC interrupt handler) with the filled block.
+ * The filled block must be consumed before the other half of the buffer has been filled.
+ *
+ * \attention The driver and its buffer must remain valid while it is enabled.
+ */
+class Stream {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \pre block_size > 0
+     * \pre callback is not null
+     *
+     * \param[in] adc The ADC peripheral to use.
+     * \param[in] dma The DMA controller to allocate the DMAC channel and linked
+     *            descriptor from.
+     * \param[in] buffer The double buffer (2 * block_size results).
+     * \param[in] block_size The number of results in each block.
+     * \param[in] callback The block callback.
+     * \param[in] context The block callback context.
+     */
+    Stream(
+        Peripheral::ADC & adc,
+        DMA::Controller & dma,
+        std::uint16_t *   buffer,
+        std::uint16_t     block_size,
+        Block_Callback    callback,
+        void *            context ) noexcept;
+
+    Stream( Stream && ) = delete;
+
+    Stream( Stream const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Stream() noexcept = default;
+
+    auto operator=( Stream && ) = delete;
+
+    auto operator=( Stream const & ) = delete;
+
+    /**
+     * \brief Configure and enable the ADC peripheral, and start streaming.
+     *
+     * The ADC peripheral is reset, and its factory calibration is loaded. Single-ended
+     * conversions are used. If more than one sample is collected per conversion, the
+     * accumulated result is right shifted so that each result is the 12 bit average of
+     * the samples (see picolibrary::Microchip::SAM::D21DA1::ADC::Stream::result_bits()).
+     *
+     * \pre the ADC peripheral's APB clock and GCLK have been enabled
+     * \pre the DMA controller has been enabled
+     * \pre sampling_time < 64
+     * \pre 0 < inputs <= 16
+     * \pre block_size is a multiple of inputs
+     * \pre if trigger is picolibrary::Microchip::SAM::D21DA1::ADC::Trigger::EVENT, the
+     *      conversion trigger event has been routed to the ADC peripheral's start
+     *      conversion event user
+     *
+     * \param[in] reference The reference.
+     * \param[in] prescaler The ADC clock prescaler.
+     * \param[in] sampling_time The additional sampling time, in half ADC clock cycles.
+     * \param[in] samples The number of samples to collect (and average) per conversion.
+     * \param[in] first_input The first input to scan.
+     * \param[in] inputs The number of inputs to scan.
+     * \param[in] gain The gain.
+     * \param[in] trigger The conversion trigger.
+     */
+    void enable(
+        Peripheral::ADC::REFCTRL::REFSEL    reference,
+        Peripheral::ADC::CTRLB::PRESCALER   prescaler,
+        std::uint_fast8_t                   sampling_time,
+        Peripheral::ADC::AVGCTRL::SAMPLENUM samples,
+        Peripheral::ADC::INPUTCTRL::MUXPOS  first_input,
+        std::uint_fast8_t                   inputs,
+        Peripheral::ADC::INPUTCTRL::GAIN    gain,
+        Trigger                             trigger ) noexcept;
+
+    /**
+     * \brief Stop streaming, and disable the ADC peripheral.
+     */
+    void disable() noexcept;
+
+    /**
+     * \brief Get the number of bits in each result.
+     *
+     * \return The number of bits in each result.
+     */
+    static constexpr auto result_bits() noexcept -> std::uint_fast8_t
+    {
+        return 12;
+    }
+
+    /**
+     * \brief Check if a result has been overwritten before it was copied (and clear the
+     *        overrun flag).
+     *
+     * \return true if a result has been overwritten before it was copied.
+     * \return false if a result has not been overwritten before it was copied.
+     */
+    auto overrun() noexcept -> bool;
+
+  private:
+    /**
+     * \brief The ADC peripheral.
+     */
+    Peripheral::ADC * m_adc;
+
+    /**
+     * \brief The DMA controller.
+     */
+    DMA::Controller * m_dma;
+
+    /**
+     * \brief The double buffer.
+     */
+    std::uint16_t * m_buffer;
+
+    /**
+     * \brief The number of results in each block.
+     */
+    std::uint16_t m_block_size;
+
+    /**
+     * \brief The block callback.
+     */
+    Block_Callback m_callback;
+
+    /**
+     * \brief The block callback context.
+     */
+    void * m_context;
+
+    /**
+     * \brief The DMAC channel.
+     */
+    DMA::Channel m_channel{};
+
+    /**
+     * \brief The linked descriptor (fills the second block).
+     */
+    DMA::Descriptor * m_descriptor{};
+
+    /**
+     * \brief The block the DMAC channel is filling.
+     */
+    std::uint_fast8_t volatile m_block{};
+
+    /**
+     * \brief Wait for ADC peripheral register synchronization to complete.
+     */
+    void synchronize() const noexcept;
+
+    /**
+     * \brief Handle a block transfer completion.
+     *
+     * \param[in] context The driver.
+     * \param[in] completion The completion status.
+     */
+    static void handle_block_complete(
+        void *          context,
+        DMA::Completion completion ) noexcept;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::ADC
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_ADC_H
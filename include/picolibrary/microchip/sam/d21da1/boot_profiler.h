@@ -0,0 +1,158 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Boot_Profiler interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_BOOT_PROFILER_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_BOOT_PROFILER_H
+
+#include <cstdint>
+
+/**
+ * \brief Microchip SAM D21/DA1 boot profiler facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::Boot_Profiler {
+
+/**
+ * \brief The processor clock frequency after reset (OSC8M divided by 8), in Hz.
+ */
+constexpr auto RESET_FREQUENCY = std::uint32_t{ 1'000'000 };
+
+/**
+ * \brief The maximum number of checkpoints that can be recorded.
+ */
+constexpr auto CHECKPOINTS_MAX = std::uint_fast8_t{ 24 };
+
+/**
+ * \brief Boot phase.
+ */
+enum class Phase : std::uint8_t {
+    RESET,              ///< Reset handler entered.
+    DATA_COPIED,        ///< .data section initialized.
+    BSS_ZEROED,         ///< .bss section zeroed.
+    VTOR_SET,           ///< VTOR set.
+    NVM_ERRATA_APPLIED, ///< NVM "Spurious Writes" silicon errata workaround applied.
+    MAIN,               ///< Static initialization complete, main() about to be called.
+    CLOCK_CHANGED,      ///< Processor clock frequency changed.
+    CHECKPOINT,         ///< User-defined checkpoint.
+};
+
+/**
+ * \brief Checkpoint.
+ */
+struct Checkpoint {
+    /**
+     * \brief The boot phase.
+     */
+    Phase phase;
+
+    /**
+     * \brief The user-defined checkpoint ID (if phase is
+     *        picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::Phase::CHECKPOINT).
+     */
+    std::uint8_t id;
+
+    /**
+     * \brief The number of processor clock cycles since the previous checkpoint.
+     */
+    std::uint32_t cycles;
+
+    /**
+     * \brief The processor clock frequency since the previous checkpoint, in Hz.
+     */
+    std::uint32_t frequency;
+};
+
+/**
+ * \brief Start profiling (records a
+ *        picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::Phase::RESET checkpoint).
+ *
+ * If SysTick is not already enabled, it is configured to count processor clock cycles
+ * with the maximum reload value (without generating interrupts).
+ *
+ * \attention This function does not depend on the .data and .bss sections, so it can be
+ *            called before they are initialized.
+ *
+ * \param[in] frequency The processor clock frequency, in Hz.
+ */
+void start( std::uint32_t frequency = RESET_FREQUENCY ) noexcept;
+
+/**
+ * \brief Record a boot phase checkpoint.
+ *
+ * If CHECKPOINTS_MAX checkpoints have already been recorded, the checkpoint is dropped.
+ *
+ * \param[in] phase The boot phase.
+ * \param[in] id The user-defined checkpoint ID (if phase is
+ *            picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::Phase::CHECKPOINT).
+ */
+void stamp( Phase phase, std::uint8_t id = 0 ) noexcept;
+
+/**
+ * \brief Record a user-defined checkpoint.
+ *
+ * \param[in] id The user-defined checkpoint ID.
+ */
+inline void checkpoint( std::uint8_t id ) noexcept
+{
+    stamp( Phase::CHECKPOINT, id );
+}
+
+/**
+ * \brief Record a processor clock frequency change (call immediately after changing the
+ *        processor clock frequency).
+ *
+ * \param[in] frequency The new processor clock frequency, in Hz.
+ */
+void clock_changed( std::uint32_t frequency ) noexcept;
+
+/**
+ * \brief Get the number of checkpoints that have been recorded.
+ *
+ * \return The number of checkpoints that have been recorded.
+ */
+auto checkpoints() noexcept -> std::uint_fast8_t;
+
+/**
+ * \brief Get a recorded checkpoint.
+ *
+ * \pre n < picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::checkpoints()
+ *
+ * \param[in] n The checkpoint number.
+ *
+ * \return The checkpoint.
+ */
+auto checkpoint_record( std::uint_fast8_t n ) noexcept -> Checkpoint;
+
+/**
+ * \brief Get the time from reset to a recorded checkpoint.
+ *
+ * \pre n < picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::checkpoints()
+ *
+ * \param[in] n The checkpoint number.
+ *
+ * \return The time from reset to the checkpoint, in microseconds (accounting for
+ *         processor clock frequency changes).
+ */
+auto elapsed_us( std::uint_fast8_t n ) noexcept -> std::uint32_t;
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Boot_Profiler
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_BOOT_PROFILER_H
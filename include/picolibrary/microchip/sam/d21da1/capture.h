@@ -0,0 +1,325 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Capture interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_CAPTURE_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_CAPTURE_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/dma.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/dmac.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/eic.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/evsys.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/tcc.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 input capture facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::Capture {
+
+/**
+ * \brief Route the level of an EIC external interrupt input to an event user using an
+ *        asynchronous EVSYS channel.
+ *
+ * The external interrupt is configured for high-level detection, so the event signal
+ * follows the input signal (as required by the period and pulse width capture event
+ * actions).
+ *
+ * \pre the EIC peripheral is disabled (its CONFIG registers are enable-protected)
+ * \pre extint < 16
+ * \pre channel < 12
+ *
+ * \param[in] eic The EIC peripheral.
+ * \param[in] extint The external interrupt.
+ * \param[in] evsys The EVSYS peripheral.
+ * \param[in] channel The EVSYS channel to use.
+ * \param[in] user The event user.
+ */
+void connect(
+    Peripheral::EIC &                eic,
+    std::uint_fast8_t                extint,
+    Peripheral::EVSYS &              evsys,
+    std::uint_fast8_t                channel,
+    Peripheral::EVSYS::USER::USER_ID user ) noexcept;
+
+/**
+ * \brief Capture statistics (for a batch of captures).
+ */
+struct Statistics {
+    /**
+     * \brief The number of captured periods in the batch.
+     */
+    std::uint32_t samples;
+
+    /**
+     * \brief The number of captured periods that were overwritten before they could be
+     *        processed.
+     */
+    std::uint32_t dropped;
+
+    /**
+     * \brief The minimum period, in counter ticks.
+     */
+    std::uint32_t period_min;
+
+    /**
+     * \brief The maximum period, in counter ticks.
+     */
+    std::uint32_t period_max;
+
+    /**
+     * \brief The mean period, in counter ticks.
+     */
+    std::uint32_t period_mean;
+
+    /**
+     * \brief The mean pulse width, in counter ticks.
+     */
+    std::uint32_t pulse_width_mean;
+
+    /**
+     * \brief The mean frequency, in mHz (64-bit, since a 32-bit frequency in mHz could not
+     *        represent input frequencies above approximately 4.29 MHz).
+     */
+    std::uint64_t frequency;
+
+    /**
+     * \brief The mean duty cycle, in 1/65536ths.
+     */
+    std::uint16_t duty_cycle;
+};
+
+/**
+ * \brief TCC based period and pulse width capture channel.
+ *
+ * The TCC peripheral's event input 1 is configured for the period and pulse width
+ * capture event action: the period is captured in CC0 (and the counter is restarted) on
+ * each rising edge of the event signal, and the pulse width is captured in CC1 on each
+ * falling edge. Each capture triggers a DMAC channel that copies the capture into a
+ * caller-owned circular buffer, so captures do not require any CPU involvement. Captures
+ * are processed in batches, when statistics() is called.
+ *
+ * The longest period that can be captured is 2^24 counter ticks (TCC0 and TCC1) or 2^16
+ * counter ticks (TCC2). The first capture after the capture channel is enabled is
+ * discarded.
+ *
+ * \attention The capture channel and its buffers must remain valid while it is enabled.
+ */
+class Channel {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \pre capacity > 1
+     * \pre capacity is a power of two
+     *
+     * \param[in] tcc The TCC peripheral to use.
+     * \param[in] dma The DMA controller to allocate the period and pulse width capture
+     *            channels from.
+     * \param[in] period_trigger The TCC peripheral's match/compare 0 DMAC trigger source.
+     * \param[in] pulse_width_trigger The TCC peripheral's match/compare 1 DMAC trigger
+     *            source.
+     * \param[in] periods The period capture buffer.
+     * \param[in] pulse_widths The pulse width capture buffer.
+     * \param[in] capacity The capacity of each capture buffer.
+     */
+    Channel(
+        Peripheral::TCC &                  tcc,
+        DMA::Controller &                  dma,
+        Peripheral::DMAC::CHCTRLB::TRIGSRC period_trigger,
+        Peripheral::DMAC::CHCTRLB::TRIGSRC pulse_width_trigger,
+        std::uint32_t *                    periods,
+        std::uint32_t *                    pulse_widths,
+        std::uint16_t                      capacity ) noexcept;
+
+    Channel( Channel && ) = delete;
+
+    Channel( Channel const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Channel() noexcept = default;
+
+    auto operator=( Channel && ) = delete;
+
+    auto operator=( Channel const & ) = delete;
+
+    /**
+     * \brief Configure and enable the capture channel.
+     *
+     * \pre the TCC peripheral's APB clock and GCLK have been enabled
+     * \pre the DMA controller has been enabled
+     * \pre the input signal has been routed to the TCC peripheral's event input 1 (see
+     *      picolibrary::Microchip::SAM::D21DA1::Capture::connect())
+     *
+     * \param[in] prescaler The counter prescaler.
+     * \param[in] gclk_frequency The frequency of the TCC peripheral's GCLK, in Hz.
+     */
+    void enable(
+        Peripheral::TCC::CTRLA::PRESCALER prescaler,
+        std::uint32_t                     gclk_frequency ) noexcept;
+
+    /**
+     * \brief Disable the capture channel.
+     */
+    void disable() noexcept;
+
+    /**
+     * \brief Get the counter tick frequency.
+     *
+     * \return The counter tick frequency, in Hz.
+     */
+    auto tick_frequency() const noexcept -> std::uint32_t
+    {
+        return m_tick_frequency;
+    }
+
+    /**
+     * \brief Process the captures made since the previous call.
+     *
+     * \return The statistics for the batch of captures.
+     */
+    auto statistics() noexcept -> Statistics;
+
+    /**
+     * \brief Get the maximum input frequency the capture channel can sustain.
+     *
+     * The maximum input frequency is the lower of the highest frequency that the counter
+     * can resolve (2 counter ticks per period) and the highest frequency at which the
+     * capture buffers do not overflow between batches.
+     *
+     * \pre batch_interval > 0
+     *
+     * \param[in] batch_interval The interval at which statistics() is called, in us.
+     *
+     * \return The maximum input frequency, in Hz.
+     *
+     * \attention DMAC service latency is not accounted for (it depends on the other
+     *            DMAC channels' traffic), so the maximum input frequency should be
+     *            derated when several capture channels (or other DMAC channels) are
+     *            active.
+     */
+    auto max_input_frequency( std::uint32_t batch_interval ) const noexcept
+        -> std::uint32_t;
+
+  private:
+    /**
+     * \brief Capture stream (a DMAC channel and its circular buffer).
+     */
+    struct Stream {
+        /**
+         * \brief The DMAC trigger source.
+         */
+        Peripheral::DMAC::CHCTRLB::TRIGSRC trigger;
+
+        /**
+         * \brief The buffer.
+         */
+        std::uint32_t * buffer;
+
+        /**
+         * \brief The DMAC channel.
+         */
+        DMA::Channel channel;
+
+        /**
+         * \brief The number of times the DMAC channel has wrapped around the buffer.
+         */
+        std::uint32_t volatile laps;
+
+        /**
+         * \brief The free-running number of captures that have been processed.
+         */
+        std::uint32_t processed;
+    };
+
+    /**
+     * \brief The TCC peripheral.
+     */
+    Peripheral::TCC * m_tcc;
+
+    /**
+     * \brief The DMA controller.
+     */
+    DMA::Controller * m_dma;
+
+    /**
+     * \brief The period capture stream.
+     */
+    Stream m_periods;
+
+    /**
+     * \brief The pulse width capture stream.
+     */
+    Stream m_pulse_widths;
+
+    /**
+     * \brief The capacity of each capture buffer.
+     */
+    std::uint16_t m_capacity;
+
+    /**
+     * \brief The counter tick frequency.
+     */
+    std::uint32_t m_tick_frequency{};
+
+    /**
+     * \brief Start a capture stream.
+     *
+     * \param[in] stream The capture stream.
+     * \param[in] source The capture register.
+     * \param[in] lap The capture stream's DMAC channel transfer complete callback.
+     */
+    void start( Stream & stream, void const * source, DMA::Callback lap ) noexcept;
+
+    /**
+     * \brief Get the free-running number of captures a capture stream has made.
+     *
+     * \param[in] stream The capture stream.
+     *
+     * \return The free-running number of captures the capture stream has made.
+     */
+    auto captured( Stream const & stream ) const noexcept -> std::uint32_t;
+
+    /**
+     * \brief Count a period capture stream lap.
+     *
+     * \param[in] context The capture channel.
+     * \param[in] completion The DMAC channel completion.
+     */
+    static void handle_period_lap( void * context, DMA::Completion completion ) noexcept;
+
+    /**
+     * \brief Count a pulse width capture stream lap.
+     *
+     * \param[in] context The capture channel.
+     * \param[in] completion The DMAC channel completion.
+     */
+    static void handle_pulse_width_lap(
+        void *          context,
+        DMA::Completion completion ) noexcept;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Capture
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_CAPTURE_H
@@ -0,0 +1,254 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Deferred_Work interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_DEFERRED_WORK_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_DEFERRED_WORK_H
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 deferred work facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::Deferred_Work {
+
+/**
+ * \brief The number of work queues (one per NVIC priority level).
+ */
+constexpr auto PRIORITIES = std::uint_fast8_t{ 4 };
+
+/**
+ * \brief The capacity of each work queue (must be a power of two).
+ */
+constexpr auto QUEUE_CAPACITY = std::uint_fast8_t{ 8 };
+
+static_assert( QUEUE_CAPACITY and not( QUEUE_CAPACITY & ( QUEUE_CAPACITY - 1 ) ) );
+
+/**
+ * \brief Work function.
+ */
+using Function = void ( * )( std::uint32_t argument );
+
+/**
+ * \brief PendSV based deferred work dispatcher.
+ *
+ * Interrupt handlers post fixed-size work items (a function and an argument) to the work
+ * queue associated with their NVIC priority level and pend PendSV. The PendSV handler
+ * drains the work queues (highest priority first) in batches.
+ *
+ * Each work queue is a single-producer, single-consumer ring buffer: handlers that share
+ * an NVIC priority level cannot preempt each other, and PendSV (which must be configured
+ * with the lowest priority) cannot preempt any of them, so posting and draining require
+ * neither locks nor interrupt masking.
+ *
+ * The dispatcher records each work queue's depth high-water mark and the number of work
+ * items dropped because it was full, and if a clock is provided, the maximum drain
+ * latency (the time from a work item being posted to it being executed).
+ */
+class Dispatcher {
+  public:
+    /**
+     * \brief Clock (returns the current time, with wraparound).
+     */
+    using Clock = std::uint32_t ( * )();
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] scb The SCB peripheral.
+     * \param[in] clock The clock to use to measure drain latency (nullptr if drain
+     *            latency should not be measured).
+     */
+    Dispatcher(
+        ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB & scb,
+        Clock                                                 clock ) noexcept :
+        m_scb{ &scb },
+        m_clock{ clock }
+    {
+    }
+
+    Dispatcher( Dispatcher && ) = delete;
+
+    Dispatcher( Dispatcher const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Dispatcher() noexcept = default;
+
+    auto operator=( Dispatcher && ) = delete;
+
+    auto operator=( Dispatcher const & ) = delete;
+
+    /**
+     * \brief Configure PendSV to have the lowest priority.
+     */
+    void configure_pendsv() noexcept;
+
+    /**
+     * \brief Post a work item and pend PendSV.
+     *
+     * \pre priority < picolibrary::Microchip::SAM::D21DA1::Deferred_Work::PRIORITIES
+     * \pre the caller is an interrupt handler whose NVIC priority level is priority (only
+     *      handlers at the same priority level may post to the same work queue)
+     *
+     * \param[in] priority The caller's NVIC priority level.
+     * \param[in] function The work function.
+     * \param[in] argument The work function argument.
+     *
+     * \return true if the work item was posted.
+     * \return false if the work queue is full (the work item is dropped).
+     */
+    auto post(
+        std::uint_fast8_t priority,
+        Function          function,
+        std::uint32_t     argument ) noexcept -> bool;
+
+    /**
+     * \brief Drain the work queues.
+     *
+     * Each work queue is drained in a batch that contains the work items that were queued
+     * when the batch started, from the highest priority work queue to the lowest priority
+     * work queue. Work items that are posted while draining are executed by the next
+     * PendSV invocation (posting pends PendSV).
+     *
+     * \attention This function must only be called by the PendSV handler.
+     */
+    void drain() noexcept;
+
+    /**
+     * \brief Get a work queue's depth high-water mark.
+     *
+     * \pre priority < picolibrary::Microchip::SAM::D21DA1::Deferred_Work::PRIORITIES
+     *
+     * \param[in] priority The work queue's NVIC priority level.
+     *
+     * \return The work queue's depth high-water mark.
+     */
+    auto high_water_mark( std::uint_fast8_t priority ) const noexcept
+        -> std::uint_fast8_t;
+
+    /**
+     * \brief Get the number of work items that have been dropped from a work queue.
+     *
+     * \pre priority < picolibrary::Microchip::SAM::D21DA1::Deferred_Work::PRIORITIES
+     *
+     * \param[in] priority The work queue's NVIC priority level.
+     *
+     * \return The number of work items that have been dropped from the work queue.
+     */
+    auto dropped( std::uint_fast8_t priority ) const noexcept -> std::uint32_t;
+
+    /**
+     * \brief Get a work queue's maximum drain latency.
+     *
+     * \pre priority < picolibrary::Microchip::SAM::D21DA1::Deferred_Work::PRIORITIES
+     *
+     * \param[in] priority The work queue's NVIC priority level.
+     *
+     * \return The work queue's maximum drain latency, in clock units.
+     */
+    auto max_drain_latency( std::uint_fast8_t priority ) const noexcept -> std::uint32_t;
+
+    /**
+     * \brief Reset the work queue statistics.
+     */
+    void reset_statistics() noexcept;
+
+  private:
+    /**
+     * \brief Work item.
+     */
+    struct Work {
+        /**
+         * \brief The work function.
+         */
+        Function function;
+
+        /**
+         * \brief The work function argument.
+         */
+        std::uint32_t argument;
+
+        /**
+         * \brief The time the work item was posted.
+         */
+        std::uint32_t posted;
+    };
+
+    /**
+     * \brief Work queue.
+     */
+    struct Queue {
+        /**
+         * \brief The work items.
+         */
+        Work work[ QUEUE_CAPACITY ];
+
+        /**
+         * \brief The free-running index of the next work item to execute (written by
+         *        the consumer only).
+         */
+        std::uint8_t volatile head;
+
+        /**
+         * \brief The free-running index of the next work item to post (written by the
+         *        producer only).
+         */
+        std::uint8_t volatile tail;
+
+        /**
+         * \brief The depth high-water mark.
+         */
+        std::uint8_t volatile high_water_mark;
+
+        /**
+         * \brief The number of work items that have been dropped.
+         */
+        std::uint32_t volatile dropped;
+
+        /**
+         * \brief The maximum drain latency.
+         */
+        std::uint32_t max_drain_latency;
+    };
+
+    /**
+     * \brief The SCB peripheral.
+     */
+    ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB * m_scb;
+
+    /**
+     * \brief The clock.
+     */
+    Clock m_clock;
+
+    /**
+     * \brief The work queues.
+     */
+    Queue m_queues[ PRIORITIES ]{};
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Deferred_Work
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_DEFERRED_WORK_H
@@ -0,0 +1,346 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::DMA interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_DMA_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_DMA_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/peripheral/dmac.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 DMA facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::DMA {
+
+/**
+ * \brief The number of DMAC channels.
+ */
+constexpr auto CHANNELS = std::uint_fast8_t{ 12 };
+
+/**
+ * \brief The number of linked descriptors available for building descriptor chains.
+ */
+constexpr auto LINKED_DESCRIPTORS = std::uint_fast8_t{ 16 };
+
+/**
+ * \brief Channel handle.
+ */
+using Channel = std::uint_fast8_t;
+
+/**
+ * \brief Transfer descriptor.
+ */
+using Descriptor = Peripheral::DMAC::Descriptor;
+
+/**
+ * \brief Transfer completion status.
+ */
+enum class Completion : std::uint_fast8_t {
+    TRANSFER_COMPLETE, ///< Transfer complete.
+    TRANSFER_ERROR,    ///< Transfer error.
+};
+
+/**
+ * \brief Transfer completion callback.
+ */
+using Callback = void ( * )( void * context, Completion completion );
+
+/**
+ * \brief Get an address in the form expected by the DMAC peripheral.
+ *
+ * \param[in] pointer The pointer to convert.
+ *
+ * \return The address.
+ */
+inline auto address( void const * pointer ) noexcept -> std::uint32_t
+{
+    return static_cast<std::uint32_t>( reinterpret_cast<std::uintptr_t>( pointer ) );
+}
+
+/**
+ * \brief Link a descriptor to the descriptor that follows it in a descriptor chain.
+ *
+ * \param[in] descriptor The descriptor.
+ * \param[in] next The descriptor that follows descriptor.
+ */
+inline void link( Descriptor & descriptor, Descriptor const & next ) noexcept
+{
+    descriptor.descaddr = address( &next );
+}
+
+/**
+ * \brief DMAC descriptor pool driver.
+ *
+ * The driver owns the DMAC peripheral's descriptor and write-back SRAM (one 128-bit
+ * aligned descriptor per channel each), and a pool of 128-bit aligned linked descriptors
+ * that can be used to build descriptor chains. Channels and linked descriptors are
+ * allocated from the driver and must be released when they are no longer needed.
+ *
+ * Each channel has a transfer completion callback that is called by the DMAC interrupt
+ * handler when the channel's transfer completes or fails.
+ *
+ * \attention The driver must be located in SRAM and must outlive every transfer it
+ *            manages.
+ * \attention Channels and linked descriptors must be allocated and released from a single
+ *            execution context.
+ */
+class Controller {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] dmac The DMAC peripheral.
+     */
+    constexpr Controller( Peripheral::DMAC & dmac ) noexcept : m_dmac{ &dmac }
+    {
+    }
+
+    Controller( Controller && ) = delete;
+
+    Controller( Controller const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Controller() noexcept = default;
+
+    auto operator=( Controller && ) = delete;
+
+    auto operator=( Controller const & ) = delete;
+
+    /**
+     * \brief Enable the DMAC peripheral (all priority levels are enabled).
+     *
+     * \pre the DMAC peripheral is disabled
+     */
+    void enable() noexcept;
+
+    /**
+     * \brief Disable the DMAC peripheral.
+     */
+    void disable() noexcept;
+
+    /**
+     * \brief Allocate a channel.
+     *
+     * \pre a channel is available
+     *
+     * \return The allocated channel.
+     */
+    auto allocate_channel() noexcept -> Channel;
+
+    /**
+     * \brief Release a channel (the channel is disabled).
+     *
+     * \pre channel has been allocated
+     *
+     * \param[in] channel The channel to release.
+     */
+    void release_channel( Channel channel ) noexcept;
+
+    /**
+     * \brief Get a channel's first descriptor.
+     *
+     * \pre channel has been allocated
+     *
+     * \param[in] channel The channel.
+     *
+     * \return The channel's first descriptor.
+     */
+    auto descriptor( Channel channel ) noexcept -> Descriptor &;
+
+    /**
+     * \brief Allocate a linked descriptor.
+     *
+     * \pre a linked descriptor is available
+     *
+     * \return The allocated linked descriptor.
+     */
+    auto allocate_descriptor() noexcept -> Descriptor &;
+
+    /**
+     * \brief Release a linked descriptor.
+     *
+     * \pre descriptor has been allocated
+     *
+     * \param[in] descriptor The linked descriptor to release.
+     */
+    void release_descriptor( Descriptor const & descriptor ) noexcept;
+
+    /**
+     * \brief Configure a channel (the channel is reset).
+     *
+     * \pre channel has been allocated
+     *
+     * \param[in] channel The channel to configure.
+     * \param[in] chctrlb The channel's CHCTRLB register value (event input action, event
+     *            input enable, event output enable, priority level, trigger source, and
+     *            trigger action).
+     * \param[in] callback The channel's transfer completion callback (nullptr if the
+     *            channel does not have a transfer completion callback).
+     * \param[in] context The channel's transfer completion callback context.
+     */
+    void configure_channel(
+        Channel       channel,
+        std::uint32_t chctrlb,
+        Callback      callback,
+        void *        context ) noexcept;
+
+    /**
+     * \brief Start a channel's transfer (enable the channel).
+     *
+     * \pre channel has been allocated
+     * \pre channel's descriptor chain is valid
+     *
+     * \param[in] channel The channel.
+     */
+    void start( Channel channel ) noexcept;
+
+    /**
+     * \brief Abort a channel's transfer (disable the channel).
+     *
+     * \pre channel has been allocated
+     *
+     * \param[in] channel The channel.
+     */
+    void abort( Channel channel ) noexcept;
+
+    /**
+     * \brief Generate a software trigger for a channel.
+     *
+     * \pre channel has been allocated
+     *
+     * \param[in] channel The channel.
+     */
+    void trigger( Channel channel ) noexcept;
+
+    /**
+     * \brief Check if a channel is busy.
+     *
+     * \pre channel has been allocated
+     *
+     * \param[in] channel The channel.
+     *
+     * \return true if the channel is busy.
+     * \return false if the channel is not busy.
+     */
+    auto busy( Channel channel ) const noexcept -> bool;
+
+    /**
+     * \brief Get the number of beats remaining in a channel's current block transfer.
+     *
+     * The count is read from the DMAC peripheral's ACTIVE register if the channel is the
+     * active channel, and from the channel's write-back descriptor otherwise.
+     *
+     * \pre channel has been allocated
+     *
+     * \param[in] channel The channel.
+     *
+     * \return The number of beats remaining in the channel's current block transfer.
+     */
+    auto remaining( Channel channel ) const noexcept -> std::uint16_t;
+
+    /**
+     * \brief Check if a channel has a transfer complete interrupt that has not been
+     *        handled.
+     *
+     * \pre channel has been allocated
+     *
+     * \param[in] channel The channel.
+     *
+     * \return true if the channel has a transfer complete interrupt that has not been
+     *         handled.
+     * \return false if the channel does not have a transfer complete interrupt that has
+     *         not been handled.
+     */
+    auto transfer_complete_pending( Channel channel ) const noexcept -> bool;
+
+    /**
+     * \brief Handle a DMAC interrupt.
+     *
+     * Every channel with a pending transfer complete or transfer error interrupt has its
+     * interrupt flags cleared and its transfer completion callback called.
+     *
+     * \attention This function must only be called by the DMAC interrupt handler.
+     */
+    void handle_interrupt() noexcept;
+
+  private:
+    /**
+     * \brief The DMAC peripheral.
+     */
+    Peripheral::DMAC * m_dmac;
+
+    /**
+     * \brief The channel descriptors (DMAC BASEADDR SRAM).
+     */
+    alignas( 16 ) Descriptor m_descriptors[ CHANNELS ]{};
+
+    /**
+     * \brief The channel write-back descriptors (DMAC WRBADDR SRAM).
+     */
+    alignas( 16 ) Descriptor m_write_back[ CHANNELS ]{};
+
+    /**
+     * \brief The linked descriptor pool.
+     */
+    alignas( 16 ) Descriptor m_linked_descriptors[ LINKED_DESCRIPTORS ]{};
+
+    /**
+     * \brief The allocated channels (one bit per channel).
+     */
+    std::uint32_t m_allocated_channels{};
+
+    /**
+     * \brief The allocated linked descriptors (one bit per linked descriptor).
+     */
+    std::uint32_t m_allocated_descriptors{};
+
+    /**
+     * \brief The channel transfer completion callbacks.
+     */
+    Callback m_callback[ CHANNELS ]{};
+
+    /**
+     * \brief The channel transfer completion callback contexts.
+     */
+    void * m_context[ CHANNELS ]{};
+
+    /**
+     * \brief Check if a channel has been allocated.
+     *
+     * \param[in] channel The channel.
+     *
+     * \return true if channel has been allocated.
+     * \return false if channel has not been allocated.
+     */
+    auto allocated( Channel channel ) const noexcept -> bool
+    {
+        return channel < CHANNELS
+               and m_allocated_channels & ( std::uint32_t{ 1 } << channel );
+    }
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::DMA
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_DMA_H
@@ -0,0 +1,284 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Event interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_EVENT_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_EVENT_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/evsys.h"
+#include "picolibrary/precondition.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 event routing facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::Event {
+
+/**
+ * \brief The number of EVSYS channels.
+ */
+constexpr auto CHANNELS = std::uint_fast8_t{ 12 };
+
+/**
+ * \brief The number of EVSYS users.
+ */
+constexpr auto USERS = std::uint_fast8_t{ 0x1D };
+
+/**
+ * \brief Event routing graph.
+ *
+ * A routing graph is built (at compile time if it is constexpr) by adding routes from
+ * event generators to event users. Routes that share a generator, path, and edge
+ * detection share an EVSYS channel, and channels are allocated in ascending order, so
+ * the graph holds the minimal set of CHANNEL and USER register writes required to
+ * configure the EVSYS peripheral.
+ *
+ * Invalid routes (a user that has already been routed, an edge detection that does not
+ * match the path, or more than
+ * picolibrary::Microchip::SAM::D21DA1::Event::CHANNELS channels) trigger a fatal
+ * error, which is a compile error if the graph is constexpr.
+ */
+class Graph {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Graph() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Graph( Graph && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Graph( Graph const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Graph() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Graph && expression ) noexcept -> Graph & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Graph const & expression ) noexcept -> Graph & = default;
+
+    /**
+     * \brief Add a route.
+     *
+     * The asynchronous path passes the generator's signal through without edge detection
+     * (and does not require the channel's GCLK). The synchronous and resynchronized paths
+     * require edge detection (and the channel's GCLK).
+     *
+     * \pre generator is not EVGEN_NONE
+     * \pre user has not been routed
+     * \pre edge is EDGSEL_NO_EVT_OUTPUT if and only if path is PATH_ASYNCHRONOUS
+     * \pre a channel is available if the route cannot share a channel
+     *
+     * \param[in] generator The event generator.
+     * \param[in] user The event user.
+     * \param[in] path The path.
+     * \param[in] edge The edge detection.
+     *
+     * \return The graph with the route added.
+     */
+    constexpr auto route(
+        Peripheral::EVSYS::CHANNEL::EVGEN  generator,
+        Peripheral::EVSYS::USER::USER_ID   user,
+        Peripheral::EVSYS::CHANNEL::PATH   path,
+        Peripheral::EVSYS::CHANNEL::EDGSEL edge ) const noexcept -> Graph
+    {
+        using EVSYS = Peripheral::EVSYS;
+
+        PICOLIBRARY_EXPECT(
+            generator != EVSYS::CHANNEL::EVGEN_NONE, Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT(
+            ( path == EVSYS::CHANNEL::PATH_ASYNCHRONOUS )
+                == ( edge == EVSYS::CHANNEL::EDGSEL_NO_EVT_OUTPUT ),
+            Generic_Error::INVALID_ARGUMENT );
+
+        for ( auto i = std::uint_fast8_t{}; i < m_users; ++i ) {
+            PICOLIBRARY_EXPECT(
+                ( m_user[ i ] & EVSYS::USER::Mask::USER ) != user,
+                Generic_Error::INVALID_ARGUMENT );
+        } // for
+
+        auto graph = *this;
+
+        auto const configuration = static_cast<std::uint32_t>( generator | path | edge );
+
+        auto channel = std::uint_fast8_t{};
+        for ( ; channel < graph.m_channels
+                and ( graph.m_channel[ channel ] & ~EVSYS::CHANNEL::Mask::CHANNEL )
+                        != configuration;
+              ++channel ) {} // for
+
+        if ( channel == graph.m_channels ) {
+            PICOLIBRARY_EXPECT(
+                channel < CHANNELS, Generic_Error::INSUFFICIENT_CAPACITY );
+
+            graph.m_channel[ channel ] = configuration
+                                         | ( channel << EVSYS::CHANNEL::Bit::CHANNEL );
+
+            ++graph.m_channels;
+        } // if
+
+        // the USER register's CHANNEL field selects channel n with the value n + 1
+        graph.m_user[ graph.m_users ] = static_cast<std::uint16_t>(
+            user | ( ( channel + 1 ) << EVSYS::USER::Bit::CHANNEL ) );
+
+        ++graph.m_users;
+
+        return graph;
+    }
+
+    /**
+     * \brief Add an asynchronous route.
+     *
+     * \pre generator is not EVGEN_NONE
+     * \pre user has not been routed
+     * \pre a channel is available if the route cannot share a channel
+     *
+     * \param[in] generator The event generator.
+     * \param[in] user The event user.
+     *
+     * \return The graph with the route added.
+     */
+    constexpr auto route(
+        Peripheral::EVSYS::CHANNEL::EVGEN generator,
+        Peripheral::EVSYS::USER::USER_ID  user ) const noexcept -> Graph
+    {
+        using EVSYS = Peripheral::EVSYS;
+
+        return route(
+            generator,
+            user,
+            EVSYS::CHANNEL::PATH_ASYNCHRONOUS,
+            EVSYS::CHANNEL::EDGSEL_NO_EVT_OUTPUT );
+    }
+
+    /**
+     * \brief Get the number of channels the graph uses (channels 0 through channels() -
+     *        1 are used).
+     *
+     * \return The number of channels the graph uses.
+     */
+    constexpr auto channels() const noexcept -> std::uint_fast8_t
+    {
+        return m_channels;
+    }
+
+    /**
+     * \brief Get the number of users the graph routes.
+     *
+     * \return The number of users the graph routes.
+     */
+    constexpr auto users() const noexcept -> std::uint_fast8_t
+    {
+        return m_users;
+    }
+
+    /**
+     * \brief Get the channel a user has been routed to.
+     *
+     * \pre user has been routed
+     *
+     * \param[in] user The event user.
+     *
+     * \return The channel the user has been routed to.
+     */
+    constexpr auto channel( Peripheral::EVSYS::USER::USER_ID user ) const noexcept
+        -> std::uint_fast8_t
+    {
+        using EVSYS = Peripheral::EVSYS;
+
+        auto i = std::uint_fast8_t{};
+        for ( ; i < m_users and ( m_user[ i ] & EVSYS::USER::Mask::USER ) != user; ++i ) {
+        } // for
+
+        PICOLIBRARY_EXPECT( i < m_users, Generic_Error::INVALID_ARGUMENT );
+
+        auto const channel = ( m_user[ i ] & EVSYS::USER::Mask::CHANNEL )
+                             >> EVSYS::USER::Bit::CHANNEL;
+
+        return channel - 1;
+    }
+
+    /**
+     * \brief Configure an EVSYS peripheral.
+     *
+     * Users are configured before channels, so that no event is generated before its
+     * users are connected.
+     *
+     * \pre the EVSYS peripheral's APB clock has been enabled
+     * \pre the GCLKs of the channels that use the synchronous or resynchronized paths
+     *      have been enabled
+     *
+     * \param[in] evsys The EVSYS peripheral to configure.
+     */
+    void configure( Peripheral::EVSYS & evsys ) const noexcept;
+
+  private:
+    /**
+     * \brief The CHANNEL register values.
+     */
+    std::uint32_t m_channel[ CHANNELS ]{};
+
+    /**
+     * \brief The number of channels the graph uses.
+     */
+    std::uint_fast8_t m_channels{};
+
+    /**
+     * \brief The USER register values.
+     */
+    std::uint16_t m_user[ USERS ]{};
+
+    /**
+     * \brief The number of users the graph routes.
+     */
+    std::uint_fast8_t m_users{};
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Event
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_EVENT_H
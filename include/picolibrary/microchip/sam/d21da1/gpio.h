@@ -0,0 +1,315 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::GPIO interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_GPIO_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_GPIO_H
+
+#include <cstdint>
+
+#include "picolibrary/gpio.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 GPIO facilities.
+ *
+ * Pin groups and pins are identified at compile time, and data direction, data output
+ * value, and data input value accesses are made using the IOBUS by default, so each
+ * access is a single store (or load) to a constant address that the CPU completes in a
+ * single cycle. All other PORT peripheral registers (PINCFG and CTRL) are only
+ * accessible using the APB, so configuration always uses
+ * picolibrary::Microchip::SAM::D21DA1::Peripheral::PORT0.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::GPIO {
+
+/**
+ * \brief Pin group (port).
+ *
+ * \tparam GROUP The pin group (0: PA, 1: PB).
+ * \tparam Port The PORT peripheral instance to use for data direction, data output
+ *         value, and data input value accesses
+ *         (picolibrary::Microchip::SAM::D21DA1::Peripheral::PORT0_IOBUS or
+ *         picolibrary::Microchip::SAM::D21DA1::Peripheral::PORT0).
+ */
+template<std::uint_fast8_t GROUP, typename Port = Peripheral::PORT0_IOBUS>
+class Pin_Group {
+  public:
+    static_assert( GROUP < 2 );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Pin_Group() noexcept = default;
+
+    /**
+     * \brief Configure pins as outputs.
+     *
+     * \param[in] mask The mask identifying the pins to configure.
+     */
+    void configure_as_outputs( std::uint32_t mask ) noexcept
+    {
+        group().dirset = mask;
+    }
+
+    /**
+     * \brief Configure pins as inputs (without enabling their input buffers).
+     *
+     * \param[in] mask The mask identifying the pins to configure.
+     */
+    void configure_as_inputs( std::uint32_t mask ) noexcept
+    {
+        group().dirclr = mask;
+    }
+
+    /**
+     * \brief Transition pins to the high state.
+     *
+     * \param[in] mask The mask identifying the pins to transition.
+     */
+    void set( std::uint32_t mask ) noexcept
+    {
+        group().outset = mask;
+    }
+
+    /**
+     * \brief Transition pins to the low state.
+     *
+     * \param[in] mask The mask identifying the pins to transition.
+     */
+    void clear( std::uint32_t mask ) noexcept
+    {
+        group().outclr = mask;
+    }
+
+    /**
+     * \brief Toggle the state of pins.
+     *
+     * \param[in] mask The mask identifying the pins to toggle.
+     */
+    void toggle( std::uint32_t mask ) noexcept
+    {
+        group().outtgl = mask;
+    }
+
+    /**
+     * \brief Write the data output value of every pin in the group.
+     *
+     * \param[in] value The data output value to write.
+     */
+    void write( std::uint32_t value ) noexcept
+    {
+        group().out = value;
+    }
+
+    /**
+     * \brief Read the data input value of every pin in the group.
+     *
+     * \attention If the IOBUS is used, the input buffers and continuous sampling (see
+     *            picolibrary::Microchip::SAM::D21DA1::GPIO::Input_Pin::initialize())
+     *            must be enabled for the pins of interest.
+     *
+     * \return The data input value of every pin in the group.
+     */
+    auto read() const noexcept -> std::uint32_t
+    {
+        return group().in;
+    }
+
+  private:
+    /**
+     * \brief Get the pin group's registers.
+     *
+     * \return The pin group's registers.
+     */
+    static auto group() noexcept -> Peripheral::PORT::GROUP &
+    {
+        return Port::instance().group[ GROUP ];
+    }
+};
+
+/**
+ * \brief Input pin.
+ *
+ * \tparam GROUP The pin group (0: PA, 1: PB).
+ * \tparam PIN The pin's number within the pin group.
+ * \tparam Port The PORT peripheral instance to use for data input value accesses.
+ */
+template<std::uint_fast8_t GROUP,
+         std::uint_fast8_t PIN,
+         typename Port = Peripheral::PORT0_IOBUS>
+class Input_Pin {
+  public:
+    static_assert( GROUP < 2 );
+    static_assert( PIN < 32 );
+
+    /**
+     * \brief The pin's mask.
+     */
+    static constexpr auto MASK = std::uint32_t{ 1 } << PIN;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Input_Pin() noexcept = default;
+
+    /**
+     * \brief Initialize the pin's hardware.
+     *
+     * The pin is configured as an input, its input buffer is enabled, and continuous
+     * sampling is enabled (IOBUS reads return the most recent sample instead of waiting
+     * for an on demand sample).
+     */
+    void initialize() noexcept
+    {
+        auto & group = Peripheral::PORT0::instance().group[ GROUP ];
+
+        group.dirclr        = MASK;
+        group.pincfg[ PIN ] = Peripheral::PORT::GROUP::PINCFG::Mask::INEN;
+        group.ctrl |= MASK;
+    }
+
+    /**
+     * \brief Enable the pin's internal pull-up resistor.
+     */
+    void enable_pull_up() noexcept
+    {
+        auto & group = Peripheral::PORT0::instance().group[ GROUP ];
+
+        // the data output value selects the pull direction
+        group.outset = MASK;
+        group.pincfg[ PIN ] |= Peripheral::PORT::GROUP::PINCFG::Mask::PULLEN;
+    }
+
+    /**
+     * \brief Disable the pin's internal pull-up resistor.
+     */
+    void disable_pull_up() noexcept
+    {
+        auto & group = Peripheral::PORT0::instance().group[ GROUP ];
+
+        group.pincfg[ PIN ] &= ~Peripheral::PORT::GROUP::PINCFG::Mask::PULLEN;
+    }
+
+    /**
+     * \brief Check if the pin is in the low state.
+     *
+     * \return true if the pin is in the low state.
+     * \return false if the pin is not in the low state.
+     */
+    auto is_low() const noexcept -> bool
+    {
+        return not is_high();
+    }
+
+    /**
+     * \brief Check if the pin is in the high state.
+     *
+     * \return true if the pin is in the high state.
+     * \return false if the pin is not in the high state.
+     */
+    auto is_high() const noexcept -> bool
+    {
+        return Port::instance().group[ GROUP ].in & MASK;
+    }
+};
+
+/**
+ * \brief Output pin.
+ *
+ * \tparam GROUP The pin group (0: PA, 1: PB).
+ * \tparam PIN The pin's number within the pin group.
+ * \tparam Port The PORT peripheral instance to use for data direction and data output
+ *         value accesses.
+ */
+template<std::uint_fast8_t GROUP,
+         std::uint_fast8_t PIN,
+         typename Port = Peripheral::PORT0_IOBUS>
+class Output_Pin {
+  public:
+    static_assert( GROUP < 2 );
+    static_assert( PIN < 32 );
+
+    /**
+     * \brief The pin's mask.
+     */
+    static constexpr auto MASK = std::uint32_t{ 1 } << PIN;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Pin() noexcept = default;
+
+    /**
+     * \brief Initialize the pin's hardware.
+     *
+     * \param[in] initial_pin_state The initial state of the pin.
+     */
+    void initialize( ::picolibrary::GPIO::Initial_Pin_State initial_pin_state =
+                         ::picolibrary::GPIO::Initial_Pin_State::LOW ) noexcept
+    {
+        if ( initial_pin_state == ::picolibrary::GPIO::Initial_Pin_State::HIGH ) {
+            transition_to_high();
+        } else {
+            transition_to_low();
+        } // else
+
+        group().dirset = MASK;
+    }
+
+    /**
+     * \brief Transition the pin to the high state.
+     */
+    void transition_to_high() noexcept
+    {
+        group().outset = MASK;
+    }
+
+    /**
+     * \brief Transition the pin to the low state.
+     */
+    void transition_to_low() noexcept
+    {
+        group().outclr = MASK;
+    }
+
+    /**
+     * \brief Toggle the pin state.
+     */
+    void toggle() noexcept
+    {
+        group().outtgl = MASK;
+    }
+
+  private:
+    /**
+     * \brief Get the pin's group's registers.
+     *
+     * \return The pin's group's registers.
+     */
+    static auto group() noexcept -> Peripheral::PORT::GROUP &
+    {
+        return Port::instance().group[ GROUP ];
+    }
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::GPIO
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_GPIO_H
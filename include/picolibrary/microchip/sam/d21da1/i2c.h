@@ -0,0 +1,456 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::I2C interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_I2C_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_I2C_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/peripheral/sercom.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 I2C facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::I2C {
+
+/**
+ * \brief Compute the BAUD register value for an I2C SCL frequency.
+ *
+ * f_SCL = f_GCLK / ( 10 + 2 * BAUD + f_GCLK * T_RISE ), with BAUDLOW = 0 (symmetric SCL
+ * high and low times). The resulting SCL frequency is the highest SCL frequency that does
+ * not exceed the desired SCL frequency.
+ *
+ * \pre scl_frequency > 0
+ * \pre scl_frequency <= 1000000 (High-speed mode is not supported)
+ * \pre the resulting BAUD register value is between 0 and 255
+ *
+ * \param[in] gclk_frequency The frequency of the SERCOM peripheral's core GCLK, in Hz.
+ * \param[in] scl_frequency The desired SCL frequency, in Hz.
+ * \param[in] rise_time The SCL rise time, in ns.
+ *
+ * \return The BAUD register value.
+ */
+auto baud(
+    std::uint32_t gclk_frequency,
+    std::uint32_t scl_frequency,
+    std::uint32_t rise_time ) noexcept -> std::uint32_t;
+
+/**
+ * \brief Transaction result.
+ */
+enum class Result : std::uint_fast8_t {
+    COMPLETE,         ///< The transaction completed successfully.
+    NACK,             ///< The device did not acknowledge its address or a data byte.
+    ARBITRATION_LOST, ///< Arbitration was lost (after the configured number of retries).
+    BUS_ERROR,        ///< A bus error or SCL low time-out occurred.
+};
+
+/**
+ * \brief Transaction completion callback.
+ */
+using Callback = void ( * )( void * context, Result result );
+
+/**
+ * \brief Transaction (an optional write followed by an optional repeated start read).
+ */
+struct Transaction {
+    /**
+     * \brief The device's 7-bit address.
+     */
+    std::uint8_t address;
+
+    /**
+     * \brief The data to write.
+     */
+    std::uint8_t const * write_data;
+
+    /**
+     * \brief The number of bytes to write.
+     */
+    std::uint8_t write_size;
+
+    /**
+     * \brief The location to write read data to.
+     */
+    std::uint8_t * read_data;
+
+    /**
+     * \brief The number of bytes to read.
+     */
+    std::uint8_t read_size;
+
+    /**
+     * \brief The transaction completion callback (nullptr if the transaction does not
+     *        have a completion callback).
+     */
+    Callback callback;
+
+    /**
+     * \brief The transaction completion callback context.
+     */
+    void * context;
+};
+
+/**
+ * \brief Interrupt driven asynchronous I2C master.
+ *
+ * Transactions are queued and executed by a state machine that runs in the SERCOM
+ * peripheral's interrupt handler: the handler loads the next byte to write, reads the
+ * next byte received, issues the repeated start between the write and read phases of a
+ * transaction, issues the stop condition, calls the completion callback, and starts the
+ * next queued transaction.
+ *
+ * Smart Mode is used, so reading the DATA register acknowledges a received byte and
+ * starts the reception of the next byte without a separate command. The last byte of a
+ * read is not acknowledged, and is followed by a stop condition.
+ *
+ * Lost arbitration is retried (up to
+ * picolibrary::Microchip::SAM::D21DA1::I2C::Master::ARBITRATION_RETRIES times) when the
+ * bus becomes idle. Bus errors and SCL low time-outs abort the transaction and force the
+ * bus state to idle so that the next transaction can be started.
+ *
+ * \attention The driver, transaction write data, and transaction read data locations
+ *            must remain valid until a transaction completes.
+ * \attention Transactions must be submitted from a single execution context.
+ */
+class Master {
+  public:
+    /**
+     * \brief The transaction queue capacity (must be a power of two).
+     */
+    static constexpr auto QUEUE_CAPACITY = std::uint_fast8_t{ 4 };
+
+    static_assert( QUEUE_CAPACITY and not( QUEUE_CAPACITY & ( QUEUE_CAPACITY - 1 ) ) );
+
+    /**
+     * \brief The number of times a transaction is retried if arbitration is lost.
+     */
+    static constexpr auto ARBITRATION_RETRIES = std::uint_fast8_t{ 3 };
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] sercom The SERCOM peripheral to use.
+     */
+    constexpr Master( Peripheral::SERCOM & sercom ) noexcept : m_sercom{ &sercom }
+    {
+    }
+
+    Master( Master && ) = delete;
+
+    Master( Master const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Master() noexcept = default;
+
+    auto operator=( Master && ) = delete;
+
+    auto operator=( Master const & ) = delete;
+
+    /**
+     * \brief Configure and enable the I2C master.
+     *
+     * Fast-mode Plus is selected if the desired SCL frequency is greater than 400 kHz.
+     *
+     * \pre the SERCOM peripheral's APB clock, core GCLK, and slow GCLK have been enabled
+     *      (the slow GCLK clocks the SCL low time-out)
+     *
+     * \param[in] gclk_frequency The frequency of the SERCOM peripheral's core GCLK, in
+     *            Hz.
+     * \param[in] scl_frequency The desired SCL frequency, in Hz.
+     * \param[in] rise_time The SCL rise time, in ns.
+     */
+    void enable(
+        std::uint32_t gclk_frequency,
+        std::uint32_t scl_frequency,
+        std::uint32_t rise_time ) noexcept;
+
+    /**
+     * \brief Submit a transaction.
+     *
+     * \param[in] transaction The transaction to submit.
+     *
+     * \return true if the transaction was queued.
+     * \return false if the transaction queue is full.
+     */
+    auto submit( Transaction const & transaction ) noexcept -> bool;
+
+    /**
+     * \brief Check if a transaction is in progress.
+     *
+     * \return true if a transaction is in progress.
+     * \return false if a transaction is not in progress.
+     */
+    auto busy() const noexcept -> bool
+    {
+        return m_busy;
+    }
+
+    /**
+     * \brief Handle a SERCOM peripheral interrupt.
+     *
+     * \attention This function must only be called by the SERCOM peripheral's interrupt
+     *            handler.
+     */
+    void handle_interrupt() noexcept;
+
+  private:
+    /**
+     * \brief The SERCOM peripheral.
+     */
+    Peripheral::SERCOM * m_sercom;
+
+    /**
+     * \brief The transaction queue.
+     */
+    Transaction m_queue[ QUEUE_CAPACITY ]{};
+
+    /**
+     * \brief The free-running index of the in progress transaction (written by the
+     *        interrupt handler only).
+     */
+    std::uint8_t volatile m_head{};
+
+    /**
+     * \brief The free-running index of the next transaction to queue (written by the
+     *        submitter only).
+     */
+    std::uint8_t volatile m_tail{};
+
+    /**
+     * \brief A transaction is in progress.
+     */
+    bool volatile m_busy{};
+
+    /**
+     * \brief The number of bytes of the in progress transaction's write or read that
+     *        have been transferred.
+     */
+    std::uint8_t m_transferred{};
+
+    /**
+     * \brief The number of times the in progress transaction has been retried.
+     */
+    std::uint_fast8_t m_retries{};
+
+    /**
+     * \brief Start the in progress transaction (or restart it after arbitration was
+     *        lost).
+     */
+    void start() noexcept;
+
+    /**
+     * \brief Issue a command.
+     *
+     * \param[in] ctrlb The CTRLB register value (Smart Mode is always enabled).
+     */
+    void command( std::uint32_t ctrlb ) noexcept;
+
+    /**
+     * \brief Complete the in progress transaction and start the next queued transaction.
+     *
+     * \param[in] result The transaction result.
+     */
+    void complete( Result result ) noexcept;
+};
+
+/**
+ * \brief Register file write callback.
+ */
+using Write_Callback =
+    void ( * )( void * context, std::uint8_t offset, std::uint16_t size );
+
+/**
+ * \brief Interrupt driven I2C client (slave) that emulates a register file.
+ *
+ * The host addresses the register file the way it would address the registers of a
+ * typical I2C device: the first byte of a write sets the register pointer, and the
+ * following bytes are written to consecutive registers. A read returns the contents of
+ * consecutive registers, starting at the register pointer (a write of just the register
+ * pointer followed by a repeated start read is the usual register read). The register
+ * pointer auto-increments, and is retained between transactions.
+ *
+ * Every byte is served directly from/to the RAM image of the register file in the
+ * SERCOM peripheral's interrupt handler. Smart Mode is used, so each data ready
+ * interrupt is serviced with a single DATA register access (the acknowledge action is
+ * executed automatically), which minimizes the time that the clock is stretched.
+ *
+ * Writes past the end of the register file are not acknowledged, and reads past the end
+ * of the register file return 0xFF.
+ *
+ * The registers that were written by the host during a transaction are reported to the
+ * application in a single write callback call (the lowest written offset and the size
+ * of the written range) when the transaction's stop condition is detected, instead of
+ * after every byte.
+ *
+ * \attention The driver and the register file must remain valid while the I2C client is
+ *            enabled.
+ * \attention The write callback is called from the SERCOM peripheral's interrupt
+ *            handler (see picolibrary::Microchip::SAM::D21DA1::Deferred_Work for
+ *            deferring the processing of written registers).
+ * \attention Multi-byte registers should be updated by the application in a critical
+ *            section (see
+ *            picolibrary::Microchip::SAM::D21DA1::Interrupt::Critical_Section) so that
+ *            the host cannot read them while they are partially updated.
+ */
+class Client {
+  public:
+    /**
+     * \brief The maximum register file size.
+     */
+    static constexpr auto REGISTER_FILE_SIZE_MAX = std::uint16_t{ 256 };
+
+    /**
+     * \brief Constructor.
+     *
+     * \pre size > 0
+     * \pre size <=
+     *      picolibrary::Microchip::SAM::D21DA1::I2C::Client::REGISTER_FILE_SIZE_MAX
+     *
+     * \param[in] sercom The SERCOM peripheral to use.
+     * \param[in] registers The register file.
+     * \param[in] size The register file size.
+     * \param[in] write_callback The write callback (nullptr if the application does not
+     *            need to be notified when registers are written).
+     * \param[in] context The write callback context.
+     */
+    Client(
+        Peripheral::SERCOM & sercom,
+        std::uint8_t *       registers,
+        std::uint16_t        size,
+        Write_Callback       write_callback,
+        void *               context ) noexcept;
+
+    Client( Client && ) = delete;
+
+    Client( Client const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Client() noexcept = default;
+
+    auto operator=( Client && ) = delete;
+
+    auto operator=( Client const & ) = delete;
+
+    /**
+     * \brief Configure and enable the I2C client.
+     *
+     * \pre the SERCOM peripheral's APB clock, core GCLK, and slow GCLK have been enabled
+     *      (the slow GCLK clocks the SCL low time-out)
+     *
+     * \param[in] address The I2C client's 7-bit address.
+     * \param[in] speed The bus speed.
+     */
+    void enable(
+        std::uint8_t                           address,
+        Peripheral::SERCOM::I2CS::CTRLA::SPEED speed ) noexcept;
+
+    /**
+     * \brief Get the register pointer.
+     *
+     * \return The register pointer.
+     */
+    auto pointer() const noexcept -> std::uint16_t
+    {
+        return m_pointer;
+    }
+
+    /**
+     * \brief Handle a SERCOM peripheral interrupt.
+     *
+     * \attention This function must only be called by the SERCOM peripheral's interrupt
+     *            handler.
+     */
+    void handle_interrupt() noexcept;
+
+  private:
+    /**
+     * \brief The SERCOM peripheral.
+     */
+    Peripheral::SERCOM * m_sercom;
+
+    /**
+     * \brief The register file.
+     */
+    std::uint8_t * m_registers;
+
+    /**
+     * \brief The register file size.
+     */
+    std::uint16_t m_size;
+
+    /**
+     * \brief The write callback.
+     */
+    Write_Callback m_write_callback;
+
+    /**
+     * \brief The write callback context.
+     */
+    void * m_context;
+
+    /**
+     * \brief The register pointer.
+     */
+    std::uint16_t volatile m_pointer{};
+
+    /**
+     * \brief The next byte written by the host is the register pointer.
+     */
+    bool m_pointer_pending{};
+
+    /**
+     * \brief A byte has been transmitted to the host during the in progress read.
+     */
+    bool m_transmitted{};
+
+    /**
+     * \brief The lowest offset written by the host since the last write callback call.
+     */
+    std::uint16_t m_written_first{};
+
+    /**
+     * \brief One past the highest offset written by the host since the last write
+     *        callback call (0 if no registers have been written).
+     */
+    std::uint16_t m_written_end{};
+
+    /**
+     * \brief Issue a command.
+     *
+     * \param[in] ctrlb The CTRLB register value (Smart Mode is always enabled).
+     */
+    void command( std::uint32_t ctrlb ) noexcept;
+
+    /**
+     * \brief Report the registers written by the host to the application.
+     */
+    void notify() noexcept;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::I2C
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_I2C_H
@@ -23,10 +23,144 @@
 #ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_H
 #define PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_H
 
+#include <cstdint>
+
 /**
  * \brief Microchip SAM D21/DA1 interrupt facilities.
  */
 namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
+
+/**
+ * \brief Interrupt request (IRQ) number (matches the order of the peripheral interrupt
+ *        vectors in picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table).
+ */
+enum class IRQ : std::uint_fast8_t {
+    PM0      = 0,  ///< PM.
+    SYSCTRL0 = 1,  ///< SYSCTRL.
+    WDT0     = 2,  ///< WDT.
+    RTC0     = 3,  ///< RTC.
+    EIC0     = 4,  ///< EIC.
+    NVMCTRL0 = 5,  ///< NVMCTRL.
+    DMAC0    = 6,  ///< DMAC.
+    USB0     = 7,  ///< USB.
+    EVSYS0   = 8,  ///< EVSYS.
+    SERCOM0  = 9,  ///< SERCOM0.
+    SERCOM1  = 10, ///< SERCOM1.
+    SERCOM2  = 11, ///< SERCOM2.
+    SERCOM3  = 12, ///< SERCOM3.
+    SERCOM4  = 13, ///< SERCOM4.
+    SERCOM5  = 14, ///< SERCOM5.
+    TCC0     = 15, ///< TCC0.
+    TCC1     = 16, ///< TCC1.
+    TCC2     = 17, ///< TCC2.
+    TC3      = 18, ///< TC3.
+    TC4      = 19, ///< TC4.
+    TC5      = 20, ///< TC5.
+    TC6      = 21, ///< TC6.
+    TC7      = 22, ///< TC7.
+    ADC0     = 23, ///< ADC.
+    AC0      = 24, ///< AC.
+    DAC0     = 25, ///< DAC.
+    PTC0     = 26, ///< PTC.
+    I2S0     = 27, ///< I2S.
+    AC1      = 28, ///< AC1.
+    TCC3     = 29, ///< TCC3.
+};
+
+/**
+ * \brief The number of IRQs.
+ */
+constexpr auto IRQS = std::uint_fast8_t{ 30 };
+
+/**
+ * \brief Exception stack frame (the registers that are stacked by the processor on
+ *        exception entry).
+ */
+struct Exception_Frame {
+    std::uint32_t r0;   ///< R0.
+    std::uint32_t r1;   ///< R1.
+    std::uint32_t r2;   ///< R2.
+    std::uint32_t r3;   ///< R3.
+    std::uint32_t r12;  ///< R12.
+    std::uint32_t lr;   ///< LR.
+    std::uint32_t pc;   ///< PC.
+    std::uint32_t xpsr; ///< xPSR.
+};
+
+/**
+ * \brief Get the exception stack frame that was captured by the hard fault handler before
+ *        the most recent reset.
+ *
+ * \return The exception stack frame that was captured by the hard fault handler before
+ *         the most recent reset if a hard fault record is present.
+ * \return nullptr if a hard fault record is not present.
+ */
+auto hard_fault_record() noexcept -> Exception_Frame const *;
+
+/**
+ * \brief Clear the hard fault record.
+ */
+void clear_hard_fault_record() noexcept;
+
+/**
+ * \brief Critical section (interrupts are disabled for the lifetime of the critical
+ *        section, and the interrupt enable state is restored when the critical section
+ *        ends).
+ */
+class Critical_Section {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Critical_Section() noexcept
+    {
+        asm volatile(
+            "mrs %[primask], primask\n"
+            "cpsid i\n"
+            : [primask] "=r"( m_primask )
+            :
+            : "memory" );
+    }
+
+    Critical_Section( Critical_Section && ) = delete;
+
+    Critical_Section( Critical_Section const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Critical_Section() noexcept
+    {
+        asm volatile(
+            "msr primask, %[primask]\n"
+            :
+            : [primask] "r"( m_primask )
+            : "memory" );
+    }
+
+    auto operator=( Critical_Section && ) = delete;
+
+    auto operator=( Critical_Section const & ) = delete;
+
+  private:
+    /**
+     * \brief The saved PRIMASK register value.
+     */
+    std::uint32_t m_primask;
+};
+
 } // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
 
+/**
+ * \brief Record a hard fault and reset the system.
+ *
+ * \attention This function is called by the hard fault handler and should not be called
+ *            directly.
+ *
+ * \param[in] frame The exception stack frame of the faulting context.
+ */
+extern "C" [[noreturn]] void picolibrary_microchip_sam_d21da1_interrupt_record_hard_fault(
+    ::picolibrary::Microchip::SAM::D21DA1::Interrupt::Exception_Frame const *
+        frame ) noexcept;
+
 #endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_H
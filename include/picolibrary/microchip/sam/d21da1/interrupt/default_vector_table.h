@@ -29,6 +29,13 @@
 #ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_DEFAULT_VECTOR_TABLE_H
 #define PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_DEFAULT_VECTOR_TABLE_H
 
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt/vector_table.h"
+
+extern std::uint32_t _stack_end;
+
 namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
 
 /**
@@ -401,6 +408,82 @@ void handle_ac1() noexcept;
  */
 void handle_tcc3() noexcept;
 
+/**
+ * \brief Get the default vector table.
+ *
+ * \return The default vector table.
+ */
+constexpr auto default_vector_table() noexcept
+    -> ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table
+{
+    return ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table{
+        .stack = &_stack_end,
+
+        .reset_handler = handle_reset,
+
+        .nmi_handler        = handle_nmi,
+        .hard_fault_handler = handle_hard_fault,
+        .reserved_n12       = nullptr,
+        .reserved_n11       = nullptr,
+        .reserved_n10       = nullptr,
+        .reserved_n9        = nullptr,
+        .reserved_n8        = nullptr,
+        .reserved_n7        = nullptr,
+        .reserved_n6        = nullptr,
+        .svcall_handler     = handle_svcall,
+        .reserved_n4        = nullptr,
+        .reserved_n3        = nullptr,
+        .pendsv_handler     = handle_pendsv,
+        .systick0_handler   = handle_systick0,
+
+        .pm0_handler      = handle_pm0,
+        .sysctrl0_handler = handle_sysctrl0,
+        .wdt0_handler     = handle_wdt0,
+        .rtc0_handler     = handle_rtc0,
+        .eic0_handler     = handle_eic0,
+        .nvmctrl0_handler = handle_nvmctrl0,
+        .dmac0_handler    = handle_dmac0,
+        .usb0_handler     = handle_usb0,
+        .evsys0_handler   = handle_evsys0,
+        .sercom0_handler  = handle_sercom0,
+        .sercom1_handler  = handle_sercom1,
+        .sercom2_handler  = handle_sercom2,
+        .sercom3_handler  = handle_sercom3,
+        .sercom4_handler  = handle_sercom4,
+        .sercom5_handler  = handle_sercom5,
+        .tcc0_handler     = handle_tcc0,
+        .tcc1_handler     = handle_tcc1,
+        .tcc2_handler     = handle_tcc2,
+        .tc3_handler      = handle_tc3,
+        .tc4_handler      = handle_tc4,
+        .tc5_handler      = handle_tc5,
+        .tc6_handler      = handle_tc6,
+        .tc7_handler      = handle_tc7,
+        .adc0_handler     = handle_adc0,
+        .ac0_handler      = handle_ac0,
+        .dac0_handler     = handle_dac0,
+        .ptc0_handler     = handle_ptc0,
+        .i2s0_handler     = handle_i2s0,
+        .ac1_handler      = handle_ac1,
+        .tcc3_handler     = handle_tcc3,
+    };
+}
+
+/**
+ * \brief Install an interrupt handler in the SRAM vector table.
+ *
+ * The handler is installed using a single word store, so it takes effect for the next
+ * exception entry.
+ *
+ * \attention This function is only defined if the default vector table is relocated to
+ *            SRAM (PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_RAM_VECTOR_TABLE is ON).
+ *
+ * \param[in] entry The vector table entry to install the handler in (e.g.
+ *            &Vector_Table::sercom0_handler).
+ * \param[in] handler The handler to install.
+ */
+void install_handler( Vector entry, Handler handler ) noexcept;
+
 } // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
 
 #endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_DEFAULT_VECTOR_TABLE_H
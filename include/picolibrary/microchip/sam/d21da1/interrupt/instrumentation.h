@@ -0,0 +1,149 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Interrupt instrumentation interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_INSTRUMENTATION_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_INSTRUMENTATION_H
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt/vector_table.h"
+#include "picolibrary/stream.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
+
+/**
+ * \brief Instrumented vector.
+ *
+ * Instrumented vectors are numbered by exception number minus 14 (PendSV is 0, SysTick is
+ * 1, and IRQ n is n + 2).
+ */
+using Instrumented_Vector = std::uint_fast8_t;
+
+/**
+ * \brief The number of instrumented vectors.
+ */
+constexpr auto INSTRUMENTED_VECTORS = Instrumented_Vector{ 32 };
+
+/**
+ * \brief Interrupt handler statistics.
+ */
+struct Handler_Statistics {
+    /**
+     * \brief The number of times the handler has been executed.
+     */
+    std::uint32_t count;
+
+    /**
+     * \brief The total number of SysTick cycles spent in the handler (64-bit, so that it
+     *        does not wrap when instrumentation is left enabled in production).
+     */
+    std::uint64_t cycles;
+
+    /**
+     * \brief The maximum number of SysTick cycles spent in a single execution of the
+     *        handler.
+     */
+    std::uint32_t max_cycles;
+};
+
+/**
+ * \brief Start interrupt instrumentation.
+ *
+ * If SysTick is not already enabled, it is configured to count processor clock cycles
+ * with the maximum reload value. If SysTick is already enabled (e.g. to generate a
+ * periodic tick), its configuration is left unchanged and handler durations are measured
+ * modulo its period.
+ *
+ * \param[in] systick The SysTick peripheral to use to measure handler durations.
+ */
+void start_instrumentation(
+    ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SYSTICK & systick ) noexcept;
+
+/**
+ * \brief Record the execution of an instrumented handler.
+ *
+ * \attention This function is called by instrumented handlers and should not be called
+ *            directly.
+ *
+ * \param[in] vector The instrumented vector.
+ * \param[in] start The SysTick current value at handler entry.
+ */
+void record_handler_execution( Instrumented_Vector vector, std::uint32_t start ) noexcept;
+
+/**
+ * \brief Get an instrumented vector's handler statistics.
+ *
+ * \pre vector < picolibrary::Microchip::SAM::D21DA1::Interrupt::INSTRUMENTED_VECTORS
+ *
+ * \param[in] vector The instrumented vector.
+ *
+ * \return The instrumented vector's handler statistics.
+ */
+auto handler_statistics( Instrumented_Vector vector ) noexcept -> Handler_Statistics;
+
+/**
+ * \brief Reset all instrumented vectors' handler statistics.
+ */
+void reset_handler_statistics() noexcept;
+
+/**
+ * \brief Write the handler statistics of every instrumented vector whose handler has been
+ *        executed to a stream.
+ *
+ * Each line has the following format: "<vector name> <count> <cycles> <max cycles>".
+ *
+ * \param[in] stream The stream to write the handler statistics to.
+ */
+void dump_handler_statistics( Reliable_Output_Stream & stream ) noexcept;
+
+/**
+ * \brief Instrumented handler.
+ *
+ * \attention Naked handlers (e.g. the WDT early warning handler) must not be
+ *            instrumented: a naked handler inspects the exception frame and EXC_RETURN
+ *            value of the interrupted context, which the wrapper's call frame hides.
+ *
+ * \tparam HANDLER The handler to instrument.
+ * \tparam VECTOR The instrumented vector.
+ */
+template<Handler HANDLER, Instrumented_Vector VECTOR>
+struct Instrumented_Handler {
+    static_assert( VECTOR < INSTRUMENTED_VECTORS );
+
+    /**
+     * \brief Handle the interrupt.
+     */
+    static void handle() noexcept
+    {
+        std::uint32_t const start =
+            ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SYSTICK0::instance().cvr;
+
+        HANDLER();
+
+        record_handler_execution( VECTOR, start );
+    }
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_INSTRUMENTATION_H
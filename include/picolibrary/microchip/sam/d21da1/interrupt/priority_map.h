@@ -0,0 +1,228 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Interrupt NVIC priority map interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_PRIORITY_MAP_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_PRIORITY_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
+
+/**
+ * \brief The number of NVIC priority levels.
+ */
+constexpr auto PRIORITY_LEVELS = std::uint_fast8_t{ 4 };
+
+/**
+ * \brief IRQ priority assignment.
+ *
+ * \tparam IRQ_NUMBER The IRQ.
+ * \tparam PRIORITY The IRQ's NVIC priority level (0 is the highest priority, must be less
+ *         than picolibrary::Microchip::SAM::D21DA1::Interrupt::PRIORITY_LEVELS).
+ * \tparam ENABLE true if the IRQ should be enabled.
+ */
+template<IRQ IRQ_NUMBER, std::uint_fast8_t PRIORITY, bool ENABLE = true>
+struct Priority {
+    static_assert( PRIORITY < PRIORITY_LEVELS, "invalid NVIC priority level" );
+
+    /**
+     * \brief The IRQ.
+     */
+    static constexpr auto irq = static_cast<std::uint_fast8_t>( IRQ_NUMBER );
+
+    /**
+     * \brief The IRQ's NVIC priority level.
+     */
+    static constexpr auto priority = PRIORITY;
+
+    /**
+     * \brief true if the IRQ should be enabled.
+     */
+    static constexpr auto enable = ENABLE;
+};
+
+/**
+ * \brief Check if each IRQ is assigned a priority at most once.
+ *
+ * \tparam Priorities The IRQ priority assignments.
+ *
+ * \return true if each IRQ is assigned a priority at most once.
+ * \return false if an IRQ is assigned a priority more than once.
+ */
+template<typename... Priorities>
+constexpr auto irqs_are_unique() noexcept -> bool
+{
+    if constexpr ( sizeof...( Priorities ) < 2 ) {
+        return true;
+    } else {
+        std::uint_fast8_t const irqs[] = { Priorities::irq... };
+
+        for ( auto i = std::size_t{}; i < sizeof...( Priorities ); ++i ) {
+            for ( auto j = i + 1; j < sizeof...( Priorities ); ++j ) {
+                if ( irqs[ i ] == irqs[ j ] ) {
+                    return false;
+                } // if
+            }     // for
+        }         // for
+
+        return true;
+    } // else
+}
+
+/**
+ * \brief Compile-time NVIC priority and enable map.
+ *
+ * The map is collapsed at compile time into the minimum set of 32-bit NVIC IPR register
+ * writes (one per IPR register that contains an assigned IRQ) and a single NVIC ISER
+ * register write.
+ *
+ * \attention IPR registers are written in their entirety, so IRQs that are not assigned a
+ *            priority but share an IPR register with an IRQ that is assigned a priority
+ *            are set to priority level 0 (the reset value).
+ *
+ * \tparam Priorities The IRQ priority assignments
+ *         (picolibrary::Microchip::SAM::D21DA1::Interrupt::Priority). Assigning an IRQ a
+ *         priority more than once is a compile-time error.
+ */
+template<typename... Priorities>
+class Priority_Map {
+  public:
+    static_assert(
+        irqs_are_unique<Priorities...>(),
+        "an IRQ can only be assigned a priority once" );
+
+    /**
+     * \brief The number of NVIC IPR registers.
+     */
+    static constexpr auto IPR_REGISTERS = std::size_t{ 8 };
+
+    /**
+     * \brief Get an NVIC IPR register value.
+     *
+     * \param[in] n The NVIC IPR register number.
+     *
+     * \return The NVIC IPR register value.
+     */
+    static constexpr auto ipr( std::size_t n ) noexcept -> std::uint32_t
+    {
+        auto value = std::uint32_t{};
+
+        ( ( value |= Priorities::irq / 4 == n ? ipr_field<Priorities>() : 0 ), ... );
+
+        return value;
+    }
+
+    /**
+     * \brief Get the mask of NVIC IPR registers that contain an IRQ that is assigned a
+     *        priority (bit n is set if IPR register n must be written).
+     *
+     * \return The mask of NVIC IPR registers that must be written.
+     */
+    static constexpr auto ipr_mask() noexcept -> std::uint8_t
+    {
+        return ( std::uint8_t{} | ... | ( 1 << ( Priorities::irq / 4 ) ) );
+    }
+
+    /**
+     * \brief Get the NVIC ISER register value.
+     *
+     * \return The NVIC ISER register value.
+     */
+    static constexpr auto iser() noexcept -> std::uint32_t
+    {
+        return ( std::uint32_t{} | ...
+                 | ( Priorities::enable ? std::uint32_t{ 1 } << Priorities::irq : 0 ) );
+    }
+
+    /**
+     * \brief Configure the NVIC.
+     *
+     * \param[in] nvic The NVIC peripheral to configure.
+     */
+    static void configure(
+        ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::NVIC & nvic ) noexcept
+    {
+        configure( nvic, std::make_index_sequence<IPR_REGISTERS>{} );
+
+        if constexpr ( iser() != 0 ) {
+            nvic.iser = iser();
+        } // if
+    }
+
+  private:
+    /**
+     * \brief Get an IRQ's NVIC IPR register field value.
+     *
+     * \tparam Priority_Assignment The IRQ priority assignment.
+     *
+     * \return The IRQ's NVIC IPR register field value (only the two most significant
+     *         bits of each field are implemented).
+     */
+    template<typename Priority_Assignment>
+    static constexpr auto ipr_field() noexcept -> std::uint32_t
+    {
+        return std::uint32_t{ Priority_Assignment::priority }
+               << ( 6 + 8 * ( Priority_Assignment::irq % 4 ) );
+    }
+
+    /**
+     * \brief Write the NVIC IPR registers that contain an IRQ that is assigned a
+     *        priority.
+     *
+     * \tparam N The NVIC IPR register numbers.
+     *
+     * \param[in] nvic The NVIC peripheral to configure.
+     */
+    template<std::size_t... N>
+    static void configure(
+        ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::NVIC & nvic,
+        std::index_sequence<N...> ) noexcept
+    {
+        ( configure_ipr<N>( nvic ), ... );
+    }
+
+    /**
+     * \brief Write an NVIC IPR register if it contains an IRQ that is assigned a
+     *        priority.
+     *
+     * \tparam N The NVIC IPR register number.
+     *
+     * \param[in] nvic The NVIC peripheral to configure.
+     */
+    template<std::size_t N>
+    static void configure_ipr(
+        ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::NVIC & nvic ) noexcept
+    {
+        if constexpr ( ipr_mask() & ( 1 << N ) ) {
+            nvic.ipr[ N ] = ipr( N );
+        } // if
+    }
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_PRIORITY_MAP_H
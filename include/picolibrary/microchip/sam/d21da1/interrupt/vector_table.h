@@ -0,0 +1,146 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Interrupt vector table generation
+ *        interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_VECTOR_TABLE_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_VECTOR_TABLE_H
+
+#include <cstddef>
+
+#include "picolibrary/arm/cortex/m0plus/interrupt.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
+
+/**
+ * \brief Interrupt handler.
+ */
+using Handler = decltype(
+    ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table::reset_handler );
+
+/**
+ * \brief Interrupt vector (vector table entry).
+ */
+using Vector = Handler ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table::*;
+
+/**
+ * \brief Vector to handler binding.
+ *
+ * \tparam VECTOR The vector table entry to bind the handler to (e.g.
+ *         &::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table::sercom0_handler).
+ * \tparam Handler The handler type (must have a static void handle() noexcept member
+ *         function).
+ */
+template<Vector VECTOR, typename Handler>
+struct Binding {
+    /**
+     * \brief The vector table entry to bind the handler to.
+     */
+    static constexpr auto vector = VECTOR;
+
+    /**
+     * \brief The handler.
+     */
+    static constexpr auto handler = &Handler::handle;
+};
+
+/**
+ * \brief Static object member function handler.
+ *
+ * The member function is called directly on the static object (no runtime indirection),
+ * allowing the compiler to inline the member function into the interrupt handler.
+ *
+ * \tparam OBJECT The static object to call the member function on.
+ * \tparam MEMBER_FUNCTION The member function to call.
+ */
+template<auto & OBJECT, auto MEMBER_FUNCTION>
+struct Member_Function_Handler {
+    /**
+     * \brief Handle the interrupt.
+     */
+    static void handle() noexcept
+    {
+        ( OBJECT.*MEMBER_FUNCTION )();
+    }
+};
+
+/**
+ * \brief Check if each vector is bound at most once.
+ *
+ * \tparam Bindings The vector to handler bindings.
+ *
+ * \return true if each vector is bound at most once.
+ * \return false if a vector is bound more than once.
+ */
+template<typename... Bindings>
+constexpr auto vectors_are_unique() noexcept -> bool
+{
+    if constexpr ( sizeof...( Bindings ) < 2 ) {
+        return true;
+    } else {
+        Vector const vectors[] = { Bindings::vector... };
+
+        for ( auto i = std::size_t{}; i < sizeof...( Bindings ); ++i ) {
+            for ( auto j = i + 1; j < sizeof...( Bindings ); ++j ) {
+                if ( vectors[ i ] == vectors[ j ] ) {
+                    return false;
+                } // if
+            }     // for
+        }         // for
+
+        return true;
+    } // else
+}
+
+/**
+ * \brief Generate a vector table at compile time.
+ *
+ * \attention To place the generated vector table in the .vectors section, the default
+ *            vector table must be omitted (use the
+ *            picolibrary-microchip-sam-d21da1-interrupt-default_handlers object library
+ *            instead of the
+ *            picolibrary-microchip-sam-d21da1-interrupt-default_vector_table object
+ *            library).
+ *
+ * \tparam Bindings The vector to handler bindings
+ *         (picolibrary::Microchip::SAM::D21DA1::Interrupt::Binding). Binding a vector
+ *         more than once is a compile-time error.
+ *
+ * \param[in] vector_table The vector table to bind the handlers in (e.g.
+ *            picolibrary::Microchip::SAM::D21DA1::Interrupt::default_vector_table()).
+ *
+ * \return The generated vector table.
+ */
+template<typename... Bindings>
+constexpr auto make_vector_table(
+    ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table vector_table ) noexcept
+    -> ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table
+{
+    static_assert( vectors_are_unique<Bindings...>(), "a vector can only be bound once" );
+
+    ( ( vector_table.*Bindings::vector = Bindings::handler ), ... );
+
+    return vector_table;
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_VECTOR_TABLE_H
@@ -0,0 +1,95 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::NVM interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_NVM_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_NVM_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/peripheral/nvmctrl.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 non-volatile memory (NVM) facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::NVM {
+
+/**
+ * \brief The NVM page size.
+ */
+constexpr auto PAGE_SIZE = std::size_t{ 64 };
+
+/**
+ * \brief The NVM row size.
+ */
+constexpr auto ROW_SIZE = std::size_t{ 4 * PAGE_SIZE };
+
+/**
+ * \brief The address of the Read While Write EEPROM Emulation (RWWEE) area.
+ *
+ * \attention Not all devices have an RWWEE area. The RWWEE area size can be determined
+ *            using the NVMCTRL peripheral's PARAM register.
+ */
+constexpr auto RWWEE_ADDRESS = std::uint32_t{ 0x00400000 };
+
+/**
+ * \brief The address of the software calibration area (factory calibration values for the
+ *        ADC, USB, OSC32K, and DFLL48M).
+ */
+constexpr auto SOFTWARE_CALIBRATION_ADDRESS = std::uint32_t{ 0x00806020 };
+
+/**
+ * \brief Erase an NVM row.
+ *
+ * Rows in the RWWEE area are erased using the RWWEE Erase Row command, all other rows are
+ * erased using the Erase Row command.
+ *
+ * \pre address is row aligned
+ *
+ * \param[in] nvmctrl The NVMCTRL peripheral to use to erase the row.
+ * \param[in] address The address of the row to erase.
+ */
+void erase_row( Peripheral::NVMCTRL & nvmctrl, std::uint32_t address ) noexcept;
+
+/**
+ * \brief Write data to erased NVM.
+ *
+ * Pages in the RWWEE area are written using the RWWEE Write Page command, all other pages
+ * are written using the Write Page command. The last page that is written is padded with
+ * 0xFF.
+ *
+ * \pre address is page aligned
+ *
+ * \param[in] nvmctrl The NVMCTRL peripheral to use to write the data.
+ * \param[in] address The address to write the data to.
+ * \param[in] data The data to write.
+ * \param[in] size The size of the data to write.
+ */
+void write(
+    Peripheral::NVMCTRL & nvmctrl,
+    std::uint32_t         address,
+    void const *          data,
+    std::size_t           size ) noexcept;
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::NVM
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_NVM_H
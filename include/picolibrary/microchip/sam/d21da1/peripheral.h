@@ -23,13 +23,21 @@
 #ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_H
 #define PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_H
 
+#include "picolibrary/microchip/sam/d21da1/peripheral/adc.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/dmac.h"
 #include "picolibrary/microchip/sam/d21da1/peripheral/eic.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/evsys.h"
 #include "picolibrary/microchip/sam/d21da1/peripheral/gclk.h"
 #include "picolibrary/microchip/sam/d21da1/peripheral/nvmctrl.h"
 #include "picolibrary/microchip/sam/d21da1/peripheral/pac.h"
 #include "picolibrary/microchip/sam/d21da1/peripheral/pm.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/port.h"
 #include "picolibrary/microchip/sam/d21da1/peripheral/rtc.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/sercom.h"
 #include "picolibrary/microchip/sam/d21da1/peripheral/sysctrl.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/tc.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/tcc.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/usb.h"
 #include "picolibrary/microchip/sam/d21da1/peripheral/wdt.h"
 #include "picolibrary/peripheral.h"
 
@@ -83,11 +91,123 @@ using PAC1 = ::picolibrary::Peripheral::Instance<PAC, 0x41000000>;
  */
 using NVMCTRL0 = ::picolibrary::Peripheral::Instance<NVMCTRL, 0x41004000>;
 
+/**
+ * \brief PORT0.
+ */
+using PORT0 = ::picolibrary::Peripheral::Instance<PORT, 0x41004400>;
+
+/**
+ * \brief DMAC0.
+ */
+using DMAC0 = ::picolibrary::Peripheral::Instance<DMAC, 0x41004800>;
+
+/**
+ * \brief USB0.
+ */
+using USB0 = ::picolibrary::Peripheral::Instance<USB, 0x41005000>;
+
 /**
  * \brief PAC2.
  */
 using PAC2 = ::picolibrary::Peripheral::Instance<PAC, 0x42000000>;
 
+/**
+ * \brief EVSYS0.
+ */
+using EVSYS0 = ::picolibrary::Peripheral::Instance<EVSYS, 0x42000400>;
+
+/**
+ * \brief SERCOM0.
+ */
+using SERCOM0 = ::picolibrary::Peripheral::Instance<SERCOM, 0x42000800>;
+
+/**
+ * \brief SERCOM1.
+ */
+using SERCOM1 = ::picolibrary::Peripheral::Instance<SERCOM, 0x42000C00>;
+
+/**
+ * \brief SERCOM2.
+ */
+using SERCOM2 = ::picolibrary::Peripheral::Instance<SERCOM, 0x42001000>;
+
+/**
+ * \brief SERCOM3.
+ */
+using SERCOM3 = ::picolibrary::Peripheral::Instance<SERCOM, 0x42001400>;
+
+/**
+ * \brief SERCOM4.
+ */
+using SERCOM4 = ::picolibrary::Peripheral::Instance<SERCOM, 0x42001800>;
+
+/**
+ * \brief SERCOM5.
+ */
+using SERCOM5 = ::picolibrary::Peripheral::Instance<SERCOM, 0x42001C00>;
+
+/**
+ * \brief TCC0.
+ */
+using TCC0 = ::picolibrary::Peripheral::Instance<TCC, 0x42002000>;
+
+/**
+ * \brief TCC1.
+ */
+using TCC1 = ::picolibrary::Peripheral::Instance<TCC, 0x42002400>;
+
+/**
+ * \brief TCC2.
+ */
+using TCC2 = ::picolibrary::Peripheral::Instance<TCC, 0x42002800>;
+
+/**
+ * \brief TC3.
+ */
+using TC3 = ::picolibrary::Peripheral::Instance<TC, 0x42002C00>;
+
+/**
+ * \brief TC4.
+ */
+using TC4 = ::picolibrary::Peripheral::Instance<TC, 0x42003000>;
+
+/**
+ * \brief TC5.
+ */
+using TC5 = ::picolibrary::Peripheral::Instance<TC, 0x42003400>;
+
+/**
+ * \brief TC6.
+ *
+ * \attention TC6 is only available on 64-pin (J) variants.
+ */
+using TC6 = ::picolibrary::Peripheral::Instance<TC, 0x42003800>;
+
+/**
+ * \brief TC7.
+ *
+ * \attention TC7 is only available on 64-pin (J) variants.
+ */
+using TC7 = ::picolibrary::Peripheral::Instance<TC, 0x42003C00>;
+
+/**
+ * \brief ADC0.
+ */
+using ADC0 = ::picolibrary::Peripheral::Instance<ADC, 0x42004000>;
+
+/**
+ * \brief TCC3.
+ *
+ * \attention TCC3 is only available on SAM D21 L and D variants (e.g. ATSAMD21E17L,
+ *            ATSAMD21G17D).
+ */
+using TCC3 = ::picolibrary::Peripheral::Instance<TCC, 0x42006000>;
+
+/**
+ * \brief PORT0_IOBUS.
+ */
+using PORT0_IOBUS = ::picolibrary::Peripheral::Instance<PORT, 0x60000000>;
+
 } // namespace picolibrary::Microchip::SAM::D21DA1::Peripheral
 
 #endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_H
@@ -0,0 +1,1224 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Peripheral::ADC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_ADC_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_ADC_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Peripheral {
+
+/**
+ * \brief Microchip SAM D21/DA1 Analog-to-Digital Converter (ADC) peripheral.
+ */
+class ADC {
+  public:
+    /**
+     * \brief Control A (CTRLA) register.
+     *
+     * This register has the following fields:
+     * - Software Reset (SWRST)
+     * - Enable (ENABLE)
+     * - Run in Standby (RUNSTDBY)
+     */
+    class CTRLA : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SWRST     = std::uint_fast8_t{ 1 }; ///< SWRST.
+            static constexpr auto ENABLE    = std::uint_fast8_t{ 1 }; ///< ENABLE.
+            static constexpr auto RUNSTDBY  = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ 5 }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+            static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+            static constexpr auto RUNSTDBY = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< RUNSTDBY.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SWRST = mask<std::uint8_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+            static constexpr auto ENABLE = mask<std::uint8_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+            static constexpr auto RUNSTDBY = mask<std::uint8_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+            static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+        };
+
+        CTRLA() = delete;
+
+        CTRLA( CTRLA && ) = delete;
+
+        CTRLA( CTRLA const & ) = delete;
+
+        ~CTRLA() = delete;
+
+        auto operator=( CTRLA && ) = delete;
+
+        auto operator=( CTRLA const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Reference Control (REFCTRL) register.
+     *
+     * This register has the following fields:
+     * - Reference Selection (REFSEL)
+     * - Reference Buffer Offset Compensation Enable (REFCOMP)
+     */
+    class REFCTRL : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto REFSEL    = std::uint_fast8_t{ 4 }; ///< REFSEL.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 3 }; ///< RESERVED4.
+            static constexpr auto REFCOMP   = std::uint_fast8_t{ 1 }; ///< REFCOMP.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto REFSEL = std::uint_fast8_t{}; ///< REFSEL.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ REFSEL + Size::REFSEL }; ///< RESERVED4.
+            static constexpr auto REFCOMP = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< REFCOMP.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto REFSEL = mask<std::uint8_t>( Size::REFSEL, Bit::REFSEL ); ///< REFSEL.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto REFCOMP = mask<std::uint8_t>( Size::REFCOMP, Bit::REFCOMP ); ///< REFCOMP.
+        };
+
+        /**
+         * \brief REFSEL.
+         */
+        enum REFSEL : std::uint8_t {
+            REFSEL_INT1V   = 0x0 << Bit::REFSEL, ///< 1.0 V voltage reference.
+            REFSEL_INTVCC0 = 0x1 << Bit::REFSEL, ///< 1/1.48 VDDANA.
+            REFSEL_INTVCC1 = 0x2 << Bit::REFSEL, ///< 1/2 VDDANA (only for VDDANA > 2.0 V).
+            REFSEL_AREFA   = 0x3 << Bit::REFSEL, ///< External reference.
+            REFSEL_AREFB   = 0x4 << Bit::REFSEL, ///< External reference.
+        };
+
+        REFCTRL() = delete;
+
+        REFCTRL( REFCTRL && ) = delete;
+
+        REFCTRL( REFCTRL const & ) = delete;
+
+        ~REFCTRL() = delete;
+
+        auto operator=( REFCTRL && ) = delete;
+
+        auto operator=( REFCTRL const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Average Control (AVGCTRL) register.
+     *
+     * This register has the following fields:
+     * - Number of Samples to be Collected (SAMPLENUM)
+     * - Adjusting Result / Division Coefficient (ADJRES)
+     */
+    class AVGCTRL : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SAMPLENUM = std::uint_fast8_t{ 4 }; ///< SAMPLENUM.
+            static constexpr auto ADJRES    = std::uint_fast8_t{ 3 }; ///< ADJRES.
+            static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SAMPLENUM = std::uint_fast8_t{}; ///< SAMPLENUM.
+            static constexpr auto ADJRES = std::uint_fast8_t{ SAMPLENUM + Size::SAMPLENUM }; ///< ADJRES.
+            static constexpr auto RESERVED7 = std::uint_fast8_t{ ADJRES + Size::ADJRES }; ///< RESERVED7.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SAMPLENUM = mask<std::uint8_t>( Size::SAMPLENUM, Bit::SAMPLENUM ); ///< SAMPLENUM.
+            static constexpr auto ADJRES = mask<std::uint8_t>( Size::ADJRES, Bit::ADJRES ); ///< ADJRES.
+            static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+        };
+
+        /**
+         * \brief SAMPLENUM.
+         */
+        enum SAMPLENUM : std::uint8_t {
+            SAMPLENUM_1    = 0x0 << Bit::SAMPLENUM, ///< 1 sample.
+            SAMPLENUM_2    = 0x1 << Bit::SAMPLENUM, ///< 2 samples.
+            SAMPLENUM_4    = 0x2 << Bit::SAMPLENUM, ///< 4 samples.
+            SAMPLENUM_8    = 0x3 << Bit::SAMPLENUM, ///< 8 samples.
+            SAMPLENUM_16   = 0x4 << Bit::SAMPLENUM, ///< 16 samples.
+            SAMPLENUM_32   = 0x5 << Bit::SAMPLENUM, ///< 32 samples.
+            SAMPLENUM_64   = 0x6 << Bit::SAMPLENUM, ///< 64 samples.
+            SAMPLENUM_128  = 0x7 << Bit::SAMPLENUM, ///< 128 samples.
+            SAMPLENUM_256  = 0x8 << Bit::SAMPLENUM, ///< 256 samples.
+            SAMPLENUM_512  = 0x9 << Bit::SAMPLENUM, ///< 512 samples.
+            SAMPLENUM_1024 = 0xA << Bit::SAMPLENUM, ///< 1024 samples.
+        };
+
+        AVGCTRL() = delete;
+
+        AVGCTRL( AVGCTRL && ) = delete;
+
+        AVGCTRL( AVGCTRL const & ) = delete;
+
+        ~AVGCTRL() = delete;
+
+        auto operator=( AVGCTRL && ) = delete;
+
+        auto operator=( AVGCTRL const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Sampling Time Control (SAMPCTRL) register.
+     *
+     * This register has the following fields:
+     * - Sampling Time Length (SAMPLEN)
+     */
+    class SAMPCTRL : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SAMPLEN   = std::uint_fast8_t{ 6 }; ///< SAMPLEN.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SAMPLEN = std::uint_fast8_t{}; ///< SAMPLEN.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ SAMPLEN + Size::SAMPLEN }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SAMPLEN = mask<std::uint8_t>( Size::SAMPLEN, Bit::SAMPLEN ); ///< SAMPLEN.
+            static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+        };
+
+        SAMPCTRL() = delete;
+
+        SAMPCTRL( SAMPCTRL && ) = delete;
+
+        SAMPCTRL( SAMPCTRL const & ) = delete;
+
+        ~SAMPCTRL() = delete;
+
+        auto operator=( SAMPCTRL && ) = delete;
+
+        auto operator=( SAMPCTRL const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Control B (CTRLB) register.
+     *
+     * This register has the following fields:
+     * - Differential Mode (DIFFMODE)
+     * - Left-Adjusted Result (LEFTADJ)
+     * - Free Running Mode (FREERUN)
+     * - Digital Correction Logic Enabled (CORREN)
+     * - Conversion Result Resolution (RESSEL)
+     * - Prescaler Configuration (PRESCALER)
+     */
+    class CTRLB : public Register<std::uint16_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto DIFFMODE   = std::uint_fast8_t{ 1 }; ///< DIFFMODE.
+            static constexpr auto LEFTADJ    = std::uint_fast8_t{ 1 }; ///< LEFTADJ.
+            static constexpr auto FREERUN    = std::uint_fast8_t{ 1 }; ///< FREERUN.
+            static constexpr auto CORREN     = std::uint_fast8_t{ 1 }; ///< CORREN.
+            static constexpr auto RESSEL     = std::uint_fast8_t{ 2 }; ///< RESSEL.
+            static constexpr auto RESERVED6  = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            static constexpr auto PRESCALER  = std::uint_fast8_t{ 3 }; ///< PRESCALER.
+            static constexpr auto RESERVED11 = std::uint_fast8_t{ 5 }; ///< RESERVED11.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto DIFFMODE = std::uint_fast8_t{}; ///< DIFFMODE.
+            static constexpr auto LEFTADJ = std::uint_fast8_t{ DIFFMODE + Size::DIFFMODE }; ///< LEFTADJ.
+            static constexpr auto FREERUN = std::uint_fast8_t{ LEFTADJ + Size::LEFTADJ }; ///< FREERUN.
+            static constexpr auto CORREN = std::uint_fast8_t{ FREERUN + Size::FREERUN }; ///< CORREN.
+            static constexpr auto RESSEL = std::uint_fast8_t{ CORREN + Size::CORREN }; ///< RESSEL.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ RESSEL + Size::RESSEL }; ///< RESERVED6.
+            static constexpr auto PRESCALER = std::uint_fast8_t{ RESERVED6 + Size::RESERVED6 }; ///< PRESCALER.
+            static constexpr auto RESERVED11 = std::uint_fast8_t{ PRESCALER + Size::PRESCALER }; ///< RESERVED11.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto DIFFMODE = mask<std::uint16_t>( Size::DIFFMODE, Bit::DIFFMODE ); ///< DIFFMODE.
+            static constexpr auto LEFTADJ = mask<std::uint16_t>( Size::LEFTADJ, Bit::LEFTADJ ); ///< LEFTADJ.
+            static constexpr auto FREERUN = mask<std::uint16_t>( Size::FREERUN, Bit::FREERUN ); ///< FREERUN.
+            static constexpr auto CORREN = mask<std::uint16_t>( Size::CORREN, Bit::CORREN ); ///< CORREN.
+            static constexpr auto RESSEL = mask<std::uint16_t>( Size::RESSEL, Bit::RESSEL ); ///< RESSEL.
+            static constexpr auto RESERVED6 = mask<std::uint16_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            static constexpr auto PRESCALER = mask<std::uint16_t>( Size::PRESCALER, Bit::PRESCALER ); ///< PRESCALER.
+            static constexpr auto RESERVED11 = mask<std::uint16_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+        };
+
+        /**
+         * \brief RESSEL.
+         */
+        enum RESSEL : std::uint16_t {
+            RESSEL_12BIT = 0x0 << Bit::RESSEL, ///< 12-bit result.
+            RESSEL_16BIT = 0x1 << Bit::RESSEL, ///< For averaging mode output.
+            RESSEL_10BIT = 0x2 << Bit::RESSEL, ///< 10-bit result.
+            RESSEL_8BIT  = 0x3 << Bit::RESSEL, ///< 8-bit result.
+        };
+
+        /**
+         * \brief PRESCALER.
+         */
+        enum PRESCALER : std::uint16_t {
+            PRESCALER_DIV4   = 0x0 << Bit::PRESCALER, ///< Peripheral clock divided by 4.
+            PRESCALER_DIV8   = 0x1 << Bit::PRESCALER, ///< Peripheral clock divided by 8.
+            PRESCALER_DIV16  = 0x2 << Bit::PRESCALER, ///< Peripheral clock divided by 16.
+            PRESCALER_DIV32  = 0x3 << Bit::PRESCALER, ///< Peripheral clock divided by 32.
+            PRESCALER_DIV64  = 0x4 << Bit::PRESCALER, ///< Peripheral clock divided by 64.
+            PRESCALER_DIV128 = 0x5 << Bit::PRESCALER, ///< Peripheral clock divided by 128.
+            PRESCALER_DIV256 = 0x6 << Bit::PRESCALER, ///< Peripheral clock divided by 256.
+            PRESCALER_DIV512 = 0x7 << Bit::PRESCALER, ///< Peripheral clock divided by 512.
+        };
+
+        CTRLB() = delete;
+
+        CTRLB( CTRLB && ) = delete;
+
+        CTRLB( CTRLB const & ) = delete;
+
+        ~CTRLB() = delete;
+
+        auto operator=( CTRLB && ) = delete;
+
+        auto operator=( CTRLB const & ) = delete;
+
+        using Register<std::uint16_t>::operator=;
+    };
+
+    /**
+     * \brief Window Monitor Control (WINCTRL) register.
+     *
+     * This register has the following fields:
+     * - Window Monitor Mode (WINMODE)
+     */
+    class WINCTRL : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto WINMODE   = std::uint_fast8_t{ 3 }; ///< WINMODE.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ 5 }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto WINMODE = std::uint_fast8_t{}; ///< WINMODE.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ WINMODE + Size::WINMODE }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto WINMODE = mask<std::uint8_t>( Size::WINMODE, Bit::WINMODE ); ///< WINMODE.
+            static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+        };
+
+        /**
+         * \brief WINMODE.
+         */
+        enum WINMODE : std::uint8_t {
+            WINMODE_DISABLE = 0x0 << Bit::WINMODE, ///< No window mode (default).
+            WINMODE_MODE1   = 0x1 << Bit::WINMODE, ///< Mode 1: RESULT > WINLT.
+            WINMODE_MODE2   = 0x2 << Bit::WINMODE, ///< Mode 2: RESULT < WINUT.
+            WINMODE_MODE3   = 0x3 << Bit::WINMODE, ///< Mode 3: WINLT < RESULT < WINUT.
+            WINMODE_MODE4   = 0x4 << Bit::WINMODE, ///< Mode 4: !(WINLT < RESULT < WINUT).
+        };
+
+        WINCTRL() = delete;
+
+        WINCTRL( WINCTRL && ) = delete;
+
+        WINCTRL( WINCTRL const & ) = delete;
+
+        ~WINCTRL() = delete;
+
+        auto operator=( WINCTRL && ) = delete;
+
+        auto operator=( WINCTRL const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Software Trigger (SWTRIG) register.
+     *
+     * This register has the following fields:
+     * - ADC Conversion Flush (FLUSH)
+     * - ADC Start Conversion (START)
+     */
+    class SWTRIG : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto FLUSH     = std::uint_fast8_t{ 1 }; ///< FLUSH.
+            static constexpr auto START     = std::uint_fast8_t{ 1 }; ///< START.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ 6 }; ///< RESERVED2.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto FLUSH = std::uint_fast8_t{}; ///< FLUSH.
+            static constexpr auto START = std::uint_fast8_t{ FLUSH + Size::FLUSH }; ///< START.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ START + Size::START }; ///< RESERVED2.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto FLUSH = mask<std::uint8_t>( Size::FLUSH, Bit::FLUSH ); ///< FLUSH.
+            static constexpr auto START = mask<std::uint8_t>( Size::START, Bit::START ); ///< START.
+            static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+        };
+
+        SWTRIG() = delete;
+
+        SWTRIG( SWTRIG && ) = delete;
+
+        SWTRIG( SWTRIG const & ) = delete;
+
+        ~SWTRIG() = delete;
+
+        auto operator=( SWTRIG && ) = delete;
+
+        auto operator=( SWTRIG const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Input Control (INPUTCTRL) register.
+     *
+     * This register has the following fields:
+     * - Positive Mux Input Selection (MUXPOS)
+     * - Negative Mux Input Selection (MUXNEG)
+     * - Number of Input Channels Included in Scan (INPUTSCAN)
+     * - Positive Mux Setting Offset (INPUTOFFSET)
+     * - Gain Factor Selection (GAIN)
+     */
+    class INPUTCTRL : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto MUXPOS      = std::uint_fast8_t{ 5 }; ///< MUXPOS.
+            static constexpr auto RESERVED5   = std::uint_fast8_t{ 3 }; ///< RESERVED5.
+            static constexpr auto MUXNEG      = std::uint_fast8_t{ 5 }; ///< MUXNEG.
+            static constexpr auto RESERVED13  = std::uint_fast8_t{ 3 }; ///< RESERVED13.
+            static constexpr auto INPUTSCAN   = std::uint_fast8_t{ 4 }; ///< INPUTSCAN.
+            static constexpr auto INPUTOFFSET = std::uint_fast8_t{ 4 }; ///< INPUTOFFSET.
+            static constexpr auto GAIN        = std::uint_fast8_t{ 4 }; ///< GAIN.
+            static constexpr auto RESERVED28  = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto MUXPOS = std::uint_fast8_t{}; ///< MUXPOS.
+            static constexpr auto RESERVED5 = std::uint_fast8_t{ MUXPOS + Size::MUXPOS }; ///< RESERVED5.
+            static constexpr auto MUXNEG = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< MUXNEG.
+            static constexpr auto RESERVED13 = std::uint_fast8_t{ MUXNEG + Size::MUXNEG }; ///< RESERVED13.
+            static constexpr auto INPUTSCAN = std::uint_fast8_t{ RESERVED13 + Size::RESERVED13 }; ///< INPUTSCAN.
+            static constexpr auto INPUTOFFSET = std::uint_fast8_t{ INPUTSCAN + Size::INPUTSCAN }; ///< INPUTOFFSET.
+            static constexpr auto GAIN = std::uint_fast8_t{ INPUTOFFSET + Size::INPUTOFFSET }; ///< GAIN.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ GAIN + Size::GAIN }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto MUXPOS = mask<std::uint32_t>( Size::MUXPOS, Bit::MUXPOS ); ///< MUXPOS.
+            static constexpr auto RESERVED5 = mask<std::uint32_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+            static constexpr auto MUXNEG = mask<std::uint32_t>( Size::MUXNEG, Bit::MUXNEG ); ///< MUXNEG.
+            static constexpr auto RESERVED13 = mask<std::uint32_t>( Size::RESERVED13, Bit::RESERVED13 ); ///< RESERVED13.
+            static constexpr auto INPUTSCAN = mask<std::uint32_t>( Size::INPUTSCAN, Bit::INPUTSCAN ); ///< INPUTSCAN.
+            static constexpr auto INPUTOFFSET = mask<std::uint32_t>( Size::INPUTOFFSET, Bit::INPUTOFFSET ); ///< INPUTOFFSET.
+            static constexpr auto GAIN = mask<std::uint32_t>( Size::GAIN, Bit::GAIN ); ///< GAIN.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        /**
+         * \brief MUXPOS.
+         */
+        enum MUXPOS : std::uint32_t {
+            MUXPOS_PIN0          = 0x00 << Bit::MUXPOS, ///< ADC AIN0 pin.
+            MUXPOS_PIN1          = 0x01 << Bit::MUXPOS, ///< ADC AIN1 pin.
+            MUXPOS_PIN2          = 0x02 << Bit::MUXPOS, ///< ADC AIN2 pin.
+            MUXPOS_PIN3          = 0x03 << Bit::MUXPOS, ///< ADC AIN3 pin.
+            MUXPOS_PIN4          = 0x04 << Bit::MUXPOS, ///< ADC AIN4 pin.
+            MUXPOS_PIN5          = 0x05 << Bit::MUXPOS, ///< ADC AIN5 pin.
+            MUXPOS_PIN6          = 0x06 << Bit::MUXPOS, ///< ADC AIN6 pin.
+            MUXPOS_PIN7          = 0x07 << Bit::MUXPOS, ///< ADC AIN7 pin.
+            MUXPOS_PIN8          = 0x08 << Bit::MUXPOS, ///< ADC AIN8 pin.
+            MUXPOS_PIN9          = 0x09 << Bit::MUXPOS, ///< ADC AIN9 pin.
+            MUXPOS_PIN10         = 0x0A << Bit::MUXPOS, ///< ADC AIN10 pin.
+            MUXPOS_PIN11         = 0x0B << Bit::MUXPOS, ///< ADC AIN11 pin.
+            MUXPOS_PIN12         = 0x0C << Bit::MUXPOS, ///< ADC AIN12 pin.
+            MUXPOS_PIN13         = 0x0D << Bit::MUXPOS, ///< ADC AIN13 pin.
+            MUXPOS_PIN14         = 0x0E << Bit::MUXPOS, ///< ADC AIN14 pin.
+            MUXPOS_PIN15         = 0x0F << Bit::MUXPOS, ///< ADC AIN15 pin.
+            MUXPOS_PIN16         = 0x10 << Bit::MUXPOS, ///< ADC AIN16 pin.
+            MUXPOS_PIN17         = 0x11 << Bit::MUXPOS, ///< ADC AIN17 pin.
+            MUXPOS_PIN18         = 0x12 << Bit::MUXPOS, ///< ADC AIN18 pin.
+            MUXPOS_PIN19         = 0x13 << Bit::MUXPOS, ///< ADC AIN19 pin.
+            MUXPOS_TEMP          = 0x18 << Bit::MUXPOS, ///< Temperature reference.
+            MUXPOS_BANDGAP       = 0x19 << Bit::MUXPOS, ///< Bandgap voltage.
+            MUXPOS_SCALEDCOREVCC = 0x1A << Bit::MUXPOS, ///< 1/4 scaled core supply.
+            MUXPOS_SCALEDIOVCC   = 0x1B << Bit::MUXPOS, ///< 1/4 scaled I/O supply.
+            MUXPOS_DAC           = 0x1C << Bit::MUXPOS, ///< DAC output.
+        };
+
+        /**
+         * \brief MUXNEG.
+         */
+        enum MUXNEG : std::uint32_t {
+            MUXNEG_PIN0  = 0x00 << Bit::MUXNEG, ///< ADC AIN0 pin.
+            MUXNEG_PIN1  = 0x01 << Bit::MUXNEG, ///< ADC AIN1 pin.
+            MUXNEG_PIN2  = 0x02 << Bit::MUXNEG, ///< ADC AIN2 pin.
+            MUXNEG_PIN3  = 0x03 << Bit::MUXNEG, ///< ADC AIN3 pin.
+            MUXNEG_PIN4  = 0x04 << Bit::MUXNEG, ///< ADC AIN4 pin.
+            MUXNEG_PIN5  = 0x05 << Bit::MUXNEG, ///< ADC AIN5 pin.
+            MUXNEG_PIN6  = 0x06 << Bit::MUXNEG, ///< ADC AIN6 pin.
+            MUXNEG_PIN7  = 0x07 << Bit::MUXNEG, ///< ADC AIN7 pin.
+            MUXNEG_GND   = 0x18 << Bit::MUXNEG, ///< Internal ground.
+            MUXNEG_IOGND = 0x19 << Bit::MUXNEG, ///< I/O ground.
+        };
+
+        /**
+         * \brief GAIN.
+         */
+        enum GAIN : std::uint32_t {
+            GAIN_1X   = 0x0 << Bit::GAIN, ///< 1x.
+            GAIN_2X   = 0x1 << Bit::GAIN, ///< 2x.
+            GAIN_4X   = 0x2 << Bit::GAIN, ///< 4x.
+            GAIN_8X   = 0x3 << Bit::GAIN, ///< 8x.
+            GAIN_16X  = 0x4 << Bit::GAIN, ///< 16x.
+            GAIN_DIV2 = 0xF << Bit::GAIN, ///< 1/2x.
+        };
+
+        INPUTCTRL() = delete;
+
+        INPUTCTRL( INPUTCTRL && ) = delete;
+
+        INPUTCTRL( INPUTCTRL const & ) = delete;
+
+        ~INPUTCTRL() = delete;
+
+        auto operator=( INPUTCTRL && ) = delete;
+
+        auto operator=( INPUTCTRL const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Event Control (EVCTRL) register.
+     *
+     * This register has the following fields:
+     * - Start Conversion Event In (STARTEI)
+     * - Synchronization Event In (SYNCEI)
+     * - Result Ready Event Out (RESRDYEO)
+     * - Window Monitor Event Out (WINMONEO)
+     */
+    class EVCTRL : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto STARTEI   = std::uint_fast8_t{ 1 }; ///< STARTEI.
+            static constexpr auto SYNCEI    = std::uint_fast8_t{ 1 }; ///< SYNCEI.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ 2 }; ///< RESERVED2.
+            static constexpr auto RESRDYEO  = std::uint_fast8_t{ 1 }; ///< RESRDYEO.
+            static constexpr auto WINMONEO  = std::uint_fast8_t{ 1 }; ///< WINMONEO.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto STARTEI = std::uint_fast8_t{}; ///< STARTEI.
+            static constexpr auto SYNCEI = std::uint_fast8_t{ STARTEI + Size::STARTEI }; ///< SYNCEI.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ SYNCEI + Size::SYNCEI }; ///< RESERVED2.
+            static constexpr auto RESRDYEO = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< RESRDYEO.
+            static constexpr auto WINMONEO = std::uint_fast8_t{ RESRDYEO + Size::RESRDYEO }; ///< WINMONEO.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ WINMONEO + Size::WINMONEO }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto STARTEI = mask<std::uint8_t>( Size::STARTEI, Bit::STARTEI ); ///< STARTEI.
+            static constexpr auto SYNCEI = mask<std::uint8_t>( Size::SYNCEI, Bit::SYNCEI ); ///< SYNCEI.
+            static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            static constexpr auto RESRDYEO = mask<std::uint8_t>( Size::RESRDYEO, Bit::RESRDYEO ); ///< RESRDYEO.
+            static constexpr auto WINMONEO = mask<std::uint8_t>( Size::WINMONEO, Bit::WINMONEO ); ///< WINMONEO.
+            static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+        };
+
+        EVCTRL() = delete;
+
+        EVCTRL( EVCTRL && ) = delete;
+
+        EVCTRL( EVCTRL const & ) = delete;
+
+        ~EVCTRL() = delete;
+
+        auto operator=( EVCTRL && ) = delete;
+
+        auto operator=( EVCTRL const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Enable Clear (INTENCLR) register.
+     *
+     * This register has the following fields:
+     * - Result Ready Interrupt Enable (RESRDY)
+     * - Overrun Interrupt Enable (OVERRUN)
+     * - Window Monitor Interrupt Enable (WINMON)
+     * - Synchronization Ready Interrupt Enable (SYNCRDY)
+     */
+    class INTENCLR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto RESRDY    = std::uint_fast8_t{ 1 }; ///< RESRDY.
+            static constexpr auto OVERRUN   = std::uint_fast8_t{ 1 }; ///< OVERRUN.
+            static constexpr auto WINMON    = std::uint_fast8_t{ 1 }; ///< WINMON.
+            static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 4 }; ///< RESERVED4.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto RESRDY = std::uint_fast8_t{}; ///< RESRDY.
+            static constexpr auto OVERRUN = std::uint_fast8_t{ RESRDY + Size::RESRDY }; ///< OVERRUN.
+            static constexpr auto WINMON = std::uint_fast8_t{ OVERRUN + Size::OVERRUN }; ///< WINMON.
+            static constexpr auto SYNCRDY = std::uint_fast8_t{ WINMON + Size::WINMON }; ///< SYNCRDY.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< RESERVED4.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto RESRDY = mask<std::uint8_t>( Size::RESRDY, Bit::RESRDY ); ///< RESRDY.
+            static constexpr auto OVERRUN = mask<std::uint8_t>( Size::OVERRUN, Bit::OVERRUN ); ///< OVERRUN.
+            static constexpr auto WINMON = mask<std::uint8_t>( Size::WINMON, Bit::WINMON ); ///< WINMON.
+            static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+        };
+
+        INTENCLR() = delete;
+
+        INTENCLR( INTENCLR && ) = delete;
+
+        INTENCLR( INTENCLR const & ) = delete;
+
+        ~INTENCLR() = delete;
+
+        auto operator=( INTENCLR && ) = delete;
+
+        auto operator=( INTENCLR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Enable Set (INTENSET) register.
+     *
+     * This register has the following fields:
+     * - Result Ready Interrupt Enable (RESRDY)
+     * - Overrun Interrupt Enable (OVERRUN)
+     * - Window Monitor Interrupt Enable (WINMON)
+     * - Synchronization Ready Interrupt Enable (SYNCRDY)
+     */
+    class INTENSET : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto RESRDY    = std::uint_fast8_t{ 1 }; ///< RESRDY.
+            static constexpr auto OVERRUN   = std::uint_fast8_t{ 1 }; ///< OVERRUN.
+            static constexpr auto WINMON    = std::uint_fast8_t{ 1 }; ///< WINMON.
+            static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 4 }; ///< RESERVED4.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto RESRDY = std::uint_fast8_t{}; ///< RESRDY.
+            static constexpr auto OVERRUN = std::uint_fast8_t{ RESRDY + Size::RESRDY }; ///< OVERRUN.
+            static constexpr auto WINMON = std::uint_fast8_t{ OVERRUN + Size::OVERRUN }; ///< WINMON.
+            static constexpr auto SYNCRDY = std::uint_fast8_t{ WINMON + Size::WINMON }; ///< SYNCRDY.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< RESERVED4.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto RESRDY = mask<std::uint8_t>( Size::RESRDY, Bit::RESRDY ); ///< RESRDY.
+            static constexpr auto OVERRUN = mask<std::uint8_t>( Size::OVERRUN, Bit::OVERRUN ); ///< OVERRUN.
+            static constexpr auto WINMON = mask<std::uint8_t>( Size::WINMON, Bit::WINMON ); ///< WINMON.
+            static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+        };
+
+        INTENSET() = delete;
+
+        INTENSET( INTENSET && ) = delete;
+
+        INTENSET( INTENSET const & ) = delete;
+
+        ~INTENSET() = delete;
+
+        auto operator=( INTENSET && ) = delete;
+
+        auto operator=( INTENSET const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+     *
+     * This register has the following fields:
+     * - Result Ready (RESRDY)
+     * - Overrun (OVERRUN)
+     * - Window Monitor (WINMON)
+     * - Synchronization Ready (SYNCRDY)
+     */
+    class INTFLAG : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto RESRDY    = std::uint_fast8_t{ 1 }; ///< RESRDY.
+            static constexpr auto OVERRUN   = std::uint_fast8_t{ 1 }; ///< OVERRUN.
+            static constexpr auto WINMON    = std::uint_fast8_t{ 1 }; ///< WINMON.
+            static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 4 }; ///< RESERVED4.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto RESRDY = std::uint_fast8_t{}; ///< RESRDY.
+            static constexpr auto OVERRUN = std::uint_fast8_t{ RESRDY + Size::RESRDY }; ///< OVERRUN.
+            static constexpr auto WINMON = std::uint_fast8_t{ OVERRUN + Size::OVERRUN }; ///< WINMON.
+            static constexpr auto SYNCRDY = std::uint_fast8_t{ WINMON + Size::WINMON }; ///< SYNCRDY.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< RESERVED4.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto RESRDY = mask<std::uint8_t>( Size::RESRDY, Bit::RESRDY ); ///< RESRDY.
+            static constexpr auto OVERRUN = mask<std::uint8_t>( Size::OVERRUN, Bit::OVERRUN ); ///< OVERRUN.
+            static constexpr auto WINMON = mask<std::uint8_t>( Size::WINMON, Bit::WINMON ); ///< WINMON.
+            static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+        };
+
+        INTFLAG() = delete;
+
+        INTFLAG( INTFLAG && ) = delete;
+
+        INTFLAG( INTFLAG const & ) = delete;
+
+        ~INTFLAG() = delete;
+
+        auto operator=( INTFLAG && ) = delete;
+
+        auto operator=( INTFLAG const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Status (STATUS) register.
+     *
+     * This register has the following fields:
+     * - Synchronization Busy (SYNCBUSY)
+     */
+    class STATUS : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto RESERVED0 = std::uint_fast8_t{ 7 }; ///< RESERVED0.
+            static constexpr auto SYNCBUSY  = std::uint_fast8_t{ 1 }; ///< SYNCBUSY.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+            static constexpr auto SYNCBUSY = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< SYNCBUSY.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto RESERVED0 = mask<std::uint8_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+            static constexpr auto SYNCBUSY = mask<std::uint8_t>( Size::SYNCBUSY, Bit::SYNCBUSY ); ///< SYNCBUSY.
+        };
+
+        STATUS() = delete;
+
+        STATUS( STATUS && ) = delete;
+
+        STATUS( STATUS const & ) = delete;
+
+        ~STATUS() = delete;
+
+        auto operator=( STATUS && ) = delete;
+
+        auto operator=( STATUS const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Gain Correction (GAINCORR) register.
+     *
+     * This register has the following fields:
+     * - Gain Correction Value (GAINCORR)
+     */
+    class GAINCORR : public Register<std::uint16_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto GAINCORR   = std::uint_fast8_t{ 12 }; ///< GAINCORR.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 4 };  ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto GAINCORR = std::uint_fast8_t{}; ///< GAINCORR.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ GAINCORR + Size::GAINCORR }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto GAINCORR = mask<std::uint16_t>( Size::GAINCORR, Bit::GAINCORR ); ///< GAINCORR.
+            static constexpr auto RESERVED12 = mask<std::uint16_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+        };
+
+        GAINCORR() = delete;
+
+        GAINCORR( GAINCORR && ) = delete;
+
+        GAINCORR( GAINCORR const & ) = delete;
+
+        ~GAINCORR() = delete;
+
+        auto operator=( GAINCORR && ) = delete;
+
+        auto operator=( GAINCORR const & ) = delete;
+
+        using Register<std::uint16_t>::operator=;
+    };
+
+    /**
+     * \brief Offset Correction (OFFSETCORR) register.
+     *
+     * This register has the following fields:
+     * - Offset Correction Value (OFFSETCORR)
+     */
+    class OFFSETCORR : public Register<std::uint16_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto OFFSETCORR = std::uint_fast8_t{ 12 }; ///< OFFSETCORR.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 4 };  ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto OFFSETCORR = std::uint_fast8_t{}; ///< OFFSETCORR.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ OFFSETCORR + Size::OFFSETCORR }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto OFFSETCORR = mask<std::uint16_t>( Size::OFFSETCORR, Bit::OFFSETCORR ); ///< OFFSETCORR.
+            static constexpr auto RESERVED12 = mask<std::uint16_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+        };
+
+        OFFSETCORR() = delete;
+
+        OFFSETCORR( OFFSETCORR && ) = delete;
+
+        OFFSETCORR( OFFSETCORR const & ) = delete;
+
+        ~OFFSETCORR() = delete;
+
+        auto operator=( OFFSETCORR && ) = delete;
+
+        auto operator=( OFFSETCORR const & ) = delete;
+
+        using Register<std::uint16_t>::operator=;
+    };
+
+    /**
+     * \brief Calibration (CALIB) register.
+     *
+     * This register has the following fields:
+     * - Linearity Calibration Value (LINEARITY_CAL)
+     * - Bias Calibration Value (BIAS_CAL)
+     */
+    class CALIB : public Register<std::uint16_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto LINEARITY_CAL = std::uint_fast8_t{ 8 }; ///< LINEARITY_CAL.
+            static constexpr auto BIAS_CAL      = std::uint_fast8_t{ 3 }; ///< BIAS_CAL.
+            static constexpr auto RESERVED11    = std::uint_fast8_t{ 5 }; ///< RESERVED11.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto LINEARITY_CAL = std::uint_fast8_t{}; ///< LINEARITY_CAL.
+            static constexpr auto BIAS_CAL = std::uint_fast8_t{ LINEARITY_CAL + Size::LINEARITY_CAL }; ///< BIAS_CAL.
+            static constexpr auto RESERVED11 = std::uint_fast8_t{ BIAS_CAL + Size::BIAS_CAL }; ///< RESERVED11.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto LINEARITY_CAL = mask<std::uint16_t>( Size::LINEARITY_CAL, Bit::LINEARITY_CAL ); ///< LINEARITY_CAL.
+            static constexpr auto BIAS_CAL = mask<std::uint16_t>( Size::BIAS_CAL, Bit::BIAS_CAL ); ///< BIAS_CAL.
+            static constexpr auto RESERVED11 = mask<std::uint16_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+        };
+
+        CALIB() = delete;
+
+        CALIB( CALIB && ) = delete;
+
+        CALIB( CALIB const & ) = delete;
+
+        ~CALIB() = delete;
+
+        auto operator=( CALIB && ) = delete;
+
+        auto operator=( CALIB const & ) = delete;
+
+        using Register<std::uint16_t>::operator=;
+    };
+
+    /**
+     * \brief Debug Control (DBGCTRL) register.
+     *
+     * This register has the following fields:
+     * - Debug Run (DBGRUN)
+     */
+    class DBGCTRL : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto DBGRUN    = std::uint_fast8_t{ 1 }; ///< DBGRUN.
+            static constexpr auto RESERVED1 = std::uint_fast8_t{ 7 }; ///< RESERVED1.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto DBGRUN = std::uint_fast8_t{}; ///< DBGRUN.
+            static constexpr auto RESERVED1 = std::uint_fast8_t{ DBGRUN + Size::DBGRUN }; ///< RESERVED1.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto DBGRUN = mask<std::uint8_t>( Size::DBGRUN, Bit::DBGRUN ); ///< DBGRUN.
+            static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+        };
+
+        DBGCTRL() = delete;
+
+        DBGCTRL( DBGCTRL && ) = delete;
+
+        DBGCTRL( DBGCTRL const & ) = delete;
+
+        ~DBGCTRL() = delete;
+
+        auto operator=( DBGCTRL && ) = delete;
+
+        auto operator=( DBGCTRL const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief CTRLA.
+     */
+    CTRLA ctrla;
+
+    /**
+     * \brief REFCTRL.
+     */
+    REFCTRL refctrl;
+
+    /**
+     * \brief AVGCTRL.
+     */
+    AVGCTRL avgctrl;
+
+    /**
+     * \brief SAMPCTRL.
+     */
+    SAMPCTRL sampctrl;
+
+    /**
+     * \brief CTRLB.
+     */
+    CTRLB ctrlb;
+
+    /**
+     * \brief Reserved registers (offset 0x06-0x07).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x06_0x07[ ( 0x07 - 0x06 ) + 1 ];
+
+    /**
+     * \brief WINCTRL.
+     */
+    WINCTRL winctrl;
+
+    /**
+     * \brief Reserved registers (offset 0x09-0x0B).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x09_0x0B[ ( 0x0B - 0x09 ) + 1 ];
+
+    /**
+     * \brief SWTRIG.
+     */
+    SWTRIG swtrig;
+
+    /**
+     * \brief Reserved registers (offset 0x0D-0x0F).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x0D_0x0F[ ( 0x0F - 0x0D ) + 1 ];
+
+    /**
+     * \brief INPUTCTRL.
+     */
+    INPUTCTRL inputctrl;
+
+    /**
+     * \brief EVCTRL.
+     */
+    EVCTRL evctrl;
+
+    /**
+     * \brief Reserved registers (offset 0x15-0x15).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x15_0x15[ ( 0x15 - 0x15 ) + 1 ];
+
+    /**
+     * \brief INTENCLR.
+     */
+    INTENCLR intenclr;
+
+    /**
+     * \brief INTENSET.
+     */
+    INTENSET intenset;
+
+    /**
+     * \brief INTFLAG.
+     */
+    INTFLAG intflag;
+
+    /**
+     * \brief STATUS.
+     */
+    STATUS const status;
+
+    /**
+     * \brief Result (RESULT) register.
+     */
+    Register<std::uint16_t> const result;
+
+    /**
+     * \brief Window Monitor Lower Threshold (WINLT) register.
+     */
+    Register<std::uint16_t> winlt;
+
+    /**
+     * \brief Reserved registers (offset 0x1E-0x1F).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x1E_0x1F[ ( 0x1F - 0x1E ) + 1 ];
+
+    /**
+     * \brief Window Monitor Upper Threshold (WINUT) register.
+     */
+    Register<std::uint16_t> winut;
+
+    /**
+     * \brief Reserved registers (offset 0x22-0x23).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x22_0x23[ ( 0x23 - 0x22 ) + 1 ];
+
+    /**
+     * \brief GAINCORR.
+     */
+    GAINCORR gaincorr;
+
+    /**
+     * \brief OFFSETCORR.
+     */
+    OFFSETCORR offsetcorr;
+
+    /**
+     * \brief CALIB.
+     */
+    CALIB calib;
+
+    /**
+     * \brief DBGCTRL.
+     */
+    DBGCTRL dbgctrl;
+
+    ADC() = delete;
+
+    ADC( ADC && ) = delete;
+
+    ADC( ADC const & ) = delete;
+
+    ~ADC() = delete;
+
+    auto operator=( ADC && ) = delete;
+
+    auto operator=( ADC const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_ADC_H
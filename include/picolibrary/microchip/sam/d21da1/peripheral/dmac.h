@@ -0,0 +1,1763 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Peripheral::DMAC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_DMAC_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_DMAC_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Peripheral {
+
+/**
+ * \brief Microchip SAM D21/DA1 Direct Memory Access Controller (DMAC) peripheral.
+ */
+class DMAC {
+  public:
+    /**
+     * \brief Control (CTRL) register.
+     *
+     * This register has the following fields:
+     * - Software Reset (SWRST)
+     * - DMA Enable (DMAENABLE)
+     * - CRC Enable (CRCENABLE)
+     * - Priority Level 0 Enable (LVLEN0)
+     * - Priority Level 1 Enable (LVLEN1)
+     * - Priority Level 2 Enable (LVLEN2)
+     * - Priority Level 3 Enable (LVLEN3)
+     */
+    class CTRL : public Register<std::uint16_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SWRST      = std::uint_fast8_t{ 1 }; ///< SWRST.
+            static constexpr auto DMAENABLE  = std::uint_fast8_t{ 1 }; ///< DMAENABLE.
+            static constexpr auto CRCENABLE  = std::uint_fast8_t{ 1 }; ///< CRCENABLE.
+            static constexpr auto RESERVED3  = std::uint_fast8_t{ 5 }; ///< RESERVED3.
+            static constexpr auto LVLEN0     = std::uint_fast8_t{ 1 }; ///< LVLEN0.
+            static constexpr auto LVLEN1     = std::uint_fast8_t{ 1 }; ///< LVLEN1.
+            static constexpr auto LVLEN2     = std::uint_fast8_t{ 1 }; ///< LVLEN2.
+            static constexpr auto LVLEN3     = std::uint_fast8_t{ 1 }; ///< LVLEN3.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 4 }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+            static constexpr auto DMAENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< DMAENABLE.
+            static constexpr auto CRCENABLE = std::uint_fast8_t{ DMAENABLE + Size::DMAENABLE }; ///< CRCENABLE.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ CRCENABLE + Size::CRCENABLE }; ///< RESERVED3.
+            static constexpr auto LVLEN0 = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< LVLEN0.
+            static constexpr auto LVLEN1 = std::uint_fast8_t{ LVLEN0 + Size::LVLEN0 }; ///< LVLEN1.
+            static constexpr auto LVLEN2 = std::uint_fast8_t{ LVLEN1 + Size::LVLEN1 }; ///< LVLEN2.
+            static constexpr auto LVLEN3 = std::uint_fast8_t{ LVLEN2 + Size::LVLEN2 }; ///< LVLEN3.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ LVLEN3 + Size::LVLEN3 }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SWRST = mask<std::uint16_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+            static constexpr auto DMAENABLE = mask<std::uint16_t>( Size::DMAENABLE, Bit::DMAENABLE ); ///< DMAENABLE.
+            static constexpr auto CRCENABLE = mask<std::uint16_t>( Size::CRCENABLE, Bit::CRCENABLE ); ///< CRCENABLE.
+            static constexpr auto RESERVED3 = mask<std::uint16_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+            static constexpr auto LVLEN0 = mask<std::uint16_t>( Size::LVLEN0, Bit::LVLEN0 ); ///< LVLEN0.
+            static constexpr auto LVLEN1 = mask<std::uint16_t>( Size::LVLEN1, Bit::LVLEN1 ); ///< LVLEN1.
+            static constexpr auto LVLEN2 = mask<std::uint16_t>( Size::LVLEN2, Bit::LVLEN2 ); ///< LVLEN2.
+            static constexpr auto LVLEN3 = mask<std::uint16_t>( Size::LVLEN3, Bit::LVLEN3 ); ///< LVLEN3.
+            static constexpr auto RESERVED12 = mask<std::uint16_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+        };
+
+        CTRL() = delete;
+
+        CTRL( CTRL && ) = delete;
+
+        CTRL( CTRL const & ) = delete;
+
+        ~CTRL() = delete;
+
+        auto operator=( CTRL && ) = delete;
+
+        auto operator=( CTRL const & ) = delete;
+
+        using Register<std::uint16_t>::operator=;
+    };
+
+    /**
+     * \brief CRC Control (CRCCTRL) register.
+     *
+     * This register has the following fields:
+     * - CRC Beat Size (CRCBEATSIZE)
+     * - CRC Polynomial Type (CRCPOLY)
+     * - CRC Input Source (CRCSRC)
+     */
+    class CRCCTRL : public Register<std::uint16_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto CRCBEATSIZE = std::uint_fast8_t{ 2 }; ///< CRCBEATSIZE.
+            static constexpr auto CRCPOLY     = std::uint_fast8_t{ 2 }; ///< CRCPOLY.
+            static constexpr auto RESERVED4   = std::uint_fast8_t{ 4 }; ///< RESERVED4.
+            static constexpr auto CRCSRC      = std::uint_fast8_t{ 6 }; ///< CRCSRC.
+            static constexpr auto RESERVED14  = std::uint_fast8_t{ 2 }; ///< RESERVED14.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto CRCBEATSIZE = std::uint_fast8_t{}; ///< CRCBEATSIZE.
+            static constexpr auto CRCPOLY = std::uint_fast8_t{ CRCBEATSIZE + Size::CRCBEATSIZE }; ///< CRCPOLY.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ CRCPOLY + Size::CRCPOLY }; ///< RESERVED4.
+            static constexpr auto CRCSRC = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< CRCSRC.
+            static constexpr auto RESERVED14 = std::uint_fast8_t{ CRCSRC + Size::CRCSRC }; ///< RESERVED14.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto CRCBEATSIZE = mask<std::uint16_t>( Size::CRCBEATSIZE, Bit::CRCBEATSIZE ); ///< CRCBEATSIZE.
+            static constexpr auto CRCPOLY = mask<std::uint16_t>( Size::CRCPOLY, Bit::CRCPOLY ); ///< CRCPOLY.
+            static constexpr auto RESERVED4 = mask<std::uint16_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto CRCSRC = mask<std::uint16_t>( Size::CRCSRC, Bit::CRCSRC ); ///< CRCSRC.
+            static constexpr auto RESERVED14 = mask<std::uint16_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+        };
+
+        /**
+         * \brief CRCBEATSIZE.
+         */
+        enum CRCBEATSIZE : std::uint16_t {
+            CRCBEATSIZE_BYTE  = 0x0 << Bit::CRCBEATSIZE, ///< 8-bit bus transfer.
+            CRCBEATSIZE_HWORD = 0x1 << Bit::CRCBEATSIZE, ///< 16-bit bus transfer.
+            CRCBEATSIZE_WORD  = 0x2 << Bit::CRCBEATSIZE, ///< 32-bit bus transfer.
+        };
+
+        /**
+         * \brief CRCPOLY.
+         */
+        enum CRCPOLY : std::uint16_t {
+            CRCPOLY_CRC16 = 0x0 << Bit::CRCPOLY, ///< CRC-16 (CRC-CCITT).
+            CRCPOLY_CRC32 = 0x1 << Bit::CRCPOLY, ///< CRC32 (IEEE 802.3).
+        };
+
+        /**
+         * \brief CRCSRC.
+         */
+        enum CRCSRC : std::uint16_t {
+            CRCSRC_NOACT = 0x00 << Bit::CRCSRC, ///< No action.
+            CRCSRC_IO    = 0x01 << Bit::CRCSRC, ///< I/O interface.
+        };
+
+        CRCCTRL() = delete;
+
+        CRCCTRL( CRCCTRL && ) = delete;
+
+        CRCCTRL( CRCCTRL const & ) = delete;
+
+        ~CRCCTRL() = delete;
+
+        auto operator=( CRCCTRL && ) = delete;
+
+        auto operator=( CRCCTRL const & ) = delete;
+
+        using Register<std::uint16_t>::operator=;
+    };
+
+    /**
+     * \brief CRC Status (CRCSTATUS) register.
+     *
+     * This register has the following fields:
+     * - CRC Module Busy (CRCBUSY)
+     * - CRC Zero (CRCZERO)
+     */
+    class CRCSTATUS : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto CRCBUSY   = std::uint_fast8_t{ 1 }; ///< CRCBUSY.
+            static constexpr auto CRCZERO   = std::uint_fast8_t{ 1 }; ///< CRCZERO.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ 6 }; ///< RESERVED2.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto CRCBUSY = std::uint_fast8_t{}; ///< CRCBUSY.
+            static constexpr auto CRCZERO = std::uint_fast8_t{ CRCBUSY + Size::CRCBUSY }; ///< CRCZERO.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ CRCZERO + Size::CRCZERO }; ///< RESERVED2.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto CRCBUSY = mask<std::uint8_t>( Size::CRCBUSY, Bit::CRCBUSY ); ///< CRCBUSY.
+            static constexpr auto CRCZERO = mask<std::uint8_t>( Size::CRCZERO, Bit::CRCZERO ); ///< CRCZERO.
+            static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+        };
+
+        CRCSTATUS() = delete;
+
+        CRCSTATUS( CRCSTATUS && ) = delete;
+
+        CRCSTATUS( CRCSTATUS const & ) = delete;
+
+        ~CRCSTATUS() = delete;
+
+        auto operator=( CRCSTATUS && ) = delete;
+
+        auto operator=( CRCSTATUS const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Debug Control (DBGCTRL) register.
+     *
+     * This register has the following fields:
+     * - Debug Run (DBGRUN)
+     */
+    class DBGCTRL : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto DBGRUN    = std::uint_fast8_t{ 1 }; ///< DBGRUN.
+            static constexpr auto RESERVED1 = std::uint_fast8_t{ 7 }; ///< RESERVED1.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto DBGRUN = std::uint_fast8_t{}; ///< DBGRUN.
+            static constexpr auto RESERVED1 = std::uint_fast8_t{ DBGRUN + Size::DBGRUN }; ///< RESERVED1.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto DBGRUN = mask<std::uint8_t>( Size::DBGRUN, Bit::DBGRUN ); ///< DBGRUN.
+            static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+        };
+
+        DBGCTRL() = delete;
+
+        DBGCTRL( DBGCTRL && ) = delete;
+
+        DBGCTRL( DBGCTRL const & ) = delete;
+
+        ~DBGCTRL() = delete;
+
+        auto operator=( DBGCTRL && ) = delete;
+
+        auto operator=( DBGCTRL const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Quality of Service Control (QOSCTRL) register.
+     *
+     * This register has the following fields:
+     * - Write-Back Quality of Service (WRBQOS)
+     * - Fetch Quality of Service (FQOS)
+     * - Data Transfer Quality of Service (DQOS)
+     */
+    class QOSCTRL : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto WRBQOS    = std::uint_fast8_t{ 2 }; ///< WRBQOS.
+            static constexpr auto FQOS      = std::uint_fast8_t{ 2 }; ///< FQOS.
+            static constexpr auto DQOS      = std::uint_fast8_t{ 2 }; ///< DQOS.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto WRBQOS = std::uint_fast8_t{}; ///< WRBQOS.
+            static constexpr auto FQOS = std::uint_fast8_t{ WRBQOS + Size::WRBQOS }; ///< FQOS.
+            static constexpr auto DQOS = std::uint_fast8_t{ FQOS + Size::FQOS }; ///< DQOS.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ DQOS + Size::DQOS }; ///< RESERVED6.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto WRBQOS = mask<std::uint8_t>( Size::WRBQOS, Bit::WRBQOS ); ///< WRBQOS.
+            static constexpr auto FQOS = mask<std::uint8_t>( Size::FQOS, Bit::FQOS ); ///< FQOS.
+            static constexpr auto DQOS = mask<std::uint8_t>( Size::DQOS, Bit::DQOS ); ///< DQOS.
+            static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+        };
+
+        /**
+         * \brief WRBQOS.
+         */
+        enum WRBQOS : std::uint8_t {
+            WRBQOS_DISABLE = 0x0 << Bit::WRBQOS, ///< Background (no sensitive operation).
+            WRBQOS_LOW     = 0x1 << Bit::WRBQOS, ///< Sensitive bandwidth.
+            WRBQOS_MEDIUM  = 0x2 << Bit::WRBQOS, ///< Sensitive latency.
+            WRBQOS_HIGH    = 0x3 << Bit::WRBQOS, ///< Critical latency.
+        };
+
+        /**
+         * \brief FQOS.
+         */
+        enum FQOS : std::uint8_t {
+            FQOS_DISABLE = 0x0 << Bit::FQOS, ///< Background (no sensitive operation).
+            FQOS_LOW     = 0x1 << Bit::FQOS, ///< Sensitive bandwidth.
+            FQOS_MEDIUM  = 0x2 << Bit::FQOS, ///< Sensitive latency.
+            FQOS_HIGH    = 0x3 << Bit::FQOS, ///< Critical latency.
+        };
+
+        /**
+         * \brief DQOS.
+         */
+        enum DQOS : std::uint8_t {
+            DQOS_DISABLE = 0x0 << Bit::DQOS, ///< Background (no sensitive operation).
+            DQOS_LOW     = 0x1 << Bit::DQOS, ///< Sensitive bandwidth.
+            DQOS_MEDIUM  = 0x2 << Bit::DQOS, ///< Sensitive latency.
+            DQOS_HIGH    = 0x3 << Bit::DQOS, ///< Critical latency.
+        };
+
+        QOSCTRL() = delete;
+
+        QOSCTRL( QOSCTRL && ) = delete;
+
+        QOSCTRL( QOSCTRL const & ) = delete;
+
+        ~QOSCTRL() = delete;
+
+        auto operator=( QOSCTRL && ) = delete;
+
+        auto operator=( QOSCTRL const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Software Trigger Control (SWTRIGCTRL) register.
+     *
+     * This register has the following fields:
+     * - Channel Software Trigger 0 (SWTRIG0)
+     * - Channel Software Trigger 1 (SWTRIG1)
+     * - Channel Software Trigger 2 (SWTRIG2)
+     * - Channel Software Trigger 3 (SWTRIG3)
+     * - Channel Software Trigger 4 (SWTRIG4)
+     * - Channel Software Trigger 5 (SWTRIG5)
+     * - Channel Software Trigger 6 (SWTRIG6)
+     * - Channel Software Trigger 7 (SWTRIG7)
+     * - Channel Software Trigger 8 (SWTRIG8)
+     * - Channel Software Trigger 9 (SWTRIG9)
+     * - Channel Software Trigger 10 (SWTRIG10)
+     * - Channel Software Trigger 11 (SWTRIG11)
+     */
+    class SWTRIGCTRL : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SWTRIG0    = std::uint_fast8_t{ 1 };  ///< SWTRIG0.
+            static constexpr auto SWTRIG1    = std::uint_fast8_t{ 1 };  ///< SWTRIG1.
+            static constexpr auto SWTRIG2    = std::uint_fast8_t{ 1 };  ///< SWTRIG2.
+            static constexpr auto SWTRIG3    = std::uint_fast8_t{ 1 };  ///< SWTRIG3.
+            static constexpr auto SWTRIG4    = std::uint_fast8_t{ 1 };  ///< SWTRIG4.
+            static constexpr auto SWTRIG5    = std::uint_fast8_t{ 1 };  ///< SWTRIG5.
+            static constexpr auto SWTRIG6    = std::uint_fast8_t{ 1 };  ///< SWTRIG6.
+            static constexpr auto SWTRIG7    = std::uint_fast8_t{ 1 };  ///< SWTRIG7.
+            static constexpr auto SWTRIG8    = std::uint_fast8_t{ 1 };  ///< SWTRIG8.
+            static constexpr auto SWTRIG9    = std::uint_fast8_t{ 1 };  ///< SWTRIG9.
+            static constexpr auto SWTRIG10   = std::uint_fast8_t{ 1 };  ///< SWTRIG10.
+            static constexpr auto SWTRIG11   = std::uint_fast8_t{ 1 };  ///< SWTRIG11.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 20 }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SWTRIG0 = std::uint_fast8_t{}; ///< SWTRIG0.
+            static constexpr auto SWTRIG1 = std::uint_fast8_t{ SWTRIG0 + Size::SWTRIG0 }; ///< SWTRIG1.
+            static constexpr auto SWTRIG2 = std::uint_fast8_t{ SWTRIG1 + Size::SWTRIG1 }; ///< SWTRIG2.
+            static constexpr auto SWTRIG3 = std::uint_fast8_t{ SWTRIG2 + Size::SWTRIG2 }; ///< SWTRIG3.
+            static constexpr auto SWTRIG4 = std::uint_fast8_t{ SWTRIG3 + Size::SWTRIG3 }; ///< SWTRIG4.
+            static constexpr auto SWTRIG5 = std::uint_fast8_t{ SWTRIG4 + Size::SWTRIG4 }; ///< SWTRIG5.
+            static constexpr auto SWTRIG6 = std::uint_fast8_t{ SWTRIG5 + Size::SWTRIG5 }; ///< SWTRIG6.
+            static constexpr auto SWTRIG7 = std::uint_fast8_t{ SWTRIG6 + Size::SWTRIG6 }; ///< SWTRIG7.
+            static constexpr auto SWTRIG8 = std::uint_fast8_t{ SWTRIG7 + Size::SWTRIG7 }; ///< SWTRIG8.
+            static constexpr auto SWTRIG9 = std::uint_fast8_t{ SWTRIG8 + Size::SWTRIG8 }; ///< SWTRIG9.
+            static constexpr auto SWTRIG10 = std::uint_fast8_t{ SWTRIG9 + Size::SWTRIG9 }; ///< SWTRIG10.
+            static constexpr auto SWTRIG11 = std::uint_fast8_t{ SWTRIG10 + Size::SWTRIG10 }; ///< SWTRIG11.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ SWTRIG11 + Size::SWTRIG11 }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SWTRIG0 = mask<std::uint32_t>( Size::SWTRIG0, Bit::SWTRIG0 ); ///< SWTRIG0.
+            static constexpr auto SWTRIG1 = mask<std::uint32_t>( Size::SWTRIG1, Bit::SWTRIG1 ); ///< SWTRIG1.
+            static constexpr auto SWTRIG2 = mask<std::uint32_t>( Size::SWTRIG2, Bit::SWTRIG2 ); ///< SWTRIG2.
+            static constexpr auto SWTRIG3 = mask<std::uint32_t>( Size::SWTRIG3, Bit::SWTRIG3 ); ///< SWTRIG3.
+            static constexpr auto SWTRIG4 = mask<std::uint32_t>( Size::SWTRIG4, Bit::SWTRIG4 ); ///< SWTRIG4.
+            static constexpr auto SWTRIG5 = mask<std::uint32_t>( Size::SWTRIG5, Bit::SWTRIG5 ); ///< SWTRIG5.
+            static constexpr auto SWTRIG6 = mask<std::uint32_t>( Size::SWTRIG6, Bit::SWTRIG6 ); ///< SWTRIG6.
+            static constexpr auto SWTRIG7 = mask<std::uint32_t>( Size::SWTRIG7, Bit::SWTRIG7 ); ///< SWTRIG7.
+            static constexpr auto SWTRIG8 = mask<std::uint32_t>( Size::SWTRIG8, Bit::SWTRIG8 ); ///< SWTRIG8.
+            static constexpr auto SWTRIG9 = mask<std::uint32_t>( Size::SWTRIG9, Bit::SWTRIG9 ); ///< SWTRIG9.
+            static constexpr auto SWTRIG10 = mask<std::uint32_t>( Size::SWTRIG10, Bit::SWTRIG10 ); ///< SWTRIG10.
+            static constexpr auto SWTRIG11 = mask<std::uint32_t>( Size::SWTRIG11, Bit::SWTRIG11 ); ///< SWTRIG11.
+            static constexpr auto RESERVED12 = mask<std::uint32_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+        };
+
+        SWTRIGCTRL() = delete;
+
+        SWTRIGCTRL( SWTRIGCTRL && ) = delete;
+
+        SWTRIGCTRL( SWTRIGCTRL const & ) = delete;
+
+        ~SWTRIGCTRL() = delete;
+
+        auto operator=( SWTRIGCTRL && ) = delete;
+
+        auto operator=( SWTRIGCTRL const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Priority Control 0 (PRICTRL0) register.
+     *
+     * This register has the following fields:
+     * - Level 0 Channel Priority Number (LVLPRI0)
+     * - Level 0 Round-Robin Scheduling Enable (RRLVLEN0)
+     * - Level 1 Channel Priority Number (LVLPRI1)
+     * - Level 1 Round-Robin Scheduling Enable (RRLVLEN1)
+     * - Level 2 Channel Priority Number (LVLPRI2)
+     * - Level 2 Round-Robin Scheduling Enable (RRLVLEN2)
+     * - Level 3 Channel Priority Number (LVLPRI3)
+     * - Level 3 Round-Robin Scheduling Enable (RRLVLEN3)
+     */
+    class PRICTRL0 : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto LVLPRI0    = std::uint_fast8_t{ 4 }; ///< LVLPRI0.
+            static constexpr auto RESERVED4  = std::uint_fast8_t{ 3 }; ///< RESERVED4.
+            static constexpr auto RRLVLEN0   = std::uint_fast8_t{ 1 }; ///< RRLVLEN0.
+            static constexpr auto LVLPRI1    = std::uint_fast8_t{ 4 }; ///< LVLPRI1.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 3 }; ///< RESERVED12.
+            static constexpr auto RRLVLEN1   = std::uint_fast8_t{ 1 }; ///< RRLVLEN1.
+            static constexpr auto LVLPRI2    = std::uint_fast8_t{ 4 }; ///< LVLPRI2.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 3 }; ///< RESERVED20.
+            static constexpr auto RRLVLEN2   = std::uint_fast8_t{ 1 }; ///< RRLVLEN2.
+            static constexpr auto LVLPRI3    = std::uint_fast8_t{ 4 }; ///< LVLPRI3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 3 }; ///< RESERVED28.
+            static constexpr auto RRLVLEN3   = std::uint_fast8_t{ 1 }; ///< RRLVLEN3.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto LVLPRI0 = std::uint_fast8_t{}; ///< LVLPRI0.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ LVLPRI0 + Size::LVLPRI0 }; ///< RESERVED4.
+            static constexpr auto RRLVLEN0 = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< RRLVLEN0.
+            static constexpr auto LVLPRI1 = std::uint_fast8_t{ RRLVLEN0 + Size::RRLVLEN0 }; ///< LVLPRI1.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ LVLPRI1 + Size::LVLPRI1 }; ///< RESERVED12.
+            static constexpr auto RRLVLEN1 = std::uint_fast8_t{ RESERVED12 + Size::RESERVED12 }; ///< RRLVLEN1.
+            static constexpr auto LVLPRI2 = std::uint_fast8_t{ RRLVLEN1 + Size::RRLVLEN1 }; ///< LVLPRI2.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ LVLPRI2 + Size::LVLPRI2 }; ///< RESERVED20.
+            static constexpr auto RRLVLEN2 = std::uint_fast8_t{ RESERVED20 + Size::RESERVED20 }; ///< RRLVLEN2.
+            static constexpr auto LVLPRI3 = std::uint_fast8_t{ RRLVLEN2 + Size::RRLVLEN2 }; ///< LVLPRI3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ LVLPRI3 + Size::LVLPRI3 }; ///< RESERVED28.
+            static constexpr auto RRLVLEN3 = std::uint_fast8_t{ RESERVED28 + Size::RESERVED28 }; ///< RRLVLEN3.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto LVLPRI0 = mask<std::uint32_t>( Size::LVLPRI0, Bit::LVLPRI0 ); ///< LVLPRI0.
+            static constexpr auto RESERVED4 = mask<std::uint32_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto RRLVLEN0 = mask<std::uint32_t>( Size::RRLVLEN0, Bit::RRLVLEN0 ); ///< RRLVLEN0.
+            static constexpr auto LVLPRI1 = mask<std::uint32_t>( Size::LVLPRI1, Bit::LVLPRI1 ); ///< LVLPRI1.
+            static constexpr auto RESERVED12 = mask<std::uint32_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+            static constexpr auto RRLVLEN1 = mask<std::uint32_t>( Size::RRLVLEN1, Bit::RRLVLEN1 ); ///< RRLVLEN1.
+            static constexpr auto LVLPRI2 = mask<std::uint32_t>( Size::LVLPRI2, Bit::LVLPRI2 ); ///< LVLPRI2.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+            static constexpr auto RRLVLEN2 = mask<std::uint32_t>( Size::RRLVLEN2, Bit::RRLVLEN2 ); ///< RRLVLEN2.
+            static constexpr auto LVLPRI3 = mask<std::uint32_t>( Size::LVLPRI3, Bit::LVLPRI3 ); ///< LVLPRI3.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+            static constexpr auto RRLVLEN3 = mask<std::uint32_t>( Size::RRLVLEN3, Bit::RRLVLEN3 ); ///< RRLVLEN3.
+        };
+
+        PRICTRL0() = delete;
+
+        PRICTRL0( PRICTRL0 && ) = delete;
+
+        PRICTRL0( PRICTRL0 const & ) = delete;
+
+        ~PRICTRL0() = delete;
+
+        auto operator=( PRICTRL0 && ) = delete;
+
+        auto operator=( PRICTRL0 const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Pending (INTPEND) register.
+     *
+     * This register has the following fields:
+     * - Channel ID (ID)
+     * - Transfer Error (TERR)
+     * - Transfer Complete (TCMPL)
+     * - Channel Suspend (SUSP)
+     * - Fetch Error (FERR)
+     * - Busy (BUSY)
+     * - Pending (PEND)
+     */
+    class INTPEND : public Register<std::uint16_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto ID         = std::uint_fast8_t{ 4 }; ///< ID.
+            static constexpr auto RESERVED4  = std::uint_fast8_t{ 4 }; ///< RESERVED4.
+            static constexpr auto TERR       = std::uint_fast8_t{ 1 }; ///< TERR.
+            static constexpr auto TCMPL      = std::uint_fast8_t{ 1 }; ///< TCMPL.
+            static constexpr auto SUSP       = std::uint_fast8_t{ 1 }; ///< SUSP.
+            static constexpr auto RESERVED11 = std::uint_fast8_t{ 2 }; ///< RESERVED11.
+            static constexpr auto FERR       = std::uint_fast8_t{ 1 }; ///< FERR.
+            static constexpr auto BUSY       = std::uint_fast8_t{ 1 }; ///< BUSY.
+            static constexpr auto PEND       = std::uint_fast8_t{ 1 }; ///< PEND.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto ID        = std::uint_fast8_t{};                ///< ID.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ ID + Size::ID }; ///< RESERVED4.
+            static constexpr auto TERR = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< TERR.
+            static constexpr auto TCMPL = std::uint_fast8_t{ TERR + Size::TERR }; ///< TCMPL.
+            static constexpr auto SUSP = std::uint_fast8_t{ TCMPL + Size::TCMPL }; ///< SUSP.
+            static constexpr auto RESERVED11 = std::uint_fast8_t{ SUSP + Size::SUSP }; ///< RESERVED11.
+            static constexpr auto FERR = std::uint_fast8_t{ RESERVED11 + Size::RESERVED11 }; ///< FERR.
+            static constexpr auto BUSY = std::uint_fast8_t{ FERR + Size::FERR }; ///< BUSY.
+            static constexpr auto PEND = std::uint_fast8_t{ BUSY + Size::BUSY }; ///< PEND.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto ID = mask<std::uint16_t>( Size::ID, Bit::ID ); ///< ID.
+            static constexpr auto RESERVED4 = mask<std::uint16_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto TERR = mask<std::uint16_t>( Size::TERR, Bit::TERR ); ///< TERR.
+            static constexpr auto TCMPL = mask<std::uint16_t>( Size::TCMPL, Bit::TCMPL ); ///< TCMPL.
+            static constexpr auto SUSP = mask<std::uint16_t>( Size::SUSP, Bit::SUSP ); ///< SUSP.
+            static constexpr auto RESERVED11 = mask<std::uint16_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+            static constexpr auto FERR = mask<std::uint16_t>( Size::FERR, Bit::FERR ); ///< FERR.
+            static constexpr auto BUSY = mask<std::uint16_t>( Size::BUSY, Bit::BUSY ); ///< BUSY.
+            static constexpr auto PEND = mask<std::uint16_t>( Size::PEND, Bit::PEND ); ///< PEND.
+        };
+
+        INTPEND() = delete;
+
+        INTPEND( INTPEND && ) = delete;
+
+        INTPEND( INTPEND const & ) = delete;
+
+        ~INTPEND() = delete;
+
+        auto operator=( INTPEND && ) = delete;
+
+        auto operator=( INTPEND const & ) = delete;
+
+        using Register<std::uint16_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Status (INTSTATUS) register.
+     *
+     * This register has the following fields:
+     * - Channel Interrupt Status 0 (CHINT0)
+     * - Channel Interrupt Status 1 (CHINT1)
+     * - Channel Interrupt Status 2 (CHINT2)
+     * - Channel Interrupt Status 3 (CHINT3)
+     * - Channel Interrupt Status 4 (CHINT4)
+     * - Channel Interrupt Status 5 (CHINT5)
+     * - Channel Interrupt Status 6 (CHINT6)
+     * - Channel Interrupt Status 7 (CHINT7)
+     * - Channel Interrupt Status 8 (CHINT8)
+     * - Channel Interrupt Status 9 (CHINT9)
+     * - Channel Interrupt Status 10 (CHINT10)
+     * - Channel Interrupt Status 11 (CHINT11)
+     */
+    class INTSTATUS : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto CHINT0     = std::uint_fast8_t{ 1 };  ///< CHINT0.
+            static constexpr auto CHINT1     = std::uint_fast8_t{ 1 };  ///< CHINT1.
+            static constexpr auto CHINT2     = std::uint_fast8_t{ 1 };  ///< CHINT2.
+            static constexpr auto CHINT3     = std::uint_fast8_t{ 1 };  ///< CHINT3.
+            static constexpr auto CHINT4     = std::uint_fast8_t{ 1 };  ///< CHINT4.
+            static constexpr auto CHINT5     = std::uint_fast8_t{ 1 };  ///< CHINT5.
+            static constexpr auto CHINT6     = std::uint_fast8_t{ 1 };  ///< CHINT6.
+            static constexpr auto CHINT7     = std::uint_fast8_t{ 1 };  ///< CHINT7.
+            static constexpr auto CHINT8     = std::uint_fast8_t{ 1 };  ///< CHINT8.
+            static constexpr auto CHINT9     = std::uint_fast8_t{ 1 };  ///< CHINT9.
+            static constexpr auto CHINT10    = std::uint_fast8_t{ 1 };  ///< CHINT10.
+            static constexpr auto CHINT11    = std::uint_fast8_t{ 1 };  ///< CHINT11.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 20 }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto CHINT0 = std::uint_fast8_t{}; ///< CHINT0.
+            static constexpr auto CHINT1 = std::uint_fast8_t{ CHINT0 + Size::CHINT0 }; ///< CHINT1.
+            static constexpr auto CHINT2 = std::uint_fast8_t{ CHINT1 + Size::CHINT1 }; ///< CHINT2.
+            static constexpr auto CHINT3 = std::uint_fast8_t{ CHINT2 + Size::CHINT2 }; ///< CHINT3.
+            static constexpr auto CHINT4 = std::uint_fast8_t{ CHINT3 + Size::CHINT3 }; ///< CHINT4.
+            static constexpr auto CHINT5 = std::uint_fast8_t{ CHINT4 + Size::CHINT4 }; ///< CHINT5.
+            static constexpr auto CHINT6 = std::uint_fast8_t{ CHINT5 + Size::CHINT5 }; ///< CHINT6.
+            static constexpr auto CHINT7 = std::uint_fast8_t{ CHINT6 + Size::CHINT6 }; ///< CHINT7.
+            static constexpr auto CHINT8 = std::uint_fast8_t{ CHINT7 + Size::CHINT7 }; ///< CHINT8.
+            static constexpr auto CHINT9 = std::uint_fast8_t{ CHINT8 + Size::CHINT8 }; ///< CHINT9.
+            static constexpr auto CHINT10 = std::uint_fast8_t{ CHINT9 + Size::CHINT9 }; ///< CHINT10.
+            static constexpr auto CHINT11 = std::uint_fast8_t{ CHINT10 + Size::CHINT10 }; ///< CHINT11.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ CHINT11 + Size::CHINT11 }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto CHINT0 = mask<std::uint32_t>( Size::CHINT0, Bit::CHINT0 ); ///< CHINT0.
+            static constexpr auto CHINT1 = mask<std::uint32_t>( Size::CHINT1, Bit::CHINT1 ); ///< CHINT1.
+            static constexpr auto CHINT2 = mask<std::uint32_t>( Size::CHINT2, Bit::CHINT2 ); ///< CHINT2.
+            static constexpr auto CHINT3 = mask<std::uint32_t>( Size::CHINT3, Bit::CHINT3 ); ///< CHINT3.
+            static constexpr auto CHINT4 = mask<std::uint32_t>( Size::CHINT4, Bit::CHINT4 ); ///< CHINT4.
+            static constexpr auto CHINT5 = mask<std::uint32_t>( Size::CHINT5, Bit::CHINT5 ); ///< CHINT5.
+            static constexpr auto CHINT6 = mask<std::uint32_t>( Size::CHINT6, Bit::CHINT6 ); ///< CHINT6.
+            static constexpr auto CHINT7 = mask<std::uint32_t>( Size::CHINT7, Bit::CHINT7 ); ///< CHINT7.
+            static constexpr auto CHINT8 = mask<std::uint32_t>( Size::CHINT8, Bit::CHINT8 ); ///< CHINT8.
+            static constexpr auto CHINT9 = mask<std::uint32_t>( Size::CHINT9, Bit::CHINT9 ); ///< CHINT9.
+            static constexpr auto CHINT10 = mask<std::uint32_t>( Size::CHINT10, Bit::CHINT10 ); ///< CHINT10.
+            static constexpr auto CHINT11 = mask<std::uint32_t>( Size::CHINT11, Bit::CHINT11 ); ///< CHINT11.
+            static constexpr auto RESERVED12 = mask<std::uint32_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+        };
+
+        INTSTATUS() = delete;
+
+        INTSTATUS( INTSTATUS && ) = delete;
+
+        INTSTATUS( INTSTATUS const & ) = delete;
+
+        ~INTSTATUS() = delete;
+
+        auto operator=( INTSTATUS && ) = delete;
+
+        auto operator=( INTSTATUS const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Busy Channels (BUSYCH) register.
+     *
+     * This register has the following fields:
+     * - Busy Channel 0 (BUSYCH0)
+     * - Busy Channel 1 (BUSYCH1)
+     * - Busy Channel 2 (BUSYCH2)
+     * - Busy Channel 3 (BUSYCH3)
+     * - Busy Channel 4 (BUSYCH4)
+     * - Busy Channel 5 (BUSYCH5)
+     * - Busy Channel 6 (BUSYCH6)
+     * - Busy Channel 7 (BUSYCH7)
+     * - Busy Channel 8 (BUSYCH8)
+     * - Busy Channel 9 (BUSYCH9)
+     * - Busy Channel 10 (BUSYCH10)
+     * - Busy Channel 11 (BUSYCH11)
+     */
+    class BUSYCH : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto BUSYCH0    = std::uint_fast8_t{ 1 };  ///< BUSYCH0.
+            static constexpr auto BUSYCH1    = std::uint_fast8_t{ 1 };  ///< BUSYCH1.
+            static constexpr auto BUSYCH2    = std::uint_fast8_t{ 1 };  ///< BUSYCH2.
+            static constexpr auto BUSYCH3    = std::uint_fast8_t{ 1 };  ///< BUSYCH3.
+            static constexpr auto BUSYCH4    = std::uint_fast8_t{ 1 };  ///< BUSYCH4.
+            static constexpr auto BUSYCH5    = std::uint_fast8_t{ 1 };  ///< BUSYCH5.
+            static constexpr auto BUSYCH6    = std::uint_fast8_t{ 1 };  ///< BUSYCH6.
+            static constexpr auto BUSYCH7    = std::uint_fast8_t{ 1 };  ///< BUSYCH7.
+            static constexpr auto BUSYCH8    = std::uint_fast8_t{ 1 };  ///< BUSYCH8.
+            static constexpr auto BUSYCH9    = std::uint_fast8_t{ 1 };  ///< BUSYCH9.
+            static constexpr auto BUSYCH10   = std::uint_fast8_t{ 1 };  ///< BUSYCH10.
+            static constexpr auto BUSYCH11   = std::uint_fast8_t{ 1 };  ///< BUSYCH11.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 20 }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto BUSYCH0 = std::uint_fast8_t{}; ///< BUSYCH0.
+            static constexpr auto BUSYCH1 = std::uint_fast8_t{ BUSYCH0 + Size::BUSYCH0 }; ///< BUSYCH1.
+            static constexpr auto BUSYCH2 = std::uint_fast8_t{ BUSYCH1 + Size::BUSYCH1 }; ///< BUSYCH2.
+            static constexpr auto BUSYCH3 = std::uint_fast8_t{ BUSYCH2 + Size::BUSYCH2 }; ///< BUSYCH3.
+            static constexpr auto BUSYCH4 = std::uint_fast8_t{ BUSYCH3 + Size::BUSYCH3 }; ///< BUSYCH4.
+            static constexpr auto BUSYCH5 = std::uint_fast8_t{ BUSYCH4 + Size::BUSYCH4 }; ///< BUSYCH5.
+            static constexpr auto BUSYCH6 = std::uint_fast8_t{ BUSYCH5 + Size::BUSYCH5 }; ///< BUSYCH6.
+            static constexpr auto BUSYCH7 = std::uint_fast8_t{ BUSYCH6 + Size::BUSYCH6 }; ///< BUSYCH7.
+            static constexpr auto BUSYCH8 = std::uint_fast8_t{ BUSYCH7 + Size::BUSYCH7 }; ///< BUSYCH8.
+            static constexpr auto BUSYCH9 = std::uint_fast8_t{ BUSYCH8 + Size::BUSYCH8 }; ///< BUSYCH9.
+            static constexpr auto BUSYCH10 = std::uint_fast8_t{ BUSYCH9 + Size::BUSYCH9 }; ///< BUSYCH10.
+            static constexpr auto BUSYCH11 = std::uint_fast8_t{ BUSYCH10 + Size::BUSYCH10 }; ///< BUSYCH11.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ BUSYCH11 + Size::BUSYCH11 }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto BUSYCH0 = mask<std::uint32_t>( Size::BUSYCH0, Bit::BUSYCH0 ); ///< BUSYCH0.
+            static constexpr auto BUSYCH1 = mask<std::uint32_t>( Size::BUSYCH1, Bit::BUSYCH1 ); ///< BUSYCH1.
+            static constexpr auto BUSYCH2 = mask<std::uint32_t>( Size::BUSYCH2, Bit::BUSYCH2 ); ///< BUSYCH2.
+            static constexpr auto BUSYCH3 = mask<std::uint32_t>( Size::BUSYCH3, Bit::BUSYCH3 ); ///< BUSYCH3.
+            static constexpr auto BUSYCH4 = mask<std::uint32_t>( Size::BUSYCH4, Bit::BUSYCH4 ); ///< BUSYCH4.
+            static constexpr auto BUSYCH5 = mask<std::uint32_t>( Size::BUSYCH5, Bit::BUSYCH5 ); ///< BUSYCH5.
+            static constexpr auto BUSYCH6 = mask<std::uint32_t>( Size::BUSYCH6, Bit::BUSYCH6 ); ///< BUSYCH6.
+            static constexpr auto BUSYCH7 = mask<std::uint32_t>( Size::BUSYCH7, Bit::BUSYCH7 ); ///< BUSYCH7.
+            static constexpr auto BUSYCH8 = mask<std::uint32_t>( Size::BUSYCH8, Bit::BUSYCH8 ); ///< BUSYCH8.
+            static constexpr auto BUSYCH9 = mask<std::uint32_t>( Size::BUSYCH9, Bit::BUSYCH9 ); ///< BUSYCH9.
+            static constexpr auto BUSYCH10 = mask<std::uint32_t>( Size::BUSYCH10, Bit::BUSYCH10 ); ///< BUSYCH10.
+            static constexpr auto BUSYCH11 = mask<std::uint32_t>( Size::BUSYCH11, Bit::BUSYCH11 ); ///< BUSYCH11.
+            static constexpr auto RESERVED12 = mask<std::uint32_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+        };
+
+        BUSYCH() = delete;
+
+        BUSYCH( BUSYCH && ) = delete;
+
+        BUSYCH( BUSYCH const & ) = delete;
+
+        ~BUSYCH() = delete;
+
+        auto operator=( BUSYCH && ) = delete;
+
+        auto operator=( BUSYCH const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Pending Channels (PENDCH) register.
+     *
+     * This register has the following fields:
+     * - Pending Channel 0 (PENDCH0)
+     * - Pending Channel 1 (PENDCH1)
+     * - Pending Channel 2 (PENDCH2)
+     * - Pending Channel 3 (PENDCH3)
+     * - Pending Channel 4 (PENDCH4)
+     * - Pending Channel 5 (PENDCH5)
+     * - Pending Channel 6 (PENDCH6)
+     * - Pending Channel 7 (PENDCH7)
+     * - Pending Channel 8 (PENDCH8)
+     * - Pending Channel 9 (PENDCH9)
+     * - Pending Channel 10 (PENDCH10)
+     * - Pending Channel 11 (PENDCH11)
+     */
+    class PENDCH : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto PENDCH0    = std::uint_fast8_t{ 1 };  ///< PENDCH0.
+            static constexpr auto PENDCH1    = std::uint_fast8_t{ 1 };  ///< PENDCH1.
+            static constexpr auto PENDCH2    = std::uint_fast8_t{ 1 };  ///< PENDCH2.
+            static constexpr auto PENDCH3    = std::uint_fast8_t{ 1 };  ///< PENDCH3.
+            static constexpr auto PENDCH4    = std::uint_fast8_t{ 1 };  ///< PENDCH4.
+            static constexpr auto PENDCH5    = std::uint_fast8_t{ 1 };  ///< PENDCH5.
+            static constexpr auto PENDCH6    = std::uint_fast8_t{ 1 };  ///< PENDCH6.
+            static constexpr auto PENDCH7    = std::uint_fast8_t{ 1 };  ///< PENDCH7.
+            static constexpr auto PENDCH8    = std::uint_fast8_t{ 1 };  ///< PENDCH8.
+            static constexpr auto PENDCH9    = std::uint_fast8_t{ 1 };  ///< PENDCH9.
+            static constexpr auto PENDCH10   = std::uint_fast8_t{ 1 };  ///< PENDCH10.
+            static constexpr auto PENDCH11   = std::uint_fast8_t{ 1 };  ///< PENDCH11.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 20 }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto PENDCH0 = std::uint_fast8_t{}; ///< PENDCH0.
+            static constexpr auto PENDCH1 = std::uint_fast8_t{ PENDCH0 + Size::PENDCH0 }; ///< PENDCH1.
+            static constexpr auto PENDCH2 = std::uint_fast8_t{ PENDCH1 + Size::PENDCH1 }; ///< PENDCH2.
+            static constexpr auto PENDCH3 = std::uint_fast8_t{ PENDCH2 + Size::PENDCH2 }; ///< PENDCH3.
+            static constexpr auto PENDCH4 = std::uint_fast8_t{ PENDCH3 + Size::PENDCH3 }; ///< PENDCH4.
+            static constexpr auto PENDCH5 = std::uint_fast8_t{ PENDCH4 + Size::PENDCH4 }; ///< PENDCH5.
+            static constexpr auto PENDCH6 = std::uint_fast8_t{ PENDCH5 + Size::PENDCH5 }; ///< PENDCH6.
+            static constexpr auto PENDCH7 = std::uint_fast8_t{ PENDCH6 + Size::PENDCH6 }; ///< PENDCH7.
+            static constexpr auto PENDCH8 = std::uint_fast8_t{ PENDCH7 + Size::PENDCH7 }; ///< PENDCH8.
+            static constexpr auto PENDCH9 = std::uint_fast8_t{ PENDCH8 + Size::PENDCH8 }; ///< PENDCH9.
+            static constexpr auto PENDCH10 = std::uint_fast8_t{ PENDCH9 + Size::PENDCH9 }; ///< PENDCH10.
+            static constexpr auto PENDCH11 = std::uint_fast8_t{ PENDCH10 + Size::PENDCH10 }; ///< PENDCH11.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ PENDCH11 + Size::PENDCH11 }; ///< RESERVED12.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto PENDCH0 = mask<std::uint32_t>( Size::PENDCH0, Bit::PENDCH0 ); ///< PENDCH0.
+            static constexpr auto PENDCH1 = mask<std::uint32_t>( Size::PENDCH1, Bit::PENDCH1 ); ///< PENDCH1.
+            static constexpr auto PENDCH2 = mask<std::uint32_t>( Size::PENDCH2, Bit::PENDCH2 ); ///< PENDCH2.
+            static constexpr auto PENDCH3 = mask<std::uint32_t>( Size::PENDCH3, Bit::PENDCH3 ); ///< PENDCH3.
+            static constexpr auto PENDCH4 = mask<std::uint32_t>( Size::PENDCH4, Bit::PENDCH4 ); ///< PENDCH4.
+            static constexpr auto PENDCH5 = mask<std::uint32_t>( Size::PENDCH5, Bit::PENDCH5 ); ///< PENDCH5.
+            static constexpr auto PENDCH6 = mask<std::uint32_t>( Size::PENDCH6, Bit::PENDCH6 ); ///< PENDCH6.
+            static constexpr auto PENDCH7 = mask<std::uint32_t>( Size::PENDCH7, Bit::PENDCH7 ); ///< PENDCH7.
+            static constexpr auto PENDCH8 = mask<std::uint32_t>( Size::PENDCH8, Bit::PENDCH8 ); ///< PENDCH8.
+            static constexpr auto PENDCH9 = mask<std::uint32_t>( Size::PENDCH9, Bit::PENDCH9 ); ///< PENDCH9.
+            static constexpr auto PENDCH10 = mask<std::uint32_t>( Size::PENDCH10, Bit::PENDCH10 ); ///< PENDCH10.
+            static constexpr auto PENDCH11 = mask<std::uint32_t>( Size::PENDCH11, Bit::PENDCH11 ); ///< PENDCH11.
+            static constexpr auto RESERVED12 = mask<std::uint32_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+        };
+
+        PENDCH() = delete;
+
+        PENDCH( PENDCH && ) = delete;
+
+        PENDCH( PENDCH const & ) = delete;
+
+        ~PENDCH() = delete;
+
+        auto operator=( PENDCH && ) = delete;
+
+        auto operator=( PENDCH const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Active Channel and Levels (ACTIVE) register.
+     *
+     * This register has the following fields:
+     * - Level 0 Channel Trigger Request Executing (LVLEX0)
+     * - Level 1 Channel Trigger Request Executing (LVLEX1)
+     * - Level 2 Channel Trigger Request Executing (LVLEX2)
+     * - Level 3 Channel Trigger Request Executing (LVLEX3)
+     * - Active Channel ID (ID)
+     * - Active Channel Busy (ABUSY)
+     * - Active Channel Block Transfer Count (BTCNT)
+     */
+    class ACTIVE : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto LVLEX0     = std::uint_fast8_t{ 1 };  ///< LVLEX0.
+            static constexpr auto LVLEX1     = std::uint_fast8_t{ 1 };  ///< LVLEX1.
+            static constexpr auto LVLEX2     = std::uint_fast8_t{ 1 };  ///< LVLEX2.
+            static constexpr auto LVLEX3     = std::uint_fast8_t{ 1 };  ///< LVLEX3.
+            static constexpr auto RESERVED4  = std::uint_fast8_t{ 4 };  ///< RESERVED4.
+            static constexpr auto ID         = std::uint_fast8_t{ 5 };  ///< ID.
+            static constexpr auto RESERVED13 = std::uint_fast8_t{ 2 };  ///< RESERVED13.
+            static constexpr auto ABUSY      = std::uint_fast8_t{ 1 };  ///< ABUSY.
+            static constexpr auto BTCNT      = std::uint_fast8_t{ 16 }; ///< BTCNT.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto LVLEX0 = std::uint_fast8_t{}; ///< LVLEX0.
+            static constexpr auto LVLEX1 = std::uint_fast8_t{ LVLEX0 + Size::LVLEX0 }; ///< LVLEX1.
+            static constexpr auto LVLEX2 = std::uint_fast8_t{ LVLEX1 + Size::LVLEX1 }; ///< LVLEX2.
+            static constexpr auto LVLEX3 = std::uint_fast8_t{ LVLEX2 + Size::LVLEX2 }; ///< LVLEX3.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ LVLEX3 + Size::LVLEX3 }; ///< RESERVED4.
+            static constexpr auto ID = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< ID.
+            static constexpr auto RESERVED13 = std::uint_fast8_t{ ID + Size::ID }; ///< RESERVED13.
+            static constexpr auto ABUSY = std::uint_fast8_t{ RESERVED13 + Size::RESERVED13 }; ///< ABUSY.
+            static constexpr auto BTCNT = std::uint_fast8_t{ ABUSY + Size::ABUSY }; ///< BTCNT.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto LVLEX0 = mask<std::uint32_t>( Size::LVLEX0, Bit::LVLEX0 ); ///< LVLEX0.
+            static constexpr auto LVLEX1 = mask<std::uint32_t>( Size::LVLEX1, Bit::LVLEX1 ); ///< LVLEX1.
+            static constexpr auto LVLEX2 = mask<std::uint32_t>( Size::LVLEX2, Bit::LVLEX2 ); ///< LVLEX2.
+            static constexpr auto LVLEX3 = mask<std::uint32_t>( Size::LVLEX3, Bit::LVLEX3 ); ///< LVLEX3.
+            static constexpr auto RESERVED4 = mask<std::uint32_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto ID = mask<std::uint32_t>( Size::ID, Bit::ID ); ///< ID.
+            static constexpr auto RESERVED13 = mask<std::uint32_t>( Size::RESERVED13, Bit::RESERVED13 ); ///< RESERVED13.
+            static constexpr auto ABUSY = mask<std::uint32_t>( Size::ABUSY, Bit::ABUSY ); ///< ABUSY.
+            static constexpr auto BTCNT = mask<std::uint32_t>( Size::BTCNT, Bit::BTCNT ); ///< BTCNT.
+        };
+
+        ACTIVE() = delete;
+
+        ACTIVE( ACTIVE && ) = delete;
+
+        ACTIVE( ACTIVE const & ) = delete;
+
+        ~ACTIVE() = delete;
+
+        auto operator=( ACTIVE && ) = delete;
+
+        auto operator=( ACTIVE const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Channel ID (CHID) register.
+     *
+     * This register has the following fields:
+     * - Channel ID (ID)
+     */
+    class CHID : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto ID        = std::uint_fast8_t{ 4 }; ///< ID.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ 4 }; ///< RESERVED4.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto ID        = std::uint_fast8_t{};                ///< ID.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ ID + Size::ID }; ///< RESERVED4.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto ID = mask<std::uint8_t>( Size::ID, Bit::ID ); ///< ID.
+            static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+        };
+
+        CHID() = delete;
+
+        CHID( CHID && ) = delete;
+
+        CHID( CHID const & ) = delete;
+
+        ~CHID() = delete;
+
+        auto operator=( CHID && ) = delete;
+
+        auto operator=( CHID const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Channel Control A (CHCTRLA) register.
+     *
+     * This register has the following fields:
+     * - Channel Software Reset (SWRST)
+     * - Channel Enable (ENABLE)
+     */
+    class CHCTRLA : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SWRST     = std::uint_fast8_t{ 1 }; ///< SWRST.
+            static constexpr auto ENABLE    = std::uint_fast8_t{ 1 }; ///< ENABLE.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ 6 }; ///< RESERVED2.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+            static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< RESERVED2.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SWRST = mask<std::uint8_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+            static constexpr auto ENABLE = mask<std::uint8_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+            static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+        };
+
+        CHCTRLA() = delete;
+
+        CHCTRLA( CHCTRLA && ) = delete;
+
+        CHCTRLA( CHCTRLA const & ) = delete;
+
+        ~CHCTRLA() = delete;
+
+        auto operator=( CHCTRLA && ) = delete;
+
+        auto operator=( CHCTRLA const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Channel Control B (CHCTRLB) register.
+     *
+     * This register has the following fields:
+     * - Event Input Action (EVACT)
+     * - Channel Event Input Enable (EVIE)
+     * - Channel Event Output Enable (EVOE)
+     * - Channel Arbitration Level (LVL)
+     * - Trigger Source (TRIGSRC)
+     * - Trigger Action (TRIGACT)
+     * - Software Command (CMD)
+     */
+    class CHCTRLB : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto EVACT      = std::uint_fast8_t{ 3 }; ///< EVACT.
+            static constexpr auto EVIE       = std::uint_fast8_t{ 1 }; ///< EVIE.
+            static constexpr auto EVOE       = std::uint_fast8_t{ 1 }; ///< EVOE.
+            static constexpr auto LVL        = std::uint_fast8_t{ 2 }; ///< LVL.
+            static constexpr auto RESERVED7  = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+            static constexpr auto TRIGSRC    = std::uint_fast8_t{ 6 }; ///< TRIGSRC.
+            static constexpr auto RESERVED14 = std::uint_fast8_t{ 8 }; ///< RESERVED14.
+            static constexpr auto TRIGACT    = std::uint_fast8_t{ 2 }; ///< TRIGACT.
+            static constexpr auto CMD        = std::uint_fast8_t{ 2 }; ///< CMD.
+            static constexpr auto RESERVED26 = std::uint_fast8_t{ 6 }; ///< RESERVED26.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto EVACT = std::uint_fast8_t{}; ///< EVACT.
+            static constexpr auto EVIE = std::uint_fast8_t{ EVACT + Size::EVACT }; ///< EVIE.
+            static constexpr auto EVOE = std::uint_fast8_t{ EVIE + Size::EVIE }; ///< EVOE.
+            static constexpr auto LVL  = std::uint_fast8_t{ EVOE + Size::EVOE }; ///< LVL.
+            static constexpr auto RESERVED7 = std::uint_fast8_t{ LVL + Size::LVL }; ///< RESERVED7.
+            static constexpr auto TRIGSRC = std::uint_fast8_t{ RESERVED7 + Size::RESERVED7 }; ///< TRIGSRC.
+            static constexpr auto RESERVED14 = std::uint_fast8_t{ TRIGSRC + Size::TRIGSRC }; ///< RESERVED14.
+            static constexpr auto TRIGACT = std::uint_fast8_t{ RESERVED14 + Size::RESERVED14 }; ///< TRIGACT.
+            static constexpr auto CMD = std::uint_fast8_t{ TRIGACT + Size::TRIGACT }; ///< CMD.
+            static constexpr auto RESERVED26 = std::uint_fast8_t{ CMD + Size::CMD }; ///< RESERVED26.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto EVACT = mask<std::uint32_t>( Size::EVACT, Bit::EVACT ); ///< EVACT.
+            static constexpr auto EVIE = mask<std::uint32_t>( Size::EVIE, Bit::EVIE ); ///< EVIE.
+            static constexpr auto EVOE = mask<std::uint32_t>( Size::EVOE, Bit::EVOE ); ///< EVOE.
+            static constexpr auto LVL = mask<std::uint32_t>( Size::LVL, Bit::LVL ); ///< LVL.
+            static constexpr auto RESERVED7 = mask<std::uint32_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+            static constexpr auto TRIGSRC = mask<std::uint32_t>( Size::TRIGSRC, Bit::TRIGSRC ); ///< TRIGSRC.
+            static constexpr auto RESERVED14 = mask<std::uint32_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+            static constexpr auto TRIGACT = mask<std::uint32_t>( Size::TRIGACT, Bit::TRIGACT ); ///< TRIGACT.
+            static constexpr auto CMD = mask<std::uint32_t>( Size::CMD, Bit::CMD ); ///< CMD.
+            static constexpr auto RESERVED26 = mask<std::uint32_t>( Size::RESERVED26, Bit::RESERVED26 ); ///< RESERVED26.
+        };
+
+        /**
+         * \brief EVACT.
+         */
+        enum EVACT : std::uint32_t {
+            EVACT_NOACT  = 0x0 << Bit::EVACT, ///< No action.
+            EVACT_TRIG   = 0x1 << Bit::EVACT, ///< Transfer and periodic transfer trigger.
+            EVACT_CTRIG  = 0x2 << Bit::EVACT, ///< Conditional transfer trigger.
+            EVACT_CBLOCK = 0x3 << Bit::EVACT, ///< Conditional block transfer.
+            EVACT_SUSPEND = 0x4 << Bit::EVACT, ///< Channel suspend operation.
+            EVACT_RESUME  = 0x5 << Bit::EVACT, ///< Channel resume operation.
+            EVACT_SSKIP   = 0x6 << Bit::EVACT, ///< Skip next block suspend action.
+        };
+
+        /**
+         * \brief LVL.
+         */
+        enum LVL : std::uint32_t {
+            LVL_LVL0 = 0x0 << Bit::LVL, ///< Channel priority level 0.
+            LVL_LVL1 = 0x1 << Bit::LVL, ///< Channel priority level 1.
+            LVL_LVL2 = 0x2 << Bit::LVL, ///< Channel priority level 2.
+            LVL_LVL3 = 0x3 << Bit::LVL, ///< Channel priority level 3.
+        };
+
+        /**
+         * \brief TRIGSRC.
+         */
+        enum TRIGSRC : std::uint32_t {
+            TRIGSRC_DISABLE    = 0x00 << Bit::TRIGSRC, ///< Only software/event triggers.
+            TRIGSRC_SERCOM0_RX = 0x01 << Bit::TRIGSRC, ///< SERCOM0 RX trigger.
+            TRIGSRC_SERCOM0_TX = 0x02 << Bit::TRIGSRC, ///< SERCOM0 TX trigger.
+            TRIGSRC_SERCOM1_RX = 0x03 << Bit::TRIGSRC, ///< SERCOM1 RX trigger.
+            TRIGSRC_SERCOM1_TX = 0x04 << Bit::TRIGSRC, ///< SERCOM1 TX trigger.
+            TRIGSRC_SERCOM2_RX = 0x05 << Bit::TRIGSRC, ///< SERCOM2 RX trigger.
+            TRIGSRC_SERCOM2_TX = 0x06 << Bit::TRIGSRC, ///< SERCOM2 TX trigger.
+            TRIGSRC_SERCOM3_RX = 0x07 << Bit::TRIGSRC, ///< SERCOM3 RX trigger.
+            TRIGSRC_SERCOM3_TX = 0x08 << Bit::TRIGSRC, ///< SERCOM3 TX trigger.
+            TRIGSRC_SERCOM4_RX = 0x09 << Bit::TRIGSRC, ///< SERCOM4 RX trigger.
+            TRIGSRC_SERCOM4_TX = 0x0A << Bit::TRIGSRC, ///< SERCOM4 TX trigger.
+            TRIGSRC_SERCOM5_RX = 0x0B << Bit::TRIGSRC, ///< SERCOM5 RX trigger.
+            TRIGSRC_SERCOM5_TX = 0x0C << Bit::TRIGSRC, ///< SERCOM5 TX trigger.
+            TRIGSRC_TCC0_OVF   = 0x0D << Bit::TRIGSRC, ///< TCC0 overflow trigger.
+            TRIGSRC_TCC0_MC0   = 0x0E << Bit::TRIGSRC, ///< TCC0 match/compare 0 trigger.
+            TRIGSRC_TCC0_MC1   = 0x0F << Bit::TRIGSRC, ///< TCC0 match/compare 1 trigger.
+            TRIGSRC_TCC0_MC2   = 0x10 << Bit::TRIGSRC, ///< TCC0 match/compare 2 trigger.
+            TRIGSRC_TCC0_MC3   = 0x11 << Bit::TRIGSRC, ///< TCC0 match/compare 3 trigger.
+            TRIGSRC_TCC1_OVF   = 0x12 << Bit::TRIGSRC, ///< TCC1 overflow trigger.
+            TRIGSRC_TCC1_MC0   = 0x13 << Bit::TRIGSRC, ///< TCC1 match/compare 0 trigger.
+            TRIGSRC_TCC1_MC1   = 0x14 << Bit::TRIGSRC, ///< TCC1 match/compare 1 trigger.
+            TRIGSRC_TCC2_OVF   = 0x15 << Bit::TRIGSRC, ///< TCC2 overflow trigger.
+            TRIGSRC_TCC2_MC0   = 0x16 << Bit::TRIGSRC, ///< TCC2 match/compare 0 trigger.
+            TRIGSRC_TCC2_MC1   = 0x17 << Bit::TRIGSRC, ///< TCC2 match/compare 1 trigger.
+            TRIGSRC_TC3_OVF    = 0x18 << Bit::TRIGSRC, ///< TC3 overflow trigger.
+            TRIGSRC_TC3_MC0    = 0x19 << Bit::TRIGSRC, ///< TC3 match/compare 0 trigger.
+            TRIGSRC_TC3_MC1    = 0x1A << Bit::TRIGSRC, ///< TC3 match/compare 1 trigger.
+            TRIGSRC_TC4_OVF    = 0x1B << Bit::TRIGSRC, ///< TC4 overflow trigger.
+            TRIGSRC_TC4_MC0    = 0x1C << Bit::TRIGSRC, ///< TC4 match/compare 0 trigger.
+            TRIGSRC_TC4_MC1    = 0x1D << Bit::TRIGSRC, ///< TC4 match/compare 1 trigger.
+            TRIGSRC_TC5_OVF    = 0x1E << Bit::TRIGSRC, ///< TC5 overflow trigger.
+            TRIGSRC_TC5_MC0    = 0x1F << Bit::TRIGSRC, ///< TC5 match/compare 0 trigger.
+            TRIGSRC_TC5_MC1    = 0x20 << Bit::TRIGSRC, ///< TC5 match/compare 1 trigger.
+            TRIGSRC_TC6_OVF    = 0x21 << Bit::TRIGSRC, ///< TC6 overflow trigger.
+            TRIGSRC_TC6_MC0    = 0x22 << Bit::TRIGSRC, ///< TC6 match/compare 0 trigger.
+            TRIGSRC_TC6_MC1    = 0x23 << Bit::TRIGSRC, ///< TC6 match/compare 1 trigger.
+            TRIGSRC_TC7_OVF    = 0x24 << Bit::TRIGSRC, ///< TC7 overflow trigger.
+            TRIGSRC_TC7_MC0    = 0x25 << Bit::TRIGSRC, ///< TC7 match/compare 0 trigger.
+            TRIGSRC_TC7_MC1    = 0x26 << Bit::TRIGSRC, ///< TC7 match/compare 1 trigger.
+            TRIGSRC_ADC_RESRDY = 0x27 << Bit::TRIGSRC, ///< ADC result ready trigger.
+            TRIGSRC_DAC_EMPTY  = 0x28 << Bit::TRIGSRC, ///< DAC empty trigger.
+            TRIGSRC_I2S_RX_0   = 0x29 << Bit::TRIGSRC, ///< I2S RX 0 trigger.
+            TRIGSRC_I2S_RX_1   = 0x2A << Bit::TRIGSRC, ///< I2S RX 1 trigger.
+            TRIGSRC_I2S_TX_0   = 0x2B << Bit::TRIGSRC, ///< I2S TX 0 trigger.
+            TRIGSRC_I2S_TX_1   = 0x2C << Bit::TRIGSRC, ///< I2S TX 1 trigger.
+        };
+
+        /**
+         * \brief TRIGACT.
+         */
+        enum TRIGACT : std::uint32_t {
+            TRIGACT_BLOCK = 0x0 << Bit::TRIGACT, ///< One trigger required for each block transfer.
+            TRIGACT_BEAT = 0x2 << Bit::TRIGACT, ///< One trigger required for each beat transfer.
+            TRIGACT_TRANSACTION = 0x3 << Bit::TRIGACT, ///< One trigger required for each transaction.
+        };
+
+        /**
+         * \brief CMD.
+         */
+        enum CMD : std::uint32_t {
+            CMD_NOACT   = 0x0 << Bit::CMD, ///< No action.
+            CMD_SUSPEND = 0x1 << Bit::CMD, ///< Channel suspend operation.
+            CMD_RESUME  = 0x2 << Bit::CMD, ///< Channel resume operation.
+        };
+
+        CHCTRLB() = delete;
+
+        CHCTRLB( CHCTRLB && ) = delete;
+
+        CHCTRLB( CHCTRLB const & ) = delete;
+
+        ~CHCTRLB() = delete;
+
+        auto operator=( CHCTRLB && ) = delete;
+
+        auto operator=( CHCTRLB const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Channel Interrupt Enable Clear (CHINTENCLR) register.
+     *
+     * This register has the following fields:
+     * - Transfer Error Interrupt Enable (TERR)
+     * - Transfer Complete Interrupt Enable (TCMPL)
+     * - Channel Suspend Interrupt Enable (SUSP)
+     */
+    class CHINTENCLR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto TERR      = std::uint_fast8_t{ 1 }; ///< TERR.
+            static constexpr auto TCMPL     = std::uint_fast8_t{ 1 }; ///< TCMPL.
+            static constexpr auto SUSP      = std::uint_fast8_t{ 1 }; ///< SUSP.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ 5 }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto TERR = std::uint_fast8_t{}; ///< TERR.
+            static constexpr auto TCMPL = std::uint_fast8_t{ TERR + Size::TERR }; ///< TCMPL.
+            static constexpr auto SUSP = std::uint_fast8_t{ TCMPL + Size::TCMPL }; ///< SUSP.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ SUSP + Size::SUSP }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto TERR = mask<std::uint8_t>( Size::TERR, Bit::TERR ); ///< TERR.
+            static constexpr auto TCMPL = mask<std::uint8_t>( Size::TCMPL, Bit::TCMPL ); ///< TCMPL.
+            static constexpr auto SUSP = mask<std::uint8_t>( Size::SUSP, Bit::SUSP ); ///< SUSP.
+            static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+        };
+
+        CHINTENCLR() = delete;
+
+        CHINTENCLR( CHINTENCLR && ) = delete;
+
+        CHINTENCLR( CHINTENCLR const & ) = delete;
+
+        ~CHINTENCLR() = delete;
+
+        auto operator=( CHINTENCLR && ) = delete;
+
+        auto operator=( CHINTENCLR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Channel Interrupt Enable Set (CHINTENSET) register.
+     *
+     * This register has the following fields:
+     * - Transfer Error Interrupt Enable (TERR)
+     * - Transfer Complete Interrupt Enable (TCMPL)
+     * - Channel Suspend Interrupt Enable (SUSP)
+     */
+    class CHINTENSET : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto TERR      = std::uint_fast8_t{ 1 }; ///< TERR.
+            static constexpr auto TCMPL     = std::uint_fast8_t{ 1 }; ///< TCMPL.
+            static constexpr auto SUSP      = std::uint_fast8_t{ 1 }; ///< SUSP.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ 5 }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto TERR = std::uint_fast8_t{}; ///< TERR.
+            static constexpr auto TCMPL = std::uint_fast8_t{ TERR + Size::TERR }; ///< TCMPL.
+            static constexpr auto SUSP = std::uint_fast8_t{ TCMPL + Size::TCMPL }; ///< SUSP.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ SUSP + Size::SUSP }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto TERR = mask<std::uint8_t>( Size::TERR, Bit::TERR ); ///< TERR.
+            static constexpr auto TCMPL = mask<std::uint8_t>( Size::TCMPL, Bit::TCMPL ); ///< TCMPL.
+            static constexpr auto SUSP = mask<std::uint8_t>( Size::SUSP, Bit::SUSP ); ///< SUSP.
+            static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+        };
+
+        CHINTENSET() = delete;
+
+        CHINTENSET( CHINTENSET && ) = delete;
+
+        CHINTENSET( CHINTENSET const & ) = delete;
+
+        ~CHINTENSET() = delete;
+
+        auto operator=( CHINTENSET && ) = delete;
+
+        auto operator=( CHINTENSET const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Channel Interrupt Flag Status and Clear (CHINTFLAG) register.
+     *
+     * This register has the following fields:
+     * - Transfer Error (TERR)
+     * - Transfer Complete (TCMPL)
+     * - Channel Suspend (SUSP)
+     */
+    class CHINTFLAG : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto TERR      = std::uint_fast8_t{ 1 }; ///< TERR.
+            static constexpr auto TCMPL     = std::uint_fast8_t{ 1 }; ///< TCMPL.
+            static constexpr auto SUSP      = std::uint_fast8_t{ 1 }; ///< SUSP.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ 5 }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto TERR = std::uint_fast8_t{}; ///< TERR.
+            static constexpr auto TCMPL = std::uint_fast8_t{ TERR + Size::TERR }; ///< TCMPL.
+            static constexpr auto SUSP = std::uint_fast8_t{ TCMPL + Size::TCMPL }; ///< SUSP.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ SUSP + Size::SUSP }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto TERR = mask<std::uint8_t>( Size::TERR, Bit::TERR ); ///< TERR.
+            static constexpr auto TCMPL = mask<std::uint8_t>( Size::TCMPL, Bit::TCMPL ); ///< TCMPL.
+            static constexpr auto SUSP = mask<std::uint8_t>( Size::SUSP, Bit::SUSP ); ///< SUSP.
+            static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+        };
+
+        CHINTFLAG() = delete;
+
+        CHINTFLAG( CHINTFLAG && ) = delete;
+
+        CHINTFLAG( CHINTFLAG const & ) = delete;
+
+        ~CHINTFLAG() = delete;
+
+        auto operator=( CHINTFLAG && ) = delete;
+
+        auto operator=( CHINTFLAG const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Channel Status (CHSTATUS) register.
+     *
+     * This register has the following fields:
+     * - Channel Pending (PEND)
+     * - Channel Busy (BUSY)
+     * - Channel Fetch Error (FERR)
+     */
+    class CHSTATUS : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto PEND      = std::uint_fast8_t{ 1 }; ///< PEND.
+            static constexpr auto BUSY      = std::uint_fast8_t{ 1 }; ///< BUSY.
+            static constexpr auto FERR      = std::uint_fast8_t{ 1 }; ///< FERR.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ 5 }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto PEND = std::uint_fast8_t{}; ///< PEND.
+            static constexpr auto BUSY = std::uint_fast8_t{ PEND + Size::PEND }; ///< BUSY.
+            static constexpr auto FERR = std::uint_fast8_t{ BUSY + Size::BUSY }; ///< FERR.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ FERR + Size::FERR }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto PEND = mask<std::uint8_t>( Size::PEND, Bit::PEND ); ///< PEND.
+            static constexpr auto BUSY = mask<std::uint8_t>( Size::BUSY, Bit::BUSY ); ///< BUSY.
+            static constexpr auto FERR = mask<std::uint8_t>( Size::FERR, Bit::FERR ); ///< FERR.
+            static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+        };
+
+        CHSTATUS() = delete;
+
+        CHSTATUS( CHSTATUS && ) = delete;
+
+        CHSTATUS( CHSTATUS const & ) = delete;
+
+        ~CHSTATUS() = delete;
+
+        auto operator=( CHSTATUS && ) = delete;
+
+        auto operator=( CHSTATUS const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Transfer descriptor (located in SRAM, must be 128-bit aligned).
+     */
+    struct Descriptor {
+        /**
+         * \brief Block Transfer Control (BTCTRL) register.
+         *
+         * This register has the following fields:
+         * - Descriptor Valid (VALID)
+         * - Event Output Selection (EVOSEL)
+         * - Block Action (BLOCKACT)
+         * - Beat Size (BEATSIZE)
+         * - Source Address Increment Enable (SRCINC)
+         * - Destination Address Increment Enable (DSTINC)
+         * - Step Selection (STEPSEL)
+         * - Address Increment Step Size (STEPSIZE)
+         */
+        struct BTCTRL {
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto VALID     = std::uint_fast8_t{ 1 }; ///< VALID.
+                static constexpr auto EVOSEL    = std::uint_fast8_t{ 2 }; ///< EVOSEL.
+                static constexpr auto BLOCKACT  = std::uint_fast8_t{ 2 }; ///< BLOCKACT.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ 3 }; ///< RESERVED5.
+                static constexpr auto BEATSIZE  = std::uint_fast8_t{ 2 }; ///< BEATSIZE.
+                static constexpr auto SRCINC    = std::uint_fast8_t{ 1 }; ///< SRCINC.
+                static constexpr auto DSTINC    = std::uint_fast8_t{ 1 }; ///< DSTINC.
+                static constexpr auto STEPSEL   = std::uint_fast8_t{ 1 }; ///< STEPSEL.
+                static constexpr auto STEPSIZE  = std::uint_fast8_t{ 3 }; ///< STEPSIZE.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto VALID = std::uint_fast8_t{}; ///< VALID.
+                static constexpr auto EVOSEL = std::uint_fast8_t{ VALID + Size::VALID }; ///< EVOSEL.
+                static constexpr auto BLOCKACT = std::uint_fast8_t{ EVOSEL + Size::EVOSEL }; ///< BLOCKACT.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ BLOCKACT + Size::BLOCKACT }; ///< RESERVED5.
+                static constexpr auto BEATSIZE = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< BEATSIZE.
+                static constexpr auto SRCINC = std::uint_fast8_t{ BEATSIZE + Size::BEATSIZE }; ///< SRCINC.
+                static constexpr auto DSTINC = std::uint_fast8_t{ SRCINC + Size::SRCINC }; ///< DSTINC.
+                static constexpr auto STEPSEL = std::uint_fast8_t{ DSTINC + Size::DSTINC }; ///< STEPSEL.
+                static constexpr auto STEPSIZE = std::uint_fast8_t{ STEPSEL + Size::STEPSEL }; ///< STEPSIZE.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto VALID = mask<std::uint16_t>( Size::VALID, Bit::VALID ); ///< VALID.
+                static constexpr auto EVOSEL = mask<std::uint16_t>( Size::EVOSEL, Bit::EVOSEL ); ///< EVOSEL.
+                static constexpr auto BLOCKACT = mask<std::uint16_t>( Size::BLOCKACT, Bit::BLOCKACT ); ///< BLOCKACT.
+                static constexpr auto RESERVED5 = mask<std::uint16_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto BEATSIZE = mask<std::uint16_t>( Size::BEATSIZE, Bit::BEATSIZE ); ///< BEATSIZE.
+                static constexpr auto SRCINC = mask<std::uint16_t>( Size::SRCINC, Bit::SRCINC ); ///< SRCINC.
+                static constexpr auto DSTINC = mask<std::uint16_t>( Size::DSTINC, Bit::DSTINC ); ///< DSTINC.
+                static constexpr auto STEPSEL = mask<std::uint16_t>( Size::STEPSEL, Bit::STEPSEL ); ///< STEPSEL.
+                static constexpr auto STEPSIZE = mask<std::uint16_t>( Size::STEPSIZE, Bit::STEPSIZE ); ///< STEPSIZE.
+            };
+
+            /**
+             * \brief EVOSEL.
+             */
+            enum EVOSEL : std::uint16_t {
+                EVOSEL_DISABLE = 0x0 << Bit::EVOSEL, ///< Event generation disabled.
+                EVOSEL_BLOCK = 0x1 << Bit::EVOSEL, ///< Event strobe when block transfer complete.
+                EVOSEL_BEAT = 0x3 << Bit::EVOSEL, ///< Event strobe when beat transfer complete.
+            };
+
+            /**
+             * \brief BLOCKACT.
+             */
+            enum BLOCKACT : std::uint16_t {
+                BLOCKACT_NOACT = 0x0 << Bit::BLOCKACT, ///< Disable the channel if last block.
+                BLOCKACT_INT = 0x1 << Bit::BLOCKACT, ///< Disable the channel if last block, and block interrupt.
+                BLOCKACT_SUSPEND = 0x2 << Bit::BLOCKACT, ///< Channel suspend operation.
+                BLOCKACT_BOTH = 0x3 << Bit::BLOCKACT, ///< Both channel suspend operation and block interrupt.
+            };
+
+            /**
+             * \brief BEATSIZE.
+             */
+            enum BEATSIZE : std::uint16_t {
+                BEATSIZE_BYTE  = 0x0 << Bit::BEATSIZE, ///< 8-bit bus transfer.
+                BEATSIZE_HWORD = 0x1 << Bit::BEATSIZE, ///< 16-bit bus transfer.
+                BEATSIZE_WORD  = 0x2 << Bit::BEATSIZE, ///< 32-bit bus transfer.
+            };
+
+            /**
+             * \brief STEPSEL.
+             */
+            enum STEPSEL : std::uint16_t {
+                STEPSEL_DST = 0x0 << Bit::STEPSEL, ///< Step size settings apply to the destination address.
+                STEPSEL_SRC = 0x1 << Bit::STEPSEL, ///< Step size settings apply to the source address.
+            };
+
+            /**
+             * \brief STEPSIZE.
+             */
+            enum STEPSIZE : std::uint16_t {
+                STEPSIZE_X1 = 0x0 << Bit::STEPSIZE, ///< Next address = address + ( 1 << BEATSIZE ) * 1.
+                STEPSIZE_X2 = 0x1 << Bit::STEPSIZE, ///< Next address = address + ( 1 << BEATSIZE ) * 2.
+                STEPSIZE_X4 = 0x2 << Bit::STEPSIZE, ///< Next address = address + ( 1 << BEATSIZE ) * 4.
+                STEPSIZE_X8 = 0x3 << Bit::STEPSIZE, ///< Next address = address + ( 1 << BEATSIZE ) * 8.
+                STEPSIZE_X16 = 0x4 << Bit::STEPSIZE, ///< Next address = address + ( 1 << BEATSIZE ) * 16.
+                STEPSIZE_X32 = 0x5 << Bit::STEPSIZE, ///< Next address = address + ( 1 << BEATSIZE ) * 32.
+                STEPSIZE_X64 = 0x6 << Bit::STEPSIZE, ///< Next address = address + ( 1 << BEATSIZE ) * 64.
+                STEPSIZE_X128 = 0x7 << Bit::STEPSIZE, ///< Next address = address + ( 1 << BEATSIZE ) * 128.
+            };
+        };
+
+        /**
+         * \brief Block Transfer Control (BTCTRL).
+         */
+        std::uint16_t btctrl;
+
+        /**
+         * \brief Block Transfer Count (BTCNT).
+         */
+        std::uint16_t btcnt;
+
+        /**
+         * \brief Block Transfer Source Address (SRCADDR) (the address of the end of the
+         *        source data if source address incrementing is enabled).
+         */
+        std::uint32_t srcaddr;
+
+        /**
+         * \brief Block Transfer Destination Address (DSTADDR) (the address of the end of
+         *        the destination data if destination address incrementing is enabled).
+         */
+        std::uint32_t dstaddr;
+
+        /**
+         * \brief Next Descriptor Address (DESCADDR) (0 if this is the last descriptor).
+         */
+        std::uint32_t descaddr;
+    };
+
+    /**
+     * \brief CTRL.
+     */
+    CTRL ctrl;
+
+    /**
+     * \brief CRCCTRL.
+     */
+    CRCCTRL crcctrl;
+
+    /**
+     * \brief CRC Data Input (CRCDATAIN) register.
+     */
+    Register<std::uint32_t> crcdatain;
+
+    /**
+     * \brief CRC Checksum (CRCCHKSUM) register.
+     */
+    Register<std::uint32_t> crcchksum;
+
+    /**
+     * \brief CRCSTATUS.
+     */
+    CRCSTATUS crcstatus;
+
+    /**
+     * \brief DBGCTRL.
+     */
+    DBGCTRL dbgctrl;
+
+    /**
+     * \brief QOSCTRL.
+     */
+    QOSCTRL qosctrl;
+
+    /**
+     * \brief Reserved registers (offset 0x0F-0x0F).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x0F_0x0F[ ( 0x0F - 0x0F ) + 1 ];
+
+    /**
+     * \brief SWTRIGCTRL.
+     */
+    SWTRIGCTRL swtrigctrl;
+
+    /**
+     * \brief PRICTRL0.
+     */
+    PRICTRL0 prictrl0;
+
+    /**
+     * \brief Reserved registers (offset 0x18-0x1F).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x18_0x1F[ ( 0x1F - 0x18 ) + 1 ];
+
+    /**
+     * \brief INTPEND.
+     */
+    INTPEND intpend;
+
+    /**
+     * \brief Reserved registers (offset 0x22-0x23).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x22_0x23[ ( 0x23 - 0x22 ) + 1 ];
+
+    /**
+     * \brief INTSTATUS.
+     */
+    INTSTATUS const intstatus;
+
+    /**
+     * \brief BUSYCH.
+     */
+    BUSYCH const busych;
+
+    /**
+     * \brief PENDCH.
+     */
+    PENDCH const pendch;
+
+    /**
+     * \brief ACTIVE.
+     */
+    ACTIVE const active;
+
+    /**
+     * \brief Descriptor Memory Section Base Address (BASEADDR) register.
+     */
+    Register<std::uint32_t> baseaddr;
+
+    /**
+     * \brief Write-Back Memory Section Base Address (WRBADDR) register.
+     */
+    Register<std::uint32_t> wrbaddr;
+
+    /**
+     * \brief Reserved registers (offset 0x3C-0x3E).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x3C_0x3E[ ( 0x3E - 0x3C ) + 1 ];
+
+    /**
+     * \brief CHID.
+     */
+    CHID chid;
+
+    /**
+     * \brief CHCTRLA.
+     */
+    CHCTRLA chctrla;
+
+    /**
+     * \brief Reserved registers (offset 0x41-0x43).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x41_0x43[ ( 0x43 - 0x41 ) + 1 ];
+
+    /**
+     * \brief CHCTRLB.
+     */
+    CHCTRLB chctrlb;
+
+    /**
+     * \brief Reserved registers (offset 0x48-0x4B).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x48_0x4B[ ( 0x4B - 0x48 ) + 1 ];
+
+    /**
+     * \brief CHINTENCLR.
+     */
+    CHINTENCLR chintenclr;
+
+    /**
+     * \brief CHINTENSET.
+     */
+    CHINTENSET chintenset;
+
+    /**
+     * \brief CHINTFLAG.
+     */
+    CHINTFLAG chintflag;
+
+    /**
+     * \brief CHSTATUS.
+     */
+    CHSTATUS const chstatus;
+
+    DMAC() = delete;
+
+    DMAC( DMAC && ) = delete;
+
+    DMAC( DMAC const & ) = delete;
+
+    ~DMAC() = delete;
+
+    auto operator=( DMAC && ) = delete;
+
+    auto operator=( DMAC const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_DMAC_H
@@ -0,0 +1,978 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Peripheral::EVSYS interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_EVSYS_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_EVSYS_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Peripheral {
+
+/**
+ * \brief Microchip SAM D21/DA1 Event System (EVSYS) peripheral.
+ */
+class EVSYS {
+  public:
+    /**
+     * \brief Control (CTRL) register.
+     *
+     * This register has the following fields:
+     * - Software Reset (SWRST)
+     * - Generic Clock Requests (GCLKREQ)
+     */
+    class CTRL : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SWRST     = std::uint_fast8_t{ 1 }; ///< SWRST.
+            static constexpr auto RESERVED1 = std::uint_fast8_t{ 3 }; ///< RESERVED1.
+            static constexpr auto GCLKREQ   = std::uint_fast8_t{ 1 }; ///< GCLKREQ.
+            static constexpr auto RESERVED5 = std::uint_fast8_t{ 3 }; ///< RESERVED5.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+            static constexpr auto RESERVED1 = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< RESERVED1.
+            static constexpr auto GCLKREQ = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< GCLKREQ.
+            static constexpr auto RESERVED5 = std::uint_fast8_t{ GCLKREQ + Size::GCLKREQ }; ///< RESERVED5.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SWRST = mask<std::uint8_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+            static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+            static constexpr auto GCLKREQ = mask<std::uint8_t>( Size::GCLKREQ, Bit::GCLKREQ ); ///< GCLKREQ.
+            static constexpr auto RESERVED5 = mask<std::uint8_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+        };
+
+        CTRL() = delete;
+
+        CTRL( CTRL && ) = delete;
+
+        CTRL( CTRL const & ) = delete;
+
+        ~CTRL() = delete;
+
+        auto operator=( CTRL && ) = delete;
+
+        auto operator=( CTRL const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Channel (CHANNEL) register.
+     *
+     * This register has the following fields:
+     * - Channel Selection (CHANNEL)
+     * - Software Event (SWEVT)
+     * - Event Generator Selection (EVGEN)
+     * - Path Selection (PATH)
+     * - Edge Detection Selection (EDGSEL)
+     */
+    class CHANNEL : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto CHANNEL    = std::uint_fast8_t{ 4 }; ///< CHANNEL.
+            static constexpr auto RESERVED4  = std::uint_fast8_t{ 4 }; ///< RESERVED4.
+            static constexpr auto SWEVT      = std::uint_fast8_t{ 1 }; ///< SWEVT.
+            static constexpr auto RESERVED9  = std::uint_fast8_t{ 7 }; ///< RESERVED9.
+            static constexpr auto EVGEN      = std::uint_fast8_t{ 7 }; ///< EVGEN.
+            static constexpr auto RESERVED23 = std::uint_fast8_t{ 1 }; ///< RESERVED23.
+            static constexpr auto PATH       = std::uint_fast8_t{ 2 }; ///< PATH.
+            static constexpr auto EDGSEL     = std::uint_fast8_t{ 2 }; ///< EDGSEL.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto CHANNEL = std::uint_fast8_t{}; ///< CHANNEL.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ CHANNEL + Size::CHANNEL }; ///< RESERVED4.
+            static constexpr auto SWEVT = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< SWEVT.
+            static constexpr auto RESERVED9 = std::uint_fast8_t{ SWEVT + Size::SWEVT }; ///< RESERVED9.
+            static constexpr auto EVGEN = std::uint_fast8_t{ RESERVED9 + Size::RESERVED9 }; ///< EVGEN.
+            static constexpr auto RESERVED23 = std::uint_fast8_t{ EVGEN + Size::EVGEN }; ///< RESERVED23.
+            static constexpr auto PATH = std::uint_fast8_t{ RESERVED23 + Size::RESERVED23 }; ///< PATH.
+            static constexpr auto EDGSEL = std::uint_fast8_t{ PATH + Size::PATH }; ///< EDGSEL.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ EDGSEL + Size::EDGSEL }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto CHANNEL = mask<std::uint32_t>( Size::CHANNEL, Bit::CHANNEL ); ///< CHANNEL.
+            static constexpr auto RESERVED4 = mask<std::uint32_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto SWEVT = mask<std::uint32_t>( Size::SWEVT, Bit::SWEVT ); ///< SWEVT.
+            static constexpr auto RESERVED9 = mask<std::uint32_t>( Size::RESERVED9, Bit::RESERVED9 ); ///< RESERVED9.
+            static constexpr auto EVGEN = mask<std::uint32_t>( Size::EVGEN, Bit::EVGEN ); ///< EVGEN.
+            static constexpr auto RESERVED23 = mask<std::uint32_t>( Size::RESERVED23, Bit::RESERVED23 ); ///< RESERVED23.
+            static constexpr auto PATH = mask<std::uint32_t>( Size::PATH, Bit::PATH ); ///< PATH.
+            static constexpr auto EDGSEL = mask<std::uint32_t>( Size::EDGSEL, Bit::EDGSEL ); ///< EDGSEL.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        /**
+         * \brief EVGEN.
+         */
+        enum EVGEN : std::uint32_t {
+            EVGEN_NONE         = 0x00 << Bit::EVGEN, ///< No event generator.
+            EVGEN_RTC_CMP0     = 0x01 << Bit::EVGEN, ///< RTC compare 0.
+            EVGEN_RTC_CMP1     = 0x02 << Bit::EVGEN, ///< RTC compare 1.
+            EVGEN_RTC_OVF      = 0x03 << Bit::EVGEN, ///< RTC overflow.
+            EVGEN_RTC_PER0     = 0x04 << Bit::EVGEN, ///< RTC period 0.
+            EVGEN_RTC_PER1     = 0x05 << Bit::EVGEN, ///< RTC period 1.
+            EVGEN_RTC_PER2     = 0x06 << Bit::EVGEN, ///< RTC period 2.
+            EVGEN_RTC_PER3     = 0x07 << Bit::EVGEN, ///< RTC period 3.
+            EVGEN_RTC_PER4     = 0x08 << Bit::EVGEN, ///< RTC period 4.
+            EVGEN_RTC_PER5     = 0x09 << Bit::EVGEN, ///< RTC period 5.
+            EVGEN_RTC_PER6     = 0x0A << Bit::EVGEN, ///< RTC period 6.
+            EVGEN_RTC_PER7     = 0x0B << Bit::EVGEN, ///< RTC period 7.
+            EVGEN_EIC_EXTINT0  = 0x0C << Bit::EVGEN, ///< EIC external interrupt 0.
+            EVGEN_EIC_EXTINT1  = 0x0D << Bit::EVGEN, ///< EIC external interrupt 1.
+            EVGEN_EIC_EXTINT2  = 0x0E << Bit::EVGEN, ///< EIC external interrupt 2.
+            EVGEN_EIC_EXTINT3  = 0x0F << Bit::EVGEN, ///< EIC external interrupt 3.
+            EVGEN_EIC_EXTINT4  = 0x10 << Bit::EVGEN, ///< EIC external interrupt 4.
+            EVGEN_EIC_EXTINT5  = 0x11 << Bit::EVGEN, ///< EIC external interrupt 5.
+            EVGEN_EIC_EXTINT6  = 0x12 << Bit::EVGEN, ///< EIC external interrupt 6.
+            EVGEN_EIC_EXTINT7  = 0x13 << Bit::EVGEN, ///< EIC external interrupt 7.
+            EVGEN_EIC_EXTINT8  = 0x14 << Bit::EVGEN, ///< EIC external interrupt 8.
+            EVGEN_EIC_EXTINT9  = 0x15 << Bit::EVGEN, ///< EIC external interrupt 9.
+            EVGEN_EIC_EXTINT10 = 0x16 << Bit::EVGEN, ///< EIC external interrupt 10.
+            EVGEN_EIC_EXTINT11 = 0x17 << Bit::EVGEN, ///< EIC external interrupt 11.
+            EVGEN_EIC_EXTINT12 = 0x18 << Bit::EVGEN, ///< EIC external interrupt 12.
+            EVGEN_EIC_EXTINT13 = 0x19 << Bit::EVGEN, ///< EIC external interrupt 13.
+            EVGEN_EIC_EXTINT14 = 0x1A << Bit::EVGEN, ///< EIC external interrupt 14.
+            EVGEN_EIC_EXTINT15 = 0x1B << Bit::EVGEN, ///< EIC external interrupt 15.
+            EVGEN_DMAC_CH0     = 0x1C << Bit::EVGEN, ///< DMAC channel 0.
+            EVGEN_DMAC_CH1     = 0x1D << Bit::EVGEN, ///< DMAC channel 1.
+            EVGEN_DMAC_CH2     = 0x1E << Bit::EVGEN, ///< DMAC channel 2.
+            EVGEN_DMAC_CH3     = 0x1F << Bit::EVGEN, ///< DMAC channel 3.
+            EVGEN_TCC0_OVF     = 0x20 << Bit::EVGEN, ///< TCC0 overflow/underflow.
+            EVGEN_TCC0_TRG     = 0x21 << Bit::EVGEN, ///< TCC0 retrigger.
+            EVGEN_TCC0_CNT     = 0x22 << Bit::EVGEN, ///< TCC0 counter.
+            EVGEN_TCC0_MCX0    = 0x23 << Bit::EVGEN, ///< TCC0 match/capture 0.
+            EVGEN_TCC0_MCX1    = 0x24 << Bit::EVGEN, ///< TCC0 match/capture 1.
+            EVGEN_TCC0_MCX2    = 0x25 << Bit::EVGEN, ///< TCC0 match/capture 2.
+            EVGEN_TCC0_MCX3    = 0x26 << Bit::EVGEN, ///< TCC0 match/capture 3.
+            EVGEN_TCC1_OVF     = 0x27 << Bit::EVGEN, ///< TCC1 overflow/underflow.
+            EVGEN_TCC1_TRG     = 0x28 << Bit::EVGEN, ///< TCC1 retrigger.
+            EVGEN_TCC1_CNT     = 0x29 << Bit::EVGEN, ///< TCC1 counter.
+            EVGEN_TCC1_MCX0    = 0x2A << Bit::EVGEN, ///< TCC1 match/capture 0.
+            EVGEN_TCC1_MCX1    = 0x2B << Bit::EVGEN, ///< TCC1 match/capture 1.
+            EVGEN_TCC2_OVF     = 0x2C << Bit::EVGEN, ///< TCC2 overflow/underflow.
+            EVGEN_TCC2_TRG     = 0x2D << Bit::EVGEN, ///< TCC2 retrigger.
+            EVGEN_TCC2_CNT     = 0x2E << Bit::EVGEN, ///< TCC2 counter.
+            EVGEN_TCC2_MCX0    = 0x2F << Bit::EVGEN, ///< TCC2 match/capture 0.
+            EVGEN_TCC2_MCX1    = 0x30 << Bit::EVGEN, ///< TCC2 match/capture 1.
+            EVGEN_TC3_OVF      = 0x31 << Bit::EVGEN, ///< TC3 overflow/underflow.
+            EVGEN_TC3_MCX0     = 0x32 << Bit::EVGEN, ///< TC3 match/capture 0.
+            EVGEN_TC3_MCX1     = 0x33 << Bit::EVGEN, ///< TC3 match/capture 1.
+            EVGEN_TC4_OVF      = 0x34 << Bit::EVGEN, ///< TC4 overflow/underflow.
+            EVGEN_TC4_MCX0     = 0x35 << Bit::EVGEN, ///< TC4 match/capture 0.
+            EVGEN_TC4_MCX1     = 0x36 << Bit::EVGEN, ///< TC4 match/capture 1.
+            EVGEN_TC5_OVF      = 0x37 << Bit::EVGEN, ///< TC5 overflow/underflow.
+            EVGEN_TC5_MCX0     = 0x38 << Bit::EVGEN, ///< TC5 match/capture 0.
+            EVGEN_TC5_MCX1     = 0x39 << Bit::EVGEN, ///< TC5 match/capture 1.
+            EVGEN_TC6_OVF      = 0x3A << Bit::EVGEN, ///< TC6 overflow/underflow.
+            EVGEN_TC6_MCX0     = 0x3B << Bit::EVGEN, ///< TC6 match/capture 0.
+            EVGEN_TC6_MCX1     = 0x3C << Bit::EVGEN, ///< TC6 match/capture 1.
+            EVGEN_TC7_OVF      = 0x3D << Bit::EVGEN, ///< TC7 overflow/underflow.
+            EVGEN_TC7_MCX0     = 0x3E << Bit::EVGEN, ///< TC7 match/capture 0.
+            EVGEN_TC7_MCX1     = 0x3F << Bit::EVGEN, ///< TC7 match/capture 1.
+            EVGEN_ADC_RESRDY   = 0x40 << Bit::EVGEN, ///< ADC result ready.
+            EVGEN_ADC_WINMON   = 0x41 << Bit::EVGEN, ///< ADC window monitor.
+            EVGEN_AC_COMP0     = 0x42 << Bit::EVGEN, ///< AC comparator 0.
+            EVGEN_AC_COMP1     = 0x43 << Bit::EVGEN, ///< AC comparator 1.
+            EVGEN_AC_WIN0      = 0x44 << Bit::EVGEN, ///< AC window 0.
+            EVGEN_DAC_EMPTY    = 0x45 << Bit::EVGEN, ///< DAC data buffer empty.
+            EVGEN_PTC_EOC      = 0x46 << Bit::EVGEN, ///< PTC end of conversion.
+            EVGEN_PTC_WCOMP    = 0x47 << Bit::EVGEN, ///< PTC window comparator.
+        };
+
+        /**
+         * \brief PATH.
+         */
+        enum PATH : std::uint32_t {
+            PATH_SYNCHRONOUS    = 0x0 << Bit::PATH, ///< Synchronous path.
+            PATH_RESYNCHRONIZED = 0x1 << Bit::PATH, ///< Resynchronized path.
+            PATH_ASYNCHRONOUS   = 0x2 << Bit::PATH, ///< Asynchronous path.
+        };
+
+        /**
+         * \brief EDGSEL.
+         */
+        enum EDGSEL : std::uint32_t {
+            EDGSEL_NO_EVT_OUTPUT = 0x0 << Bit::EDGSEL, ///< No event output when using the resynchronized or synchronous path.
+            EDGSEL_RISING_EDGE = 0x1 << Bit::EDGSEL, ///< Event detection only on the rising edge of the signal from the event generator.
+            EDGSEL_FALLING_EDGE = 0x2 << Bit::EDGSEL, ///< Event detection only on the falling edge of the signal from the event generator.
+            EDGSEL_BOTH_EDGES = 0x3 << Bit::EDGSEL, ///< Event detection on both edges of the signal from the event generator.
+        };
+
+        CHANNEL() = delete;
+
+        CHANNEL( CHANNEL && ) = delete;
+
+        CHANNEL( CHANNEL const & ) = delete;
+
+        ~CHANNEL() = delete;
+
+        auto operator=( CHANNEL && ) = delete;
+
+        auto operator=( CHANNEL const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief User Multiplexer (USER) register.
+     *
+     * This register has the following fields:
+     * - User Multiplexer Selection (USER)
+     * - Channel Event Selection (CHANNEL)
+     */
+    class USER : public Register<std::uint16_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto USER       = std::uint_fast8_t{ 5 }; ///< USER.
+            static constexpr auto RESERVED5  = std::uint_fast8_t{ 3 }; ///< RESERVED5.
+            static constexpr auto CHANNEL    = std::uint_fast8_t{ 5 }; ///< CHANNEL.
+            static constexpr auto RESERVED13 = std::uint_fast8_t{ 3 }; ///< RESERVED13.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto USER = std::uint_fast8_t{}; ///< USER.
+            static constexpr auto RESERVED5 = std::uint_fast8_t{ USER + Size::USER }; ///< RESERVED5.
+            static constexpr auto CHANNEL = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< CHANNEL.
+            static constexpr auto RESERVED13 = std::uint_fast8_t{ CHANNEL + Size::CHANNEL }; ///< RESERVED13.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto USER = mask<std::uint16_t>( Size::USER, Bit::USER ); ///< USER.
+            static constexpr auto RESERVED5 = mask<std::uint16_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+            static constexpr auto CHANNEL = mask<std::uint16_t>( Size::CHANNEL, Bit::CHANNEL ); ///< CHANNEL.
+            static constexpr auto RESERVED13 = mask<std::uint16_t>( Size::RESERVED13, Bit::RESERVED13 ); ///< RESERVED13.
+        };
+
+        /**
+         * \brief USER (USER_ID since a member of the USER class cannot be named USER).
+         */
+        enum USER_ID : std::uint16_t {
+            USER_DMAC_CH0   = 0x00 << Bit::USER, ///< DMAC channel 0.
+            USER_DMAC_CH1   = 0x01 << Bit::USER, ///< DMAC channel 1.
+            USER_DMAC_CH2   = 0x02 << Bit::USER, ///< DMAC channel 2.
+            USER_DMAC_CH3   = 0x03 << Bit::USER, ///< DMAC channel 3.
+            USER_TCC0_EV0   = 0x04 << Bit::USER, ///< TCC0 event 0.
+            USER_TCC0_EV1   = 0x05 << Bit::USER, ///< TCC0 event 1.
+            USER_TCC0_MC0   = 0x06 << Bit::USER, ///< TCC0 match/capture 0.
+            USER_TCC0_MC1   = 0x07 << Bit::USER, ///< TCC0 match/capture 1.
+            USER_TCC0_MC2   = 0x08 << Bit::USER, ///< TCC0 match/capture 2.
+            USER_TCC0_MC3   = 0x09 << Bit::USER, ///< TCC0 match/capture 3.
+            USER_TCC1_EV0   = 0x0A << Bit::USER, ///< TCC1 event 0.
+            USER_TCC1_EV1   = 0x0B << Bit::USER, ///< TCC1 event 1.
+            USER_TCC1_MC0   = 0x0C << Bit::USER, ///< TCC1 match/capture 0.
+            USER_TCC1_MC1   = 0x0D << Bit::USER, ///< TCC1 match/capture 1.
+            USER_TCC2_EV0   = 0x0E << Bit::USER, ///< TCC2 event 0.
+            USER_TCC2_EV1   = 0x0F << Bit::USER, ///< TCC2 event 1.
+            USER_TCC2_MC0   = 0x10 << Bit::USER, ///< TCC2 match/capture 0.
+            USER_TCC2_MC1   = 0x11 << Bit::USER, ///< TCC2 match/capture 1.
+            USER_TC3        = 0x12 << Bit::USER, ///< TC3.
+            USER_TC4        = 0x13 << Bit::USER, ///< TC4.
+            USER_TC5        = 0x14 << Bit::USER, ///< TC5.
+            USER_TC6        = 0x15 << Bit::USER, ///< TC6.
+            USER_TC7        = 0x16 << Bit::USER, ///< TC7.
+            USER_ADC_START  = 0x17 << Bit::USER, ///< ADC start conversion.
+            USER_ADC_SYNC   = 0x18 << Bit::USER, ///< ADC flush.
+            USER_AC_SOC0    = 0x19 << Bit::USER, ///< AC start comparator 0.
+            USER_AC_SOC1    = 0x1A << Bit::USER, ///< AC start comparator 1.
+            USER_DAC_START  = 0x1B << Bit::USER, ///< DAC start conversion.
+            USER_PTC_STCONV = 0x1C << Bit::USER, ///< PTC start conversion.
+        };
+
+        USER() = delete;
+
+        USER( USER && ) = delete;
+
+        USER( USER const & ) = delete;
+
+        ~USER() = delete;
+
+        auto operator=( USER && ) = delete;
+
+        auto operator=( USER const & ) = delete;
+
+        using Register<std::uint16_t>::operator=;
+    };
+
+    /**
+     * \brief Channel Status (CHSTATUS) register.
+     *
+     * This register has the following fields:
+     * - Channel 0 User Ready (USRRDY0)
+     * - Channel 1 User Ready (USRRDY1)
+     * - Channel 2 User Ready (USRRDY2)
+     * - Channel 3 User Ready (USRRDY3)
+     * - Channel 4 User Ready (USRRDY4)
+     * - Channel 5 User Ready (USRRDY5)
+     * - Channel 6 User Ready (USRRDY6)
+     * - Channel 7 User Ready (USRRDY7)
+     * - Channel 0 Busy (CHBUSY0)
+     * - Channel 1 Busy (CHBUSY1)
+     * - Channel 2 Busy (CHBUSY2)
+     * - Channel 3 Busy (CHBUSY3)
+     * - Channel 4 Busy (CHBUSY4)
+     * - Channel 5 Busy (CHBUSY5)
+     * - Channel 6 Busy (CHBUSY6)
+     * - Channel 7 Busy (CHBUSY7)
+     * - Channel 8 User Ready (USRRDY8)
+     * - Channel 9 User Ready (USRRDY9)
+     * - Channel 10 User Ready (USRRDY10)
+     * - Channel 11 User Ready (USRRDY11)
+     * - Channel 8 Busy (CHBUSY8)
+     * - Channel 9 Busy (CHBUSY9)
+     * - Channel 10 Busy (CHBUSY10)
+     * - Channel 11 Busy (CHBUSY11)
+     */
+    class CHSTATUS : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto USRRDY0    = std::uint_fast8_t{ 1 }; ///< USRRDY0.
+            static constexpr auto USRRDY1    = std::uint_fast8_t{ 1 }; ///< USRRDY1.
+            static constexpr auto USRRDY2    = std::uint_fast8_t{ 1 }; ///< USRRDY2.
+            static constexpr auto USRRDY3    = std::uint_fast8_t{ 1 }; ///< USRRDY3.
+            static constexpr auto USRRDY4    = std::uint_fast8_t{ 1 }; ///< USRRDY4.
+            static constexpr auto USRRDY5    = std::uint_fast8_t{ 1 }; ///< USRRDY5.
+            static constexpr auto USRRDY6    = std::uint_fast8_t{ 1 }; ///< USRRDY6.
+            static constexpr auto USRRDY7    = std::uint_fast8_t{ 1 }; ///< USRRDY7.
+            static constexpr auto CHBUSY0    = std::uint_fast8_t{ 1 }; ///< CHBUSY0.
+            static constexpr auto CHBUSY1    = std::uint_fast8_t{ 1 }; ///< CHBUSY1.
+            static constexpr auto CHBUSY2    = std::uint_fast8_t{ 1 }; ///< CHBUSY2.
+            static constexpr auto CHBUSY3    = std::uint_fast8_t{ 1 }; ///< CHBUSY3.
+            static constexpr auto CHBUSY4    = std::uint_fast8_t{ 1 }; ///< CHBUSY4.
+            static constexpr auto CHBUSY5    = std::uint_fast8_t{ 1 }; ///< CHBUSY5.
+            static constexpr auto CHBUSY6    = std::uint_fast8_t{ 1 }; ///< CHBUSY6.
+            static constexpr auto CHBUSY7    = std::uint_fast8_t{ 1 }; ///< CHBUSY7.
+            static constexpr auto USRRDY8    = std::uint_fast8_t{ 1 }; ///< USRRDY8.
+            static constexpr auto USRRDY9    = std::uint_fast8_t{ 1 }; ///< USRRDY9.
+            static constexpr auto USRRDY10   = std::uint_fast8_t{ 1 }; ///< USRRDY10.
+            static constexpr auto USRRDY11   = std::uint_fast8_t{ 1 }; ///< USRRDY11.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 4 }; ///< RESERVED20.
+            static constexpr auto CHBUSY8    = std::uint_fast8_t{ 1 }; ///< CHBUSY8.
+            static constexpr auto CHBUSY9    = std::uint_fast8_t{ 1 }; ///< CHBUSY9.
+            static constexpr auto CHBUSY10   = std::uint_fast8_t{ 1 }; ///< CHBUSY10.
+            static constexpr auto CHBUSY11   = std::uint_fast8_t{ 1 }; ///< CHBUSY11.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto USRRDY0 = std::uint_fast8_t{}; ///< USRRDY0.
+            static constexpr auto USRRDY1 = std::uint_fast8_t{ USRRDY0 + Size::USRRDY0 }; ///< USRRDY1.
+            static constexpr auto USRRDY2 = std::uint_fast8_t{ USRRDY1 + Size::USRRDY1 }; ///< USRRDY2.
+            static constexpr auto USRRDY3 = std::uint_fast8_t{ USRRDY2 + Size::USRRDY2 }; ///< USRRDY3.
+            static constexpr auto USRRDY4 = std::uint_fast8_t{ USRRDY3 + Size::USRRDY3 }; ///< USRRDY4.
+            static constexpr auto USRRDY5 = std::uint_fast8_t{ USRRDY4 + Size::USRRDY4 }; ///< USRRDY5.
+            static constexpr auto USRRDY6 = std::uint_fast8_t{ USRRDY5 + Size::USRRDY5 }; ///< USRRDY6.
+            static constexpr auto USRRDY7 = std::uint_fast8_t{ USRRDY6 + Size::USRRDY6 }; ///< USRRDY7.
+            static constexpr auto CHBUSY0 = std::uint_fast8_t{ USRRDY7 + Size::USRRDY7 }; ///< CHBUSY0.
+            static constexpr auto CHBUSY1 = std::uint_fast8_t{ CHBUSY0 + Size::CHBUSY0 }; ///< CHBUSY1.
+            static constexpr auto CHBUSY2 = std::uint_fast8_t{ CHBUSY1 + Size::CHBUSY1 }; ///< CHBUSY2.
+            static constexpr auto CHBUSY3 = std::uint_fast8_t{ CHBUSY2 + Size::CHBUSY2 }; ///< CHBUSY3.
+            static constexpr auto CHBUSY4 = std::uint_fast8_t{ CHBUSY3 + Size::CHBUSY3 }; ///< CHBUSY4.
+            static constexpr auto CHBUSY5 = std::uint_fast8_t{ CHBUSY4 + Size::CHBUSY4 }; ///< CHBUSY5.
+            static constexpr auto CHBUSY6 = std::uint_fast8_t{ CHBUSY5 + Size::CHBUSY5 }; ///< CHBUSY6.
+            static constexpr auto CHBUSY7 = std::uint_fast8_t{ CHBUSY6 + Size::CHBUSY6 }; ///< CHBUSY7.
+            static constexpr auto USRRDY8 = std::uint_fast8_t{ CHBUSY7 + Size::CHBUSY7 }; ///< USRRDY8.
+            static constexpr auto USRRDY9 = std::uint_fast8_t{ USRRDY8 + Size::USRRDY8 }; ///< USRRDY9.
+            static constexpr auto USRRDY10 = std::uint_fast8_t{ USRRDY9 + Size::USRRDY9 }; ///< USRRDY10.
+            static constexpr auto USRRDY11 = std::uint_fast8_t{ USRRDY10 + Size::USRRDY10 }; ///< USRRDY11.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ USRRDY11 + Size::USRRDY11 }; ///< RESERVED20.
+            static constexpr auto CHBUSY8 = std::uint_fast8_t{ RESERVED20 + Size::RESERVED20 }; ///< CHBUSY8.
+            static constexpr auto CHBUSY9 = std::uint_fast8_t{ CHBUSY8 + Size::CHBUSY8 }; ///< CHBUSY9.
+            static constexpr auto CHBUSY10 = std::uint_fast8_t{ CHBUSY9 + Size::CHBUSY9 }; ///< CHBUSY10.
+            static constexpr auto CHBUSY11 = std::uint_fast8_t{ CHBUSY10 + Size::CHBUSY10 }; ///< CHBUSY11.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ CHBUSY11 + Size::CHBUSY11 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto USRRDY0 = mask<std::uint32_t>( Size::USRRDY0, Bit::USRRDY0 ); ///< USRRDY0.
+            static constexpr auto USRRDY1 = mask<std::uint32_t>( Size::USRRDY1, Bit::USRRDY1 ); ///< USRRDY1.
+            static constexpr auto USRRDY2 = mask<std::uint32_t>( Size::USRRDY2, Bit::USRRDY2 ); ///< USRRDY2.
+            static constexpr auto USRRDY3 = mask<std::uint32_t>( Size::USRRDY3, Bit::USRRDY3 ); ///< USRRDY3.
+            static constexpr auto USRRDY4 = mask<std::uint32_t>( Size::USRRDY4, Bit::USRRDY4 ); ///< USRRDY4.
+            static constexpr auto USRRDY5 = mask<std::uint32_t>( Size::USRRDY5, Bit::USRRDY5 ); ///< USRRDY5.
+            static constexpr auto USRRDY6 = mask<std::uint32_t>( Size::USRRDY6, Bit::USRRDY6 ); ///< USRRDY6.
+            static constexpr auto USRRDY7 = mask<std::uint32_t>( Size::USRRDY7, Bit::USRRDY7 ); ///< USRRDY7.
+            static constexpr auto CHBUSY0 = mask<std::uint32_t>( Size::CHBUSY0, Bit::CHBUSY0 ); ///< CHBUSY0.
+            static constexpr auto CHBUSY1 = mask<std::uint32_t>( Size::CHBUSY1, Bit::CHBUSY1 ); ///< CHBUSY1.
+            static constexpr auto CHBUSY2 = mask<std::uint32_t>( Size::CHBUSY2, Bit::CHBUSY2 ); ///< CHBUSY2.
+            static constexpr auto CHBUSY3 = mask<std::uint32_t>( Size::CHBUSY3, Bit::CHBUSY3 ); ///< CHBUSY3.
+            static constexpr auto CHBUSY4 = mask<std::uint32_t>( Size::CHBUSY4, Bit::CHBUSY4 ); ///< CHBUSY4.
+            static constexpr auto CHBUSY5 = mask<std::uint32_t>( Size::CHBUSY5, Bit::CHBUSY5 ); ///< CHBUSY5.
+            static constexpr auto CHBUSY6 = mask<std::uint32_t>( Size::CHBUSY6, Bit::CHBUSY6 ); ///< CHBUSY6.
+            static constexpr auto CHBUSY7 = mask<std::uint32_t>( Size::CHBUSY7, Bit::CHBUSY7 ); ///< CHBUSY7.
+            static constexpr auto USRRDY8 = mask<std::uint32_t>( Size::USRRDY8, Bit::USRRDY8 ); ///< USRRDY8.
+            static constexpr auto USRRDY9 = mask<std::uint32_t>( Size::USRRDY9, Bit::USRRDY9 ); ///< USRRDY9.
+            static constexpr auto USRRDY10 = mask<std::uint32_t>( Size::USRRDY10, Bit::USRRDY10 ); ///< USRRDY10.
+            static constexpr auto USRRDY11 = mask<std::uint32_t>( Size::USRRDY11, Bit::USRRDY11 ); ///< USRRDY11.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+            static constexpr auto CHBUSY8 = mask<std::uint32_t>( Size::CHBUSY8, Bit::CHBUSY8 ); ///< CHBUSY8.
+            static constexpr auto CHBUSY9 = mask<std::uint32_t>( Size::CHBUSY9, Bit::CHBUSY9 ); ///< CHBUSY9.
+            static constexpr auto CHBUSY10 = mask<std::uint32_t>( Size::CHBUSY10, Bit::CHBUSY10 ); ///< CHBUSY10.
+            static constexpr auto CHBUSY11 = mask<std::uint32_t>( Size::CHBUSY11, Bit::CHBUSY11 ); ///< CHBUSY11.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        CHSTATUS() = delete;
+
+        CHSTATUS( CHSTATUS && ) = delete;
+
+        CHSTATUS( CHSTATUS const & ) = delete;
+
+        ~CHSTATUS() = delete;
+
+        auto operator=( CHSTATUS && ) = delete;
+
+        auto operator=( CHSTATUS const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Enable Clear (INTENCLR) register.
+     *
+     * This register has the following fields:
+     * - Channel 0 Overrun Interrupt Enable (OVR0)
+     * - Channel 1 Overrun Interrupt Enable (OVR1)
+     * - Channel 2 Overrun Interrupt Enable (OVR2)
+     * - Channel 3 Overrun Interrupt Enable (OVR3)
+     * - Channel 4 Overrun Interrupt Enable (OVR4)
+     * - Channel 5 Overrun Interrupt Enable (OVR5)
+     * - Channel 6 Overrun Interrupt Enable (OVR6)
+     * - Channel 7 Overrun Interrupt Enable (OVR7)
+     * - Channel 0 Event Detection Interrupt Enable (EVD0)
+     * - Channel 1 Event Detection Interrupt Enable (EVD1)
+     * - Channel 2 Event Detection Interrupt Enable (EVD2)
+     * - Channel 3 Event Detection Interrupt Enable (EVD3)
+     * - Channel 4 Event Detection Interrupt Enable (EVD4)
+     * - Channel 5 Event Detection Interrupt Enable (EVD5)
+     * - Channel 6 Event Detection Interrupt Enable (EVD6)
+     * - Channel 7 Event Detection Interrupt Enable (EVD7)
+     * - Channel 8 Overrun Interrupt Enable (OVR8)
+     * - Channel 9 Overrun Interrupt Enable (OVR9)
+     * - Channel 10 Overrun Interrupt Enable (OVR10)
+     * - Channel 11 Overrun Interrupt Enable (OVR11)
+     * - Channel 8 Event Detection Interrupt Enable (EVD8)
+     * - Channel 9 Event Detection Interrupt Enable (EVD9)
+     * - Channel 10 Event Detection Interrupt Enable (EVD10)
+     * - Channel 11 Event Detection Interrupt Enable (EVD11)
+     */
+    class INTENCLR : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto OVR0       = std::uint_fast8_t{ 1 }; ///< OVR0.
+            static constexpr auto OVR1       = std::uint_fast8_t{ 1 }; ///< OVR1.
+            static constexpr auto OVR2       = std::uint_fast8_t{ 1 }; ///< OVR2.
+            static constexpr auto OVR3       = std::uint_fast8_t{ 1 }; ///< OVR3.
+            static constexpr auto OVR4       = std::uint_fast8_t{ 1 }; ///< OVR4.
+            static constexpr auto OVR5       = std::uint_fast8_t{ 1 }; ///< OVR5.
+            static constexpr auto OVR6       = std::uint_fast8_t{ 1 }; ///< OVR6.
+            static constexpr auto OVR7       = std::uint_fast8_t{ 1 }; ///< OVR7.
+            static constexpr auto EVD0       = std::uint_fast8_t{ 1 }; ///< EVD0.
+            static constexpr auto EVD1       = std::uint_fast8_t{ 1 }; ///< EVD1.
+            static constexpr auto EVD2       = std::uint_fast8_t{ 1 }; ///< EVD2.
+            static constexpr auto EVD3       = std::uint_fast8_t{ 1 }; ///< EVD3.
+            static constexpr auto EVD4       = std::uint_fast8_t{ 1 }; ///< EVD4.
+            static constexpr auto EVD5       = std::uint_fast8_t{ 1 }; ///< EVD5.
+            static constexpr auto EVD6       = std::uint_fast8_t{ 1 }; ///< EVD6.
+            static constexpr auto EVD7       = std::uint_fast8_t{ 1 }; ///< EVD7.
+            static constexpr auto OVR8       = std::uint_fast8_t{ 1 }; ///< OVR8.
+            static constexpr auto OVR9       = std::uint_fast8_t{ 1 }; ///< OVR9.
+            static constexpr auto OVR10      = std::uint_fast8_t{ 1 }; ///< OVR10.
+            static constexpr auto OVR11      = std::uint_fast8_t{ 1 }; ///< OVR11.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 4 }; ///< RESERVED20.
+            static constexpr auto EVD8       = std::uint_fast8_t{ 1 }; ///< EVD8.
+            static constexpr auto EVD9       = std::uint_fast8_t{ 1 }; ///< EVD9.
+            static constexpr auto EVD10      = std::uint_fast8_t{ 1 }; ///< EVD10.
+            static constexpr auto EVD11      = std::uint_fast8_t{ 1 }; ///< EVD11.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto OVR0 = std::uint_fast8_t{}; ///< OVR0.
+            static constexpr auto OVR1 = std::uint_fast8_t{ OVR0 + Size::OVR0 }; ///< OVR1.
+            static constexpr auto OVR2 = std::uint_fast8_t{ OVR1 + Size::OVR1 }; ///< OVR2.
+            static constexpr auto OVR3 = std::uint_fast8_t{ OVR2 + Size::OVR2 }; ///< OVR3.
+            static constexpr auto OVR4 = std::uint_fast8_t{ OVR3 + Size::OVR3 }; ///< OVR4.
+            static constexpr auto OVR5 = std::uint_fast8_t{ OVR4 + Size::OVR4 }; ///< OVR5.
+            static constexpr auto OVR6 = std::uint_fast8_t{ OVR5 + Size::OVR5 }; ///< OVR6.
+            static constexpr auto OVR7 = std::uint_fast8_t{ OVR6 + Size::OVR6 }; ///< OVR7.
+            static constexpr auto EVD0 = std::uint_fast8_t{ OVR7 + Size::OVR7 }; ///< EVD0.
+            static constexpr auto EVD1 = std::uint_fast8_t{ EVD0 + Size::EVD0 }; ///< EVD1.
+            static constexpr auto EVD2 = std::uint_fast8_t{ EVD1 + Size::EVD1 }; ///< EVD2.
+            static constexpr auto EVD3 = std::uint_fast8_t{ EVD2 + Size::EVD2 }; ///< EVD3.
+            static constexpr auto EVD4 = std::uint_fast8_t{ EVD3 + Size::EVD3 }; ///< EVD4.
+            static constexpr auto EVD5 = std::uint_fast8_t{ EVD4 + Size::EVD4 }; ///< EVD5.
+            static constexpr auto EVD6 = std::uint_fast8_t{ EVD5 + Size::EVD5 }; ///< EVD6.
+            static constexpr auto EVD7 = std::uint_fast8_t{ EVD6 + Size::EVD6 }; ///< EVD7.
+            static constexpr auto OVR8 = std::uint_fast8_t{ EVD7 + Size::EVD7 }; ///< OVR8.
+            static constexpr auto OVR9 = std::uint_fast8_t{ OVR8 + Size::OVR8 }; ///< OVR9.
+            static constexpr auto OVR10 = std::uint_fast8_t{ OVR9 + Size::OVR9 }; ///< OVR10.
+            static constexpr auto OVR11 = std::uint_fast8_t{ OVR10 + Size::OVR10 }; ///< OVR11.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ OVR11 + Size::OVR11 }; ///< RESERVED20.
+            static constexpr auto EVD8 = std::uint_fast8_t{ RESERVED20 + Size::RESERVED20 }; ///< EVD8.
+            static constexpr auto EVD9 = std::uint_fast8_t{ EVD8 + Size::EVD8 }; ///< EVD9.
+            static constexpr auto EVD10 = std::uint_fast8_t{ EVD9 + Size::EVD9 }; ///< EVD10.
+            static constexpr auto EVD11 = std::uint_fast8_t{ EVD10 + Size::EVD10 }; ///< EVD11.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ EVD11 + Size::EVD11 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto OVR0 = mask<std::uint32_t>( Size::OVR0, Bit::OVR0 ); ///< OVR0.
+            static constexpr auto OVR1 = mask<std::uint32_t>( Size::OVR1, Bit::OVR1 ); ///< OVR1.
+            static constexpr auto OVR2 = mask<std::uint32_t>( Size::OVR2, Bit::OVR2 ); ///< OVR2.
+            static constexpr auto OVR3 = mask<std::uint32_t>( Size::OVR3, Bit::OVR3 ); ///< OVR3.
+            static constexpr auto OVR4 = mask<std::uint32_t>( Size::OVR4, Bit::OVR4 ); ///< OVR4.
+            static constexpr auto OVR5 = mask<std::uint32_t>( Size::OVR5, Bit::OVR5 ); ///< OVR5.
+            static constexpr auto OVR6 = mask<std::uint32_t>( Size::OVR6, Bit::OVR6 ); ///< OVR6.
+            static constexpr auto OVR7 = mask<std::uint32_t>( Size::OVR7, Bit::OVR7 ); ///< OVR7.
+            static constexpr auto EVD0 = mask<std::uint32_t>( Size::EVD0, Bit::EVD0 ); ///< EVD0.
+            static constexpr auto EVD1 = mask<std::uint32_t>( Size::EVD1, Bit::EVD1 ); ///< EVD1.
+            static constexpr auto EVD2 = mask<std::uint32_t>( Size::EVD2, Bit::EVD2 ); ///< EVD2.
+            static constexpr auto EVD3 = mask<std::uint32_t>( Size::EVD3, Bit::EVD3 ); ///< EVD3.
+            static constexpr auto EVD4 = mask<std::uint32_t>( Size::EVD4, Bit::EVD4 ); ///< EVD4.
+            static constexpr auto EVD5 = mask<std::uint32_t>( Size::EVD5, Bit::EVD5 ); ///< EVD5.
+            static constexpr auto EVD6 = mask<std::uint32_t>( Size::EVD6, Bit::EVD6 ); ///< EVD6.
+            static constexpr auto EVD7 = mask<std::uint32_t>( Size::EVD7, Bit::EVD7 ); ///< EVD7.
+            static constexpr auto OVR8 = mask<std::uint32_t>( Size::OVR8, Bit::OVR8 ); ///< OVR8.
+            static constexpr auto OVR9 = mask<std::uint32_t>( Size::OVR9, Bit::OVR9 ); ///< OVR9.
+            static constexpr auto OVR10 = mask<std::uint32_t>( Size::OVR10, Bit::OVR10 ); ///< OVR10.
+            static constexpr auto OVR11 = mask<std::uint32_t>( Size::OVR11, Bit::OVR11 ); ///< OVR11.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+            static constexpr auto EVD8 = mask<std::uint32_t>( Size::EVD8, Bit::EVD8 ); ///< EVD8.
+            static constexpr auto EVD9 = mask<std::uint32_t>( Size::EVD9, Bit::EVD9 ); ///< EVD9.
+            static constexpr auto EVD10 = mask<std::uint32_t>( Size::EVD10, Bit::EVD10 ); ///< EVD10.
+            static constexpr auto EVD11 = mask<std::uint32_t>( Size::EVD11, Bit::EVD11 ); ///< EVD11.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        INTENCLR() = delete;
+
+        INTENCLR( INTENCLR && ) = delete;
+
+        INTENCLR( INTENCLR const & ) = delete;
+
+        ~INTENCLR() = delete;
+
+        auto operator=( INTENCLR && ) = delete;
+
+        auto operator=( INTENCLR const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Enable Set (INTENSET) register.
+     *
+     * This register has the following fields:
+     * - Channel 0 Overrun Interrupt Enable (OVR0)
+     * - Channel 1 Overrun Interrupt Enable (OVR1)
+     * - Channel 2 Overrun Interrupt Enable (OVR2)
+     * - Channel 3 Overrun Interrupt Enable (OVR3)
+     * - Channel 4 Overrun Interrupt Enable (OVR4)
+     * - Channel 5 Overrun Interrupt Enable (OVR5)
+     * - Channel 6 Overrun Interrupt Enable (OVR6)
+     * - Channel 7 Overrun Interrupt Enable (OVR7)
+     * - Channel 0 Event Detection Interrupt Enable (EVD0)
+     * - Channel 1 Event Detection Interrupt Enable (EVD1)
+     * - Channel 2 Event Detection Interrupt Enable (EVD2)
+     * - Channel 3 Event Detection Interrupt Enable (EVD3)
+     * - Channel 4 Event Detection Interrupt Enable (EVD4)
+     * - Channel 5 Event Detection Interrupt Enable (EVD5)
+     * - Channel 6 Event Detection Interrupt Enable (EVD6)
+     * - Channel 7 Event Detection Interrupt Enable (EVD7)
+     * - Channel 8 Overrun Interrupt Enable (OVR8)
+     * - Channel 9 Overrun Interrupt Enable (OVR9)
+     * - Channel 10 Overrun Interrupt Enable (OVR10)
+     * - Channel 11 Overrun Interrupt Enable (OVR11)
+     * - Channel 8 Event Detection Interrupt Enable (EVD8)
+     * - Channel 9 Event Detection Interrupt Enable (EVD9)
+     * - Channel 10 Event Detection Interrupt Enable (EVD10)
+     * - Channel 11 Event Detection Interrupt Enable (EVD11)
+     */
+    class INTENSET : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto OVR0       = std::uint_fast8_t{ 1 }; ///< OVR0.
+            static constexpr auto OVR1       = std::uint_fast8_t{ 1 }; ///< OVR1.
+            static constexpr auto OVR2       = std::uint_fast8_t{ 1 }; ///< OVR2.
+            static constexpr auto OVR3       = std::uint_fast8_t{ 1 }; ///< OVR3.
+            static constexpr auto OVR4       = std::uint_fast8_t{ 1 }; ///< OVR4.
+            static constexpr auto OVR5       = std::uint_fast8_t{ 1 }; ///< OVR5.
+            static constexpr auto OVR6       = std::uint_fast8_t{ 1 }; ///< OVR6.
+            static constexpr auto OVR7       = std::uint_fast8_t{ 1 }; ///< OVR7.
+            static constexpr auto EVD0       = std::uint_fast8_t{ 1 }; ///< EVD0.
+            static constexpr auto EVD1       = std::uint_fast8_t{ 1 }; ///< EVD1.
+            static constexpr auto EVD2       = std::uint_fast8_t{ 1 }; ///< EVD2.
+            static constexpr auto EVD3       = std::uint_fast8_t{ 1 }; ///< EVD3.
+            static constexpr auto EVD4       = std::uint_fast8_t{ 1 }; ///< EVD4.
+            static constexpr auto EVD5       = std::uint_fast8_t{ 1 }; ///< EVD5.
+            static constexpr auto EVD6       = std::uint_fast8_t{ 1 }; ///< EVD6.
+            static constexpr auto EVD7       = std::uint_fast8_t{ 1 }; ///< EVD7.
+            static constexpr auto OVR8       = std::uint_fast8_t{ 1 }; ///< OVR8.
+            static constexpr auto OVR9       = std::uint_fast8_t{ 1 }; ///< OVR9.
+            static constexpr auto OVR10      = std::uint_fast8_t{ 1 }; ///< OVR10.
+            static constexpr auto OVR11      = std::uint_fast8_t{ 1 }; ///< OVR11.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 4 }; ///< RESERVED20.
+            static constexpr auto EVD8       = std::uint_fast8_t{ 1 }; ///< EVD8.
+            static constexpr auto EVD9       = std::uint_fast8_t{ 1 }; ///< EVD9.
+            static constexpr auto EVD10      = std::uint_fast8_t{ 1 }; ///< EVD10.
+            static constexpr auto EVD11      = std::uint_fast8_t{ 1 }; ///< EVD11.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto OVR0 = std::uint_fast8_t{}; ///< OVR0.
+            static constexpr auto OVR1 = std::uint_fast8_t{ OVR0 + Size::OVR0 }; ///< OVR1.
+            static constexpr auto OVR2 = std::uint_fast8_t{ OVR1 + Size::OVR1 }; ///< OVR2.
+            static constexpr auto OVR3 = std::uint_fast8_t{ OVR2 + Size::OVR2 }; ///< OVR3.
+            static constexpr auto OVR4 = std::uint_fast8_t{ OVR3 + Size::OVR3 }; ///< OVR4.
+            static constexpr auto OVR5 = std::uint_fast8_t{ OVR4 + Size::OVR4 }; ///< OVR5.
+            static constexpr auto OVR6 = std::uint_fast8_t{ OVR5 + Size::OVR5 }; ///< OVR6.
+            static constexpr auto OVR7 = std::uint_fast8_t{ OVR6 + Size::OVR6 }; ///< OVR7.
+            static constexpr auto EVD0 = std::uint_fast8_t{ OVR7 + Size::OVR7 }; ///< EVD0.
+            static constexpr auto EVD1 = std::uint_fast8_t{ EVD0 + Size::EVD0 }; ///< EVD1.
+            static constexpr auto EVD2 = std::uint_fast8_t{ EVD1 + Size::EVD1 }; ///< EVD2.
+            static constexpr auto EVD3 = std::uint_fast8_t{ EVD2 + Size::EVD2 }; ///< EVD3.
+            static constexpr auto EVD4 = std::uint_fast8_t{ EVD3 + Size::EVD3 }; ///< EVD4.
+            static constexpr auto EVD5 = std::uint_fast8_t{ EVD4 + Size::EVD4 }; ///< EVD5.
+            static constexpr auto EVD6 = std::uint_fast8_t{ EVD5 + Size::EVD5 }; ///< EVD6.
+            static constexpr auto EVD7 = std::uint_fast8_t{ EVD6 + Size::EVD6 }; ///< EVD7.
+            static constexpr auto OVR8 = std::uint_fast8_t{ EVD7 + Size::EVD7 }; ///< OVR8.
+            static constexpr auto OVR9 = std::uint_fast8_t{ OVR8 + Size::OVR8 }; ///< OVR9.
+            static constexpr auto OVR10 = std::uint_fast8_t{ OVR9 + Size::OVR9 }; ///< OVR10.
+            static constexpr auto OVR11 = std::uint_fast8_t{ OVR10 + Size::OVR10 }; ///< OVR11.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ OVR11 + Size::OVR11 }; ///< RESERVED20.
+            static constexpr auto EVD8 = std::uint_fast8_t{ RESERVED20 + Size::RESERVED20 }; ///< EVD8.
+            static constexpr auto EVD9 = std::uint_fast8_t{ EVD8 + Size::EVD8 }; ///< EVD9.
+            static constexpr auto EVD10 = std::uint_fast8_t{ EVD9 + Size::EVD9 }; ///< EVD10.
+            static constexpr auto EVD11 = std::uint_fast8_t{ EVD10 + Size::EVD10 }; ///< EVD11.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ EVD11 + Size::EVD11 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto OVR0 = mask<std::uint32_t>( Size::OVR0, Bit::OVR0 ); ///< OVR0.
+            static constexpr auto OVR1 = mask<std::uint32_t>( Size::OVR1, Bit::OVR1 ); ///< OVR1.
+            static constexpr auto OVR2 = mask<std::uint32_t>( Size::OVR2, Bit::OVR2 ); ///< OVR2.
+            static constexpr auto OVR3 = mask<std::uint32_t>( Size::OVR3, Bit::OVR3 ); ///< OVR3.
+            static constexpr auto OVR4 = mask<std::uint32_t>( Size::OVR4, Bit::OVR4 ); ///< OVR4.
+            static constexpr auto OVR5 = mask<std::uint32_t>( Size::OVR5, Bit::OVR5 ); ///< OVR5.
+            static constexpr auto OVR6 = mask<std::uint32_t>( Size::OVR6, Bit::OVR6 ); ///< OVR6.
+            static constexpr auto OVR7 = mask<std::uint32_t>( Size::OVR7, Bit::OVR7 ); ///< OVR7.
+            static constexpr auto EVD0 = mask<std::uint32_t>( Size::EVD0, Bit::EVD0 ); ///< EVD0.
+            static constexpr auto EVD1 = mask<std::uint32_t>( Size::EVD1, Bit::EVD1 ); ///< EVD1.
+            static constexpr auto EVD2 = mask<std::uint32_t>( Size::EVD2, Bit::EVD2 ); ///< EVD2.
+            static constexpr auto EVD3 = mask<std::uint32_t>( Size::EVD3, Bit::EVD3 ); ///< EVD3.
+            static constexpr auto EVD4 = mask<std::uint32_t>( Size::EVD4, Bit::EVD4 ); ///< EVD4.
+            static constexpr auto EVD5 = mask<std::uint32_t>( Size::EVD5, Bit::EVD5 ); ///< EVD5.
+            static constexpr auto EVD6 = mask<std::uint32_t>( Size::EVD6, Bit::EVD6 ); ///< EVD6.
+            static constexpr auto EVD7 = mask<std::uint32_t>( Size::EVD7, Bit::EVD7 ); ///< EVD7.
+            static constexpr auto OVR8 = mask<std::uint32_t>( Size::OVR8, Bit::OVR8 ); ///< OVR8.
+            static constexpr auto OVR9 = mask<std::uint32_t>( Size::OVR9, Bit::OVR9 ); ///< OVR9.
+            static constexpr auto OVR10 = mask<std::uint32_t>( Size::OVR10, Bit::OVR10 ); ///< OVR10.
+            static constexpr auto OVR11 = mask<std::uint32_t>( Size::OVR11, Bit::OVR11 ); ///< OVR11.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+            static constexpr auto EVD8 = mask<std::uint32_t>( Size::EVD8, Bit::EVD8 ); ///< EVD8.
+            static constexpr auto EVD9 = mask<std::uint32_t>( Size::EVD9, Bit::EVD9 ); ///< EVD9.
+            static constexpr auto EVD10 = mask<std::uint32_t>( Size::EVD10, Bit::EVD10 ); ///< EVD10.
+            static constexpr auto EVD11 = mask<std::uint32_t>( Size::EVD11, Bit::EVD11 ); ///< EVD11.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        INTENSET() = delete;
+
+        INTENSET( INTENSET && ) = delete;
+
+        INTENSET( INTENSET const & ) = delete;
+
+        ~INTENSET() = delete;
+
+        auto operator=( INTENSET && ) = delete;
+
+        auto operator=( INTENSET const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+     *
+     * This register has the following fields:
+     * - Channel 0 Overrun (OVR0)
+     * - Channel 1 Overrun (OVR1)
+     * - Channel 2 Overrun (OVR2)
+     * - Channel 3 Overrun (OVR3)
+     * - Channel 4 Overrun (OVR4)
+     * - Channel 5 Overrun (OVR5)
+     * - Channel 6 Overrun (OVR6)
+     * - Channel 7 Overrun (OVR7)
+     * - Channel 0 Event Detection (EVD0)
+     * - Channel 1 Event Detection (EVD1)
+     * - Channel 2 Event Detection (EVD2)
+     * - Channel 3 Event Detection (EVD3)
+     * - Channel 4 Event Detection (EVD4)
+     * - Channel 5 Event Detection (EVD5)
+     * - Channel 6 Event Detection (EVD6)
+     * - Channel 7 Event Detection (EVD7)
+     * - Channel 8 Overrun (OVR8)
+     * - Channel 9 Overrun (OVR9)
+     * - Channel 10 Overrun (OVR10)
+     * - Channel 11 Overrun (OVR11)
+     * - Channel 8 Event Detection (EVD8)
+     * - Channel 9 Event Detection (EVD9)
+     * - Channel 10 Event Detection (EVD10)
+     * - Channel 11 Event Detection (EVD11)
+     */
+    class INTFLAG : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto OVR0       = std::uint_fast8_t{ 1 }; ///< OVR0.
+            static constexpr auto OVR1       = std::uint_fast8_t{ 1 }; ///< OVR1.
+            static constexpr auto OVR2       = std::uint_fast8_t{ 1 }; ///< OVR2.
+            static constexpr auto OVR3       = std::uint_fast8_t{ 1 }; ///< OVR3.
+            static constexpr auto OVR4       = std::uint_fast8_t{ 1 }; ///< OVR4.
+            static constexpr auto OVR5       = std::uint_fast8_t{ 1 }; ///< OVR5.
+            static constexpr auto OVR6       = std::uint_fast8_t{ 1 }; ///< OVR6.
+            static constexpr auto OVR7       = std::uint_fast8_t{ 1 }; ///< OVR7.
+            static constexpr auto EVD0       = std::uint_fast8_t{ 1 }; ///< EVD0.
+            static constexpr auto EVD1       = std::uint_fast8_t{ 1 }; ///< EVD1.
+            static constexpr auto EVD2       = std::uint_fast8_t{ 1 }; ///< EVD2.
+            static constexpr auto EVD3       = std::uint_fast8_t{ 1 }; ///< EVD3.
+            static constexpr auto EVD4       = std::uint_fast8_t{ 1 }; ///< EVD4.
+            static constexpr auto EVD5       = std::uint_fast8_t{ 1 }; ///< EVD5.
+            static constexpr auto EVD6       = std::uint_fast8_t{ 1 }; ///< EVD6.
+            static constexpr auto EVD7       = std::uint_fast8_t{ 1 }; ///< EVD7.
+            static constexpr auto OVR8       = std::uint_fast8_t{ 1 }; ///< OVR8.
+            static constexpr auto OVR9       = std::uint_fast8_t{ 1 }; ///< OVR9.
+            static constexpr auto OVR10      = std::uint_fast8_t{ 1 }; ///< OVR10.
+            static constexpr auto OVR11      = std::uint_fast8_t{ 1 }; ///< OVR11.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 4 }; ///< RESERVED20.
+            static constexpr auto EVD8       = std::uint_fast8_t{ 1 }; ///< EVD8.
+            static constexpr auto EVD9       = std::uint_fast8_t{ 1 }; ///< EVD9.
+            static constexpr auto EVD10      = std::uint_fast8_t{ 1 }; ///< EVD10.
+            static constexpr auto EVD11      = std::uint_fast8_t{ 1 }; ///< EVD11.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto OVR0 = std::uint_fast8_t{}; ///< OVR0.
+            static constexpr auto OVR1 = std::uint_fast8_t{ OVR0 + Size::OVR0 }; ///< OVR1.
+            static constexpr auto OVR2 = std::uint_fast8_t{ OVR1 + Size::OVR1 }; ///< OVR2.
+            static constexpr auto OVR3 = std::uint_fast8_t{ OVR2 + Size::OVR2 }; ///< OVR3.
+            static constexpr auto OVR4 = std::uint_fast8_t{ OVR3 + Size::OVR3 }; ///< OVR4.
+            static constexpr auto OVR5 = std::uint_fast8_t{ OVR4 + Size::OVR4 }; ///< OVR5.
+            static constexpr auto OVR6 = std::uint_fast8_t{ OVR5 + Size::OVR5 }; ///< OVR6.
+            static constexpr auto OVR7 = std::uint_fast8_t{ OVR6 + Size::OVR6 }; ///< OVR7.
+            static constexpr auto EVD0 = std::uint_fast8_t{ OVR7 + Size::OVR7 }; ///< EVD0.
+            static constexpr auto EVD1 = std::uint_fast8_t{ EVD0 + Size::EVD0 }; ///< EVD1.
+            static constexpr auto EVD2 = std::uint_fast8_t{ EVD1 + Size::EVD1 }; ///< EVD2.
+            static constexpr auto EVD3 = std::uint_fast8_t{ EVD2 + Size::EVD2 }; ///< EVD3.
+            static constexpr auto EVD4 = std::uint_fast8_t{ EVD3 + Size::EVD3 }; ///< EVD4.
+            static constexpr auto EVD5 = std::uint_fast8_t{ EVD4 + Size::EVD4 }; ///< EVD5.
+            static constexpr auto EVD6 = std::uint_fast8_t{ EVD5 + Size::EVD5 }; ///< EVD6.
+            static constexpr auto EVD7 = std::uint_fast8_t{ EVD6 + Size::EVD6 }; ///< EVD7.
+            static constexpr auto OVR8 = std::uint_fast8_t{ EVD7 + Size::EVD7 }; ///< OVR8.
+            static constexpr auto OVR9 = std::uint_fast8_t{ OVR8 + Size::OVR8 }; ///< OVR9.
+            static constexpr auto OVR10 = std::uint_fast8_t{ OVR9 + Size::OVR9 }; ///< OVR10.
+            static constexpr auto OVR11 = std::uint_fast8_t{ OVR10 + Size::OVR10 }; ///< OVR11.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ OVR11 + Size::OVR11 }; ///< RESERVED20.
+            static constexpr auto EVD8 = std::uint_fast8_t{ RESERVED20 + Size::RESERVED20 }; ///< EVD8.
+            static constexpr auto EVD9 = std::uint_fast8_t{ EVD8 + Size::EVD8 }; ///< EVD9.
+            static constexpr auto EVD10 = std::uint_fast8_t{ EVD9 + Size::EVD9 }; ///< EVD10.
+            static constexpr auto EVD11 = std::uint_fast8_t{ EVD10 + Size::EVD10 }; ///< EVD11.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ EVD11 + Size::EVD11 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto OVR0 = mask<std::uint32_t>( Size::OVR0, Bit::OVR0 ); ///< OVR0.
+            static constexpr auto OVR1 = mask<std::uint32_t>( Size::OVR1, Bit::OVR1 ); ///< OVR1.
+            static constexpr auto OVR2 = mask<std::uint32_t>( Size::OVR2, Bit::OVR2 ); ///< OVR2.
+            static constexpr auto OVR3 = mask<std::uint32_t>( Size::OVR3, Bit::OVR3 ); ///< OVR3.
+            static constexpr auto OVR4 = mask<std::uint32_t>( Size::OVR4, Bit::OVR4 ); ///< OVR4.
+            static constexpr auto OVR5 = mask<std::uint32_t>( Size::OVR5, Bit::OVR5 ); ///< OVR5.
+            static constexpr auto OVR6 = mask<std::uint32_t>( Size::OVR6, Bit::OVR6 ); ///< OVR6.
+            static constexpr auto OVR7 = mask<std::uint32_t>( Size::OVR7, Bit::OVR7 ); ///< OVR7.
+            static constexpr auto EVD0 = mask<std::uint32_t>( Size::EVD0, Bit::EVD0 ); ///< EVD0.
+            static constexpr auto EVD1 = mask<std::uint32_t>( Size::EVD1, Bit::EVD1 ); ///< EVD1.
+            static constexpr auto EVD2 = mask<std::uint32_t>( Size::EVD2, Bit::EVD2 ); ///< EVD2.
+            static constexpr auto EVD3 = mask<std::uint32_t>( Size::EVD3, Bit::EVD3 ); ///< EVD3.
+            static constexpr auto EVD4 = mask<std::uint32_t>( Size::EVD4, Bit::EVD4 ); ///< EVD4.
+            static constexpr auto EVD5 = mask<std::uint32_t>( Size::EVD5, Bit::EVD5 ); ///< EVD5.
+            static constexpr auto EVD6 = mask<std::uint32_t>( Size::EVD6, Bit::EVD6 ); ///< EVD6.
+            static constexpr auto EVD7 = mask<std::uint32_t>( Size::EVD7, Bit::EVD7 ); ///< EVD7.
+            static constexpr auto OVR8 = mask<std::uint32_t>( Size::OVR8, Bit::OVR8 ); ///< OVR8.
+            static constexpr auto OVR9 = mask<std::uint32_t>( Size::OVR9, Bit::OVR9 ); ///< OVR9.
+            static constexpr auto OVR10 = mask<std::uint32_t>( Size::OVR10, Bit::OVR10 ); ///< OVR10.
+            static constexpr auto OVR11 = mask<std::uint32_t>( Size::OVR11, Bit::OVR11 ); ///< OVR11.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+            static constexpr auto EVD8 = mask<std::uint32_t>( Size::EVD8, Bit::EVD8 ); ///< EVD8.
+            static constexpr auto EVD9 = mask<std::uint32_t>( Size::EVD9, Bit::EVD9 ); ///< EVD9.
+            static constexpr auto EVD10 = mask<std::uint32_t>( Size::EVD10, Bit::EVD10 ); ///< EVD10.
+            static constexpr auto EVD11 = mask<std::uint32_t>( Size::EVD11, Bit::EVD11 ); ///< EVD11.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        INTFLAG() = delete;
+
+        INTFLAG( INTFLAG && ) = delete;
+
+        INTFLAG( INTFLAG const & ) = delete;
+
+        ~INTFLAG() = delete;
+
+        auto operator=( INTFLAG && ) = delete;
+
+        auto operator=( INTFLAG const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief CTRL.
+     */
+    CTRL ctrl;
+
+    /**
+     * \brief Reserved registers (offset 0x01-0x03).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x01_0x03[ ( 0x03 - 0x01 ) + 1 ];
+
+    /**
+     * \brief CHANNEL.
+     */
+    CHANNEL channel;
+
+    /**
+     * \brief USER.
+     */
+    USER user;
+
+    /**
+     * \brief Reserved registers (offset 0x0A-0x0B).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x0A_0x0B[ ( 0x0B - 0x0A ) + 1 ];
+
+    /**
+     * \brief CHSTATUS.
+     */
+    CHSTATUS const chstatus;
+
+    /**
+     * \brief INTENCLR.
+     */
+    INTENCLR intenclr;
+
+    /**
+     * \brief INTENSET.
+     */
+    INTENSET intenset;
+
+    /**
+     * \brief INTFLAG.
+     */
+    INTFLAG intflag;
+
+    EVSYS() = delete;
+
+    EVSYS( EVSYS && ) = delete;
+
+    EVSYS( EVSYS const & ) = delete;
+
+    ~EVSYS() = delete;
+
+    auto operator=( EVSYS && ) = delete;
+
+    auto operator=( EVSYS const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_EVSYS_H
@@ -166,6 +166,13 @@ class NVMCTRL {
             CMD_UDR = 0x48 << Bit::CMD,
         };
 
+        /**
+         * \brief CMDEX.
+         */
+        enum CMDEX : std::uint16_t {
+            CMDEX_KEY = 0xA5 << Bit::CMDEX, ///< Command execution key.
+        };
+
         CTRLA() = delete;
 
         CTRLA( CTRLA && ) = delete;
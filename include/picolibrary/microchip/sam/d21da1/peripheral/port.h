@@ -0,0 +1,424 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Peripheral::PORT interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_PORT_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_PORT_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Peripheral {
+
+/**
+ * \brief Microchip SAM D21/DA1 I/O Pin Controller (PORT) peripheral.
+ *
+ * The Data Direction, Data Output Value, and Data Input Value registers can also be
+ * accessed (in a single cycle) using the IOBUS (see
+ * picolibrary::Microchip::SAM::D21DA1::Peripheral::PORT0_IOBUS), all other registers
+ * must be accessed using the APB (see
+ * picolibrary::Microchip::SAM::D21DA1::Peripheral::PORT0).
+ */
+class PORT {
+  public:
+    /**
+     * \brief I/O pin group registers.
+     */
+    class GROUP {
+      public:
+        /**
+         * \brief Control (CTRL) register.
+         *
+         * This register has the following fields:
+         * - Input Sampling Mode (SAMPLING)
+         */
+        class CTRL : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SAMPLING = std::uint_fast8_t{ 32 }; ///< SAMPLING.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SAMPLING = std::uint_fast8_t{}; ///< SAMPLING.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SAMPLING = mask<std::uint32_t>( Size::SAMPLING, Bit::SAMPLING ); ///< SAMPLING.
+            };
+
+            CTRL() = delete;
+
+            CTRL( CTRL && ) = delete;
+
+            CTRL( CTRL const & ) = delete;
+
+            ~CTRL() = delete;
+
+            auto operator=( CTRL && ) = delete;
+
+            auto operator=( CTRL const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Write Configuration (WRCONFIG) register.
+         *
+         * This register has the following fields:
+         * - Pin Mask for Multiple Pin Configuration (PINMASK)
+         * - Peripheral Multiplexer Enable (PMUXEN)
+         * - Input Enable (INEN)
+         * - Pull Enable (PULLEN)
+         * - Output Driver Strength Selection (DRVSTR)
+         * - Peripheral Multiplexing (PMUX)
+         * - Write PMUX (WRPMUX)
+         * - Write PINCFG (WRPINCFG)
+         * - Half-Word Select (HWSEL)
+         */
+        class WRCONFIG : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto PINMASK    = std::uint_fast8_t{ 16 }; ///< PINMASK.
+                static constexpr auto PMUXEN     = std::uint_fast8_t{ 1 };  ///< PMUXEN.
+                static constexpr auto INEN       = std::uint_fast8_t{ 1 };  ///< INEN.
+                static constexpr auto PULLEN     = std::uint_fast8_t{ 1 };  ///< PULLEN.
+                static constexpr auto RESERVED19 = std::uint_fast8_t{ 3 }; ///< RESERVED19.
+                static constexpr auto DRVSTR     = std::uint_fast8_t{ 1 }; ///< DRVSTR.
+                static constexpr auto RESERVED23 = std::uint_fast8_t{ 1 }; ///< RESERVED23.
+                static constexpr auto PMUX       = std::uint_fast8_t{ 4 }; ///< PMUX.
+                static constexpr auto WRPMUX     = std::uint_fast8_t{ 1 }; ///< WRPMUX.
+                static constexpr auto RESERVED29 = std::uint_fast8_t{ 1 }; ///< RESERVED29.
+                static constexpr auto WRPINCFG   = std::uint_fast8_t{ 1 }; ///< WRPINCFG.
+                static constexpr auto HWSEL      = std::uint_fast8_t{ 1 }; ///< HWSEL.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto PINMASK = std::uint_fast8_t{}; ///< PINMASK.
+                static constexpr auto PMUXEN = std::uint_fast8_t{ PINMASK + Size::PINMASK }; ///< PMUXEN.
+                static constexpr auto INEN = std::uint_fast8_t{ PMUXEN + Size::PMUXEN }; ///< INEN.
+                static constexpr auto PULLEN = std::uint_fast8_t{ INEN + Size::INEN }; ///< PULLEN.
+                static constexpr auto RESERVED19 = std::uint_fast8_t{ PULLEN + Size::PULLEN }; ///< RESERVED19.
+                static constexpr auto DRVSTR = std::uint_fast8_t{ RESERVED19 + Size::RESERVED19 }; ///< DRVSTR.
+                static constexpr auto RESERVED23 = std::uint_fast8_t{ DRVSTR + Size::DRVSTR }; ///< RESERVED23.
+                static constexpr auto PMUX = std::uint_fast8_t{ RESERVED23 + Size::RESERVED23 }; ///< PMUX.
+                static constexpr auto WRPMUX = std::uint_fast8_t{ PMUX + Size::PMUX }; ///< WRPMUX.
+                static constexpr auto RESERVED29 = std::uint_fast8_t{ WRPMUX + Size::WRPMUX }; ///< RESERVED29.
+                static constexpr auto WRPINCFG = std::uint_fast8_t{ RESERVED29 + Size::RESERVED29 }; ///< WRPINCFG.
+                static constexpr auto HWSEL = std::uint_fast8_t{ WRPINCFG + Size::WRPINCFG }; ///< HWSEL.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto PINMASK = mask<std::uint32_t>( Size::PINMASK, Bit::PINMASK ); ///< PINMASK.
+                static constexpr auto PMUXEN = mask<std::uint32_t>( Size::PMUXEN, Bit::PMUXEN ); ///< PMUXEN.
+                static constexpr auto INEN = mask<std::uint32_t>( Size::INEN, Bit::INEN ); ///< INEN.
+                static constexpr auto PULLEN = mask<std::uint32_t>( Size::PULLEN, Bit::PULLEN ); ///< PULLEN.
+                static constexpr auto RESERVED19 = mask<std::uint32_t>( Size::RESERVED19, Bit::RESERVED19 ); ///< RESERVED19.
+                static constexpr auto DRVSTR = mask<std::uint32_t>( Size::DRVSTR, Bit::DRVSTR ); ///< DRVSTR.
+                static constexpr auto RESERVED23 = mask<std::uint32_t>( Size::RESERVED23, Bit::RESERVED23 ); ///< RESERVED23.
+                static constexpr auto PMUX = mask<std::uint32_t>( Size::PMUX, Bit::PMUX ); ///< PMUX.
+                static constexpr auto WRPMUX = mask<std::uint32_t>( Size::WRPMUX, Bit::WRPMUX ); ///< WRPMUX.
+                static constexpr auto RESERVED29 = mask<std::uint32_t>( Size::RESERVED29, Bit::RESERVED29 ); ///< RESERVED29.
+                static constexpr auto WRPINCFG = mask<std::uint32_t>( Size::WRPINCFG, Bit::WRPINCFG ); ///< WRPINCFG.
+                static constexpr auto HWSEL = mask<std::uint32_t>( Size::HWSEL, Bit::HWSEL ); ///< HWSEL.
+            };
+
+            WRCONFIG() = delete;
+
+            WRCONFIG( WRCONFIG && ) = delete;
+
+            WRCONFIG( WRCONFIG const & ) = delete;
+
+            ~WRCONFIG() = delete;
+
+            auto operator=( WRCONFIG && ) = delete;
+
+            auto operator=( WRCONFIG const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Peripheral Multiplexing (PMUX) register.
+         *
+         * This register has the following fields:
+         * - Peripheral Multiplexing Even (PMUXE)
+         * - Peripheral Multiplexing Odd (PMUXO)
+         */
+        class PMUX : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto PMUXE = std::uint_fast8_t{ 4 }; ///< PMUXE.
+                static constexpr auto PMUXO = std::uint_fast8_t{ 4 }; ///< PMUXO.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto PMUXE = std::uint_fast8_t{}; ///< PMUXE.
+                static constexpr auto PMUXO = std::uint_fast8_t{ PMUXE + Size::PMUXE }; ///< PMUXO.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto PMUXE = mask<std::uint8_t>( Size::PMUXE, Bit::PMUXE ); ///< PMUXE.
+                static constexpr auto PMUXO = mask<std::uint8_t>( Size::PMUXO, Bit::PMUXO ); ///< PMUXO.
+            };
+
+            /**
+             * \brief PMUXE.
+             */
+            enum PMUXE : std::uint8_t {
+                PMUXE_A = 0x0 << Bit::PMUXE, ///< Peripheral function A selected.
+                PMUXE_B = 0x1 << Bit::PMUXE, ///< Peripheral function B selected.
+                PMUXE_C = 0x2 << Bit::PMUXE, ///< Peripheral function C selected.
+                PMUXE_D = 0x3 << Bit::PMUXE, ///< Peripheral function D selected.
+                PMUXE_E = 0x4 << Bit::PMUXE, ///< Peripheral function E selected.
+                PMUXE_F = 0x5 << Bit::PMUXE, ///< Peripheral function F selected.
+                PMUXE_G = 0x6 << Bit::PMUXE, ///< Peripheral function G selected.
+                PMUXE_H = 0x7 << Bit::PMUXE, ///< Peripheral function H selected.
+            };
+
+            /**
+             * \brief PMUXO.
+             */
+            enum PMUXO : std::uint8_t {
+                PMUXO_A = 0x0 << Bit::PMUXO, ///< Peripheral function A selected.
+                PMUXO_B = 0x1 << Bit::PMUXO, ///< Peripheral function B selected.
+                PMUXO_C = 0x2 << Bit::PMUXO, ///< Peripheral function C selected.
+                PMUXO_D = 0x3 << Bit::PMUXO, ///< Peripheral function D selected.
+                PMUXO_E = 0x4 << Bit::PMUXO, ///< Peripheral function E selected.
+                PMUXO_F = 0x5 << Bit::PMUXO, ///< Peripheral function F selected.
+                PMUXO_G = 0x6 << Bit::PMUXO, ///< Peripheral function G selected.
+                PMUXO_H = 0x7 << Bit::PMUXO, ///< Peripheral function H selected.
+            };
+
+            PMUX() = delete;
+
+            PMUX( PMUX && ) = delete;
+
+            PMUX( PMUX const & ) = delete;
+
+            ~PMUX() = delete;
+
+            auto operator=( PMUX && ) = delete;
+
+            auto operator=( PMUX const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Pin Configuration (PINCFG) register.
+         *
+         * This register has the following fields:
+         * - Peripheral Multiplexer Enable (PMUXEN)
+         * - Input Enable (INEN)
+         * - Pull Enable (PULLEN)
+         * - Output Driver Strength Selection (DRVSTR)
+         */
+        class PINCFG : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto PMUXEN    = std::uint_fast8_t{ 1 }; ///< PMUXEN.
+                static constexpr auto INEN      = std::uint_fast8_t{ 1 }; ///< INEN.
+                static constexpr auto PULLEN    = std::uint_fast8_t{ 1 }; ///< PULLEN.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 3 }; ///< RESERVED3.
+                static constexpr auto DRVSTR    = std::uint_fast8_t{ 1 }; ///< DRVSTR.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto PMUXEN = std::uint_fast8_t{}; ///< PMUXEN.
+                static constexpr auto INEN = std::uint_fast8_t{ PMUXEN + Size::PMUXEN }; ///< INEN.
+                static constexpr auto PULLEN = std::uint_fast8_t{ INEN + Size::INEN }; ///< PULLEN.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ PULLEN + Size::PULLEN }; ///< RESERVED3.
+                static constexpr auto DRVSTR = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< DRVSTR.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ DRVSTR + Size::DRVSTR }; ///< RESERVED7.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto PMUXEN = mask<std::uint8_t>( Size::PMUXEN, Bit::PMUXEN ); ///< PMUXEN.
+                static constexpr auto INEN = mask<std::uint8_t>( Size::INEN, Bit::INEN ); ///< INEN.
+                static constexpr auto PULLEN = mask<std::uint8_t>( Size::PULLEN, Bit::PULLEN ); ///< PULLEN.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto DRVSTR = mask<std::uint8_t>( Size::DRVSTR, Bit::DRVSTR ); ///< DRVSTR.
+                static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+            };
+
+            PINCFG() = delete;
+
+            PINCFG( PINCFG && ) = delete;
+
+            PINCFG( PINCFG const & ) = delete;
+
+            ~PINCFG() = delete;
+
+            auto operator=( PINCFG && ) = delete;
+
+            auto operator=( PINCFG const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Data Direction (DIR) register.
+         */
+        Register<std::uint32_t> dir;
+
+        /**
+         * \brief Data Direction Clear (DIRCLR) register.
+         */
+        Register<std::uint32_t> dirclr;
+
+        /**
+         * \brief Data Direction Set (DIRSET) register.
+         */
+        Register<std::uint32_t> dirset;
+
+        /**
+         * \brief Data Direction Toggle (DIRTGL) register.
+         */
+        Register<std::uint32_t> dirtgl;
+
+        /**
+         * \brief Data Output Value (OUT) register.
+         */
+        Register<std::uint32_t> out;
+
+        /**
+         * \brief Data Output Value Clear (OUTCLR) register.
+         */
+        Register<std::uint32_t> outclr;
+
+        /**
+         * \brief Data Output Value Set (OUTSET) register.
+         */
+        Register<std::uint32_t> outset;
+
+        /**
+         * \brief Data Output Value Toggle (OUTTGL) register.
+         */
+        Register<std::uint32_t> outtgl;
+
+        /**
+         * \brief Data Input Value (IN) register.
+         */
+        Register<std::uint32_t> const in;
+
+        /**
+         * \brief CTRL.
+         */
+        CTRL ctrl;
+
+        /**
+         * \brief WRCONFIG.
+         */
+        WRCONFIG wrconfig;
+
+        /**
+         * \brief Reserved registers (offset 0x2C-0x2F).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x2C_0x2F[ ( 0x2F - 0x2C ) + 1 ];
+
+        /**
+         * \brief PMUX.
+         */
+        PMUX pmux[ 16 ];
+
+        /**
+         * \brief PINCFG.
+         */
+        PINCFG pincfg[ 32 ];
+
+        /**
+         * \brief Reserved registers (offset 0x60-0x7F).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x60_0x7F[ ( 0x7F - 0x60 ) + 1 ];
+
+        GROUP() = delete;
+
+        GROUP( GROUP && ) = delete;
+
+        GROUP( GROUP const & ) = delete;
+
+        ~GROUP() = delete;
+
+        auto operator=( GROUP && ) = delete;
+
+        auto operator=( GROUP const & ) = delete;
+    };
+
+    /**
+     * \brief The I/O pin groups.
+     */
+    GROUP group[ 2 ];
+
+    PORT() = delete;
+
+    PORT( PORT && ) = delete;
+
+    PORT( PORT const & ) = delete;
+
+    ~PORT() = delete;
+
+    auto operator=( PORT && ) = delete;
+
+    auto operator=( PORT const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_PORT_H
@@ -0,0 +1,3116 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Peripheral::SERCOM interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_SERCOM_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_SERCOM_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Peripheral {
+
+/**
+ * \brief Microchip SAM D21/DA1 Serial Communication Interface (SERCOM) peripheral.
+ */
+class SERCOM {
+  public:
+    /**
+     * \brief USART operating mode.
+     */
+    class USART {
+      public:
+        /**
+         * \brief Control A (CTRLA) register.
+         *
+         * This register has the following fields:
+         * - Software Reset (SWRST)
+         * - Enable (ENABLE)
+         * - Operating Mode (MODE)
+         * - Run in Standby (RUNSTDBY)
+         * - Immediate Buffer Overflow Notification (IBON)
+         * - Sample Rate (SAMPR)
+         * - Transmit Data Pinout (TXPO)
+         * - Receive Data Pinout (RXPO)
+         * - Sample Adjustment (SAMPA)
+         * - Frame Format (FORM)
+         * - Communication Mode (CMODE)
+         * - Clock Polarity (CPOL)
+         * - Data Order (DORD)
+         */
+        class CTRLA : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST      = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE     = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto MODE       = std::uint_fast8_t{ 3 }; ///< MODE.
+                static constexpr auto RESERVED5  = std::uint_fast8_t{ 2 }; ///< RESERVED5.
+                static constexpr auto RUNSTDBY   = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+                static constexpr auto IBON       = std::uint_fast8_t{ 1 }; ///< IBON.
+                static constexpr auto RESERVED9  = std::uint_fast8_t{ 4 }; ///< RESERVED9.
+                static constexpr auto SAMPR      = std::uint_fast8_t{ 3 }; ///< SAMPR.
+                static constexpr auto TXPO       = std::uint_fast8_t{ 2 }; ///< TXPO.
+                static constexpr auto RESERVED18 = std::uint_fast8_t{ 2 }; ///< RESERVED18.
+                static constexpr auto RXPO       = std::uint_fast8_t{ 2 }; ///< RXPO.
+                static constexpr auto SAMPA      = std::uint_fast8_t{ 2 }; ///< SAMPA.
+                static constexpr auto FORM       = std::uint_fast8_t{ 4 }; ///< FORM.
+                static constexpr auto CMODE      = std::uint_fast8_t{ 1 }; ///< CMODE.
+                static constexpr auto CPOL       = std::uint_fast8_t{ 1 }; ///< CPOL.
+                static constexpr auto DORD       = std::uint_fast8_t{ 1 }; ///< DORD.
+                static constexpr auto RESERVED31 = std::uint_fast8_t{ 1 }; ///< RESERVED31.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto MODE = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< MODE.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ MODE + Size::MODE }; ///< RESERVED5.
+                static constexpr auto RUNSTDBY = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< RUNSTDBY.
+                static constexpr auto IBON = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< IBON.
+                static constexpr auto RESERVED9 = std::uint_fast8_t{ IBON + Size::IBON }; ///< RESERVED9.
+                static constexpr auto SAMPR = std::uint_fast8_t{ RESERVED9 + Size::RESERVED9 }; ///< SAMPR.
+                static constexpr auto TXPO = std::uint_fast8_t{ SAMPR + Size::SAMPR }; ///< TXPO.
+                static constexpr auto RESERVED18 = std::uint_fast8_t{ TXPO + Size::TXPO }; ///< RESERVED18.
+                static constexpr auto RXPO = std::uint_fast8_t{ RESERVED18 + Size::RESERVED18 }; ///< RXPO.
+                static constexpr auto SAMPA = std::uint_fast8_t{ RXPO + Size::RXPO }; ///< SAMPA.
+                static constexpr auto FORM = std::uint_fast8_t{ SAMPA + Size::SAMPA }; ///< FORM.
+                static constexpr auto CMODE = std::uint_fast8_t{ FORM + Size::FORM }; ///< CMODE.
+                static constexpr auto CPOL = std::uint_fast8_t{ CMODE + Size::CMODE }; ///< CPOL.
+                static constexpr auto DORD = std::uint_fast8_t{ CPOL + Size::CPOL }; ///< DORD.
+                static constexpr auto RESERVED31 = std::uint_fast8_t{ DORD + Size::DORD }; ///< RESERVED31.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint32_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint32_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto MODE = mask<std::uint32_t>( Size::MODE, Bit::MODE ); ///< MODE.
+                static constexpr auto RESERVED5 = mask<std::uint32_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto RUNSTDBY = mask<std::uint32_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+                static constexpr auto IBON = mask<std::uint32_t>( Size::IBON, Bit::IBON ); ///< IBON.
+                static constexpr auto RESERVED9 = mask<std::uint32_t>( Size::RESERVED9, Bit::RESERVED9 ); ///< RESERVED9.
+                static constexpr auto SAMPR = mask<std::uint32_t>( Size::SAMPR, Bit::SAMPR ); ///< SAMPR.
+                static constexpr auto TXPO = mask<std::uint32_t>( Size::TXPO, Bit::TXPO ); ///< TXPO.
+                static constexpr auto RESERVED18 = mask<std::uint32_t>( Size::RESERVED18, Bit::RESERVED18 ); ///< RESERVED18.
+                static constexpr auto RXPO = mask<std::uint32_t>( Size::RXPO, Bit::RXPO ); ///< RXPO.
+                static constexpr auto SAMPA = mask<std::uint32_t>( Size::SAMPA, Bit::SAMPA ); ///< SAMPA.
+                static constexpr auto FORM = mask<std::uint32_t>( Size::FORM, Bit::FORM ); ///< FORM.
+                static constexpr auto CMODE = mask<std::uint32_t>( Size::CMODE, Bit::CMODE ); ///< CMODE.
+                static constexpr auto CPOL = mask<std::uint32_t>( Size::CPOL, Bit::CPOL ); ///< CPOL.
+                static constexpr auto DORD = mask<std::uint32_t>( Size::DORD, Bit::DORD ); ///< DORD.
+                static constexpr auto RESERVED31 = mask<std::uint32_t>( Size::RESERVED31, Bit::RESERVED31 ); ///< RESERVED31.
+            };
+
+            /**
+             * \brief MODE.
+             */
+            enum MODE : std::uint32_t {
+                MODE_USART_EXT_CLK = 0x0 << Bit::MODE, ///< USART with external clock.
+                MODE_USART_INT_CLK = 0x1 << Bit::MODE, ///< USART with internal clock.
+            };
+
+            /**
+             * \brief SAMPR.
+             */
+            enum SAMPR : std::uint32_t {
+                SAMPR_16X_ARITHMETIC = 0x0 << Bit::SAMPR, ///< 16x over-sampling using arithmetic baud rate generation.
+                SAMPR_16X_FRACTIONAL = 0x1 << Bit::SAMPR, ///< 16x over-sampling using fractional baud rate generation.
+                SAMPR_8X_ARITHMETIC = 0x2 << Bit::SAMPR, ///< 8x over-sampling using arithmetic baud rate generation.
+                SAMPR_8X_FRACTIONAL = 0x3 << Bit::SAMPR, ///< 8x over-sampling using fractional baud rate generation.
+                SAMPR_3X_ARITHMETIC = 0x4 << Bit::SAMPR, ///< 3x over-sampling using arithmetic baud rate generation.
+            };
+
+            /**
+             * \brief TXPO.
+             */
+            enum TXPO : std::uint32_t {
+                TXPO_PAD0 = 0x0 << Bit::TXPO, ///< TxD on PAD[0], XCK on PAD[1].
+                TXPO_PAD2 = 0x1 << Bit::TXPO, ///< TxD on PAD[2], XCK on PAD[3].
+                TXPO_PAD0_RTS_PAD2_CTS_PAD3 = 0x2 << Bit::TXPO, ///< TxD on PAD[0], RTS on PAD[2], CTS on PAD[3].
+            };
+
+            /**
+             * \brief RXPO.
+             */
+            enum RXPO : std::uint32_t {
+                RXPO_PAD0 = 0x0 << Bit::RXPO, ///< RxD on PAD[0].
+                RXPO_PAD1 = 0x1 << Bit::RXPO, ///< RxD on PAD[1].
+                RXPO_PAD2 = 0x2 << Bit::RXPO, ///< RxD on PAD[2].
+                RXPO_PAD3 = 0x3 << Bit::RXPO, ///< RxD on PAD[3].
+            };
+
+            /**
+             * \brief FORM.
+             */
+            enum FORM : std::uint32_t {
+                FORM_USART            = 0x0 << Bit::FORM, ///< USART frame.
+                FORM_USART_PARITY     = 0x1 << Bit::FORM, ///< USART frame with parity.
+                FORM_AUTO_BAUD        = 0x4 << Bit::FORM, ///< Auto-baud frame.
+                FORM_AUTO_BAUD_PARITY = 0x5 << Bit::FORM, ///< Auto-baud frame with parity.
+            };
+
+            /**
+             * \brief CMODE.
+             */
+            enum CMODE : std::uint32_t {
+                CMODE_ASYNCHRONOUS = 0x0 << Bit::CMODE, ///< Asynchronous communication.
+                CMODE_SYNCHRONOUS  = 0x1 << Bit::CMODE, ///< Synchronous communication.
+            };
+
+            /**
+             * \brief CPOL.
+             */
+            enum CPOL : std::uint32_t {
+                CPOL_RISING = 0x0 << Bit::CPOL, ///< TxD change on XCK rising edge, RxD sample on XCK falling edge.
+                CPOL_FALLING = 0x1 << Bit::CPOL, ///< TxD change on XCK falling edge, RxD sample on XCK rising edge.
+            };
+
+            /**
+             * \brief DORD.
+             */
+            enum DORD : std::uint32_t {
+                DORD_MSB = 0x0 << Bit::DORD, ///< MSB first.
+                DORD_LSB = 0x1 << Bit::DORD, ///< LSB first.
+            };
+
+            CTRLA() = delete;
+
+            CTRLA( CTRLA && ) = delete;
+
+            CTRLA( CTRLA const & ) = delete;
+
+            ~CTRLA() = delete;
+
+            auto operator=( CTRLA && ) = delete;
+
+            auto operator=( CTRLA const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Control B (CTRLB) register.
+         *
+         * This register has the following fields:
+         * - Character Size (CHSIZE)
+         * - Stop Bit Mode (SBMODE)
+         * - Collision Detection Enable (COLDEN)
+         * - Start of Frame Detection Enable (SFDE)
+         * - Encoding Format (ENC)
+         * - Parity Mode (PMODE)
+         * - Transmitter Enable (TXEN)
+         * - Receiver Enable (RXEN)
+         */
+        class CTRLB : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto CHSIZE     = std::uint_fast8_t{ 3 }; ///< CHSIZE.
+                static constexpr auto RESERVED3  = std::uint_fast8_t{ 3 }; ///< RESERVED3.
+                static constexpr auto SBMODE     = std::uint_fast8_t{ 1 }; ///< SBMODE.
+                static constexpr auto RESERVED7  = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+                static constexpr auto COLDEN     = std::uint_fast8_t{ 1 }; ///< COLDEN.
+                static constexpr auto SFDE       = std::uint_fast8_t{ 1 }; ///< SFDE.
+                static constexpr auto ENC        = std::uint_fast8_t{ 1 }; ///< ENC.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ 2 }; ///< RESERVED11.
+                static constexpr auto PMODE      = std::uint_fast8_t{ 1 }; ///< PMODE.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ 2 }; ///< RESERVED14.
+                static constexpr auto TXEN       = std::uint_fast8_t{ 1 }; ///< TXEN.
+                static constexpr auto RXEN       = std::uint_fast8_t{ 1 }; ///< RXEN.
+                static constexpr auto RESERVED18 = std::uint_fast8_t{ 14 }; ///< RESERVED18.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto CHSIZE = std::uint_fast8_t{}; ///< CHSIZE.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ CHSIZE + Size::CHSIZE }; ///< RESERVED3.
+                static constexpr auto SBMODE = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< SBMODE.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ SBMODE + Size::SBMODE }; ///< RESERVED7.
+                static constexpr auto COLDEN = std::uint_fast8_t{ RESERVED7 + Size::RESERVED7 }; ///< COLDEN.
+                static constexpr auto SFDE = std::uint_fast8_t{ COLDEN + Size::COLDEN }; ///< SFDE.
+                static constexpr auto ENC = std::uint_fast8_t{ SFDE + Size::SFDE }; ///< ENC.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ ENC + Size::ENC }; ///< RESERVED11.
+                static constexpr auto PMODE = std::uint_fast8_t{ RESERVED11 + Size::RESERVED11 }; ///< PMODE.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ PMODE + Size::PMODE }; ///< RESERVED14.
+                static constexpr auto TXEN = std::uint_fast8_t{ RESERVED14 + Size::RESERVED14 }; ///< TXEN.
+                static constexpr auto RXEN = std::uint_fast8_t{ TXEN + Size::TXEN }; ///< RXEN.
+                static constexpr auto RESERVED18 = std::uint_fast8_t{ RXEN + Size::RXEN }; ///< RESERVED18.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto CHSIZE = mask<std::uint32_t>( Size::CHSIZE, Bit::CHSIZE ); ///< CHSIZE.
+                static constexpr auto RESERVED3 = mask<std::uint32_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto SBMODE = mask<std::uint32_t>( Size::SBMODE, Bit::SBMODE ); ///< SBMODE.
+                static constexpr auto RESERVED7 = mask<std::uint32_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                static constexpr auto COLDEN = mask<std::uint32_t>( Size::COLDEN, Bit::COLDEN ); ///< COLDEN.
+                static constexpr auto SFDE = mask<std::uint32_t>( Size::SFDE, Bit::SFDE ); ///< SFDE.
+                static constexpr auto ENC = mask<std::uint32_t>( Size::ENC, Bit::ENC ); ///< ENC.
+                static constexpr auto RESERVED11 = mask<std::uint32_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+                static constexpr auto PMODE = mask<std::uint32_t>( Size::PMODE, Bit::PMODE ); ///< PMODE.
+                static constexpr auto RESERVED14 = mask<std::uint32_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+                static constexpr auto TXEN = mask<std::uint32_t>( Size::TXEN, Bit::TXEN ); ///< TXEN.
+                static constexpr auto RXEN = mask<std::uint32_t>( Size::RXEN, Bit::RXEN ); ///< RXEN.
+                static constexpr auto RESERVED18 = mask<std::uint32_t>( Size::RESERVED18, Bit::RESERVED18 ); ///< RESERVED18.
+            };
+
+            /**
+             * \brief CHSIZE.
+             */
+            enum CHSIZE : std::uint32_t {
+                CHSIZE_8_BIT = 0x0 << Bit::CHSIZE, ///< 8 bits.
+                CHSIZE_9_BIT = 0x1 << Bit::CHSIZE, ///< 9 bits.
+                CHSIZE_5_BIT = 0x5 << Bit::CHSIZE, ///< 5 bits.
+                CHSIZE_6_BIT = 0x6 << Bit::CHSIZE, ///< 6 bits.
+                CHSIZE_7_BIT = 0x7 << Bit::CHSIZE, ///< 7 bits.
+            };
+
+            /**
+             * \brief SBMODE.
+             */
+            enum SBMODE : std::uint32_t {
+                SBMODE_1_BIT = 0x0 << Bit::SBMODE, ///< One stop bit.
+                SBMODE_2_BIT = 0x1 << Bit::SBMODE, ///< Two stop bits.
+            };
+
+            /**
+             * \brief PMODE.
+             */
+            enum PMODE : std::uint32_t {
+                PMODE_EVEN = 0x0 << Bit::PMODE, ///< Even parity.
+                PMODE_ODD  = 0x1 << Bit::PMODE, ///< Odd parity.
+            };
+
+            CTRLB() = delete;
+
+            CTRLB( CTRLB && ) = delete;
+
+            CTRLB( CTRLB const & ) = delete;
+
+            ~CTRLB() = delete;
+
+            auto operator=( CTRLB && ) = delete;
+
+            auto operator=( CTRLB const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Clear (INTENCLR) register.
+         *
+         * This register has the following fields:
+         * - Data Register Empty Interrupt Enable (DRE)
+         * - Transmit Complete Interrupt Enable (TXC)
+         * - Receive Complete Interrupt Enable (RXC)
+         * - Receive Start Interrupt Enable (RXS)
+         * - Clear to Send Input Change Interrupt Enable (CTSIC)
+         * - Receive Break Interrupt Enable (RXBRK)
+         * - Combined Error Interrupt Enable (ERROR)
+         */
+        class INTENCLR : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DRE       = std::uint_fast8_t{ 1 }; ///< DRE.
+                static constexpr auto TXC       = std::uint_fast8_t{ 1 }; ///< TXC.
+                static constexpr auto RXC       = std::uint_fast8_t{ 1 }; ///< RXC.
+                static constexpr auto RXS       = std::uint_fast8_t{ 1 }; ///< RXS.
+                static constexpr auto CTSIC     = std::uint_fast8_t{ 1 }; ///< CTSIC.
+                static constexpr auto RXBRK     = std::uint_fast8_t{ 1 }; ///< RXBRK.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 1 }; ///< RESERVED6.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DRE = std::uint_fast8_t{}; ///< DRE.
+                static constexpr auto TXC = std::uint_fast8_t{ DRE + Size::DRE }; ///< TXC.
+                static constexpr auto RXC = std::uint_fast8_t{ TXC + Size::TXC }; ///< RXC.
+                static constexpr auto RXS = std::uint_fast8_t{ RXC + Size::RXC }; ///< RXS.
+                static constexpr auto CTSIC = std::uint_fast8_t{ RXS + Size::RXS }; ///< CTSIC.
+                static constexpr auto RXBRK = std::uint_fast8_t{ CTSIC + Size::CTSIC }; ///< RXBRK.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ RXBRK + Size::RXBRK }; ///< RESERVED6.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED6 + Size::RESERVED6 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DRE = mask<std::uint8_t>( Size::DRE, Bit::DRE ); ///< DRE.
+                static constexpr auto TXC = mask<std::uint8_t>( Size::TXC, Bit::TXC ); ///< TXC.
+                static constexpr auto RXC = mask<std::uint8_t>( Size::RXC, Bit::RXC ); ///< RXC.
+                static constexpr auto RXS = mask<std::uint8_t>( Size::RXS, Bit::RXS ); ///< RXS.
+                static constexpr auto CTSIC = mask<std::uint8_t>( Size::CTSIC, Bit::CTSIC ); ///< CTSIC.
+                static constexpr auto RXBRK = mask<std::uint8_t>( Size::RXBRK, Bit::RXBRK ); ///< RXBRK.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTENCLR() = delete;
+
+            INTENCLR( INTENCLR && ) = delete;
+
+            INTENCLR( INTENCLR const & ) = delete;
+
+            ~INTENCLR() = delete;
+
+            auto operator=( INTENCLR && ) = delete;
+
+            auto operator=( INTENCLR const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Set (INTENSET) register.
+         *
+         * This register has the following fields:
+         * - Data Register Empty Interrupt Enable (DRE)
+         * - Transmit Complete Interrupt Enable (TXC)
+         * - Receive Complete Interrupt Enable (RXC)
+         * - Receive Start Interrupt Enable (RXS)
+         * - Clear to Send Input Change Interrupt Enable (CTSIC)
+         * - Receive Break Interrupt Enable (RXBRK)
+         * - Combined Error Interrupt Enable (ERROR)
+         */
+        class INTENSET : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DRE       = std::uint_fast8_t{ 1 }; ///< DRE.
+                static constexpr auto TXC       = std::uint_fast8_t{ 1 }; ///< TXC.
+                static constexpr auto RXC       = std::uint_fast8_t{ 1 }; ///< RXC.
+                static constexpr auto RXS       = std::uint_fast8_t{ 1 }; ///< RXS.
+                static constexpr auto CTSIC     = std::uint_fast8_t{ 1 }; ///< CTSIC.
+                static constexpr auto RXBRK     = std::uint_fast8_t{ 1 }; ///< RXBRK.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 1 }; ///< RESERVED6.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DRE = std::uint_fast8_t{}; ///< DRE.
+                static constexpr auto TXC = std::uint_fast8_t{ DRE + Size::DRE }; ///< TXC.
+                static constexpr auto RXC = std::uint_fast8_t{ TXC + Size::TXC }; ///< RXC.
+                static constexpr auto RXS = std::uint_fast8_t{ RXC + Size::RXC }; ///< RXS.
+                static constexpr auto CTSIC = std::uint_fast8_t{ RXS + Size::RXS }; ///< CTSIC.
+                static constexpr auto RXBRK = std::uint_fast8_t{ CTSIC + Size::CTSIC }; ///< RXBRK.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ RXBRK + Size::RXBRK }; ///< RESERVED6.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED6 + Size::RESERVED6 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DRE = mask<std::uint8_t>( Size::DRE, Bit::DRE ); ///< DRE.
+                static constexpr auto TXC = mask<std::uint8_t>( Size::TXC, Bit::TXC ); ///< TXC.
+                static constexpr auto RXC = mask<std::uint8_t>( Size::RXC, Bit::RXC ); ///< RXC.
+                static constexpr auto RXS = mask<std::uint8_t>( Size::RXS, Bit::RXS ); ///< RXS.
+                static constexpr auto CTSIC = mask<std::uint8_t>( Size::CTSIC, Bit::CTSIC ); ///< CTSIC.
+                static constexpr auto RXBRK = mask<std::uint8_t>( Size::RXBRK, Bit::RXBRK ); ///< RXBRK.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTENSET() = delete;
+
+            INTENSET( INTENSET && ) = delete;
+
+            INTENSET( INTENSET const & ) = delete;
+
+            ~INTENSET() = delete;
+
+            auto operator=( INTENSET && ) = delete;
+
+            auto operator=( INTENSET const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+         *
+         * This register has the following fields:
+         * - Data Register Empty (DRE)
+         * - Transmit Complete (TXC)
+         * - Receive Complete (RXC)
+         * - Receive Start (RXS)
+         * - Clear to Send Input Change (CTSIC)
+         * - Receive Break (RXBRK)
+         * - Combined Error (ERROR)
+         */
+        class INTFLAG : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DRE       = std::uint_fast8_t{ 1 }; ///< DRE.
+                static constexpr auto TXC       = std::uint_fast8_t{ 1 }; ///< TXC.
+                static constexpr auto RXC       = std::uint_fast8_t{ 1 }; ///< RXC.
+                static constexpr auto RXS       = std::uint_fast8_t{ 1 }; ///< RXS.
+                static constexpr auto CTSIC     = std::uint_fast8_t{ 1 }; ///< CTSIC.
+                static constexpr auto RXBRK     = std::uint_fast8_t{ 1 }; ///< RXBRK.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 1 }; ///< RESERVED6.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DRE = std::uint_fast8_t{}; ///< DRE.
+                static constexpr auto TXC = std::uint_fast8_t{ DRE + Size::DRE }; ///< TXC.
+                static constexpr auto RXC = std::uint_fast8_t{ TXC + Size::TXC }; ///< RXC.
+                static constexpr auto RXS = std::uint_fast8_t{ RXC + Size::RXC }; ///< RXS.
+                static constexpr auto CTSIC = std::uint_fast8_t{ RXS + Size::RXS }; ///< CTSIC.
+                static constexpr auto RXBRK = std::uint_fast8_t{ CTSIC + Size::CTSIC }; ///< RXBRK.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ RXBRK + Size::RXBRK }; ///< RESERVED6.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED6 + Size::RESERVED6 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DRE = mask<std::uint8_t>( Size::DRE, Bit::DRE ); ///< DRE.
+                static constexpr auto TXC = mask<std::uint8_t>( Size::TXC, Bit::TXC ); ///< TXC.
+                static constexpr auto RXC = mask<std::uint8_t>( Size::RXC, Bit::RXC ); ///< RXC.
+                static constexpr auto RXS = mask<std::uint8_t>( Size::RXS, Bit::RXS ); ///< RXS.
+                static constexpr auto CTSIC = mask<std::uint8_t>( Size::CTSIC, Bit::CTSIC ); ///< CTSIC.
+                static constexpr auto RXBRK = mask<std::uint8_t>( Size::RXBRK, Bit::RXBRK ); ///< RXBRK.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTFLAG() = delete;
+
+            INTFLAG( INTFLAG && ) = delete;
+
+            INTFLAG( INTFLAG const & ) = delete;
+
+            ~INTFLAG() = delete;
+
+            auto operator=( INTFLAG && ) = delete;
+
+            auto operator=( INTFLAG const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Status (STATUS) register.
+         *
+         * This register has the following fields:
+         * - Parity Error (PERR)
+         * - Frame Error (FERR)
+         * - Buffer Overflow (BUFOVF)
+         * - Clear to Send (CTS)
+         * - Inconsistent Sync Field (ISF)
+         * - Collision Detected (COLL)
+         */
+        class STATUS : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto PERR      = std::uint_fast8_t{ 1 };  ///< PERR.
+                static constexpr auto FERR      = std::uint_fast8_t{ 1 };  ///< FERR.
+                static constexpr auto BUFOVF    = std::uint_fast8_t{ 1 };  ///< BUFOVF.
+                static constexpr auto CTS       = std::uint_fast8_t{ 1 };  ///< CTS.
+                static constexpr auto ISF       = std::uint_fast8_t{ 1 };  ///< ISF.
+                static constexpr auto COLL      = std::uint_fast8_t{ 1 };  ///< COLL.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 10 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto PERR = std::uint_fast8_t{}; ///< PERR.
+                static constexpr auto FERR = std::uint_fast8_t{ PERR + Size::PERR }; ///< FERR.
+                static constexpr auto BUFOVF = std::uint_fast8_t{ FERR + Size::FERR }; ///< BUFOVF.
+                static constexpr auto CTS = std::uint_fast8_t{ BUFOVF + Size::BUFOVF }; ///< CTS.
+                static constexpr auto ISF = std::uint_fast8_t{ CTS + Size::CTS }; ///< ISF.
+                static constexpr auto COLL = std::uint_fast8_t{ ISF + Size::ISF }; ///< COLL.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ COLL + Size::COLL }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto PERR = mask<std::uint16_t>( Size::PERR, Bit::PERR ); ///< PERR.
+                static constexpr auto FERR = mask<std::uint16_t>( Size::FERR, Bit::FERR ); ///< FERR.
+                static constexpr auto BUFOVF = mask<std::uint16_t>( Size::BUFOVF, Bit::BUFOVF ); ///< BUFOVF.
+                static constexpr auto CTS = mask<std::uint16_t>( Size::CTS, Bit::CTS ); ///< CTS.
+                static constexpr auto ISF = mask<std::uint16_t>( Size::ISF, Bit::ISF ); ///< ISF.
+                static constexpr auto COLL = mask<std::uint16_t>( Size::COLL, Bit::COLL ); ///< COLL.
+                static constexpr auto RESERVED6 = mask<std::uint16_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            STATUS() = delete;
+
+            STATUS( STATUS && ) = delete;
+
+            STATUS( STATUS const & ) = delete;
+
+            ~STATUS() = delete;
+
+            auto operator=( STATUS && ) = delete;
+
+            auto operator=( STATUS const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Synchronization Busy (SYNCBUSY) register.
+         *
+         * This register has the following fields:
+         * - Software Reset Synchronization Busy (SWRST)
+         * - SERCOM Enable Synchronization Busy (ENABLE)
+         * - CTRLB Synchronization Busy (CTRLB)
+         */
+        class SYNCBUSY : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST     = std::uint_fast8_t{ 1 };  ///< SWRST.
+                static constexpr auto ENABLE    = std::uint_fast8_t{ 1 };  ///< ENABLE.
+                static constexpr auto CTRLB     = std::uint_fast8_t{ 1 };  ///< CTRLB.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 29 }; ///< RESERVED3.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto CTRLB = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< CTRLB.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ CTRLB + Size::CTRLB }; ///< RESERVED3.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint32_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint32_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto CTRLB = mask<std::uint32_t>( Size::CTRLB, Bit::CTRLB ); ///< CTRLB.
+                static constexpr auto RESERVED3 = mask<std::uint32_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+            };
+
+            SYNCBUSY() = delete;
+
+            SYNCBUSY( SYNCBUSY && ) = delete;
+
+            SYNCBUSY( SYNCBUSY const & ) = delete;
+
+            ~SYNCBUSY() = delete;
+
+            auto operator=( SYNCBUSY && ) = delete;
+
+            auto operator=( SYNCBUSY const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Debug Control (DBGCTRL) register.
+         *
+         * This register has the following fields:
+         * - Debug Mode (DBGSTOP)
+         */
+        class DBGCTRL : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DBGSTOP   = std::uint_fast8_t{ 1 }; ///< DBGSTOP.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 7 }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DBGSTOP = std::uint_fast8_t{}; ///< DBGSTOP.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DBGSTOP + Size::DBGSTOP }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DBGSTOP = mask<std::uint8_t>( Size::DBGSTOP, Bit::DBGSTOP ); ///< DBGSTOP.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+            };
+
+            DBGCTRL() = delete;
+
+            DBGCTRL( DBGCTRL && ) = delete;
+
+            DBGCTRL( DBGCTRL const & ) = delete;
+
+            ~DBGCTRL() = delete;
+
+            auto operator=( DBGCTRL && ) = delete;
+
+            auto operator=( DBGCTRL const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief CTRLA.
+         */
+        CTRLA ctrla;
+
+        /**
+         * \brief CTRLB.
+         */
+        CTRLB ctrlb;
+
+        /**
+         * \brief Reserved registers (offset 0x08-0x0B).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x08_0x0B[ ( 0x0B - 0x08 ) + 1 ];
+
+        /**
+         * \brief Baud (BAUD) register.
+         */
+        Register<std::uint16_t> baud;
+
+        /**
+         * \brief Receive Pulse Length (RXPL) register.
+         */
+        Register<std::uint8_t> rxpl;
+
+        /**
+         * \brief Reserved registers (offset 0x0F-0x13).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x0F_0x13[ ( 0x13 - 0x0F ) + 1 ];
+
+        /**
+         * \brief INTENCLR.
+         */
+        INTENCLR intenclr;
+
+        /**
+         * \brief Reserved registers (offset 0x15-0x15).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x15_0x15[ ( 0x15 - 0x15 ) + 1 ];
+
+        /**
+         * \brief INTENSET.
+         */
+        INTENSET intenset;
+
+        /**
+         * \brief Reserved registers (offset 0x17-0x17).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x17_0x17[ ( 0x17 - 0x17 ) + 1 ];
+
+        /**
+         * \brief INTFLAG.
+         */
+        INTFLAG intflag;
+
+        /**
+         * \brief Reserved registers (offset 0x19-0x19).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x19_0x19[ ( 0x19 - 0x19 ) + 1 ];
+
+        /**
+         * \brief STATUS.
+         */
+        STATUS status;
+
+        /**
+         * \brief SYNCBUSY.
+         */
+        SYNCBUSY const syncbusy;
+
+        /**
+         * \brief Reserved registers (offset 0x20-0x27).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x20_0x27[ ( 0x27 - 0x20 ) + 1 ];
+
+        /**
+         * \brief Data (DATA) register.
+         */
+        Register<std::uint16_t> data;
+
+        /**
+         * \brief Reserved registers (offset 0x2A-0x2F).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x2A_0x2F[ ( 0x2F - 0x2A ) + 1 ];
+
+        /**
+         * \brief DBGCTRL.
+         */
+        DBGCTRL dbgctrl;
+
+        USART() = delete;
+
+        USART( USART && ) = delete;
+
+        USART( USART const & ) = delete;
+
+        ~USART() = delete;
+
+        auto operator=( USART && ) = delete;
+
+        auto operator=( USART const & ) = delete;
+    };
+
+    /**
+     * \brief SPI operating mode.
+     */
+    class SPI {
+      public:
+        /**
+         * \brief Control A (CTRLA) register.
+         *
+         * This register has the following fields:
+         * - Software Reset (SWRST)
+         * - Enable (ENABLE)
+         * - Operating Mode (MODE)
+         * - Run in Standby (RUNSTDBY)
+         * - Immediate Buffer Overflow Notification (IBON)
+         * - Data Out Pinout (DOPO)
+         * - Data In Pinout (DIPO)
+         * - Frame Format (FORM)
+         * - Clock Phase (CPHA)
+         * - Clock Polarity (CPOL)
+         * - Data Order (DORD)
+         */
+        class CTRLA : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST      = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE     = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto MODE       = std::uint_fast8_t{ 3 }; ///< MODE.
+                static constexpr auto RESERVED5  = std::uint_fast8_t{ 2 }; ///< RESERVED5.
+                static constexpr auto RUNSTDBY   = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+                static constexpr auto IBON       = std::uint_fast8_t{ 1 }; ///< IBON.
+                static constexpr auto RESERVED9  = std::uint_fast8_t{ 7 }; ///< RESERVED9.
+                static constexpr auto DOPO       = std::uint_fast8_t{ 2 }; ///< DOPO.
+                static constexpr auto RESERVED18 = std::uint_fast8_t{ 2 }; ///< RESERVED18.
+                static constexpr auto DIPO       = std::uint_fast8_t{ 2 }; ///< DIPO.
+                static constexpr auto RESERVED22 = std::uint_fast8_t{ 2 }; ///< RESERVED22.
+                static constexpr auto FORM       = std::uint_fast8_t{ 4 }; ///< FORM.
+                static constexpr auto CPHA       = std::uint_fast8_t{ 1 }; ///< CPHA.
+                static constexpr auto CPOL       = std::uint_fast8_t{ 1 }; ///< CPOL.
+                static constexpr auto DORD       = std::uint_fast8_t{ 1 }; ///< DORD.
+                static constexpr auto RESERVED31 = std::uint_fast8_t{ 1 }; ///< RESERVED31.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto MODE = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< MODE.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ MODE + Size::MODE }; ///< RESERVED5.
+                static constexpr auto RUNSTDBY = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< RUNSTDBY.
+                static constexpr auto IBON = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< IBON.
+                static constexpr auto RESERVED9 = std::uint_fast8_t{ IBON + Size::IBON }; ///< RESERVED9.
+                static constexpr auto DOPO = std::uint_fast8_t{ RESERVED9 + Size::RESERVED9 }; ///< DOPO.
+                static constexpr auto RESERVED18 = std::uint_fast8_t{ DOPO + Size::DOPO }; ///< RESERVED18.
+                static constexpr auto DIPO = std::uint_fast8_t{ RESERVED18 + Size::RESERVED18 }; ///< DIPO.
+                static constexpr auto RESERVED22 = std::uint_fast8_t{ DIPO + Size::DIPO }; ///< RESERVED22.
+                static constexpr auto FORM = std::uint_fast8_t{ RESERVED22 + Size::RESERVED22 }; ///< FORM.
+                static constexpr auto CPHA = std::uint_fast8_t{ FORM + Size::FORM }; ///< CPHA.
+                static constexpr auto CPOL = std::uint_fast8_t{ CPHA + Size::CPHA }; ///< CPOL.
+                static constexpr auto DORD = std::uint_fast8_t{ CPOL + Size::CPOL }; ///< DORD.
+                static constexpr auto RESERVED31 = std::uint_fast8_t{ DORD + Size::DORD }; ///< RESERVED31.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint32_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint32_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto MODE = mask<std::uint32_t>( Size::MODE, Bit::MODE ); ///< MODE.
+                static constexpr auto RESERVED5 = mask<std::uint32_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto RUNSTDBY = mask<std::uint32_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+                static constexpr auto IBON = mask<std::uint32_t>( Size::IBON, Bit::IBON ); ///< IBON.
+                static constexpr auto RESERVED9 = mask<std::uint32_t>( Size::RESERVED9, Bit::RESERVED9 ); ///< RESERVED9.
+                static constexpr auto DOPO = mask<std::uint32_t>( Size::DOPO, Bit::DOPO ); ///< DOPO.
+                static constexpr auto RESERVED18 = mask<std::uint32_t>( Size::RESERVED18, Bit::RESERVED18 ); ///< RESERVED18.
+                static constexpr auto DIPO = mask<std::uint32_t>( Size::DIPO, Bit::DIPO ); ///< DIPO.
+                static constexpr auto RESERVED22 = mask<std::uint32_t>( Size::RESERVED22, Bit::RESERVED22 ); ///< RESERVED22.
+                static constexpr auto FORM = mask<std::uint32_t>( Size::FORM, Bit::FORM ); ///< FORM.
+                static constexpr auto CPHA = mask<std::uint32_t>( Size::CPHA, Bit::CPHA ); ///< CPHA.
+                static constexpr auto CPOL = mask<std::uint32_t>( Size::CPOL, Bit::CPOL ); ///< CPOL.
+                static constexpr auto DORD = mask<std::uint32_t>( Size::DORD, Bit::DORD ); ///< DORD.
+                static constexpr auto RESERVED31 = mask<std::uint32_t>( Size::RESERVED31, Bit::RESERVED31 ); ///< RESERVED31.
+            };
+
+            /**
+             * \brief MODE.
+             */
+            enum MODE : std::uint32_t {
+                MODE_SPI_SLAVE  = 0x2 << Bit::MODE, ///< SPI slave.
+                MODE_SPI_MASTER = 0x3 << Bit::MODE, ///< SPI master.
+            };
+
+            /**
+             * \brief DOPO.
+             */
+            enum DOPO : std::uint32_t {
+                DOPO_PAD0 = 0x0 << Bit::DOPO, ///< DO on PAD[0], SCK on PAD[1], SS on PAD[2].
+                DOPO_PAD2 = 0x1 << Bit::DOPO, ///< DO on PAD[2], SCK on PAD[3], SS on PAD[1].
+                DOPO_PAD3 = 0x2 << Bit::DOPO, ///< DO on PAD[3], SCK on PAD[1], SS on PAD[2].
+                DOPO_PAD0_SCK_PAD3 = 0x3 << Bit::DOPO, ///< DO on PAD[0], SCK on PAD[3], SS on PAD[1].
+            };
+
+            /**
+             * \brief DIPO.
+             */
+            enum DIPO : std::uint32_t {
+                DIPO_PAD0 = 0x0 << Bit::DIPO, ///< DI on PAD[0].
+                DIPO_PAD1 = 0x1 << Bit::DIPO, ///< DI on PAD[1].
+                DIPO_PAD2 = 0x2 << Bit::DIPO, ///< DI on PAD[2].
+                DIPO_PAD3 = 0x3 << Bit::DIPO, ///< DI on PAD[3].
+            };
+
+            /**
+             * \brief FORM.
+             */
+            enum FORM : std::uint32_t {
+                FORM_SPI         = 0x0 << Bit::FORM, ///< SPI frame.
+                FORM_SPI_ADDRESS = 0x2 << Bit::FORM, ///< SPI frame with address.
+            };
+
+            /**
+             * \brief CPHA.
+             */
+            enum CPHA : std::uint32_t {
+                CPHA_LEADING = 0x0 << Bit::CPHA, ///< Sample on leading edge, change on trailing edge.
+                CPHA_TRAILING = 0x1 << Bit::CPHA, ///< Change on leading edge, sample on trailing edge.
+            };
+
+            /**
+             * \brief CPOL.
+             */
+            enum CPOL : std::uint32_t {
+                CPOL_IDLE_LOW  = 0x0 << Bit::CPOL, ///< SCK is low when idle.
+                CPOL_IDLE_HIGH = 0x1 << Bit::CPOL, ///< SCK is high when idle.
+            };
+
+            /**
+             * \brief DORD.
+             */
+            enum DORD : std::uint32_t {
+                DORD_MSB = 0x0 << Bit::DORD, ///< MSB first.
+                DORD_LSB = 0x1 << Bit::DORD, ///< LSB first.
+            };
+
+            CTRLA() = delete;
+
+            CTRLA( CTRLA && ) = delete;
+
+            CTRLA( CTRLA const & ) = delete;
+
+            ~CTRLA() = delete;
+
+            auto operator=( CTRLA && ) = delete;
+
+            auto operator=( CTRLA const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Control B (CTRLB) register.
+         *
+         * This register has the following fields:
+         * - Character Size (CHSIZE)
+         * - Data Preload Enable (PLOADEN)
+         * - Slave Select Low Detect Enable (SSDE)
+         * - Master Slave Select Enable (MSSEN)
+         * - Address Mode (AMODE)
+         * - Receiver Enable (RXEN)
+         */
+        class CTRLB : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto CHSIZE     = std::uint_fast8_t{ 3 }; ///< CHSIZE.
+                static constexpr auto RESERVED3  = std::uint_fast8_t{ 3 }; ///< RESERVED3.
+                static constexpr auto PLOADEN    = std::uint_fast8_t{ 1 }; ///< PLOADEN.
+                static constexpr auto RESERVED7  = std::uint_fast8_t{ 2 }; ///< RESERVED7.
+                static constexpr auto SSDE       = std::uint_fast8_t{ 1 }; ///< SSDE.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ 3 }; ///< RESERVED10.
+                static constexpr auto MSSEN      = std::uint_fast8_t{ 1 }; ///< MSSEN.
+                static constexpr auto AMODE      = std::uint_fast8_t{ 2 }; ///< AMODE.
+                static constexpr auto RESERVED16 = std::uint_fast8_t{ 1 }; ///< RESERVED16.
+                static constexpr auto RXEN       = std::uint_fast8_t{ 1 }; ///< RXEN.
+                static constexpr auto RESERVED18 = std::uint_fast8_t{ 14 }; ///< RESERVED18.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto CHSIZE = std::uint_fast8_t{}; ///< CHSIZE.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ CHSIZE + Size::CHSIZE }; ///< RESERVED3.
+                static constexpr auto PLOADEN = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< PLOADEN.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ PLOADEN + Size::PLOADEN }; ///< RESERVED7.
+                static constexpr auto SSDE = std::uint_fast8_t{ RESERVED7 + Size::RESERVED7 }; ///< SSDE.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ SSDE + Size::SSDE }; ///< RESERVED10.
+                static constexpr auto MSSEN = std::uint_fast8_t{ RESERVED10 + Size::RESERVED10 }; ///< MSSEN.
+                static constexpr auto AMODE = std::uint_fast8_t{ MSSEN + Size::MSSEN }; ///< AMODE.
+                static constexpr auto RESERVED16 = std::uint_fast8_t{ AMODE + Size::AMODE }; ///< RESERVED16.
+                static constexpr auto RXEN = std::uint_fast8_t{ RESERVED16 + Size::RESERVED16 }; ///< RXEN.
+                static constexpr auto RESERVED18 = std::uint_fast8_t{ RXEN + Size::RXEN }; ///< RESERVED18.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto CHSIZE = mask<std::uint32_t>( Size::CHSIZE, Bit::CHSIZE ); ///< CHSIZE.
+                static constexpr auto RESERVED3 = mask<std::uint32_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto PLOADEN = mask<std::uint32_t>( Size::PLOADEN, Bit::PLOADEN ); ///< PLOADEN.
+                static constexpr auto RESERVED7 = mask<std::uint32_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                static constexpr auto SSDE = mask<std::uint32_t>( Size::SSDE, Bit::SSDE ); ///< SSDE.
+                static constexpr auto RESERVED10 = mask<std::uint32_t>( Size::RESERVED10, Bit::RESERVED10 ); ///< RESERVED10.
+                static constexpr auto MSSEN = mask<std::uint32_t>( Size::MSSEN, Bit::MSSEN ); ///< MSSEN.
+                static constexpr auto AMODE = mask<std::uint32_t>( Size::AMODE, Bit::AMODE ); ///< AMODE.
+                static constexpr auto RESERVED16 = mask<std::uint32_t>( Size::RESERVED16, Bit::RESERVED16 ); ///< RESERVED16.
+                static constexpr auto RXEN = mask<std::uint32_t>( Size::RXEN, Bit::RXEN ); ///< RXEN.
+                static constexpr auto RESERVED18 = mask<std::uint32_t>( Size::RESERVED18, Bit::RESERVED18 ); ///< RESERVED18.
+            };
+
+            /**
+             * \brief CHSIZE.
+             */
+            enum CHSIZE : std::uint32_t {
+                CHSIZE_8_BIT = 0x0 << Bit::CHSIZE, ///< 8 bits.
+                CHSIZE_9_BIT = 0x1 << Bit::CHSIZE, ///< 9 bits.
+            };
+
+            /**
+             * \brief AMODE.
+             */
+            enum AMODE : std::uint32_t {
+                AMODE_MASK = 0x0 << Bit::AMODE, ///< ADDRMASK is used as a mask to the ADDR register.
+                AMODE_2_ADDRESSES = 0x1 << Bit::AMODE, ///< The slave responds to the two unique addresses in ADDR and ADDRMASK.
+                AMODE_RANGE = 0x2 << Bit::AMODE, ///< The slave responds to the range of addresses between and including ADDR and ADDRMASK.
+            };
+
+            CTRLB() = delete;
+
+            CTRLB( CTRLB && ) = delete;
+
+            CTRLB( CTRLB const & ) = delete;
+
+            ~CTRLB() = delete;
+
+            auto operator=( CTRLB && ) = delete;
+
+            auto operator=( CTRLB const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Clear (INTENCLR) register.
+         *
+         * This register has the following fields:
+         * - Data Register Empty Interrupt Enable (DRE)
+         * - Transmit Complete Interrupt Enable (TXC)
+         * - Receive Complete Interrupt Enable (RXC)
+         * - Slave Select Low Interrupt Enable (SSL)
+         * - Combined Error Interrupt Enable (ERROR)
+         */
+        class INTENCLR : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DRE       = std::uint_fast8_t{ 1 }; ///< DRE.
+                static constexpr auto TXC       = std::uint_fast8_t{ 1 }; ///< TXC.
+                static constexpr auto RXC       = std::uint_fast8_t{ 1 }; ///< RXC.
+                static constexpr auto SSL       = std::uint_fast8_t{ 1 }; ///< SSL.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ 3 }; ///< RESERVED4.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DRE = std::uint_fast8_t{}; ///< DRE.
+                static constexpr auto TXC = std::uint_fast8_t{ DRE + Size::DRE }; ///< TXC.
+                static constexpr auto RXC = std::uint_fast8_t{ TXC + Size::TXC }; ///< RXC.
+                static constexpr auto SSL = std::uint_fast8_t{ RXC + Size::RXC }; ///< SSL.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ SSL + Size::SSL }; ///< RESERVED4.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DRE = mask<std::uint8_t>( Size::DRE, Bit::DRE ); ///< DRE.
+                static constexpr auto TXC = mask<std::uint8_t>( Size::TXC, Bit::TXC ); ///< TXC.
+                static constexpr auto RXC = mask<std::uint8_t>( Size::RXC, Bit::RXC ); ///< RXC.
+                static constexpr auto SSL = mask<std::uint8_t>( Size::SSL, Bit::SSL ); ///< SSL.
+                static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTENCLR() = delete;
+
+            INTENCLR( INTENCLR && ) = delete;
+
+            INTENCLR( INTENCLR const & ) = delete;
+
+            ~INTENCLR() = delete;
+
+            auto operator=( INTENCLR && ) = delete;
+
+            auto operator=( INTENCLR const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Set (INTENSET) register.
+         *
+         * This register has the following fields:
+         * - Data Register Empty Interrupt Enable (DRE)
+         * - Transmit Complete Interrupt Enable (TXC)
+         * - Receive Complete Interrupt Enable (RXC)
+         * - Slave Select Low Interrupt Enable (SSL)
+         * - Combined Error Interrupt Enable (ERROR)
+         */
+        class INTENSET : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DRE       = std::uint_fast8_t{ 1 }; ///< DRE.
+                static constexpr auto TXC       = std::uint_fast8_t{ 1 }; ///< TXC.
+                static constexpr auto RXC       = std::uint_fast8_t{ 1 }; ///< RXC.
+                static constexpr auto SSL       = std::uint_fast8_t{ 1 }; ///< SSL.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ 3 }; ///< RESERVED4.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DRE = std::uint_fast8_t{}; ///< DRE.
+                static constexpr auto TXC = std::uint_fast8_t{ DRE + Size::DRE }; ///< TXC.
+                static constexpr auto RXC = std::uint_fast8_t{ TXC + Size::TXC }; ///< RXC.
+                static constexpr auto SSL = std::uint_fast8_t{ RXC + Size::RXC }; ///< SSL.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ SSL + Size::SSL }; ///< RESERVED4.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DRE = mask<std::uint8_t>( Size::DRE, Bit::DRE ); ///< DRE.
+                static constexpr auto TXC = mask<std::uint8_t>( Size::TXC, Bit::TXC ); ///< TXC.
+                static constexpr auto RXC = mask<std::uint8_t>( Size::RXC, Bit::RXC ); ///< RXC.
+                static constexpr auto SSL = mask<std::uint8_t>( Size::SSL, Bit::SSL ); ///< SSL.
+                static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTENSET() = delete;
+
+            INTENSET( INTENSET && ) = delete;
+
+            INTENSET( INTENSET const & ) = delete;
+
+            ~INTENSET() = delete;
+
+            auto operator=( INTENSET && ) = delete;
+
+            auto operator=( INTENSET const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+         *
+         * This register has the following fields:
+         * - Data Register Empty (DRE)
+         * - Transmit Complete (TXC)
+         * - Receive Complete (RXC)
+         * - Slave Select Low (SSL)
+         * - Combined Error (ERROR)
+         */
+        class INTFLAG : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DRE       = std::uint_fast8_t{ 1 }; ///< DRE.
+                static constexpr auto TXC       = std::uint_fast8_t{ 1 }; ///< TXC.
+                static constexpr auto RXC       = std::uint_fast8_t{ 1 }; ///< RXC.
+                static constexpr auto SSL       = std::uint_fast8_t{ 1 }; ///< SSL.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ 3 }; ///< RESERVED4.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DRE = std::uint_fast8_t{}; ///< DRE.
+                static constexpr auto TXC = std::uint_fast8_t{ DRE + Size::DRE }; ///< TXC.
+                static constexpr auto RXC = std::uint_fast8_t{ TXC + Size::TXC }; ///< RXC.
+                static constexpr auto SSL = std::uint_fast8_t{ RXC + Size::RXC }; ///< SSL.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ SSL + Size::SSL }; ///< RESERVED4.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DRE = mask<std::uint8_t>( Size::DRE, Bit::DRE ); ///< DRE.
+                static constexpr auto TXC = mask<std::uint8_t>( Size::TXC, Bit::TXC ); ///< TXC.
+                static constexpr auto RXC = mask<std::uint8_t>( Size::RXC, Bit::RXC ); ///< RXC.
+                static constexpr auto SSL = mask<std::uint8_t>( Size::SSL, Bit::SSL ); ///< SSL.
+                static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTFLAG() = delete;
+
+            INTFLAG( INTFLAG && ) = delete;
+
+            INTFLAG( INTFLAG const & ) = delete;
+
+            ~INTFLAG() = delete;
+
+            auto operator=( INTFLAG && ) = delete;
+
+            auto operator=( INTFLAG const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Status (STATUS) register.
+         *
+         * This register has the following fields:
+         * - Buffer Overflow (BUFOVF)
+         */
+        class STATUS : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{ 2 };  ///< RESERVED0.
+                static constexpr auto BUFOVF    = std::uint_fast8_t{ 1 };  ///< BUFOVF.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 13 }; ///< RESERVED3.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto BUFOVF = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< BUFOVF.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ BUFOVF + Size::BUFOVF }; ///< RESERVED3.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint16_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto BUFOVF = mask<std::uint16_t>( Size::BUFOVF, Bit::BUFOVF ); ///< BUFOVF.
+                static constexpr auto RESERVED3 = mask<std::uint16_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+            };
+
+            STATUS() = delete;
+
+            STATUS( STATUS && ) = delete;
+
+            STATUS( STATUS const & ) = delete;
+
+            ~STATUS() = delete;
+
+            auto operator=( STATUS && ) = delete;
+
+            auto operator=( STATUS const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Synchronization Busy (SYNCBUSY) register.
+         *
+         * This register has the following fields:
+         * - Software Reset Synchronization Busy (SWRST)
+         * - SERCOM Enable Synchronization Busy (ENABLE)
+         * - CTRLB Synchronization Busy (CTRLB)
+         */
+        class SYNCBUSY : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST     = std::uint_fast8_t{ 1 };  ///< SWRST.
+                static constexpr auto ENABLE    = std::uint_fast8_t{ 1 };  ///< ENABLE.
+                static constexpr auto CTRLB     = std::uint_fast8_t{ 1 };  ///< CTRLB.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 29 }; ///< RESERVED3.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto CTRLB = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< CTRLB.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ CTRLB + Size::CTRLB }; ///< RESERVED3.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint32_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint32_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto CTRLB = mask<std::uint32_t>( Size::CTRLB, Bit::CTRLB ); ///< CTRLB.
+                static constexpr auto RESERVED3 = mask<std::uint32_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+            };
+
+            SYNCBUSY() = delete;
+
+            SYNCBUSY( SYNCBUSY && ) = delete;
+
+            SYNCBUSY( SYNCBUSY const & ) = delete;
+
+            ~SYNCBUSY() = delete;
+
+            auto operator=( SYNCBUSY && ) = delete;
+
+            auto operator=( SYNCBUSY const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Address (ADDR) register.
+         *
+         * This register has the following fields:
+         * - Address (ADDR)
+         * - Address Mask (ADDRMASK)
+         */
+        class ADDR : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto ADDR       = std::uint_fast8_t{ 8 }; ///< ADDR.
+                static constexpr auto RESERVED8  = std::uint_fast8_t{ 8 }; ///< RESERVED8.
+                static constexpr auto ADDRMASK   = std::uint_fast8_t{ 8 }; ///< ADDRMASK.
+                static constexpr auto RESERVED24 = std::uint_fast8_t{ 8 }; ///< RESERVED24.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto ADDR = std::uint_fast8_t{}; ///< ADDR.
+                static constexpr auto RESERVED8 = std::uint_fast8_t{ ADDR + Size::ADDR }; ///< RESERVED8.
+                static constexpr auto ADDRMASK = std::uint_fast8_t{ RESERVED8 + Size::RESERVED8 }; ///< ADDRMASK.
+                static constexpr auto RESERVED24 = std::uint_fast8_t{ ADDRMASK + Size::ADDRMASK }; ///< RESERVED24.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto ADDR = mask<std::uint32_t>( Size::ADDR, Bit::ADDR ); ///< ADDR.
+                static constexpr auto RESERVED8 = mask<std::uint32_t>( Size::RESERVED8, Bit::RESERVED8 ); ///< RESERVED8.
+                static constexpr auto ADDRMASK = mask<std::uint32_t>( Size::ADDRMASK, Bit::ADDRMASK ); ///< ADDRMASK.
+                static constexpr auto RESERVED24 = mask<std::uint32_t>( Size::RESERVED24, Bit::RESERVED24 ); ///< RESERVED24.
+            };
+
+            ADDR() = delete;
+
+            ADDR( ADDR && ) = delete;
+
+            ADDR( ADDR const & ) = delete;
+
+            ~ADDR() = delete;
+
+            auto operator=( ADDR && ) = delete;
+
+            auto operator=( ADDR const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Debug Control (DBGCTRL) register.
+         *
+         * This register has the following fields:
+         * - Debug Mode (DBGSTOP)
+         */
+        class DBGCTRL : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DBGSTOP   = std::uint_fast8_t{ 1 }; ///< DBGSTOP.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 7 }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DBGSTOP = std::uint_fast8_t{}; ///< DBGSTOP.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DBGSTOP + Size::DBGSTOP }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DBGSTOP = mask<std::uint8_t>( Size::DBGSTOP, Bit::DBGSTOP ); ///< DBGSTOP.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+            };
+
+            DBGCTRL() = delete;
+
+            DBGCTRL( DBGCTRL && ) = delete;
+
+            DBGCTRL( DBGCTRL const & ) = delete;
+
+            ~DBGCTRL() = delete;
+
+            auto operator=( DBGCTRL && ) = delete;
+
+            auto operator=( DBGCTRL const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief CTRLA.
+         */
+        CTRLA ctrla;
+
+        /**
+         * \brief CTRLB.
+         */
+        CTRLB ctrlb;
+
+        /**
+         * \brief Reserved registers (offset 0x08-0x0B).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x08_0x0B[ ( 0x0B - 0x08 ) + 1 ];
+
+        /**
+         * \brief Baud (BAUD) register.
+         */
+        Register<std::uint8_t> baud;
+
+        /**
+         * \brief Reserved registers (offset 0x0D-0x13).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x0D_0x13[ ( 0x13 - 0x0D ) + 1 ];
+
+        /**
+         * \brief INTENCLR.
+         */
+        INTENCLR intenclr;
+
+        /**
+         * \brief Reserved registers (offset 0x15-0x15).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x15_0x15[ ( 0x15 - 0x15 ) + 1 ];
+
+        /**
+         * \brief INTENSET.
+         */
+        INTENSET intenset;
+
+        /**
+         * \brief Reserved registers (offset 0x17-0x17).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x17_0x17[ ( 0x17 - 0x17 ) + 1 ];
+
+        /**
+         * \brief INTFLAG.
+         */
+        INTFLAG intflag;
+
+        /**
+         * \brief Reserved registers (offset 0x19-0x19).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x19_0x19[ ( 0x19 - 0x19 ) + 1 ];
+
+        /**
+         * \brief STATUS.
+         */
+        STATUS status;
+
+        /**
+         * \brief SYNCBUSY.
+         */
+        SYNCBUSY const syncbusy;
+
+        /**
+         * \brief Reserved registers (offset 0x20-0x23).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x20_0x23[ ( 0x23 - 0x20 ) + 1 ];
+
+        /**
+         * \brief ADDR.
+         */
+        ADDR addr;
+
+        /**
+         * \brief Data (DATA) register.
+         */
+        Register<std::uint32_t> data;
+
+        /**
+         * \brief Reserved registers (offset 0x2C-0x2F).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x2C_0x2F[ ( 0x2F - 0x2C ) + 1 ];
+
+        /**
+         * \brief DBGCTRL.
+         */
+        DBGCTRL dbgctrl;
+
+        SPI() = delete;
+
+        SPI( SPI && ) = delete;
+
+        SPI( SPI const & ) = delete;
+
+        ~SPI() = delete;
+
+        auto operator=( SPI && ) = delete;
+
+        auto operator=( SPI const & ) = delete;
+    };
+
+    /**
+     * \brief I2C master operating mode.
+     */
+    class I2CM {
+      public:
+        /**
+         * \brief Control A (CTRLA) register.
+         *
+         * This register has the following fields:
+         * - Software Reset (SWRST)
+         * - Enable (ENABLE)
+         * - Operating Mode (MODE)
+         * - Run in Standby (RUNSTDBY)
+         * - Pin Usage (PINOUT)
+         * - SDA Hold Time (SDAHOLD)
+         * - Master SCL Low Extend Timeout (MEXTTOEN)
+         * - Slave SCL Low Extend Timeout (SEXTTOEN)
+         * - Transfer Speed (SPEED)
+         * - SCL Clock Stretch Mode (SCLSM)
+         * - Inactive Timeout (INACTOUT)
+         * - SCL Low Timeout Enable (LOWTOUTEN)
+         */
+        class CTRLA : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST      = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE     = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto MODE       = std::uint_fast8_t{ 3 }; ///< MODE.
+                static constexpr auto RESERVED5  = std::uint_fast8_t{ 2 }; ///< RESERVED5.
+                static constexpr auto RUNSTDBY   = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+                static constexpr auto RESERVED8  = std::uint_fast8_t{ 8 }; ///< RESERVED8.
+                static constexpr auto PINOUT     = std::uint_fast8_t{ 1 }; ///< PINOUT.
+                static constexpr auto RESERVED17 = std::uint_fast8_t{ 3 }; ///< RESERVED17.
+                static constexpr auto SDAHOLD    = std::uint_fast8_t{ 2 }; ///< SDAHOLD.
+                static constexpr auto MEXTTOEN   = std::uint_fast8_t{ 1 }; ///< MEXTTOEN.
+                static constexpr auto SEXTTOEN   = std::uint_fast8_t{ 1 }; ///< SEXTTOEN.
+                static constexpr auto SPEED      = std::uint_fast8_t{ 2 }; ///< SPEED.
+                static constexpr auto RESERVED26 = std::uint_fast8_t{ 1 }; ///< RESERVED26.
+                static constexpr auto SCLSM      = std::uint_fast8_t{ 1 }; ///< SCLSM.
+                static constexpr auto INACTOUT   = std::uint_fast8_t{ 2 }; ///< INACTOUT.
+                static constexpr auto LOWTOUTEN  = std::uint_fast8_t{ 1 }; ///< LOWTOUTEN.
+                static constexpr auto RESERVED31 = std::uint_fast8_t{ 1 }; ///< RESERVED31.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto MODE = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< MODE.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ MODE + Size::MODE }; ///< RESERVED5.
+                static constexpr auto RUNSTDBY = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< RUNSTDBY.
+                static constexpr auto RESERVED8 = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< RESERVED8.
+                static constexpr auto PINOUT = std::uint_fast8_t{ RESERVED8 + Size::RESERVED8 }; ///< PINOUT.
+                static constexpr auto RESERVED17 = std::uint_fast8_t{ PINOUT + Size::PINOUT }; ///< RESERVED17.
+                static constexpr auto SDAHOLD = std::uint_fast8_t{ RESERVED17 + Size::RESERVED17 }; ///< SDAHOLD.
+                static constexpr auto MEXTTOEN = std::uint_fast8_t{ SDAHOLD + Size::SDAHOLD }; ///< MEXTTOEN.
+                static constexpr auto SEXTTOEN = std::uint_fast8_t{ MEXTTOEN + Size::MEXTTOEN }; ///< SEXTTOEN.
+                static constexpr auto SPEED = std::uint_fast8_t{ SEXTTOEN + Size::SEXTTOEN }; ///< SPEED.
+                static constexpr auto RESERVED26 = std::uint_fast8_t{ SPEED + Size::SPEED }; ///< RESERVED26.
+                static constexpr auto SCLSM = std::uint_fast8_t{ RESERVED26 + Size::RESERVED26 }; ///< SCLSM.
+                static constexpr auto INACTOUT = std::uint_fast8_t{ SCLSM + Size::SCLSM }; ///< INACTOUT.
+                static constexpr auto LOWTOUTEN = std::uint_fast8_t{ INACTOUT + Size::INACTOUT }; ///< LOWTOUTEN.
+                static constexpr auto RESERVED31 = std::uint_fast8_t{ LOWTOUTEN + Size::LOWTOUTEN }; ///< RESERVED31.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint32_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint32_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto MODE = mask<std::uint32_t>( Size::MODE, Bit::MODE ); ///< MODE.
+                static constexpr auto RESERVED5 = mask<std::uint32_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto RUNSTDBY = mask<std::uint32_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+                static constexpr auto RESERVED8 = mask<std::uint32_t>( Size::RESERVED8, Bit::RESERVED8 ); ///< RESERVED8.
+                static constexpr auto PINOUT = mask<std::uint32_t>( Size::PINOUT, Bit::PINOUT ); ///< PINOUT.
+                static constexpr auto RESERVED17 = mask<std::uint32_t>( Size::RESERVED17, Bit::RESERVED17 ); ///< RESERVED17.
+                static constexpr auto SDAHOLD = mask<std::uint32_t>( Size::SDAHOLD, Bit::SDAHOLD ); ///< SDAHOLD.
+                static constexpr auto MEXTTOEN = mask<std::uint32_t>( Size::MEXTTOEN, Bit::MEXTTOEN ); ///< MEXTTOEN.
+                static constexpr auto SEXTTOEN = mask<std::uint32_t>( Size::SEXTTOEN, Bit::SEXTTOEN ); ///< SEXTTOEN.
+                static constexpr auto SPEED = mask<std::uint32_t>( Size::SPEED, Bit::SPEED ); ///< SPEED.
+                static constexpr auto RESERVED26 = mask<std::uint32_t>( Size::RESERVED26, Bit::RESERVED26 ); ///< RESERVED26.
+                static constexpr auto SCLSM = mask<std::uint32_t>( Size::SCLSM, Bit::SCLSM ); ///< SCLSM.
+                static constexpr auto INACTOUT = mask<std::uint32_t>( Size::INACTOUT, Bit::INACTOUT ); ///< INACTOUT.
+                static constexpr auto LOWTOUTEN = mask<std::uint32_t>( Size::LOWTOUTEN, Bit::LOWTOUTEN ); ///< LOWTOUTEN.
+                static constexpr auto RESERVED31 = mask<std::uint32_t>( Size::RESERVED31, Bit::RESERVED31 ); ///< RESERVED31.
+            };
+
+            /**
+             * \brief MODE.
+             */
+            enum MODE : std::uint32_t {
+                MODE_I2C_MASTER = 0x5 << Bit::MODE, ///< I2C master.
+            };
+
+            /**
+             * \brief SDAHOLD.
+             */
+            enum SDAHOLD : std::uint32_t {
+                SDAHOLD_DISABLE = 0x0 << Bit::SDAHOLD, ///< Disabled.
+                SDAHOLD_75NS    = 0x1 << Bit::SDAHOLD, ///< 50-100 ns hold time.
+                SDAHOLD_450NS   = 0x2 << Bit::SDAHOLD, ///< 300-600 ns hold time.
+                SDAHOLD_600NS   = 0x3 << Bit::SDAHOLD, ///< 400-800 ns hold time.
+            };
+
+            /**
+             * \brief SPEED.
+             */
+            enum SPEED : std::uint32_t {
+                SPEED_STANDARD_AND_FAST_MODE = 0x0 << Bit::SPEED, ///< Standard-mode (up to 100 kHz) and Fast-mode (up to 400 kHz).
+                SPEED_FASTPLUS_MODE = 0x1 << Bit::SPEED, ///< Fast-mode Plus (up to 1 MHz).
+                SPEED_HIGH_SPEED_MODE = 0x2 << Bit::SPEED, ///< High-speed mode (up to 3.4 MHz).
+            };
+
+            /**
+             * \brief INACTOUT.
+             */
+            enum INACTOUT : std::uint32_t {
+                INACTOUT_DISABLE = 0x0 << Bit::INACTOUT, ///< Disabled.
+                INACTOUT_55US    = 0x1 << Bit::INACTOUT, ///< 5-6 SCL time-out (50-60 us).
+                INACTOUT_105US = 0x2 << Bit::INACTOUT, ///< 10-11 SCL time-out (100-110 us).
+                INACTOUT_205US = 0x3 << Bit::INACTOUT, ///< 20-21 SCL time-out (200-210 us).
+            };
+
+            CTRLA() = delete;
+
+            CTRLA( CTRLA && ) = delete;
+
+            CTRLA( CTRLA const & ) = delete;
+
+            ~CTRLA() = delete;
+
+            auto operator=( CTRLA && ) = delete;
+
+            auto operator=( CTRLA const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Control B (CTRLB) register.
+         *
+         * This register has the following fields:
+         * - Smart Mode Enable (SMEN)
+         * - Quick Command Enable (QCEN)
+         * - Command (CMD)
+         * - Acknowledge Action (ACKACT)
+         */
+        class CTRLB : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0  = std::uint_fast8_t{ 8 }; ///< RESERVED0.
+                static constexpr auto SMEN       = std::uint_fast8_t{ 1 }; ///< SMEN.
+                static constexpr auto QCEN       = std::uint_fast8_t{ 1 }; ///< QCEN.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ 6 }; ///< RESERVED10.
+                static constexpr auto CMD        = std::uint_fast8_t{ 2 }; ///< CMD.
+                static constexpr auto ACKACT     = std::uint_fast8_t{ 1 }; ///< ACKACT.
+                static constexpr auto RESERVED19 = std::uint_fast8_t{ 13 }; ///< RESERVED19.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto SMEN = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< SMEN.
+                static constexpr auto QCEN = std::uint_fast8_t{ SMEN + Size::SMEN }; ///< QCEN.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ QCEN + Size::QCEN }; ///< RESERVED10.
+                static constexpr auto CMD = std::uint_fast8_t{ RESERVED10 + Size::RESERVED10 }; ///< CMD.
+                static constexpr auto ACKACT = std::uint_fast8_t{ CMD + Size::CMD }; ///< ACKACT.
+                static constexpr auto RESERVED19 = std::uint_fast8_t{ ACKACT + Size::ACKACT }; ///< RESERVED19.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint32_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto SMEN = mask<std::uint32_t>( Size::SMEN, Bit::SMEN ); ///< SMEN.
+                static constexpr auto QCEN = mask<std::uint32_t>( Size::QCEN, Bit::QCEN ); ///< QCEN.
+                static constexpr auto RESERVED10 = mask<std::uint32_t>( Size::RESERVED10, Bit::RESERVED10 ); ///< RESERVED10.
+                static constexpr auto CMD = mask<std::uint32_t>( Size::CMD, Bit::CMD ); ///< CMD.
+                static constexpr auto ACKACT = mask<std::uint32_t>( Size::ACKACT, Bit::ACKACT ); ///< ACKACT.
+                static constexpr auto RESERVED19 = mask<std::uint32_t>( Size::RESERVED19, Bit::RESERVED19 ); ///< RESERVED19.
+            };
+
+            /**
+             * \brief CMD.
+             */
+            enum CMD : std::uint32_t {
+                CMD_NOACT = 0x0 << Bit::CMD, ///< No action.
+                CMD_REPEATED_START = 0x1 << Bit::CMD, ///< Execute acknowledge action succeeded by repeated start.
+                CMD_READ = 0x2 << Bit::CMD, ///< Execute acknowledge action succeeded by a byte read operation.
+                CMD_STOP = 0x3 << Bit::CMD, ///< Execute acknowledge action succeeded by issuing a stop condition.
+            };
+
+            /**
+             * \brief ACKACT.
+             */
+            enum ACKACT : std::uint32_t {
+                ACKACT_ACK  = 0x0 << Bit::ACKACT, ///< Send ACK.
+                ACKACT_NACK = 0x1 << Bit::ACKACT, ///< Send NACK.
+            };
+
+            CTRLB() = delete;
+
+            CTRLB( CTRLB && ) = delete;
+
+            CTRLB( CTRLB const & ) = delete;
+
+            ~CTRLB() = delete;
+
+            auto operator=( CTRLB && ) = delete;
+
+            auto operator=( CTRLB const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Baud (BAUD) register.
+         *
+         * This register has the following fields:
+         * - Baud Rate Value (BAUD)
+         * - Baud Rate Value Low (BAUDLOW)
+         * - High Speed Baud Rate Value (HSBAUD)
+         * - High Speed Baud Rate Value Low (HSBAUDLOW)
+         */
+        class BAUD : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto BAUD      = std::uint_fast8_t{ 8 }; ///< BAUD.
+                static constexpr auto BAUDLOW   = std::uint_fast8_t{ 8 }; ///< BAUDLOW.
+                static constexpr auto HSBAUD    = std::uint_fast8_t{ 8 }; ///< HSBAUD.
+                static constexpr auto HSBAUDLOW = std::uint_fast8_t{ 8 }; ///< HSBAUDLOW.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto BAUD = std::uint_fast8_t{}; ///< BAUD.
+                static constexpr auto BAUDLOW = std::uint_fast8_t{ BAUD + Size::BAUD }; ///< BAUDLOW.
+                static constexpr auto HSBAUD = std::uint_fast8_t{ BAUDLOW + Size::BAUDLOW }; ///< HSBAUD.
+                static constexpr auto HSBAUDLOW = std::uint_fast8_t{ HSBAUD + Size::HSBAUD }; ///< HSBAUDLOW.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto BAUD = mask<std::uint32_t>( Size::BAUD, Bit::BAUD ); ///< BAUD.
+                static constexpr auto BAUDLOW = mask<std::uint32_t>( Size::BAUDLOW, Bit::BAUDLOW ); ///< BAUDLOW.
+                static constexpr auto HSBAUD = mask<std::uint32_t>( Size::HSBAUD, Bit::HSBAUD ); ///< HSBAUD.
+                static constexpr auto HSBAUDLOW = mask<std::uint32_t>( Size::HSBAUDLOW, Bit::HSBAUDLOW ); ///< HSBAUDLOW.
+            };
+
+            BAUD() = delete;
+
+            BAUD( BAUD && ) = delete;
+
+            BAUD( BAUD const & ) = delete;
+
+            ~BAUD() = delete;
+
+            auto operator=( BAUD && ) = delete;
+
+            auto operator=( BAUD const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Clear (INTENCLR) register.
+         *
+         * This register has the following fields:
+         * - Master on Bus Interrupt Enable (MB)
+         * - Slave on Bus Interrupt Enable (SB)
+         * - Combined Error Interrupt Enable (ERROR)
+         */
+        class INTENCLR : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto MB        = std::uint_fast8_t{ 1 }; ///< MB.
+                static constexpr auto SB        = std::uint_fast8_t{ 1 }; ///< SB.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 5 }; ///< RESERVED2.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto MB = std::uint_fast8_t{};                ///< MB.
+                static constexpr auto SB = std::uint_fast8_t{ MB + Size::MB }; ///< SB.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ SB + Size::SB }; ///< RESERVED2.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto MB = mask<std::uint8_t>( Size::MB, Bit::MB ); ///< MB.
+                static constexpr auto SB = mask<std::uint8_t>( Size::SB, Bit::SB ); ///< SB.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTENCLR() = delete;
+
+            INTENCLR( INTENCLR && ) = delete;
+
+            INTENCLR( INTENCLR const & ) = delete;
+
+            ~INTENCLR() = delete;
+
+            auto operator=( INTENCLR && ) = delete;
+
+            auto operator=( INTENCLR const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Set (INTENSET) register.
+         *
+         * This register has the following fields:
+         * - Master on Bus Interrupt Enable (MB)
+         * - Slave on Bus Interrupt Enable (SB)
+         * - Combined Error Interrupt Enable (ERROR)
+         */
+        class INTENSET : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto MB        = std::uint_fast8_t{ 1 }; ///< MB.
+                static constexpr auto SB        = std::uint_fast8_t{ 1 }; ///< SB.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 5 }; ///< RESERVED2.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto MB = std::uint_fast8_t{};                ///< MB.
+                static constexpr auto SB = std::uint_fast8_t{ MB + Size::MB }; ///< SB.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ SB + Size::SB }; ///< RESERVED2.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto MB = mask<std::uint8_t>( Size::MB, Bit::MB ); ///< MB.
+                static constexpr auto SB = mask<std::uint8_t>( Size::SB, Bit::SB ); ///< SB.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTENSET() = delete;
+
+            INTENSET( INTENSET && ) = delete;
+
+            INTENSET( INTENSET const & ) = delete;
+
+            ~INTENSET() = delete;
+
+            auto operator=( INTENSET && ) = delete;
+
+            auto operator=( INTENSET const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+         *
+         * This register has the following fields:
+         * - Master on Bus (MB)
+         * - Slave on Bus (SB)
+         * - Combined Error (ERROR)
+         */
+        class INTFLAG : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto MB        = std::uint_fast8_t{ 1 }; ///< MB.
+                static constexpr auto SB        = std::uint_fast8_t{ 1 }; ///< SB.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 5 }; ///< RESERVED2.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto MB = std::uint_fast8_t{};                ///< MB.
+                static constexpr auto SB = std::uint_fast8_t{ MB + Size::MB }; ///< SB.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ SB + Size::SB }; ///< RESERVED2.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto MB = mask<std::uint8_t>( Size::MB, Bit::MB ); ///< MB.
+                static constexpr auto SB = mask<std::uint8_t>( Size::SB, Bit::SB ); ///< SB.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTFLAG() = delete;
+
+            INTFLAG( INTFLAG && ) = delete;
+
+            INTFLAG( INTFLAG const & ) = delete;
+
+            ~INTFLAG() = delete;
+
+            auto operator=( INTFLAG && ) = delete;
+
+            auto operator=( INTFLAG const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Status (STATUS) register.
+         *
+         * This register has the following fields:
+         * - Bus Error (BUSERR)
+         * - Arbitration Lost (ARBLOST)
+         * - Received Not Acknowledge (RXNACK)
+         * - Bus State (BUSSTATE)
+         * - SCL Low Timeout (LOWTOUT)
+         * - Clock Hold (CLKHOLD)
+         * - Master SCL Low Extend Timeout (MEXTTOUT)
+         * - Slave SCL Low Extend Timeout (SEXTTOUT)
+         * - Transaction Length Error (LENERR)
+         */
+        class STATUS : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto BUSERR     = std::uint_fast8_t{ 1 }; ///< BUSERR.
+                static constexpr auto ARBLOST    = std::uint_fast8_t{ 1 }; ///< ARBLOST.
+                static constexpr auto RXNACK     = std::uint_fast8_t{ 1 }; ///< RXNACK.
+                static constexpr auto RESERVED3  = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                static constexpr auto BUSSTATE   = std::uint_fast8_t{ 2 }; ///< BUSSTATE.
+                static constexpr auto LOWTOUT    = std::uint_fast8_t{ 1 }; ///< LOWTOUT.
+                static constexpr auto CLKHOLD    = std::uint_fast8_t{ 1 }; ///< CLKHOLD.
+                static constexpr auto MEXTTOUT   = std::uint_fast8_t{ 1 }; ///< MEXTTOUT.
+                static constexpr auto SEXTTOUT   = std::uint_fast8_t{ 1 }; ///< SEXTTOUT.
+                static constexpr auto LENERR     = std::uint_fast8_t{ 1 }; ///< LENERR.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ 5 }; ///< RESERVED11.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto BUSERR = std::uint_fast8_t{}; ///< BUSERR.
+                static constexpr auto ARBLOST = std::uint_fast8_t{ BUSERR + Size::BUSERR }; ///< ARBLOST.
+                static constexpr auto RXNACK = std::uint_fast8_t{ ARBLOST + Size::ARBLOST }; ///< RXNACK.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ RXNACK + Size::RXNACK }; ///< RESERVED3.
+                static constexpr auto BUSSTATE = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< BUSSTATE.
+                static constexpr auto LOWTOUT = std::uint_fast8_t{ BUSSTATE + Size::BUSSTATE }; ///< LOWTOUT.
+                static constexpr auto CLKHOLD = std::uint_fast8_t{ LOWTOUT + Size::LOWTOUT }; ///< CLKHOLD.
+                static constexpr auto MEXTTOUT = std::uint_fast8_t{ CLKHOLD + Size::CLKHOLD }; ///< MEXTTOUT.
+                static constexpr auto SEXTTOUT = std::uint_fast8_t{ MEXTTOUT + Size::MEXTTOUT }; ///< SEXTTOUT.
+                static constexpr auto LENERR = std::uint_fast8_t{ SEXTTOUT + Size::SEXTTOUT }; ///< LENERR.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ LENERR + Size::LENERR }; ///< RESERVED11.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto BUSERR = mask<std::uint16_t>( Size::BUSERR, Bit::BUSERR ); ///< BUSERR.
+                static constexpr auto ARBLOST = mask<std::uint16_t>( Size::ARBLOST, Bit::ARBLOST ); ///< ARBLOST.
+                static constexpr auto RXNACK = mask<std::uint16_t>( Size::RXNACK, Bit::RXNACK ); ///< RXNACK.
+                static constexpr auto RESERVED3 = mask<std::uint16_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto BUSSTATE = mask<std::uint16_t>( Size::BUSSTATE, Bit::BUSSTATE ); ///< BUSSTATE.
+                static constexpr auto LOWTOUT = mask<std::uint16_t>( Size::LOWTOUT, Bit::LOWTOUT ); ///< LOWTOUT.
+                static constexpr auto CLKHOLD = mask<std::uint16_t>( Size::CLKHOLD, Bit::CLKHOLD ); ///< CLKHOLD.
+                static constexpr auto MEXTTOUT = mask<std::uint16_t>( Size::MEXTTOUT, Bit::MEXTTOUT ); ///< MEXTTOUT.
+                static constexpr auto SEXTTOUT = mask<std::uint16_t>( Size::SEXTTOUT, Bit::SEXTTOUT ); ///< SEXTTOUT.
+                static constexpr auto LENERR = mask<std::uint16_t>( Size::LENERR, Bit::LENERR ); ///< LENERR.
+                static constexpr auto RESERVED11 = mask<std::uint16_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+            };
+
+            /**
+             * \brief BUSSTATE.
+             */
+            enum BUSSTATE : std::uint16_t {
+                BUSSTATE_UNKNOWN = 0x0 << Bit::BUSSTATE, ///< Unknown.
+                BUSSTATE_IDLE    = 0x1 << Bit::BUSSTATE, ///< Idle.
+                BUSSTATE_OWNER   = 0x2 << Bit::BUSSTATE, ///< Owner.
+                BUSSTATE_BUSY    = 0x3 << Bit::BUSSTATE, ///< Busy.
+            };
+
+            STATUS() = delete;
+
+            STATUS( STATUS && ) = delete;
+
+            STATUS( STATUS const & ) = delete;
+
+            ~STATUS() = delete;
+
+            auto operator=( STATUS && ) = delete;
+
+            auto operator=( STATUS const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Synchronization Busy (SYNCBUSY) register.
+         *
+         * This register has the following fields:
+         * - Software Reset Synchronization Busy (SWRST)
+         * - SERCOM Enable Synchronization Busy (ENABLE)
+         * - System Operation Synchronization Busy (SYSOP)
+         */
+        class SYNCBUSY : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST     = std::uint_fast8_t{ 1 };  ///< SWRST.
+                static constexpr auto ENABLE    = std::uint_fast8_t{ 1 };  ///< ENABLE.
+                static constexpr auto SYSOP     = std::uint_fast8_t{ 1 };  ///< SYSOP.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 29 }; ///< RESERVED3.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto SYSOP = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< SYSOP.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ SYSOP + Size::SYSOP }; ///< RESERVED3.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint32_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint32_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto SYSOP = mask<std::uint32_t>( Size::SYSOP, Bit::SYSOP ); ///< SYSOP.
+                static constexpr auto RESERVED3 = mask<std::uint32_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+            };
+
+            SYNCBUSY() = delete;
+
+            SYNCBUSY( SYNCBUSY && ) = delete;
+
+            SYNCBUSY( SYNCBUSY const & ) = delete;
+
+            ~SYNCBUSY() = delete;
+
+            auto operator=( SYNCBUSY && ) = delete;
+
+            auto operator=( SYNCBUSY const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Address (ADDR) register.
+         *
+         * This register has the following fields:
+         * - Address Value (ADDR)
+         * - Length Enable (LENEN)
+         * - High Speed Mode (HS)
+         * - Ten Bit Addressing Enable (TENBITEN)
+         * - Length (LEN)
+         */
+        class ADDR : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto ADDR       = std::uint_fast8_t{ 11 }; ///< ADDR.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ 2 }; ///< RESERVED11.
+                static constexpr auto LENEN      = std::uint_fast8_t{ 1 }; ///< LENEN.
+                static constexpr auto HS         = std::uint_fast8_t{ 1 }; ///< HS.
+                static constexpr auto TENBITEN   = std::uint_fast8_t{ 1 }; ///< TENBITEN.
+                static constexpr auto LEN        = std::uint_fast8_t{ 8 }; ///< LEN.
+                static constexpr auto RESERVED24 = std::uint_fast8_t{ 8 }; ///< RESERVED24.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto ADDR = std::uint_fast8_t{}; ///< ADDR.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ ADDR + Size::ADDR }; ///< RESERVED11.
+                static constexpr auto LENEN = std::uint_fast8_t{ RESERVED11 + Size::RESERVED11 }; ///< LENEN.
+                static constexpr auto HS = std::uint_fast8_t{ LENEN + Size::LENEN }; ///< HS.
+                static constexpr auto TENBITEN = std::uint_fast8_t{ HS + Size::HS }; ///< TENBITEN.
+                static constexpr auto LEN = std::uint_fast8_t{ TENBITEN + Size::TENBITEN }; ///< LEN.
+                static constexpr auto RESERVED24 = std::uint_fast8_t{ LEN + Size::LEN }; ///< RESERVED24.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto ADDR = mask<std::uint32_t>( Size::ADDR, Bit::ADDR ); ///< ADDR.
+                static constexpr auto RESERVED11 = mask<std::uint32_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+                static constexpr auto LENEN = mask<std::uint32_t>( Size::LENEN, Bit::LENEN ); ///< LENEN.
+                static constexpr auto HS = mask<std::uint32_t>( Size::HS, Bit::HS ); ///< HS.
+                static constexpr auto TENBITEN = mask<std::uint32_t>( Size::TENBITEN, Bit::TENBITEN ); ///< TENBITEN.
+                static constexpr auto LEN = mask<std::uint32_t>( Size::LEN, Bit::LEN ); ///< LEN.
+                static constexpr auto RESERVED24 = mask<std::uint32_t>( Size::RESERVED24, Bit::RESERVED24 ); ///< RESERVED24.
+            };
+
+            ADDR() = delete;
+
+            ADDR( ADDR && ) = delete;
+
+            ADDR( ADDR const & ) = delete;
+
+            ~ADDR() = delete;
+
+            auto operator=( ADDR && ) = delete;
+
+            auto operator=( ADDR const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Debug Control (DBGCTRL) register.
+         *
+         * This register has the following fields:
+         * - Debug Mode (DBGSTOP)
+         */
+        class DBGCTRL : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DBGSTOP   = std::uint_fast8_t{ 1 }; ///< DBGSTOP.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 7 }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DBGSTOP = std::uint_fast8_t{}; ///< DBGSTOP.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DBGSTOP + Size::DBGSTOP }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DBGSTOP = mask<std::uint8_t>( Size::DBGSTOP, Bit::DBGSTOP ); ///< DBGSTOP.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+            };
+
+            DBGCTRL() = delete;
+
+            DBGCTRL( DBGCTRL && ) = delete;
+
+            DBGCTRL( DBGCTRL const & ) = delete;
+
+            ~DBGCTRL() = delete;
+
+            auto operator=( DBGCTRL && ) = delete;
+
+            auto operator=( DBGCTRL const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief CTRLA.
+         */
+        CTRLA ctrla;
+
+        /**
+         * \brief CTRLB.
+         */
+        CTRLB ctrlb;
+
+        /**
+         * \brief Reserved registers (offset 0x08-0x0B).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x08_0x0B[ ( 0x0B - 0x08 ) + 1 ];
+
+        /**
+         * \brief BAUD.
+         */
+        BAUD baud;
+
+        /**
+         * \brief Reserved registers (offset 0x10-0x13).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x10_0x13[ ( 0x13 - 0x10 ) + 1 ];
+
+        /**
+         * \brief INTENCLR.
+         */
+        INTENCLR intenclr;
+
+        /**
+         * \brief Reserved registers (offset 0x15-0x15).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x15_0x15[ ( 0x15 - 0x15 ) + 1 ];
+
+        /**
+         * \brief INTENSET.
+         */
+        INTENSET intenset;
+
+        /**
+         * \brief Reserved registers (offset 0x17-0x17).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x17_0x17[ ( 0x17 - 0x17 ) + 1 ];
+
+        /**
+         * \brief INTFLAG.
+         */
+        INTFLAG intflag;
+
+        /**
+         * \brief Reserved registers (offset 0x19-0x19).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x19_0x19[ ( 0x19 - 0x19 ) + 1 ];
+
+        /**
+         * \brief STATUS.
+         */
+        STATUS status;
+
+        /**
+         * \brief SYNCBUSY.
+         */
+        SYNCBUSY const syncbusy;
+
+        /**
+         * \brief Reserved registers (offset 0x20-0x23).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x20_0x23[ ( 0x23 - 0x20 ) + 1 ];
+
+        /**
+         * \brief ADDR.
+         */
+        ADDR addr;
+
+        /**
+         * \brief Data (DATA) register.
+         */
+        Register<std::uint8_t> data;
+
+        /**
+         * \brief Reserved registers (offset 0x29-0x2F).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x29_0x2F[ ( 0x2F - 0x29 ) + 1 ];
+
+        /**
+         * \brief DBGCTRL.
+         */
+        DBGCTRL dbgctrl;
+
+        I2CM() = delete;
+
+        I2CM( I2CM && ) = delete;
+
+        I2CM( I2CM const & ) = delete;
+
+        ~I2CM() = delete;
+
+        auto operator=( I2CM && ) = delete;
+
+        auto operator=( I2CM const & ) = delete;
+    };
+
+    /**
+     * \brief I2C slave operating mode.
+     */
+    class I2CS {
+      public:
+        /**
+         * \brief Control A (CTRLA) register.
+         *
+         * This register has the following fields:
+         * - Software Reset (SWRST)
+         * - Enable (ENABLE)
+         * - Operating Mode (MODE)
+         * - Run in Standby (RUNSTDBY)
+         * - Pin Usage (PINOUT)
+         * - SDA Hold Time (SDAHOLD)
+         * - Slave SCL Low Extend Timeout (SEXTTOEN)
+         * - Transfer Speed (SPEED)
+         * - SCL Clock Stretch Mode (SCLSM)
+         * - SCL Low Timeout Enable (LOWTOUTEN)
+         */
+        class CTRLA : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST      = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE     = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto MODE       = std::uint_fast8_t{ 3 }; ///< MODE.
+                static constexpr auto RESERVED5  = std::uint_fast8_t{ 2 }; ///< RESERVED5.
+                static constexpr auto RUNSTDBY   = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+                static constexpr auto RESERVED8  = std::uint_fast8_t{ 8 }; ///< RESERVED8.
+                static constexpr auto PINOUT     = std::uint_fast8_t{ 1 }; ///< PINOUT.
+                static constexpr auto RESERVED17 = std::uint_fast8_t{ 3 }; ///< RESERVED17.
+                static constexpr auto SDAHOLD    = std::uint_fast8_t{ 2 }; ///< SDAHOLD.
+                static constexpr auto RESERVED22 = std::uint_fast8_t{ 1 }; ///< RESERVED22.
+                static constexpr auto SEXTTOEN   = std::uint_fast8_t{ 1 }; ///< SEXTTOEN.
+                static constexpr auto SPEED      = std::uint_fast8_t{ 2 }; ///< SPEED.
+                static constexpr auto RESERVED26 = std::uint_fast8_t{ 1 }; ///< RESERVED26.
+                static constexpr auto SCLSM      = std::uint_fast8_t{ 1 }; ///< SCLSM.
+                static constexpr auto RESERVED28 = std::uint_fast8_t{ 2 }; ///< RESERVED28.
+                static constexpr auto LOWTOUTEN  = std::uint_fast8_t{ 1 }; ///< LOWTOUTEN.
+                static constexpr auto RESERVED31 = std::uint_fast8_t{ 1 }; ///< RESERVED31.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto MODE = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< MODE.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ MODE + Size::MODE }; ///< RESERVED5.
+                static constexpr auto RUNSTDBY = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< RUNSTDBY.
+                static constexpr auto RESERVED8 = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< RESERVED8.
+                static constexpr auto PINOUT = std::uint_fast8_t{ RESERVED8 + Size::RESERVED8 }; ///< PINOUT.
+                static constexpr auto RESERVED17 = std::uint_fast8_t{ PINOUT + Size::PINOUT }; ///< RESERVED17.
+                static constexpr auto SDAHOLD = std::uint_fast8_t{ RESERVED17 + Size::RESERVED17 }; ///< SDAHOLD.
+                static constexpr auto RESERVED22 = std::uint_fast8_t{ SDAHOLD + Size::SDAHOLD }; ///< RESERVED22.
+                static constexpr auto SEXTTOEN = std::uint_fast8_t{ RESERVED22 + Size::RESERVED22 }; ///< SEXTTOEN.
+                static constexpr auto SPEED = std::uint_fast8_t{ SEXTTOEN + Size::SEXTTOEN }; ///< SPEED.
+                static constexpr auto RESERVED26 = std::uint_fast8_t{ SPEED + Size::SPEED }; ///< RESERVED26.
+                static constexpr auto SCLSM = std::uint_fast8_t{ RESERVED26 + Size::RESERVED26 }; ///< SCLSM.
+                static constexpr auto RESERVED28 = std::uint_fast8_t{ SCLSM + Size::SCLSM }; ///< RESERVED28.
+                static constexpr auto LOWTOUTEN = std::uint_fast8_t{ RESERVED28 + Size::RESERVED28 }; ///< LOWTOUTEN.
+                static constexpr auto RESERVED31 = std::uint_fast8_t{ LOWTOUTEN + Size::LOWTOUTEN }; ///< RESERVED31.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint32_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint32_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto MODE = mask<std::uint32_t>( Size::MODE, Bit::MODE ); ///< MODE.
+                static constexpr auto RESERVED5 = mask<std::uint32_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto RUNSTDBY = mask<std::uint32_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+                static constexpr auto RESERVED8 = mask<std::uint32_t>( Size::RESERVED8, Bit::RESERVED8 ); ///< RESERVED8.
+                static constexpr auto PINOUT = mask<std::uint32_t>( Size::PINOUT, Bit::PINOUT ); ///< PINOUT.
+                static constexpr auto RESERVED17 = mask<std::uint32_t>( Size::RESERVED17, Bit::RESERVED17 ); ///< RESERVED17.
+                static constexpr auto SDAHOLD = mask<std::uint32_t>( Size::SDAHOLD, Bit::SDAHOLD ); ///< SDAHOLD.
+                static constexpr auto RESERVED22 = mask<std::uint32_t>( Size::RESERVED22, Bit::RESERVED22 ); ///< RESERVED22.
+                static constexpr auto SEXTTOEN = mask<std::uint32_t>( Size::SEXTTOEN, Bit::SEXTTOEN ); ///< SEXTTOEN.
+                static constexpr auto SPEED = mask<std::uint32_t>( Size::SPEED, Bit::SPEED ); ///< SPEED.
+                static constexpr auto RESERVED26 = mask<std::uint32_t>( Size::RESERVED26, Bit::RESERVED26 ); ///< RESERVED26.
+                static constexpr auto SCLSM = mask<std::uint32_t>( Size::SCLSM, Bit::SCLSM ); ///< SCLSM.
+                static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+                static constexpr auto LOWTOUTEN = mask<std::uint32_t>( Size::LOWTOUTEN, Bit::LOWTOUTEN ); ///< LOWTOUTEN.
+                static constexpr auto RESERVED31 = mask<std::uint32_t>( Size::RESERVED31, Bit::RESERVED31 ); ///< RESERVED31.
+            };
+
+            /**
+             * \brief MODE.
+             */
+            enum MODE : std::uint32_t {
+                MODE_I2C_SLAVE = 0x4 << Bit::MODE, ///< I2C slave.
+            };
+
+            /**
+             * \brief SDAHOLD.
+             */
+            enum SDAHOLD : std::uint32_t {
+                SDAHOLD_DISABLE = 0x0 << Bit::SDAHOLD, ///< Disabled.
+                SDAHOLD_75NS    = 0x1 << Bit::SDAHOLD, ///< 50-100 ns hold time.
+                SDAHOLD_450NS   = 0x2 << Bit::SDAHOLD, ///< 300-600 ns hold time.
+                SDAHOLD_600NS   = 0x3 << Bit::SDAHOLD, ///< 400-800 ns hold time.
+            };
+
+            /**
+             * \brief SPEED.
+             */
+            enum SPEED : std::uint32_t {
+                SPEED_STANDARD_AND_FAST_MODE = 0x0 << Bit::SPEED, ///< Standard-mode (up to 100 kHz) and Fast-mode (up to 400 kHz).
+                SPEED_FASTPLUS_MODE = 0x1 << Bit::SPEED, ///< Fast-mode Plus (up to 1 MHz).
+                SPEED_HIGH_SPEED_MODE = 0x2 << Bit::SPEED, ///< High-speed mode (up to 3.4 MHz).
+            };
+
+            CTRLA() = delete;
+
+            CTRLA( CTRLA && ) = delete;
+
+            CTRLA( CTRLA const & ) = delete;
+
+            ~CTRLA() = delete;
+
+            auto operator=( CTRLA && ) = delete;
+
+            auto operator=( CTRLA const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Control B (CTRLB) register.
+         *
+         * This register has the following fields:
+         * - Smart Mode Enable (SMEN)
+         * - PMBus Group Command (GCMD)
+         * - Automatic Address Acknowledge (AACKEN)
+         * - Address Mode (AMODE)
+         * - Command (CMD)
+         * - Acknowledge Action (ACKACT)
+         */
+        class CTRLB : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0  = std::uint_fast8_t{ 8 }; ///< RESERVED0.
+                static constexpr auto SMEN       = std::uint_fast8_t{ 1 }; ///< SMEN.
+                static constexpr auto GCMD       = std::uint_fast8_t{ 1 }; ///< GCMD.
+                static constexpr auto AACKEN     = std::uint_fast8_t{ 1 }; ///< AACKEN.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ 3 }; ///< RESERVED11.
+                static constexpr auto AMODE      = std::uint_fast8_t{ 2 }; ///< AMODE.
+                static constexpr auto CMD        = std::uint_fast8_t{ 2 }; ///< CMD.
+                static constexpr auto ACKACT     = std::uint_fast8_t{ 1 }; ///< ACKACT.
+                static constexpr auto RESERVED19 = std::uint_fast8_t{ 13 }; ///< RESERVED19.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto SMEN = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< SMEN.
+                static constexpr auto GCMD = std::uint_fast8_t{ SMEN + Size::SMEN }; ///< GCMD.
+                static constexpr auto AACKEN = std::uint_fast8_t{ GCMD + Size::GCMD }; ///< AACKEN.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ AACKEN + Size::AACKEN }; ///< RESERVED11.
+                static constexpr auto AMODE = std::uint_fast8_t{ RESERVED11 + Size::RESERVED11 }; ///< AMODE.
+                static constexpr auto CMD = std::uint_fast8_t{ AMODE + Size::AMODE }; ///< CMD.
+                static constexpr auto ACKACT = std::uint_fast8_t{ CMD + Size::CMD }; ///< ACKACT.
+                static constexpr auto RESERVED19 = std::uint_fast8_t{ ACKACT + Size::ACKACT }; ///< RESERVED19.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint32_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto SMEN = mask<std::uint32_t>( Size::SMEN, Bit::SMEN ); ///< SMEN.
+                static constexpr auto GCMD = mask<std::uint32_t>( Size::GCMD, Bit::GCMD ); ///< GCMD.
+                static constexpr auto AACKEN = mask<std::uint32_t>( Size::AACKEN, Bit::AACKEN ); ///< AACKEN.
+                static constexpr auto RESERVED11 = mask<std::uint32_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+                static constexpr auto AMODE = mask<std::uint32_t>( Size::AMODE, Bit::AMODE ); ///< AMODE.
+                static constexpr auto CMD = mask<std::uint32_t>( Size::CMD, Bit::CMD ); ///< CMD.
+                static constexpr auto ACKACT = mask<std::uint32_t>( Size::ACKACT, Bit::ACKACT ); ///< ACKACT.
+                static constexpr auto RESERVED19 = mask<std::uint32_t>( Size::RESERVED19, Bit::RESERVED19 ); ///< RESERVED19.
+            };
+
+            /**
+             * \brief AMODE.
+             */
+            enum AMODE : std::uint32_t {
+                AMODE_MASK = 0x0 << Bit::AMODE, ///< ADDRMASK is used as a mask to the ADDR register.
+                AMODE_2_ADDRESSES = 0x1 << Bit::AMODE, ///< The slave responds to the two unique addresses in ADDR and ADDRMASK.
+                AMODE_RANGE = 0x2 << Bit::AMODE, ///< The slave responds to the range of addresses between and including ADDR and ADDRMASK.
+            };
+
+            /**
+             * \brief CMD.
+             */
+            enum CMD : std::uint32_t {
+                CMD_NOACT = 0x0 << Bit::CMD, ///< No action.
+                CMD_COMPLETE = 0x2 << Bit::CMD, ///< Execute acknowledge action (or wait for any start condition if the last byte was transmitted).
+                CMD_RESPONSE = 0x3 << Bit::CMD, ///< Execute acknowledge action succeeded by a byte read/write operation.
+            };
+
+            /**
+             * \brief ACKACT.
+             */
+            enum ACKACT : std::uint32_t {
+                ACKACT_ACK  = 0x0 << Bit::ACKACT, ///< Send ACK.
+                ACKACT_NACK = 0x1 << Bit::ACKACT, ///< Send NACK.
+            };
+
+            CTRLB() = delete;
+
+            CTRLB( CTRLB && ) = delete;
+
+            CTRLB( CTRLB const & ) = delete;
+
+            ~CTRLB() = delete;
+
+            auto operator=( CTRLB && ) = delete;
+
+            auto operator=( CTRLB const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Clear (INTENCLR) register.
+         *
+         * This register has the following fields:
+         * - Stop Received Interrupt Enable (PREC)
+         * - Address Match Interrupt Enable (AMATCH)
+         * - Data Ready Interrupt Enable (DRDY)
+         * - Combined Error Interrupt Enable (ERROR)
+         */
+        class INTENCLR : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto PREC      = std::uint_fast8_t{ 1 }; ///< PREC.
+                static constexpr auto AMATCH    = std::uint_fast8_t{ 1 }; ///< AMATCH.
+                static constexpr auto DRDY      = std::uint_fast8_t{ 1 }; ///< DRDY.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 4 }; ///< RESERVED3.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto PREC = std::uint_fast8_t{}; ///< PREC.
+                static constexpr auto AMATCH = std::uint_fast8_t{ PREC + Size::PREC }; ///< AMATCH.
+                static constexpr auto DRDY = std::uint_fast8_t{ AMATCH + Size::AMATCH }; ///< DRDY.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ DRDY + Size::DRDY }; ///< RESERVED3.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto PREC = mask<std::uint8_t>( Size::PREC, Bit::PREC ); ///< PREC.
+                static constexpr auto AMATCH = mask<std::uint8_t>( Size::AMATCH, Bit::AMATCH ); ///< AMATCH.
+                static constexpr auto DRDY = mask<std::uint8_t>( Size::DRDY, Bit::DRDY ); ///< DRDY.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTENCLR() = delete;
+
+            INTENCLR( INTENCLR && ) = delete;
+
+            INTENCLR( INTENCLR const & ) = delete;
+
+            ~INTENCLR() = delete;
+
+            auto operator=( INTENCLR && ) = delete;
+
+            auto operator=( INTENCLR const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Set (INTENSET) register.
+         *
+         * This register has the following fields:
+         * - Stop Received Interrupt Enable (PREC)
+         * - Address Match Interrupt Enable (AMATCH)
+         * - Data Ready Interrupt Enable (DRDY)
+         * - Combined Error Interrupt Enable (ERROR)
+         */
+        class INTENSET : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto PREC      = std::uint_fast8_t{ 1 }; ///< PREC.
+                static constexpr auto AMATCH    = std::uint_fast8_t{ 1 }; ///< AMATCH.
+                static constexpr auto DRDY      = std::uint_fast8_t{ 1 }; ///< DRDY.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 4 }; ///< RESERVED3.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto PREC = std::uint_fast8_t{}; ///< PREC.
+                static constexpr auto AMATCH = std::uint_fast8_t{ PREC + Size::PREC }; ///< AMATCH.
+                static constexpr auto DRDY = std::uint_fast8_t{ AMATCH + Size::AMATCH }; ///< DRDY.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ DRDY + Size::DRDY }; ///< RESERVED3.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto PREC = mask<std::uint8_t>( Size::PREC, Bit::PREC ); ///< PREC.
+                static constexpr auto AMATCH = mask<std::uint8_t>( Size::AMATCH, Bit::AMATCH ); ///< AMATCH.
+                static constexpr auto DRDY = mask<std::uint8_t>( Size::DRDY, Bit::DRDY ); ///< DRDY.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTENSET() = delete;
+
+            INTENSET( INTENSET && ) = delete;
+
+            INTENSET( INTENSET const & ) = delete;
+
+            ~INTENSET() = delete;
+
+            auto operator=( INTENSET && ) = delete;
+
+            auto operator=( INTENSET const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+         *
+         * This register has the following fields:
+         * - Stop Received (PREC)
+         * - Address Match (AMATCH)
+         * - Data Ready (DRDY)
+         * - Combined Error (ERROR)
+         */
+        class INTFLAG : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto PREC      = std::uint_fast8_t{ 1 }; ///< PREC.
+                static constexpr auto AMATCH    = std::uint_fast8_t{ 1 }; ///< AMATCH.
+                static constexpr auto DRDY      = std::uint_fast8_t{ 1 }; ///< DRDY.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 4 }; ///< RESERVED3.
+                static constexpr auto ERROR     = std::uint_fast8_t{ 1 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto PREC = std::uint_fast8_t{}; ///< PREC.
+                static constexpr auto AMATCH = std::uint_fast8_t{ PREC + Size::PREC }; ///< AMATCH.
+                static constexpr auto DRDY = std::uint_fast8_t{ AMATCH + Size::AMATCH }; ///< DRDY.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ DRDY + Size::DRDY }; ///< RESERVED3.
+                static constexpr auto ERROR = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< ERROR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto PREC = mask<std::uint8_t>( Size::PREC, Bit::PREC ); ///< PREC.
+                static constexpr auto AMATCH = mask<std::uint8_t>( Size::AMATCH, Bit::AMATCH ); ///< AMATCH.
+                static constexpr auto DRDY = mask<std::uint8_t>( Size::DRDY, Bit::DRDY ); ///< DRDY.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto ERROR = mask<std::uint8_t>( Size::ERROR, Bit::ERROR ); ///< ERROR.
+            };
+
+            INTFLAG() = delete;
+
+            INTFLAG( INTFLAG && ) = delete;
+
+            INTFLAG( INTFLAG const & ) = delete;
+
+            ~INTFLAG() = delete;
+
+            auto operator=( INTFLAG && ) = delete;
+
+            auto operator=( INTFLAG const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Status (STATUS) register.
+         *
+         * This register has the following fields:
+         * - Bus Error (BUSERR)
+         * - Transmit Collision (COLL)
+         * - Received Not Acknowledge (RXNACK)
+         * - Read/Write Direction (DIR)
+         * - Repeated Start (SR)
+         * - SCL Low Timeout (LOWTOUT)
+         * - Clock Hold (CLKHOLD)
+         * - Slave SCL Low Extend Timeout (SEXTTOUT)
+         * - High Speed (HS)
+         */
+        class STATUS : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto BUSERR     = std::uint_fast8_t{ 1 }; ///< BUSERR.
+                static constexpr auto COLL       = std::uint_fast8_t{ 1 }; ///< COLL.
+                static constexpr auto RXNACK     = std::uint_fast8_t{ 1 }; ///< RXNACK.
+                static constexpr auto DIR        = std::uint_fast8_t{ 1 }; ///< DIR.
+                static constexpr auto SR         = std::uint_fast8_t{ 1 }; ///< SR.
+                static constexpr auto RESERVED5  = std::uint_fast8_t{ 1 }; ///< RESERVED5.
+                static constexpr auto LOWTOUT    = std::uint_fast8_t{ 1 }; ///< LOWTOUT.
+                static constexpr auto CLKHOLD    = std::uint_fast8_t{ 1 }; ///< CLKHOLD.
+                static constexpr auto RESERVED8  = std::uint_fast8_t{ 1 }; ///< RESERVED8.
+                static constexpr auto SEXTTOUT   = std::uint_fast8_t{ 1 }; ///< SEXTTOUT.
+                static constexpr auto HS         = std::uint_fast8_t{ 1 }; ///< HS.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ 5 }; ///< RESERVED11.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto BUSERR = std::uint_fast8_t{}; ///< BUSERR.
+                static constexpr auto COLL = std::uint_fast8_t{ BUSERR + Size::BUSERR }; ///< COLL.
+                static constexpr auto RXNACK = std::uint_fast8_t{ COLL + Size::COLL }; ///< RXNACK.
+                static constexpr auto DIR = std::uint_fast8_t{ RXNACK + Size::RXNACK }; ///< DIR.
+                static constexpr auto SR = std::uint_fast8_t{ DIR + Size::DIR }; ///< SR.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ SR + Size::SR }; ///< RESERVED5.
+                static constexpr auto LOWTOUT = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< LOWTOUT.
+                static constexpr auto CLKHOLD = std::uint_fast8_t{ LOWTOUT + Size::LOWTOUT }; ///< CLKHOLD.
+                static constexpr auto RESERVED8 = std::uint_fast8_t{ CLKHOLD + Size::CLKHOLD }; ///< RESERVED8.
+                static constexpr auto SEXTTOUT = std::uint_fast8_t{ RESERVED8 + Size::RESERVED8 }; ///< SEXTTOUT.
+                static constexpr auto HS = std::uint_fast8_t{ SEXTTOUT + Size::SEXTTOUT }; ///< HS.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ HS + Size::HS }; ///< RESERVED11.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto BUSERR = mask<std::uint16_t>( Size::BUSERR, Bit::BUSERR ); ///< BUSERR.
+                static constexpr auto COLL = mask<std::uint16_t>( Size::COLL, Bit::COLL ); ///< COLL.
+                static constexpr auto RXNACK = mask<std::uint16_t>( Size::RXNACK, Bit::RXNACK ); ///< RXNACK.
+                static constexpr auto DIR = mask<std::uint16_t>( Size::DIR, Bit::DIR ); ///< DIR.
+                static constexpr auto SR = mask<std::uint16_t>( Size::SR, Bit::SR ); ///< SR.
+                static constexpr auto RESERVED5 = mask<std::uint16_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto LOWTOUT = mask<std::uint16_t>( Size::LOWTOUT, Bit::LOWTOUT ); ///< LOWTOUT.
+                static constexpr auto CLKHOLD = mask<std::uint16_t>( Size::CLKHOLD, Bit::CLKHOLD ); ///< CLKHOLD.
+                static constexpr auto RESERVED8 = mask<std::uint16_t>( Size::RESERVED8, Bit::RESERVED8 ); ///< RESERVED8.
+                static constexpr auto SEXTTOUT = mask<std::uint16_t>( Size::SEXTTOUT, Bit::SEXTTOUT ); ///< SEXTTOUT.
+                static constexpr auto HS = mask<std::uint16_t>( Size::HS, Bit::HS ); ///< HS.
+                static constexpr auto RESERVED11 = mask<std::uint16_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+            };
+
+            STATUS() = delete;
+
+            STATUS( STATUS && ) = delete;
+
+            STATUS( STATUS const & ) = delete;
+
+            ~STATUS() = delete;
+
+            auto operator=( STATUS && ) = delete;
+
+            auto operator=( STATUS const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Synchronization Busy (SYNCBUSY) register.
+         *
+         * This register has the following fields:
+         * - Software Reset Synchronization Busy (SWRST)
+         * - SERCOM Enable Synchronization Busy (ENABLE)
+         */
+        class SYNCBUSY : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST     = std::uint_fast8_t{ 1 };  ///< SWRST.
+                static constexpr auto ENABLE    = std::uint_fast8_t{ 1 };  ///< ENABLE.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 30 }; ///< RESERVED2.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< RESERVED2.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint32_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint32_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto RESERVED2 = mask<std::uint32_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            };
+
+            SYNCBUSY() = delete;
+
+            SYNCBUSY( SYNCBUSY && ) = delete;
+
+            SYNCBUSY( SYNCBUSY const & ) = delete;
+
+            ~SYNCBUSY() = delete;
+
+            auto operator=( SYNCBUSY && ) = delete;
+
+            auto operator=( SYNCBUSY const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief Address (ADDR) register.
+         *
+         * This register has the following fields:
+         * - General Call Address Enable (GENCEN)
+         * - Address Value (ADDR)
+         * - Ten Bit Addressing Enable (TENBITEN)
+         * - Address Mask (ADDRMASK)
+         */
+        class ADDR : public Register<std::uint32_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto GENCEN     = std::uint_fast8_t{ 1 };  ///< GENCEN.
+                static constexpr auto ADDR       = std::uint_fast8_t{ 10 }; ///< ADDR.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ 4 }; ///< RESERVED11.
+                static constexpr auto TENBITEN   = std::uint_fast8_t{ 1 }; ///< TENBITEN.
+                static constexpr auto RESERVED16 = std::uint_fast8_t{ 1 }; ///< RESERVED16.
+                static constexpr auto ADDRMASK   = std::uint_fast8_t{ 10 }; ///< ADDRMASK.
+                static constexpr auto RESERVED27 = std::uint_fast8_t{ 5 }; ///< RESERVED27.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto GENCEN = std::uint_fast8_t{}; ///< GENCEN.
+                static constexpr auto ADDR = std::uint_fast8_t{ GENCEN + Size::GENCEN }; ///< ADDR.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ ADDR + Size::ADDR }; ///< RESERVED11.
+                static constexpr auto TENBITEN = std::uint_fast8_t{ RESERVED11 + Size::RESERVED11 }; ///< TENBITEN.
+                static constexpr auto RESERVED16 = std::uint_fast8_t{ TENBITEN + Size::TENBITEN }; ///< RESERVED16.
+                static constexpr auto ADDRMASK = std::uint_fast8_t{ RESERVED16 + Size::RESERVED16 }; ///< ADDRMASK.
+                static constexpr auto RESERVED27 = std::uint_fast8_t{ ADDRMASK + Size::ADDRMASK }; ///< RESERVED27.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto GENCEN = mask<std::uint32_t>( Size::GENCEN, Bit::GENCEN ); ///< GENCEN.
+                static constexpr auto ADDR = mask<std::uint32_t>( Size::ADDR, Bit::ADDR ); ///< ADDR.
+                static constexpr auto RESERVED11 = mask<std::uint32_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+                static constexpr auto TENBITEN = mask<std::uint32_t>( Size::TENBITEN, Bit::TENBITEN ); ///< TENBITEN.
+                static constexpr auto RESERVED16 = mask<std::uint32_t>( Size::RESERVED16, Bit::RESERVED16 ); ///< RESERVED16.
+                static constexpr auto ADDRMASK = mask<std::uint32_t>( Size::ADDRMASK, Bit::ADDRMASK ); ///< ADDRMASK.
+                static constexpr auto RESERVED27 = mask<std::uint32_t>( Size::RESERVED27, Bit::RESERVED27 ); ///< RESERVED27.
+            };
+
+            ADDR() = delete;
+
+            ADDR( ADDR && ) = delete;
+
+            ADDR( ADDR const & ) = delete;
+
+            ~ADDR() = delete;
+
+            auto operator=( ADDR && ) = delete;
+
+            auto operator=( ADDR const & ) = delete;
+
+            using Register<std::uint32_t>::operator=;
+        };
+
+        /**
+         * \brief CTRLA.
+         */
+        CTRLA ctrla;
+
+        /**
+         * \brief CTRLB.
+         */
+        CTRLB ctrlb;
+
+        /**
+         * \brief Reserved registers (offset 0x08-0x13).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x08_0x13[ ( 0x13 - 0x08 ) + 1 ];
+
+        /**
+         * \brief INTENCLR.
+         */
+        INTENCLR intenclr;
+
+        /**
+         * \brief Reserved registers (offset 0x15-0x15).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x15_0x15[ ( 0x15 - 0x15 ) + 1 ];
+
+        /**
+         * \brief INTENSET.
+         */
+        INTENSET intenset;
+
+        /**
+         * \brief Reserved registers (offset 0x17-0x17).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x17_0x17[ ( 0x17 - 0x17 ) + 1 ];
+
+        /**
+         * \brief INTFLAG.
+         */
+        INTFLAG intflag;
+
+        /**
+         * \brief Reserved registers (offset 0x19-0x19).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x19_0x19[ ( 0x19 - 0x19 ) + 1 ];
+
+        /**
+         * \brief STATUS.
+         */
+        STATUS status;
+
+        /**
+         * \brief SYNCBUSY.
+         */
+        SYNCBUSY const syncbusy;
+
+        /**
+         * \brief Reserved registers (offset 0x20-0x23).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x20_0x23[ ( 0x23 - 0x20 ) + 1 ];
+
+        /**
+         * \brief ADDR.
+         */
+        ADDR addr;
+
+        /**
+         * \brief Data (DATA) register.
+         */
+        Register<std::uint8_t> data;
+
+        I2CS() = delete;
+
+        I2CS( I2CS && ) = delete;
+
+        I2CS( I2CS const & ) = delete;
+
+        ~I2CS() = delete;
+
+        auto operator=( I2CS && ) = delete;
+
+        auto operator=( I2CS const & ) = delete;
+    };
+
+    union {
+        /**
+         * \brief USART.
+         */
+        USART usart;
+
+        /**
+         * \brief SPI.
+         */
+        SPI spi;
+
+        /**
+         * \brief I2CM.
+         */
+        I2CM i2cm;
+
+        /**
+         * \brief I2CS.
+         */
+        I2CS i2cs;
+    };
+
+    SERCOM() = delete;
+
+    SERCOM( SERCOM && ) = delete;
+
+    SERCOM( SERCOM const & ) = delete;
+
+    ~SERCOM() = delete;
+
+    auto operator=( SERCOM && ) = delete;
+
+    auto operator=( SERCOM const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_SERCOM_H
@@ -0,0 +1,2651 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Peripheral::TC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_TC_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_TC_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Peripheral {
+
+/**
+ * \brief Microchip SAM D21/DA1 Timer/Counter (TC) peripheral.
+ */
+class TC {
+  public:
+    /**
+     * \brief 8-bit counter mode.
+     */
+    class COUNT8 {
+      public:
+        /**
+         * \brief Control A (CTRLA) register.
+         *
+         * This register has the following fields:
+         * - Software Reset (SWRST)
+         * - Enable (ENABLE)
+         * - Timer Counter Mode (MODE)
+         * - Waveform Generation Operation (WAVEGEN)
+         * - Prescaler (PRESCALER)
+         * - Run in Standby (RUNSTDBY)
+         * - Prescaler and Counter Synchronization (PRESCSYNC)
+         */
+        class CTRLA : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST      = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE     = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto MODE       = std::uint_fast8_t{ 2 }; ///< MODE.
+                static constexpr auto RESERVED4  = std::uint_fast8_t{ 1 }; ///< RESERVED4.
+                static constexpr auto WAVEGEN    = std::uint_fast8_t{ 2 }; ///< WAVEGEN.
+                static constexpr auto RESERVED7  = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+                static constexpr auto PRESCALER  = std::uint_fast8_t{ 3 }; ///< PRESCALER.
+                static constexpr auto RUNSTDBY   = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+                static constexpr auto PRESCSYNC  = std::uint_fast8_t{ 2 }; ///< PRESCSYNC.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ 2 }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto MODE = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< MODE.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ MODE + Size::MODE }; ///< RESERVED4.
+                static constexpr auto WAVEGEN = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< WAVEGEN.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ WAVEGEN + Size::WAVEGEN }; ///< RESERVED7.
+                static constexpr auto PRESCALER = std::uint_fast8_t{ RESERVED7 + Size::RESERVED7 }; ///< PRESCALER.
+                static constexpr auto RUNSTDBY = std::uint_fast8_t{ PRESCALER + Size::PRESCALER }; ///< RUNSTDBY.
+                static constexpr auto PRESCSYNC = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< PRESCSYNC.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ PRESCSYNC + Size::PRESCSYNC }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint16_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint16_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto MODE = mask<std::uint16_t>( Size::MODE, Bit::MODE ); ///< MODE.
+                static constexpr auto RESERVED4 = mask<std::uint16_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+                static constexpr auto WAVEGEN = mask<std::uint16_t>( Size::WAVEGEN, Bit::WAVEGEN ); ///< WAVEGEN.
+                static constexpr auto RESERVED7 = mask<std::uint16_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                static constexpr auto PRESCALER = mask<std::uint16_t>( Size::PRESCALER, Bit::PRESCALER ); ///< PRESCALER.
+                static constexpr auto RUNSTDBY = mask<std::uint16_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+                static constexpr auto PRESCSYNC = mask<std::uint16_t>( Size::PRESCSYNC, Bit::PRESCSYNC ); ///< PRESCSYNC.
+                static constexpr auto RESERVED14 = mask<std::uint16_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+            };
+
+            /**
+             * \brief MODE.
+             */
+            enum MODE : std::uint16_t {
+                MODE_COUNT8 = 0x1 << Bit::MODE, ///< Counter in 8-bit mode.
+            };
+
+            /**
+             * \brief WAVEGEN.
+             */
+            enum WAVEGEN : std::uint16_t {
+                WAVEGEN_NFRQ = 0x0 << Bit::WAVEGEN, ///< Normal frequency.
+                WAVEGEN_MFRQ = 0x1 << Bit::WAVEGEN, ///< Match frequency.
+                WAVEGEN_NPWM = 0x2 << Bit::WAVEGEN, ///< Normal PWM.
+                WAVEGEN_MPWM = 0x3 << Bit::WAVEGEN, ///< Match PWM.
+            };
+
+            /**
+             * \brief PRESCALER.
+             */
+            enum PRESCALER : std::uint16_t {
+                PRESCALER_DIV1    = 0x0 << Bit::PRESCALER, ///< Prescaler: GCLK_TC.
+                PRESCALER_DIV2    = 0x1 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/2.
+                PRESCALER_DIV4    = 0x2 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/4.
+                PRESCALER_DIV8    = 0x3 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/8.
+                PRESCALER_DIV16   = 0x4 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/16.
+                PRESCALER_DIV64   = 0x5 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/64.
+                PRESCALER_DIV256  = 0x6 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/256.
+                PRESCALER_DIV1024 = 0x7 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/1024.
+            };
+
+            /**
+             * \brief PRESCSYNC.
+             */
+            enum PRESCSYNC : std::uint16_t {
+                PRESCSYNC_GCLK = 0x0 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next generic clock.
+                PRESCSYNC_PRESC = 0x1 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next prescaler clock.
+                PRESCSYNC_RESYNC = 0x2 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next generic clock, and reset the prescaler counter.
+            };
+
+            CTRLA() = delete;
+
+            CTRLA( CTRLA && ) = delete;
+
+            CTRLA( CTRLA const & ) = delete;
+
+            ~CTRLA() = delete;
+
+            auto operator=( CTRLA && ) = delete;
+
+            auto operator=( CTRLA const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Read Request (READREQ) register.
+         *
+         * This register has the following fields:
+         * - Address (ADDR)
+         * - Read Continuously (RCONT)
+         * - Read Request (RREQ)
+         */
+        class READREQ : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto ADDR      = std::uint_fast8_t{ 5 }; ///< ADDR.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ 9 }; ///< RESERVED5.
+                static constexpr auto RCONT     = std::uint_fast8_t{ 1 }; ///< RCONT.
+                static constexpr auto RREQ      = std::uint_fast8_t{ 1 }; ///< RREQ.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto ADDR = std::uint_fast8_t{}; ///< ADDR.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ ADDR + Size::ADDR }; ///< RESERVED5.
+                static constexpr auto RCONT = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< RCONT.
+                static constexpr auto RREQ = std::uint_fast8_t{ RCONT + Size::RCONT }; ///< RREQ.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto ADDR = mask<std::uint16_t>( Size::ADDR, Bit::ADDR ); ///< ADDR.
+                static constexpr auto RESERVED5 = mask<std::uint16_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto RCONT = mask<std::uint16_t>( Size::RCONT, Bit::RCONT ); ///< RCONT.
+                static constexpr auto RREQ = mask<std::uint16_t>( Size::RREQ, Bit::RREQ ); ///< RREQ.
+            };
+
+            READREQ() = delete;
+
+            READREQ( READREQ && ) = delete;
+
+            READREQ( READREQ const & ) = delete;
+
+            ~READREQ() = delete;
+
+            auto operator=( READREQ && ) = delete;
+
+            auto operator=( READREQ const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Control B Clear (CTRLBCLR) register.
+         *
+         * This register has the following fields:
+         * - Counter Direction (DIR)
+         * - One-Shot (ONESHOT)
+         * - Command (CMD)
+         */
+        class CTRLBCLR : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DIR       = std::uint_fast8_t{ 1 }; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                static constexpr auto ONESHOT   = std::uint_fast8_t{ 1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 3 }; ///< RESERVED3.
+                static constexpr auto CMD       = std::uint_fast8_t{ 2 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DIR = std::uint_fast8_t{}; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DIR + Size::DIR }; ///< RESERVED1.
+                static constexpr auto ONESHOT = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ ONESHOT + Size::ONESHOT }; ///< RESERVED3.
+                static constexpr auto CMD = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DIR = mask<std::uint8_t>( Size::DIR, Bit::DIR ); ///< DIR.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                static constexpr auto ONESHOT = mask<std::uint8_t>( Size::ONESHOT, Bit::ONESHOT ); ///< ONESHOT.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto CMD = mask<std::uint8_t>( Size::CMD, Bit::CMD ); ///< CMD.
+            };
+
+            /**
+             * \brief CMD.
+             */
+            enum CMD : std::uint8_t {
+                CMD_NONE      = 0x0 << Bit::CMD, ///< No action.
+                CMD_RETRIGGER = 0x1 << Bit::CMD, ///< Force a start, restart, or retrigger.
+                CMD_STOP      = 0x2 << Bit::CMD, ///< Force a stop.
+            };
+
+            CTRLBCLR() = delete;
+
+            CTRLBCLR( CTRLBCLR && ) = delete;
+
+            CTRLBCLR( CTRLBCLR const & ) = delete;
+
+            ~CTRLBCLR() = delete;
+
+            auto operator=( CTRLBCLR && ) = delete;
+
+            auto operator=( CTRLBCLR const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Control B Set (CTRLBSET) register.
+         *
+         * This register has the following fields:
+         * - Counter Direction (DIR)
+         * - One-Shot (ONESHOT)
+         * - Command (CMD)
+         */
+        class CTRLBSET : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DIR       = std::uint_fast8_t{ 1 }; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                static constexpr auto ONESHOT   = std::uint_fast8_t{ 1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 3 }; ///< RESERVED3.
+                static constexpr auto CMD       = std::uint_fast8_t{ 2 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DIR = std::uint_fast8_t{}; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DIR + Size::DIR }; ///< RESERVED1.
+                static constexpr auto ONESHOT = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ ONESHOT + Size::ONESHOT }; ///< RESERVED3.
+                static constexpr auto CMD = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DIR = mask<std::uint8_t>( Size::DIR, Bit::DIR ); ///< DIR.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                static constexpr auto ONESHOT = mask<std::uint8_t>( Size::ONESHOT, Bit::ONESHOT ); ///< ONESHOT.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto CMD = mask<std::uint8_t>( Size::CMD, Bit::CMD ); ///< CMD.
+            };
+
+            /**
+             * \brief CMD.
+             */
+            enum CMD : std::uint8_t {
+                CMD_NONE      = 0x0 << Bit::CMD, ///< No action.
+                CMD_RETRIGGER = 0x1 << Bit::CMD, ///< Force a start, restart, or retrigger.
+                CMD_STOP      = 0x2 << Bit::CMD, ///< Force a stop.
+            };
+
+            CTRLBSET() = delete;
+
+            CTRLBSET( CTRLBSET && ) = delete;
+
+            CTRLBSET( CTRLBSET const & ) = delete;
+
+            ~CTRLBSET() = delete;
+
+            auto operator=( CTRLBSET && ) = delete;
+
+            auto operator=( CTRLBSET const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Control C (CTRLC) register.
+         *
+         * This register has the following fields:
+         * - Output Waveform Invert Enable 0 (INVEN0)
+         * - Output Waveform Invert Enable 1 (INVEN1)
+         * - Capture Channel Enable 0 (CPTEN0)
+         * - Capture Channel Enable 1 (CPTEN1)
+         */
+        class CTRLC : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto INVEN0    = std::uint_fast8_t{ 1 }; ///< INVEN0.
+                static constexpr auto INVEN1    = std::uint_fast8_t{ 1 }; ///< INVEN1.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 2 }; ///< RESERVED2.
+                static constexpr auto CPTEN0    = std::uint_fast8_t{ 1 }; ///< CPTEN0.
+                static constexpr auto CPTEN1    = std::uint_fast8_t{ 1 }; ///< CPTEN1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto INVEN0 = std::uint_fast8_t{}; ///< INVEN0.
+                static constexpr auto INVEN1 = std::uint_fast8_t{ INVEN0 + Size::INVEN0 }; ///< INVEN1.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ INVEN1 + Size::INVEN1 }; ///< RESERVED2.
+                static constexpr auto CPTEN0 = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< CPTEN0.
+                static constexpr auto CPTEN1 = std::uint_fast8_t{ CPTEN0 + Size::CPTEN0 }; ///< CPTEN1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ CPTEN1 + Size::CPTEN1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto INVEN0 = mask<std::uint8_t>( Size::INVEN0, Bit::INVEN0 ); ///< INVEN0.
+                static constexpr auto INVEN1 = mask<std::uint8_t>( Size::INVEN1, Bit::INVEN1 ); ///< INVEN1.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto CPTEN0 = mask<std::uint8_t>( Size::CPTEN0, Bit::CPTEN0 ); ///< CPTEN0.
+                static constexpr auto CPTEN1 = mask<std::uint8_t>( Size::CPTEN1, Bit::CPTEN1 ); ///< CPTEN1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            CTRLC() = delete;
+
+            CTRLC( CTRLC && ) = delete;
+
+            CTRLC( CTRLC const & ) = delete;
+
+            ~CTRLC() = delete;
+
+            auto operator=( CTRLC && ) = delete;
+
+            auto operator=( CTRLC const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Debug Control (DBGCTRL) register.
+         *
+         * This register has the following fields:
+         * - Debug Run Mode (DBGRUN)
+         */
+        class DBGCTRL : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DBGRUN    = std::uint_fast8_t{ 1 }; ///< DBGRUN.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 7 }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DBGRUN = std::uint_fast8_t{}; ///< DBGRUN.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DBGRUN + Size::DBGRUN }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DBGRUN = mask<std::uint8_t>( Size::DBGRUN, Bit::DBGRUN ); ///< DBGRUN.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+            };
+
+            DBGCTRL() = delete;
+
+            DBGCTRL( DBGCTRL && ) = delete;
+
+            DBGCTRL( DBGCTRL const & ) = delete;
+
+            ~DBGCTRL() = delete;
+
+            auto operator=( DBGCTRL && ) = delete;
+
+            auto operator=( DBGCTRL const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Event Control (EVCTRL) register.
+         *
+         * This register has the following fields:
+         * - Event Action (EVACT)
+         * - TC Inverted Event Input (TCINV)
+         * - TC Event Input (TCEI)
+         * - Overflow/Underflow Event Output Enable (OVFEO)
+         * - Match or Capture Channel Event Output Enable 0 (MCEO0)
+         * - Match or Capture Channel Event Output Enable 1 (MCEO1)
+         */
+        class EVCTRL : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto EVACT      = std::uint_fast8_t{ 3 }; ///< EVACT.
+                static constexpr auto RESERVED3  = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                static constexpr auto TCINV      = std::uint_fast8_t{ 1 }; ///< TCINV.
+                static constexpr auto TCEI       = std::uint_fast8_t{ 1 }; ///< TCEI.
+                static constexpr auto RESERVED6  = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+                static constexpr auto OVFEO      = std::uint_fast8_t{ 1 }; ///< OVFEO.
+                static constexpr auto RESERVED9  = std::uint_fast8_t{ 3 }; ///< RESERVED9.
+                static constexpr auto MCEO0      = std::uint_fast8_t{ 1 }; ///< MCEO0.
+                static constexpr auto MCEO1      = std::uint_fast8_t{ 1 }; ///< MCEO1.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ 2 }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto EVACT = std::uint_fast8_t{}; ///< EVACT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ EVACT + Size::EVACT }; ///< RESERVED3.
+                static constexpr auto TCINV = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< TCINV.
+                static constexpr auto TCEI = std::uint_fast8_t{ TCINV + Size::TCINV }; ///< TCEI.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ TCEI + Size::TCEI }; ///< RESERVED6.
+                static constexpr auto OVFEO = std::uint_fast8_t{ RESERVED6 + Size::RESERVED6 }; ///< OVFEO.
+                static constexpr auto RESERVED9 = std::uint_fast8_t{ OVFEO + Size::OVFEO }; ///< RESERVED9.
+                static constexpr auto MCEO0 = std::uint_fast8_t{ RESERVED9 + Size::RESERVED9 }; ///< MCEO0.
+                static constexpr auto MCEO1 = std::uint_fast8_t{ MCEO0 + Size::MCEO0 }; ///< MCEO1.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ MCEO1 + Size::MCEO1 }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto EVACT = mask<std::uint16_t>( Size::EVACT, Bit::EVACT ); ///< EVACT.
+                static constexpr auto RESERVED3 = mask<std::uint16_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto TCINV = mask<std::uint16_t>( Size::TCINV, Bit::TCINV ); ///< TCINV.
+                static constexpr auto TCEI = mask<std::uint16_t>( Size::TCEI, Bit::TCEI ); ///< TCEI.
+                static constexpr auto RESERVED6 = mask<std::uint16_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+                static constexpr auto OVFEO = mask<std::uint16_t>( Size::OVFEO, Bit::OVFEO ); ///< OVFEO.
+                static constexpr auto RESERVED9 = mask<std::uint16_t>( Size::RESERVED9, Bit::RESERVED9 ); ///< RESERVED9.
+                static constexpr auto MCEO0 = mask<std::uint16_t>( Size::MCEO0, Bit::MCEO0 ); ///< MCEO0.
+                static constexpr auto MCEO1 = mask<std::uint16_t>( Size::MCEO1, Bit::MCEO1 ); ///< MCEO1.
+                static constexpr auto RESERVED14 = mask<std::uint16_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+            };
+
+            /**
+             * \brief EVACT.
+             */
+            enum EVACT : std::uint16_t {
+                EVACT_OFF = 0x0 << Bit::EVACT, ///< Event action disabled.
+                EVACT_RETRIGGER = 0x1 << Bit::EVACT, ///< Start, restart, or retrigger TC on event.
+                EVACT_COUNT = 0x2 << Bit::EVACT,     ///< Count on event.
+                EVACT_START = 0x3 << Bit::EVACT,     ///< Start TC on event.
+                EVACT_PPW = 0x5 << Bit::EVACT, ///< Period captured in CC0, pulse width in CC1.
+                EVACT_PWP = 0x6 << Bit::EVACT, ///< Period captured in CC1, pulse width in CC0.
+            };
+
+            EVCTRL() = delete;
+
+            EVCTRL( EVCTRL && ) = delete;
+
+            EVCTRL( EVCTRL const & ) = delete;
+
+            ~EVCTRL() = delete;
+
+            auto operator=( EVCTRL && ) = delete;
+
+            auto operator=( EVCTRL const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Clear (INTENCLR) register.
+         *
+         * This register has the following fields:
+         * - Overflow Interrupt Enable (OVF)
+         * - Error Interrupt Enable (ERR)
+         * - Synchronization Ready Interrupt Enable (SYNCRDY)
+         * - Match or Capture Channel 0 Interrupt Enable (MC0)
+         * - Match or Capture Channel 1 Interrupt Enable (MC1)
+         */
+        class INTENCLR : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto OVF       = std::uint_fast8_t{ 1 }; ///< OVF.
+                static constexpr auto ERR       = std::uint_fast8_t{ 1 }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+                static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+                static constexpr auto MC0       = std::uint_fast8_t{ 1 }; ///< MC0.
+                static constexpr auto MC1       = std::uint_fast8_t{ 1 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto OVF = std::uint_fast8_t{}; ///< OVF.
+                static constexpr auto ERR = std::uint_fast8_t{ OVF + Size::OVF }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED2.
+                static constexpr auto SYNCRDY = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< SYNCRDY.
+                static constexpr auto MC0 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< MC0.
+                static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto OVF = mask<std::uint8_t>( Size::OVF, Bit::OVF ); ///< OVF.
+                static constexpr auto ERR = mask<std::uint8_t>( Size::ERR, Bit::ERR ); ///< ERR.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+                static constexpr auto MC0 = mask<std::uint8_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+                static constexpr auto MC1 = mask<std::uint8_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            INTENCLR() = delete;
+
+            INTENCLR( INTENCLR && ) = delete;
+
+            INTENCLR( INTENCLR const & ) = delete;
+
+            ~INTENCLR() = delete;
+
+            auto operator=( INTENCLR && ) = delete;
+
+            auto operator=( INTENCLR const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Set (INTENSET) register.
+         *
+         * This register has the following fields:
+         * - Overflow Interrupt Enable (OVF)
+         * - Error Interrupt Enable (ERR)
+         * - Synchronization Ready Interrupt Enable (SYNCRDY)
+         * - Match or Capture Channel 0 Interrupt Enable (MC0)
+         * - Match or Capture Channel 1 Interrupt Enable (MC1)
+         */
+        class INTENSET : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto OVF       = std::uint_fast8_t{ 1 }; ///< OVF.
+                static constexpr auto ERR       = std::uint_fast8_t{ 1 }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+                static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+                static constexpr auto MC0       = std::uint_fast8_t{ 1 }; ///< MC0.
+                static constexpr auto MC1       = std::uint_fast8_t{ 1 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto OVF = std::uint_fast8_t{}; ///< OVF.
+                static constexpr auto ERR = std::uint_fast8_t{ OVF + Size::OVF }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED2.
+                static constexpr auto SYNCRDY = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< SYNCRDY.
+                static constexpr auto MC0 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< MC0.
+                static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto OVF = mask<std::uint8_t>( Size::OVF, Bit::OVF ); ///< OVF.
+                static constexpr auto ERR = mask<std::uint8_t>( Size::ERR, Bit::ERR ); ///< ERR.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+                static constexpr auto MC0 = mask<std::uint8_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+                static constexpr auto MC1 = mask<std::uint8_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            INTENSET() = delete;
+
+            INTENSET( INTENSET && ) = delete;
+
+            INTENSET( INTENSET const & ) = delete;
+
+            ~INTENSET() = delete;
+
+            auto operator=( INTENSET && ) = delete;
+
+            auto operator=( INTENSET const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+         *
+         * This register has the following fields:
+         * - Overflow (OVF)
+         * - Error (ERR)
+         * - Synchronization Ready (SYNCRDY)
+         * - Match or Capture Channel 0 (MC0)
+         * - Match or Capture Channel 1 (MC1)
+         */
+        class INTFLAG : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto OVF       = std::uint_fast8_t{ 1 }; ///< OVF.
+                static constexpr auto ERR       = std::uint_fast8_t{ 1 }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+                static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+                static constexpr auto MC0       = std::uint_fast8_t{ 1 }; ///< MC0.
+                static constexpr auto MC1       = std::uint_fast8_t{ 1 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto OVF = std::uint_fast8_t{}; ///< OVF.
+                static constexpr auto ERR = std::uint_fast8_t{ OVF + Size::OVF }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED2.
+                static constexpr auto SYNCRDY = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< SYNCRDY.
+                static constexpr auto MC0 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< MC0.
+                static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto OVF = mask<std::uint8_t>( Size::OVF, Bit::OVF ); ///< OVF.
+                static constexpr auto ERR = mask<std::uint8_t>( Size::ERR, Bit::ERR ); ///< ERR.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+                static constexpr auto MC0 = mask<std::uint8_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+                static constexpr auto MC1 = mask<std::uint8_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            INTFLAG() = delete;
+
+            INTFLAG( INTFLAG && ) = delete;
+
+            INTFLAG( INTFLAG const & ) = delete;
+
+            ~INTFLAG() = delete;
+
+            auto operator=( INTFLAG && ) = delete;
+
+            auto operator=( INTFLAG const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Status (STATUS) register.
+         *
+         * This register has the following fields:
+         * - Stop (STOP)
+         * - Slave (SLAVE)
+         * - Synchronization Busy (SYNCBUSY)
+         */
+        class STATUS : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{ 3 }; ///< RESERVED0.
+                static constexpr auto STOP      = std::uint_fast8_t{ 1 }; ///< STOP.
+                static constexpr auto SLAVE     = std::uint_fast8_t{ 1 }; ///< SLAVE.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ 2 }; ///< RESERVED5.
+                static constexpr auto SYNCBUSY  = std::uint_fast8_t{ 1 }; ///< SYNCBUSY.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto STOP = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< STOP.
+                static constexpr auto SLAVE = std::uint_fast8_t{ STOP + Size::STOP }; ///< SLAVE.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ SLAVE + Size::SLAVE }; ///< RESERVED5.
+                static constexpr auto SYNCBUSY = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< SYNCBUSY.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint8_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto STOP = mask<std::uint8_t>( Size::STOP, Bit::STOP ); ///< STOP.
+                static constexpr auto SLAVE = mask<std::uint8_t>( Size::SLAVE, Bit::SLAVE ); ///< SLAVE.
+                static constexpr auto RESERVED5 = mask<std::uint8_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto SYNCBUSY = mask<std::uint8_t>( Size::SYNCBUSY, Bit::SYNCBUSY ); ///< SYNCBUSY.
+            };
+
+            STATUS() = delete;
+
+            STATUS( STATUS && ) = delete;
+
+            STATUS( STATUS const & ) = delete;
+
+            ~STATUS() = delete;
+
+            auto operator=( STATUS && ) = delete;
+
+            auto operator=( STATUS const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief CTRLA.
+         */
+        CTRLA ctrla;
+
+        /**
+         * \brief READREQ.
+         */
+        READREQ readreq;
+
+        /**
+         * \brief CTRLBCLR.
+         */
+        CTRLBCLR ctrlbclr;
+
+        /**
+         * \brief CTRLBSET.
+         */
+        CTRLBSET ctrlbset;
+
+        /**
+         * \brief CTRLC.
+         */
+        CTRLC ctrlc;
+
+        /**
+         * \brief Reserved registers (offset 0x07-0x07).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x07_0x07[ ( 0x07 - 0x07 ) + 1 ];
+
+        /**
+         * \brief DBGCTRL.
+         */
+        DBGCTRL dbgctrl;
+
+        /**
+         * \brief Reserved registers (offset 0x09-0x09).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x09_0x09[ ( 0x09 - 0x09 ) + 1 ];
+
+        /**
+         * \brief EVCTRL.
+         */
+        EVCTRL evctrl;
+
+        /**
+         * \brief INTENCLR.
+         */
+        INTENCLR intenclr;
+
+        /**
+         * \brief INTENSET.
+         */
+        INTENSET intenset;
+
+        /**
+         * \brief INTFLAG.
+         */
+        INTFLAG intflag;
+
+        /**
+         * \brief STATUS.
+         */
+        STATUS const status;
+
+        /**
+         * \brief Count (COUNT) register.
+         */
+        Register<std::uint8_t> count;
+
+        /**
+         * \brief Reserved registers (offset 0x11-0x13).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x11_0x13[ ( 0x13 - 0x11 ) + 1 ];
+
+        /**
+         * \brief Period (PER) register.
+         */
+        Register<std::uint8_t> per;
+
+        /**
+         * \brief Reserved registers (offset 0x15-0x17).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x15_0x17[ ( 0x17 - 0x15 ) + 1 ];
+
+        /**
+         * \brief Compare/Capture (CC) registers.
+         */
+        Register<std::uint8_t> cc[ 2 ];
+
+        COUNT8() = delete;
+
+        COUNT8( COUNT8 && ) = delete;
+
+        COUNT8( COUNT8 const & ) = delete;
+
+        ~COUNT8() = delete;
+
+        auto operator=( COUNT8 && ) = delete;
+
+        auto operator=( COUNT8 const & ) = delete;
+    };
+
+    /**
+     * \brief 16-bit counter mode.
+     */
+    class COUNT16 {
+      public:
+        /**
+         * \brief Control A (CTRLA) register.
+         *
+         * This register has the following fields:
+         * - Software Reset (SWRST)
+         * - Enable (ENABLE)
+         * - Timer Counter Mode (MODE)
+         * - Waveform Generation Operation (WAVEGEN)
+         * - Prescaler (PRESCALER)
+         * - Run in Standby (RUNSTDBY)
+         * - Prescaler and Counter Synchronization (PRESCSYNC)
+         */
+        class CTRLA : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST      = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE     = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto MODE       = std::uint_fast8_t{ 2 }; ///< MODE.
+                static constexpr auto RESERVED4  = std::uint_fast8_t{ 1 }; ///< RESERVED4.
+                static constexpr auto WAVEGEN    = std::uint_fast8_t{ 2 }; ///< WAVEGEN.
+                static constexpr auto RESERVED7  = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+                static constexpr auto PRESCALER  = std::uint_fast8_t{ 3 }; ///< PRESCALER.
+                static constexpr auto RUNSTDBY   = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+                static constexpr auto PRESCSYNC  = std::uint_fast8_t{ 2 }; ///< PRESCSYNC.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ 2 }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto MODE = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< MODE.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ MODE + Size::MODE }; ///< RESERVED4.
+                static constexpr auto WAVEGEN = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< WAVEGEN.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ WAVEGEN + Size::WAVEGEN }; ///< RESERVED7.
+                static constexpr auto PRESCALER = std::uint_fast8_t{ RESERVED7 + Size::RESERVED7 }; ///< PRESCALER.
+                static constexpr auto RUNSTDBY = std::uint_fast8_t{ PRESCALER + Size::PRESCALER }; ///< RUNSTDBY.
+                static constexpr auto PRESCSYNC = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< PRESCSYNC.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ PRESCSYNC + Size::PRESCSYNC }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint16_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint16_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto MODE = mask<std::uint16_t>( Size::MODE, Bit::MODE ); ///< MODE.
+                static constexpr auto RESERVED4 = mask<std::uint16_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+                static constexpr auto WAVEGEN = mask<std::uint16_t>( Size::WAVEGEN, Bit::WAVEGEN ); ///< WAVEGEN.
+                static constexpr auto RESERVED7 = mask<std::uint16_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                static constexpr auto PRESCALER = mask<std::uint16_t>( Size::PRESCALER, Bit::PRESCALER ); ///< PRESCALER.
+                static constexpr auto RUNSTDBY = mask<std::uint16_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+                static constexpr auto PRESCSYNC = mask<std::uint16_t>( Size::PRESCSYNC, Bit::PRESCSYNC ); ///< PRESCSYNC.
+                static constexpr auto RESERVED14 = mask<std::uint16_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+            };
+
+            /**
+             * \brief MODE.
+             */
+            enum MODE : std::uint16_t {
+                MODE_COUNT16 = 0x0 << Bit::MODE, ///< Counter in 16-bit mode.
+            };
+
+            /**
+             * \brief WAVEGEN.
+             */
+            enum WAVEGEN : std::uint16_t {
+                WAVEGEN_NFRQ = 0x0 << Bit::WAVEGEN, ///< Normal frequency.
+                WAVEGEN_MFRQ = 0x1 << Bit::WAVEGEN, ///< Match frequency.
+                WAVEGEN_NPWM = 0x2 << Bit::WAVEGEN, ///< Normal PWM.
+                WAVEGEN_MPWM = 0x3 << Bit::WAVEGEN, ///< Match PWM.
+            };
+
+            /**
+             * \brief PRESCALER.
+             */
+            enum PRESCALER : std::uint16_t {
+                PRESCALER_DIV1    = 0x0 << Bit::PRESCALER, ///< Prescaler: GCLK_TC.
+                PRESCALER_DIV2    = 0x1 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/2.
+                PRESCALER_DIV4    = 0x2 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/4.
+                PRESCALER_DIV8    = 0x3 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/8.
+                PRESCALER_DIV16   = 0x4 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/16.
+                PRESCALER_DIV64   = 0x5 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/64.
+                PRESCALER_DIV256  = 0x6 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/256.
+                PRESCALER_DIV1024 = 0x7 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/1024.
+            };
+
+            /**
+             * \brief PRESCSYNC.
+             */
+            enum PRESCSYNC : std::uint16_t {
+                PRESCSYNC_GCLK = 0x0 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next generic clock.
+                PRESCSYNC_PRESC = 0x1 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next prescaler clock.
+                PRESCSYNC_RESYNC = 0x2 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next generic clock, and reset the prescaler counter.
+            };
+
+            CTRLA() = delete;
+
+            CTRLA( CTRLA && ) = delete;
+
+            CTRLA( CTRLA const & ) = delete;
+
+            ~CTRLA() = delete;
+
+            auto operator=( CTRLA && ) = delete;
+
+            auto operator=( CTRLA const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Read Request (READREQ) register.
+         *
+         * This register has the following fields:
+         * - Address (ADDR)
+         * - Read Continuously (RCONT)
+         * - Read Request (RREQ)
+         */
+        class READREQ : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto ADDR      = std::uint_fast8_t{ 5 }; ///< ADDR.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ 9 }; ///< RESERVED5.
+                static constexpr auto RCONT     = std::uint_fast8_t{ 1 }; ///< RCONT.
+                static constexpr auto RREQ      = std::uint_fast8_t{ 1 }; ///< RREQ.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto ADDR = std::uint_fast8_t{}; ///< ADDR.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ ADDR + Size::ADDR }; ///< RESERVED5.
+                static constexpr auto RCONT = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< RCONT.
+                static constexpr auto RREQ = std::uint_fast8_t{ RCONT + Size::RCONT }; ///< RREQ.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto ADDR = mask<std::uint16_t>( Size::ADDR, Bit::ADDR ); ///< ADDR.
+                static constexpr auto RESERVED5 = mask<std::uint16_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto RCONT = mask<std::uint16_t>( Size::RCONT, Bit::RCONT ); ///< RCONT.
+                static constexpr auto RREQ = mask<std::uint16_t>( Size::RREQ, Bit::RREQ ); ///< RREQ.
+            };
+
+            READREQ() = delete;
+
+            READREQ( READREQ && ) = delete;
+
+            READREQ( READREQ const & ) = delete;
+
+            ~READREQ() = delete;
+
+            auto operator=( READREQ && ) = delete;
+
+            auto operator=( READREQ const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Control B Clear (CTRLBCLR) register.
+         *
+         * This register has the following fields:
+         * - Counter Direction (DIR)
+         * - One-Shot (ONESHOT)
+         * - Command (CMD)
+         */
+        class CTRLBCLR : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DIR       = std::uint_fast8_t{ 1 }; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                static constexpr auto ONESHOT   = std::uint_fast8_t{ 1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 3 }; ///< RESERVED3.
+                static constexpr auto CMD       = std::uint_fast8_t{ 2 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DIR = std::uint_fast8_t{}; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DIR + Size::DIR }; ///< RESERVED1.
+                static constexpr auto ONESHOT = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ ONESHOT + Size::ONESHOT }; ///< RESERVED3.
+                static constexpr auto CMD = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DIR = mask<std::uint8_t>( Size::DIR, Bit::DIR ); ///< DIR.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                static constexpr auto ONESHOT = mask<std::uint8_t>( Size::ONESHOT, Bit::ONESHOT ); ///< ONESHOT.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto CMD = mask<std::uint8_t>( Size::CMD, Bit::CMD ); ///< CMD.
+            };
+
+            /**
+             * \brief CMD.
+             */
+            enum CMD : std::uint8_t {
+                CMD_NONE      = 0x0 << Bit::CMD, ///< No action.
+                CMD_RETRIGGER = 0x1 << Bit::CMD, ///< Force a start, restart, or retrigger.
+                CMD_STOP      = 0x2 << Bit::CMD, ///< Force a stop.
+            };
+
+            CTRLBCLR() = delete;
+
+            CTRLBCLR( CTRLBCLR && ) = delete;
+
+            CTRLBCLR( CTRLBCLR const & ) = delete;
+
+            ~CTRLBCLR() = delete;
+
+            auto operator=( CTRLBCLR && ) = delete;
+
+            auto operator=( CTRLBCLR const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Control B Set (CTRLBSET) register.
+         *
+         * This register has the following fields:
+         * - Counter Direction (DIR)
+         * - One-Shot (ONESHOT)
+         * - Command (CMD)
+         */
+        class CTRLBSET : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DIR       = std::uint_fast8_t{ 1 }; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                static constexpr auto ONESHOT   = std::uint_fast8_t{ 1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 3 }; ///< RESERVED3.
+                static constexpr auto CMD       = std::uint_fast8_t{ 2 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DIR = std::uint_fast8_t{}; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DIR + Size::DIR }; ///< RESERVED1.
+                static constexpr auto ONESHOT = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ ONESHOT + Size::ONESHOT }; ///< RESERVED3.
+                static constexpr auto CMD = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DIR = mask<std::uint8_t>( Size::DIR, Bit::DIR ); ///< DIR.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                static constexpr auto ONESHOT = mask<std::uint8_t>( Size::ONESHOT, Bit::ONESHOT ); ///< ONESHOT.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto CMD = mask<std::uint8_t>( Size::CMD, Bit::CMD ); ///< CMD.
+            };
+
+            /**
+             * \brief CMD.
+             */
+            enum CMD : std::uint8_t {
+                CMD_NONE      = 0x0 << Bit::CMD, ///< No action.
+                CMD_RETRIGGER = 0x1 << Bit::CMD, ///< Force a start, restart, or retrigger.
+                CMD_STOP      = 0x2 << Bit::CMD, ///< Force a stop.
+            };
+
+            CTRLBSET() = delete;
+
+            CTRLBSET( CTRLBSET && ) = delete;
+
+            CTRLBSET( CTRLBSET const & ) = delete;
+
+            ~CTRLBSET() = delete;
+
+            auto operator=( CTRLBSET && ) = delete;
+
+            auto operator=( CTRLBSET const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Control C (CTRLC) register.
+         *
+         * This register has the following fields:
+         * - Output Waveform Invert Enable 0 (INVEN0)
+         * - Output Waveform Invert Enable 1 (INVEN1)
+         * - Capture Channel Enable 0 (CPTEN0)
+         * - Capture Channel Enable 1 (CPTEN1)
+         */
+        class CTRLC : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto INVEN0    = std::uint_fast8_t{ 1 }; ///< INVEN0.
+                static constexpr auto INVEN1    = std::uint_fast8_t{ 1 }; ///< INVEN1.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 2 }; ///< RESERVED2.
+                static constexpr auto CPTEN0    = std::uint_fast8_t{ 1 }; ///< CPTEN0.
+                static constexpr auto CPTEN1    = std::uint_fast8_t{ 1 }; ///< CPTEN1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto INVEN0 = std::uint_fast8_t{}; ///< INVEN0.
+                static constexpr auto INVEN1 = std::uint_fast8_t{ INVEN0 + Size::INVEN0 }; ///< INVEN1.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ INVEN1 + Size::INVEN1 }; ///< RESERVED2.
+                static constexpr auto CPTEN0 = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< CPTEN0.
+                static constexpr auto CPTEN1 = std::uint_fast8_t{ CPTEN0 + Size::CPTEN0 }; ///< CPTEN1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ CPTEN1 + Size::CPTEN1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto INVEN0 = mask<std::uint8_t>( Size::INVEN0, Bit::INVEN0 ); ///< INVEN0.
+                static constexpr auto INVEN1 = mask<std::uint8_t>( Size::INVEN1, Bit::INVEN1 ); ///< INVEN1.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto CPTEN0 = mask<std::uint8_t>( Size::CPTEN0, Bit::CPTEN0 ); ///< CPTEN0.
+                static constexpr auto CPTEN1 = mask<std::uint8_t>( Size::CPTEN1, Bit::CPTEN1 ); ///< CPTEN1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            CTRLC() = delete;
+
+            CTRLC( CTRLC && ) = delete;
+
+            CTRLC( CTRLC const & ) = delete;
+
+            ~CTRLC() = delete;
+
+            auto operator=( CTRLC && ) = delete;
+
+            auto operator=( CTRLC const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Debug Control (DBGCTRL) register.
+         *
+         * This register has the following fields:
+         * - Debug Run Mode (DBGRUN)
+         */
+        class DBGCTRL : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DBGRUN    = std::uint_fast8_t{ 1 }; ///< DBGRUN.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 7 }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DBGRUN = std::uint_fast8_t{}; ///< DBGRUN.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DBGRUN + Size::DBGRUN }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DBGRUN = mask<std::uint8_t>( Size::DBGRUN, Bit::DBGRUN ); ///< DBGRUN.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+            };
+
+            DBGCTRL() = delete;
+
+            DBGCTRL( DBGCTRL && ) = delete;
+
+            DBGCTRL( DBGCTRL const & ) = delete;
+
+            ~DBGCTRL() = delete;
+
+            auto operator=( DBGCTRL && ) = delete;
+
+            auto operator=( DBGCTRL const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Event Control (EVCTRL) register.
+         *
+         * This register has the following fields:
+         * - Event Action (EVACT)
+         * - TC Inverted Event Input (TCINV)
+         * - TC Event Input (TCEI)
+         * - Overflow/Underflow Event Output Enable (OVFEO)
+         * - Match or Capture Channel Event Output Enable 0 (MCEO0)
+         * - Match or Capture Channel Event Output Enable 1 (MCEO1)
+         */
+        class EVCTRL : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto EVACT      = std::uint_fast8_t{ 3 }; ///< EVACT.
+                static constexpr auto RESERVED3  = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                static constexpr auto TCINV      = std::uint_fast8_t{ 1 }; ///< TCINV.
+                static constexpr auto TCEI       = std::uint_fast8_t{ 1 }; ///< TCEI.
+                static constexpr auto RESERVED6  = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+                static constexpr auto OVFEO      = std::uint_fast8_t{ 1 }; ///< OVFEO.
+                static constexpr auto RESERVED9  = std::uint_fast8_t{ 3 }; ///< RESERVED9.
+                static constexpr auto MCEO0      = std::uint_fast8_t{ 1 }; ///< MCEO0.
+                static constexpr auto MCEO1      = std::uint_fast8_t{ 1 }; ///< MCEO1.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ 2 }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto EVACT = std::uint_fast8_t{}; ///< EVACT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ EVACT + Size::EVACT }; ///< RESERVED3.
+                static constexpr auto TCINV = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< TCINV.
+                static constexpr auto TCEI = std::uint_fast8_t{ TCINV + Size::TCINV }; ///< TCEI.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ TCEI + Size::TCEI }; ///< RESERVED6.
+                static constexpr auto OVFEO = std::uint_fast8_t{ RESERVED6 + Size::RESERVED6 }; ///< OVFEO.
+                static constexpr auto RESERVED9 = std::uint_fast8_t{ OVFEO + Size::OVFEO }; ///< RESERVED9.
+                static constexpr auto MCEO0 = std::uint_fast8_t{ RESERVED9 + Size::RESERVED9 }; ///< MCEO0.
+                static constexpr auto MCEO1 = std::uint_fast8_t{ MCEO0 + Size::MCEO0 }; ///< MCEO1.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ MCEO1 + Size::MCEO1 }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto EVACT = mask<std::uint16_t>( Size::EVACT, Bit::EVACT ); ///< EVACT.
+                static constexpr auto RESERVED3 = mask<std::uint16_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto TCINV = mask<std::uint16_t>( Size::TCINV, Bit::TCINV ); ///< TCINV.
+                static constexpr auto TCEI = mask<std::uint16_t>( Size::TCEI, Bit::TCEI ); ///< TCEI.
+                static constexpr auto RESERVED6 = mask<std::uint16_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+                static constexpr auto OVFEO = mask<std::uint16_t>( Size::OVFEO, Bit::OVFEO ); ///< OVFEO.
+                static constexpr auto RESERVED9 = mask<std::uint16_t>( Size::RESERVED9, Bit::RESERVED9 ); ///< RESERVED9.
+                static constexpr auto MCEO0 = mask<std::uint16_t>( Size::MCEO0, Bit::MCEO0 ); ///< MCEO0.
+                static constexpr auto MCEO1 = mask<std::uint16_t>( Size::MCEO1, Bit::MCEO1 ); ///< MCEO1.
+                static constexpr auto RESERVED14 = mask<std::uint16_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+            };
+
+            /**
+             * \brief EVACT.
+             */
+            enum EVACT : std::uint16_t {
+                EVACT_OFF = 0x0 << Bit::EVACT, ///< Event action disabled.
+                EVACT_RETRIGGER = 0x1 << Bit::EVACT, ///< Start, restart, or retrigger TC on event.
+                EVACT_COUNT = 0x2 << Bit::EVACT,     ///< Count on event.
+                EVACT_START = 0x3 << Bit::EVACT,     ///< Start TC on event.
+                EVACT_PPW = 0x5 << Bit::EVACT, ///< Period captured in CC0, pulse width in CC1.
+                EVACT_PWP = 0x6 << Bit::EVACT, ///< Period captured in CC1, pulse width in CC0.
+            };
+
+            EVCTRL() = delete;
+
+            EVCTRL( EVCTRL && ) = delete;
+
+            EVCTRL( EVCTRL const & ) = delete;
+
+            ~EVCTRL() = delete;
+
+            auto operator=( EVCTRL && ) = delete;
+
+            auto operator=( EVCTRL const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Clear (INTENCLR) register.
+         *
+         * This register has the following fields:
+         * - Overflow Interrupt Enable (OVF)
+         * - Error Interrupt Enable (ERR)
+         * - Synchronization Ready Interrupt Enable (SYNCRDY)
+         * - Match or Capture Channel 0 Interrupt Enable (MC0)
+         * - Match or Capture Channel 1 Interrupt Enable (MC1)
+         */
+        class INTENCLR : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto OVF       = std::uint_fast8_t{ 1 }; ///< OVF.
+                static constexpr auto ERR       = std::uint_fast8_t{ 1 }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+                static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+                static constexpr auto MC0       = std::uint_fast8_t{ 1 }; ///< MC0.
+                static constexpr auto MC1       = std::uint_fast8_t{ 1 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto OVF = std::uint_fast8_t{}; ///< OVF.
+                static constexpr auto ERR = std::uint_fast8_t{ OVF + Size::OVF }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED2.
+                static constexpr auto SYNCRDY = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< SYNCRDY.
+                static constexpr auto MC0 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< MC0.
+                static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto OVF = mask<std::uint8_t>( Size::OVF, Bit::OVF ); ///< OVF.
+                static constexpr auto ERR = mask<std::uint8_t>( Size::ERR, Bit::ERR ); ///< ERR.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+                static constexpr auto MC0 = mask<std::uint8_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+                static constexpr auto MC1 = mask<std::uint8_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            INTENCLR() = delete;
+
+            INTENCLR( INTENCLR && ) = delete;
+
+            INTENCLR( INTENCLR const & ) = delete;
+
+            ~INTENCLR() = delete;
+
+            auto operator=( INTENCLR && ) = delete;
+
+            auto operator=( INTENCLR const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Set (INTENSET) register.
+         *
+         * This register has the following fields:
+         * - Overflow Interrupt Enable (OVF)
+         * - Error Interrupt Enable (ERR)
+         * - Synchronization Ready Interrupt Enable (SYNCRDY)
+         * - Match or Capture Channel 0 Interrupt Enable (MC0)
+         * - Match or Capture Channel 1 Interrupt Enable (MC1)
+         */
+        class INTENSET : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto OVF       = std::uint_fast8_t{ 1 }; ///< OVF.
+                static constexpr auto ERR       = std::uint_fast8_t{ 1 }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+                static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+                static constexpr auto MC0       = std::uint_fast8_t{ 1 }; ///< MC0.
+                static constexpr auto MC1       = std::uint_fast8_t{ 1 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto OVF = std::uint_fast8_t{}; ///< OVF.
+                static constexpr auto ERR = std::uint_fast8_t{ OVF + Size::OVF }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED2.
+                static constexpr auto SYNCRDY = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< SYNCRDY.
+                static constexpr auto MC0 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< MC0.
+                static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto OVF = mask<std::uint8_t>( Size::OVF, Bit::OVF ); ///< OVF.
+                static constexpr auto ERR = mask<std::uint8_t>( Size::ERR, Bit::ERR ); ///< ERR.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+                static constexpr auto MC0 = mask<std::uint8_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+                static constexpr auto MC1 = mask<std::uint8_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            INTENSET() = delete;
+
+            INTENSET( INTENSET && ) = delete;
+
+            INTENSET( INTENSET const & ) = delete;
+
+            ~INTENSET() = delete;
+
+            auto operator=( INTENSET && ) = delete;
+
+            auto operator=( INTENSET const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+         *
+         * This register has the following fields:
+         * - Overflow (OVF)
+         * - Error (ERR)
+         * - Synchronization Ready (SYNCRDY)
+         * - Match or Capture Channel 0 (MC0)
+         * - Match or Capture Channel 1 (MC1)
+         */
+        class INTFLAG : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto OVF       = std::uint_fast8_t{ 1 }; ///< OVF.
+                static constexpr auto ERR       = std::uint_fast8_t{ 1 }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+                static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+                static constexpr auto MC0       = std::uint_fast8_t{ 1 }; ///< MC0.
+                static constexpr auto MC1       = std::uint_fast8_t{ 1 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto OVF = std::uint_fast8_t{}; ///< OVF.
+                static constexpr auto ERR = std::uint_fast8_t{ OVF + Size::OVF }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED2.
+                static constexpr auto SYNCRDY = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< SYNCRDY.
+                static constexpr auto MC0 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< MC0.
+                static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto OVF = mask<std::uint8_t>( Size::OVF, Bit::OVF ); ///< OVF.
+                static constexpr auto ERR = mask<std::uint8_t>( Size::ERR, Bit::ERR ); ///< ERR.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+                static constexpr auto MC0 = mask<std::uint8_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+                static constexpr auto MC1 = mask<std::uint8_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            INTFLAG() = delete;
+
+            INTFLAG( INTFLAG && ) = delete;
+
+            INTFLAG( INTFLAG const & ) = delete;
+
+            ~INTFLAG() = delete;
+
+            auto operator=( INTFLAG && ) = delete;
+
+            auto operator=( INTFLAG const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Status (STATUS) register.
+         *
+         * This register has the following fields:
+         * - Stop (STOP)
+         * - Slave (SLAVE)
+         * - Synchronization Busy (SYNCBUSY)
+         */
+        class STATUS : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{ 3 }; ///< RESERVED0.
+                static constexpr auto STOP      = std::uint_fast8_t{ 1 }; ///< STOP.
+                static constexpr auto SLAVE     = std::uint_fast8_t{ 1 }; ///< SLAVE.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ 2 }; ///< RESERVED5.
+                static constexpr auto SYNCBUSY  = std::uint_fast8_t{ 1 }; ///< SYNCBUSY.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto STOP = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< STOP.
+                static constexpr auto SLAVE = std::uint_fast8_t{ STOP + Size::STOP }; ///< SLAVE.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ SLAVE + Size::SLAVE }; ///< RESERVED5.
+                static constexpr auto SYNCBUSY = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< SYNCBUSY.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint8_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto STOP = mask<std::uint8_t>( Size::STOP, Bit::STOP ); ///< STOP.
+                static constexpr auto SLAVE = mask<std::uint8_t>( Size::SLAVE, Bit::SLAVE ); ///< SLAVE.
+                static constexpr auto RESERVED5 = mask<std::uint8_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto SYNCBUSY = mask<std::uint8_t>( Size::SYNCBUSY, Bit::SYNCBUSY ); ///< SYNCBUSY.
+            };
+
+            STATUS() = delete;
+
+            STATUS( STATUS && ) = delete;
+
+            STATUS( STATUS const & ) = delete;
+
+            ~STATUS() = delete;
+
+            auto operator=( STATUS && ) = delete;
+
+            auto operator=( STATUS const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief CTRLA.
+         */
+        CTRLA ctrla;
+
+        /**
+         * \brief READREQ.
+         */
+        READREQ readreq;
+
+        /**
+         * \brief CTRLBCLR.
+         */
+        CTRLBCLR ctrlbclr;
+
+        /**
+         * \brief CTRLBSET.
+         */
+        CTRLBSET ctrlbset;
+
+        /**
+         * \brief CTRLC.
+         */
+        CTRLC ctrlc;
+
+        /**
+         * \brief Reserved registers (offset 0x07-0x07).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x07_0x07[ ( 0x07 - 0x07 ) + 1 ];
+
+        /**
+         * \brief DBGCTRL.
+         */
+        DBGCTRL dbgctrl;
+
+        /**
+         * \brief Reserved registers (offset 0x09-0x09).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x09_0x09[ ( 0x09 - 0x09 ) + 1 ];
+
+        /**
+         * \brief EVCTRL.
+         */
+        EVCTRL evctrl;
+
+        /**
+         * \brief INTENCLR.
+         */
+        INTENCLR intenclr;
+
+        /**
+         * \brief INTENSET.
+         */
+        INTENSET intenset;
+
+        /**
+         * \brief INTFLAG.
+         */
+        INTFLAG intflag;
+
+        /**
+         * \brief STATUS.
+         */
+        STATUS const status;
+
+        /**
+         * \brief Count (COUNT) register.
+         */
+        Register<std::uint16_t> count;
+
+        /**
+         * \brief Reserved registers (offset 0x12-0x17).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x12_0x17[ ( 0x17 - 0x12 ) + 1 ];
+
+        /**
+         * \brief Compare/Capture (CC) registers.
+         */
+        Register<std::uint16_t> cc[ 2 ];
+
+        COUNT16() = delete;
+
+        COUNT16( COUNT16 && ) = delete;
+
+        COUNT16( COUNT16 const & ) = delete;
+
+        ~COUNT16() = delete;
+
+        auto operator=( COUNT16 && ) = delete;
+
+        auto operator=( COUNT16 const & ) = delete;
+    };
+
+    /**
+     * \brief 32-bit counter mode.
+     */
+    class COUNT32 {
+      public:
+        /**
+         * \brief Control A (CTRLA) register.
+         *
+         * This register has the following fields:
+         * - Software Reset (SWRST)
+         * - Enable (ENABLE)
+         * - Timer Counter Mode (MODE)
+         * - Waveform Generation Operation (WAVEGEN)
+         * - Prescaler (PRESCALER)
+         * - Run in Standby (RUNSTDBY)
+         * - Prescaler and Counter Synchronization (PRESCSYNC)
+         */
+        class CTRLA : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST      = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE     = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto MODE       = std::uint_fast8_t{ 2 }; ///< MODE.
+                static constexpr auto RESERVED4  = std::uint_fast8_t{ 1 }; ///< RESERVED4.
+                static constexpr auto WAVEGEN    = std::uint_fast8_t{ 2 }; ///< WAVEGEN.
+                static constexpr auto RESERVED7  = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+                static constexpr auto PRESCALER  = std::uint_fast8_t{ 3 }; ///< PRESCALER.
+                static constexpr auto RUNSTDBY   = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+                static constexpr auto PRESCSYNC  = std::uint_fast8_t{ 2 }; ///< PRESCSYNC.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ 2 }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto MODE = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< MODE.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ MODE + Size::MODE }; ///< RESERVED4.
+                static constexpr auto WAVEGEN = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< WAVEGEN.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ WAVEGEN + Size::WAVEGEN }; ///< RESERVED7.
+                static constexpr auto PRESCALER = std::uint_fast8_t{ RESERVED7 + Size::RESERVED7 }; ///< PRESCALER.
+                static constexpr auto RUNSTDBY = std::uint_fast8_t{ PRESCALER + Size::PRESCALER }; ///< RUNSTDBY.
+                static constexpr auto PRESCSYNC = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< PRESCSYNC.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ PRESCSYNC + Size::PRESCSYNC }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint16_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint16_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto MODE = mask<std::uint16_t>( Size::MODE, Bit::MODE ); ///< MODE.
+                static constexpr auto RESERVED4 = mask<std::uint16_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+                static constexpr auto WAVEGEN = mask<std::uint16_t>( Size::WAVEGEN, Bit::WAVEGEN ); ///< WAVEGEN.
+                static constexpr auto RESERVED7 = mask<std::uint16_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                static constexpr auto PRESCALER = mask<std::uint16_t>( Size::PRESCALER, Bit::PRESCALER ); ///< PRESCALER.
+                static constexpr auto RUNSTDBY = mask<std::uint16_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+                static constexpr auto PRESCSYNC = mask<std::uint16_t>( Size::PRESCSYNC, Bit::PRESCSYNC ); ///< PRESCSYNC.
+                static constexpr auto RESERVED14 = mask<std::uint16_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+            };
+
+            /**
+             * \brief MODE.
+             */
+            enum MODE : std::uint16_t {
+                MODE_COUNT32 = 0x2 << Bit::MODE, ///< Counter in 32-bit mode.
+            };
+
+            /**
+             * \brief WAVEGEN.
+             */
+            enum WAVEGEN : std::uint16_t {
+                WAVEGEN_NFRQ = 0x0 << Bit::WAVEGEN, ///< Normal frequency.
+                WAVEGEN_MFRQ = 0x1 << Bit::WAVEGEN, ///< Match frequency.
+                WAVEGEN_NPWM = 0x2 << Bit::WAVEGEN, ///< Normal PWM.
+                WAVEGEN_MPWM = 0x3 << Bit::WAVEGEN, ///< Match PWM.
+            };
+
+            /**
+             * \brief PRESCALER.
+             */
+            enum PRESCALER : std::uint16_t {
+                PRESCALER_DIV1    = 0x0 << Bit::PRESCALER, ///< Prescaler: GCLK_TC.
+                PRESCALER_DIV2    = 0x1 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/2.
+                PRESCALER_DIV4    = 0x2 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/4.
+                PRESCALER_DIV8    = 0x3 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/8.
+                PRESCALER_DIV16   = 0x4 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/16.
+                PRESCALER_DIV64   = 0x5 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/64.
+                PRESCALER_DIV256  = 0x6 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/256.
+                PRESCALER_DIV1024 = 0x7 << Bit::PRESCALER, ///< Prescaler: GCLK_TC/1024.
+            };
+
+            /**
+             * \brief PRESCSYNC.
+             */
+            enum PRESCSYNC : std::uint16_t {
+                PRESCSYNC_GCLK = 0x0 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next generic clock.
+                PRESCSYNC_PRESC = 0x1 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next prescaler clock.
+                PRESCSYNC_RESYNC = 0x2 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next generic clock, and reset the prescaler counter.
+            };
+
+            CTRLA() = delete;
+
+            CTRLA( CTRLA && ) = delete;
+
+            CTRLA( CTRLA const & ) = delete;
+
+            ~CTRLA() = delete;
+
+            auto operator=( CTRLA && ) = delete;
+
+            auto operator=( CTRLA const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Read Request (READREQ) register.
+         *
+         * This register has the following fields:
+         * - Address (ADDR)
+         * - Read Continuously (RCONT)
+         * - Read Request (RREQ)
+         */
+        class READREQ : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto ADDR      = std::uint_fast8_t{ 5 }; ///< ADDR.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ 9 }; ///< RESERVED5.
+                static constexpr auto RCONT     = std::uint_fast8_t{ 1 }; ///< RCONT.
+                static constexpr auto RREQ      = std::uint_fast8_t{ 1 }; ///< RREQ.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto ADDR = std::uint_fast8_t{}; ///< ADDR.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ ADDR + Size::ADDR }; ///< RESERVED5.
+                static constexpr auto RCONT = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< RCONT.
+                static constexpr auto RREQ = std::uint_fast8_t{ RCONT + Size::RCONT }; ///< RREQ.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto ADDR = mask<std::uint16_t>( Size::ADDR, Bit::ADDR ); ///< ADDR.
+                static constexpr auto RESERVED5 = mask<std::uint16_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto RCONT = mask<std::uint16_t>( Size::RCONT, Bit::RCONT ); ///< RCONT.
+                static constexpr auto RREQ = mask<std::uint16_t>( Size::RREQ, Bit::RREQ ); ///< RREQ.
+            };
+
+            READREQ() = delete;
+
+            READREQ( READREQ && ) = delete;
+
+            READREQ( READREQ const & ) = delete;
+
+            ~READREQ() = delete;
+
+            auto operator=( READREQ && ) = delete;
+
+            auto operator=( READREQ const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Control B Clear (CTRLBCLR) register.
+         *
+         * This register has the following fields:
+         * - Counter Direction (DIR)
+         * - One-Shot (ONESHOT)
+         * - Command (CMD)
+         */
+        class CTRLBCLR : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DIR       = std::uint_fast8_t{ 1 }; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                static constexpr auto ONESHOT   = std::uint_fast8_t{ 1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 3 }; ///< RESERVED3.
+                static constexpr auto CMD       = std::uint_fast8_t{ 2 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DIR = std::uint_fast8_t{}; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DIR + Size::DIR }; ///< RESERVED1.
+                static constexpr auto ONESHOT = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ ONESHOT + Size::ONESHOT }; ///< RESERVED3.
+                static constexpr auto CMD = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DIR = mask<std::uint8_t>( Size::DIR, Bit::DIR ); ///< DIR.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                static constexpr auto ONESHOT = mask<std::uint8_t>( Size::ONESHOT, Bit::ONESHOT ); ///< ONESHOT.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto CMD = mask<std::uint8_t>( Size::CMD, Bit::CMD ); ///< CMD.
+            };
+
+            /**
+             * \brief CMD.
+             */
+            enum CMD : std::uint8_t {
+                CMD_NONE      = 0x0 << Bit::CMD, ///< No action.
+                CMD_RETRIGGER = 0x1 << Bit::CMD, ///< Force a start, restart, or retrigger.
+                CMD_STOP      = 0x2 << Bit::CMD, ///< Force a stop.
+            };
+
+            CTRLBCLR() = delete;
+
+            CTRLBCLR( CTRLBCLR && ) = delete;
+
+            CTRLBCLR( CTRLBCLR const & ) = delete;
+
+            ~CTRLBCLR() = delete;
+
+            auto operator=( CTRLBCLR && ) = delete;
+
+            auto operator=( CTRLBCLR const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Control B Set (CTRLBSET) register.
+         *
+         * This register has the following fields:
+         * - Counter Direction (DIR)
+         * - One-Shot (ONESHOT)
+         * - Command (CMD)
+         */
+        class CTRLBSET : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DIR       = std::uint_fast8_t{ 1 }; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                static constexpr auto ONESHOT   = std::uint_fast8_t{ 1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 3 }; ///< RESERVED3.
+                static constexpr auto CMD       = std::uint_fast8_t{ 2 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DIR = std::uint_fast8_t{}; ///< DIR.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DIR + Size::DIR }; ///< RESERVED1.
+                static constexpr auto ONESHOT = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< ONESHOT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ ONESHOT + Size::ONESHOT }; ///< RESERVED3.
+                static constexpr auto CMD = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< CMD.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DIR = mask<std::uint8_t>( Size::DIR, Bit::DIR ); ///< DIR.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                static constexpr auto ONESHOT = mask<std::uint8_t>( Size::ONESHOT, Bit::ONESHOT ); ///< ONESHOT.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto CMD = mask<std::uint8_t>( Size::CMD, Bit::CMD ); ///< CMD.
+            };
+
+            /**
+             * \brief CMD.
+             */
+            enum CMD : std::uint8_t {
+                CMD_NONE      = 0x0 << Bit::CMD, ///< No action.
+                CMD_RETRIGGER = 0x1 << Bit::CMD, ///< Force a start, restart, or retrigger.
+                CMD_STOP      = 0x2 << Bit::CMD, ///< Force a stop.
+            };
+
+            CTRLBSET() = delete;
+
+            CTRLBSET( CTRLBSET && ) = delete;
+
+            CTRLBSET( CTRLBSET const & ) = delete;
+
+            ~CTRLBSET() = delete;
+
+            auto operator=( CTRLBSET && ) = delete;
+
+            auto operator=( CTRLBSET const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Control C (CTRLC) register.
+         *
+         * This register has the following fields:
+         * - Output Waveform Invert Enable 0 (INVEN0)
+         * - Output Waveform Invert Enable 1 (INVEN1)
+         * - Capture Channel Enable 0 (CPTEN0)
+         * - Capture Channel Enable 1 (CPTEN1)
+         */
+        class CTRLC : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto INVEN0    = std::uint_fast8_t{ 1 }; ///< INVEN0.
+                static constexpr auto INVEN1    = std::uint_fast8_t{ 1 }; ///< INVEN1.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 2 }; ///< RESERVED2.
+                static constexpr auto CPTEN0    = std::uint_fast8_t{ 1 }; ///< CPTEN0.
+                static constexpr auto CPTEN1    = std::uint_fast8_t{ 1 }; ///< CPTEN1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto INVEN0 = std::uint_fast8_t{}; ///< INVEN0.
+                static constexpr auto INVEN1 = std::uint_fast8_t{ INVEN0 + Size::INVEN0 }; ///< INVEN1.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ INVEN1 + Size::INVEN1 }; ///< RESERVED2.
+                static constexpr auto CPTEN0 = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< CPTEN0.
+                static constexpr auto CPTEN1 = std::uint_fast8_t{ CPTEN0 + Size::CPTEN0 }; ///< CPTEN1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ CPTEN1 + Size::CPTEN1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto INVEN0 = mask<std::uint8_t>( Size::INVEN0, Bit::INVEN0 ); ///< INVEN0.
+                static constexpr auto INVEN1 = mask<std::uint8_t>( Size::INVEN1, Bit::INVEN1 ); ///< INVEN1.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto CPTEN0 = mask<std::uint8_t>( Size::CPTEN0, Bit::CPTEN0 ); ///< CPTEN0.
+                static constexpr auto CPTEN1 = mask<std::uint8_t>( Size::CPTEN1, Bit::CPTEN1 ); ///< CPTEN1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            CTRLC() = delete;
+
+            CTRLC( CTRLC && ) = delete;
+
+            CTRLC( CTRLC const & ) = delete;
+
+            ~CTRLC() = delete;
+
+            auto operator=( CTRLC && ) = delete;
+
+            auto operator=( CTRLC const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Debug Control (DBGCTRL) register.
+         *
+         * This register has the following fields:
+         * - Debug Run Mode (DBGRUN)
+         */
+        class DBGCTRL : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DBGRUN    = std::uint_fast8_t{ 1 }; ///< DBGRUN.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ 7 }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DBGRUN = std::uint_fast8_t{}; ///< DBGRUN.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ DBGRUN + Size::DBGRUN }; ///< RESERVED1.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DBGRUN = mask<std::uint8_t>( Size::DBGRUN, Bit::DBGRUN ); ///< DBGRUN.
+                static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+            };
+
+            DBGCTRL() = delete;
+
+            DBGCTRL( DBGCTRL && ) = delete;
+
+            DBGCTRL( DBGCTRL const & ) = delete;
+
+            ~DBGCTRL() = delete;
+
+            auto operator=( DBGCTRL && ) = delete;
+
+            auto operator=( DBGCTRL const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Event Control (EVCTRL) register.
+         *
+         * This register has the following fields:
+         * - Event Action (EVACT)
+         * - TC Inverted Event Input (TCINV)
+         * - TC Event Input (TCEI)
+         * - Overflow/Underflow Event Output Enable (OVFEO)
+         * - Match or Capture Channel Event Output Enable 0 (MCEO0)
+         * - Match or Capture Channel Event Output Enable 1 (MCEO1)
+         */
+        class EVCTRL : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto EVACT      = std::uint_fast8_t{ 3 }; ///< EVACT.
+                static constexpr auto RESERVED3  = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                static constexpr auto TCINV      = std::uint_fast8_t{ 1 }; ///< TCINV.
+                static constexpr auto TCEI       = std::uint_fast8_t{ 1 }; ///< TCEI.
+                static constexpr auto RESERVED6  = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+                static constexpr auto OVFEO      = std::uint_fast8_t{ 1 }; ///< OVFEO.
+                static constexpr auto RESERVED9  = std::uint_fast8_t{ 3 }; ///< RESERVED9.
+                static constexpr auto MCEO0      = std::uint_fast8_t{ 1 }; ///< MCEO0.
+                static constexpr auto MCEO1      = std::uint_fast8_t{ 1 }; ///< MCEO1.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ 2 }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto EVACT = std::uint_fast8_t{}; ///< EVACT.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ EVACT + Size::EVACT }; ///< RESERVED3.
+                static constexpr auto TCINV = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< TCINV.
+                static constexpr auto TCEI = std::uint_fast8_t{ TCINV + Size::TCINV }; ///< TCEI.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ TCEI + Size::TCEI }; ///< RESERVED6.
+                static constexpr auto OVFEO = std::uint_fast8_t{ RESERVED6 + Size::RESERVED6 }; ///< OVFEO.
+                static constexpr auto RESERVED9 = std::uint_fast8_t{ OVFEO + Size::OVFEO }; ///< RESERVED9.
+                static constexpr auto MCEO0 = std::uint_fast8_t{ RESERVED9 + Size::RESERVED9 }; ///< MCEO0.
+                static constexpr auto MCEO1 = std::uint_fast8_t{ MCEO0 + Size::MCEO0 }; ///< MCEO1.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ MCEO1 + Size::MCEO1 }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto EVACT = mask<std::uint16_t>( Size::EVACT, Bit::EVACT ); ///< EVACT.
+                static constexpr auto RESERVED3 = mask<std::uint16_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto TCINV = mask<std::uint16_t>( Size::TCINV, Bit::TCINV ); ///< TCINV.
+                static constexpr auto TCEI = mask<std::uint16_t>( Size::TCEI, Bit::TCEI ); ///< TCEI.
+                static constexpr auto RESERVED6 = mask<std::uint16_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+                static constexpr auto OVFEO = mask<std::uint16_t>( Size::OVFEO, Bit::OVFEO ); ///< OVFEO.
+                static constexpr auto RESERVED9 = mask<std::uint16_t>( Size::RESERVED9, Bit::RESERVED9 ); ///< RESERVED9.
+                static constexpr auto MCEO0 = mask<std::uint16_t>( Size::MCEO0, Bit::MCEO0 ); ///< MCEO0.
+                static constexpr auto MCEO1 = mask<std::uint16_t>( Size::MCEO1, Bit::MCEO1 ); ///< MCEO1.
+                static constexpr auto RESERVED14 = mask<std::uint16_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+            };
+
+            /**
+             * \brief EVACT.
+             */
+            enum EVACT : std::uint16_t {
+                EVACT_OFF = 0x0 << Bit::EVACT, ///< Event action disabled.
+                EVACT_RETRIGGER = 0x1 << Bit::EVACT, ///< Start, restart, or retrigger TC on event.
+                EVACT_COUNT = 0x2 << Bit::EVACT,     ///< Count on event.
+                EVACT_START = 0x3 << Bit::EVACT,     ///< Start TC on event.
+                EVACT_PPW = 0x5 << Bit::EVACT, ///< Period captured in CC0, pulse width in CC1.
+                EVACT_PWP = 0x6 << Bit::EVACT, ///< Period captured in CC1, pulse width in CC0.
+            };
+
+            EVCTRL() = delete;
+
+            EVCTRL( EVCTRL && ) = delete;
+
+            EVCTRL( EVCTRL const & ) = delete;
+
+            ~EVCTRL() = delete;
+
+            auto operator=( EVCTRL && ) = delete;
+
+            auto operator=( EVCTRL const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Clear (INTENCLR) register.
+         *
+         * This register has the following fields:
+         * - Overflow Interrupt Enable (OVF)
+         * - Error Interrupt Enable (ERR)
+         * - Synchronization Ready Interrupt Enable (SYNCRDY)
+         * - Match or Capture Channel 0 Interrupt Enable (MC0)
+         * - Match or Capture Channel 1 Interrupt Enable (MC1)
+         */
+        class INTENCLR : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto OVF       = std::uint_fast8_t{ 1 }; ///< OVF.
+                static constexpr auto ERR       = std::uint_fast8_t{ 1 }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+                static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+                static constexpr auto MC0       = std::uint_fast8_t{ 1 }; ///< MC0.
+                static constexpr auto MC1       = std::uint_fast8_t{ 1 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto OVF = std::uint_fast8_t{}; ///< OVF.
+                static constexpr auto ERR = std::uint_fast8_t{ OVF + Size::OVF }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED2.
+                static constexpr auto SYNCRDY = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< SYNCRDY.
+                static constexpr auto MC0 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< MC0.
+                static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto OVF = mask<std::uint8_t>( Size::OVF, Bit::OVF ); ///< OVF.
+                static constexpr auto ERR = mask<std::uint8_t>( Size::ERR, Bit::ERR ); ///< ERR.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+                static constexpr auto MC0 = mask<std::uint8_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+                static constexpr auto MC1 = mask<std::uint8_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            INTENCLR() = delete;
+
+            INTENCLR( INTENCLR && ) = delete;
+
+            INTENCLR( INTENCLR const & ) = delete;
+
+            ~INTENCLR() = delete;
+
+            auto operator=( INTENCLR && ) = delete;
+
+            auto operator=( INTENCLR const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Set (INTENSET) register.
+         *
+         * This register has the following fields:
+         * - Overflow Interrupt Enable (OVF)
+         * - Error Interrupt Enable (ERR)
+         * - Synchronization Ready Interrupt Enable (SYNCRDY)
+         * - Match or Capture Channel 0 Interrupt Enable (MC0)
+         * - Match or Capture Channel 1 Interrupt Enable (MC1)
+         */
+        class INTENSET : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto OVF       = std::uint_fast8_t{ 1 }; ///< OVF.
+                static constexpr auto ERR       = std::uint_fast8_t{ 1 }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+                static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+                static constexpr auto MC0       = std::uint_fast8_t{ 1 }; ///< MC0.
+                static constexpr auto MC1       = std::uint_fast8_t{ 1 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto OVF = std::uint_fast8_t{}; ///< OVF.
+                static constexpr auto ERR = std::uint_fast8_t{ OVF + Size::OVF }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED2.
+                static constexpr auto SYNCRDY = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< SYNCRDY.
+                static constexpr auto MC0 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< MC0.
+                static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto OVF = mask<std::uint8_t>( Size::OVF, Bit::OVF ); ///< OVF.
+                static constexpr auto ERR = mask<std::uint8_t>( Size::ERR, Bit::ERR ); ///< ERR.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+                static constexpr auto MC0 = mask<std::uint8_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+                static constexpr auto MC1 = mask<std::uint8_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            INTENSET() = delete;
+
+            INTENSET( INTENSET && ) = delete;
+
+            INTENSET( INTENSET const & ) = delete;
+
+            ~INTENSET() = delete;
+
+            auto operator=( INTENSET && ) = delete;
+
+            auto operator=( INTENSET const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+         *
+         * This register has the following fields:
+         * - Overflow (OVF)
+         * - Error (ERR)
+         * - Synchronization Ready (SYNCRDY)
+         * - Match or Capture Channel 0 (MC0)
+         * - Match or Capture Channel 1 (MC1)
+         */
+        class INTFLAG : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto OVF       = std::uint_fast8_t{ 1 }; ///< OVF.
+                static constexpr auto ERR       = std::uint_fast8_t{ 1 }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+                static constexpr auto SYNCRDY   = std::uint_fast8_t{ 1 }; ///< SYNCRDY.
+                static constexpr auto MC0       = std::uint_fast8_t{ 1 }; ///< MC0.
+                static constexpr auto MC1       = std::uint_fast8_t{ 1 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto OVF = std::uint_fast8_t{}; ///< OVF.
+                static constexpr auto ERR = std::uint_fast8_t{ OVF + Size::OVF }; ///< ERR.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED2.
+                static constexpr auto SYNCRDY = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< SYNCRDY.
+                static constexpr auto MC0 = std::uint_fast8_t{ SYNCRDY + Size::SYNCRDY }; ///< MC0.
+                static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+                static constexpr auto RESERVED6 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< RESERVED6.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto OVF = mask<std::uint8_t>( Size::OVF, Bit::OVF ); ///< OVF.
+                static constexpr auto ERR = mask<std::uint8_t>( Size::ERR, Bit::ERR ); ///< ERR.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                static constexpr auto SYNCRDY = mask<std::uint8_t>( Size::SYNCRDY, Bit::SYNCRDY ); ///< SYNCRDY.
+                static constexpr auto MC0 = mask<std::uint8_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+                static constexpr auto MC1 = mask<std::uint8_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+                static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            };
+
+            INTFLAG() = delete;
+
+            INTFLAG( INTFLAG && ) = delete;
+
+            INTFLAG( INTFLAG const & ) = delete;
+
+            ~INTFLAG() = delete;
+
+            auto operator=( INTFLAG && ) = delete;
+
+            auto operator=( INTFLAG const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Status (STATUS) register.
+         *
+         * This register has the following fields:
+         * - Stop (STOP)
+         * - Slave (SLAVE)
+         * - Synchronization Busy (SYNCBUSY)
+         */
+        class STATUS : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{ 3 }; ///< RESERVED0.
+                static constexpr auto STOP      = std::uint_fast8_t{ 1 }; ///< STOP.
+                static constexpr auto SLAVE     = std::uint_fast8_t{ 1 }; ///< SLAVE.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ 2 }; ///< RESERVED5.
+                static constexpr auto SYNCBUSY  = std::uint_fast8_t{ 1 }; ///< SYNCBUSY.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto STOP = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< STOP.
+                static constexpr auto SLAVE = std::uint_fast8_t{ STOP + Size::STOP }; ///< SLAVE.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ SLAVE + Size::SLAVE }; ///< RESERVED5.
+                static constexpr auto SYNCBUSY = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< SYNCBUSY.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint8_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto STOP = mask<std::uint8_t>( Size::STOP, Bit::STOP ); ///< STOP.
+                static constexpr auto SLAVE = mask<std::uint8_t>( Size::SLAVE, Bit::SLAVE ); ///< SLAVE.
+                static constexpr auto RESERVED5 = mask<std::uint8_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto SYNCBUSY = mask<std::uint8_t>( Size::SYNCBUSY, Bit::SYNCBUSY ); ///< SYNCBUSY.
+            };
+
+            STATUS() = delete;
+
+            STATUS( STATUS && ) = delete;
+
+            STATUS( STATUS const & ) = delete;
+
+            ~STATUS() = delete;
+
+            auto operator=( STATUS && ) = delete;
+
+            auto operator=( STATUS const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief CTRLA.
+         */
+        CTRLA ctrla;
+
+        /**
+         * \brief READREQ.
+         */
+        READREQ readreq;
+
+        /**
+         * \brief CTRLBCLR.
+         */
+        CTRLBCLR ctrlbclr;
+
+        /**
+         * \brief CTRLBSET.
+         */
+        CTRLBSET ctrlbset;
+
+        /**
+         * \brief CTRLC.
+         */
+        CTRLC ctrlc;
+
+        /**
+         * \brief Reserved registers (offset 0x07-0x07).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x07_0x07[ ( 0x07 - 0x07 ) + 1 ];
+
+        /**
+         * \brief DBGCTRL.
+         */
+        DBGCTRL dbgctrl;
+
+        /**
+         * \brief Reserved registers (offset 0x09-0x09).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x09_0x09[ ( 0x09 - 0x09 ) + 1 ];
+
+        /**
+         * \brief EVCTRL.
+         */
+        EVCTRL evctrl;
+
+        /**
+         * \brief INTENCLR.
+         */
+        INTENCLR intenclr;
+
+        /**
+         * \brief INTENSET.
+         */
+        INTENSET intenset;
+
+        /**
+         * \brief INTFLAG.
+         */
+        INTFLAG intflag;
+
+        /**
+         * \brief STATUS.
+         */
+        STATUS const status;
+
+        /**
+         * \brief Count (COUNT) register.
+         */
+        Register<std::uint32_t> count;
+
+        /**
+         * \brief Reserved registers (offset 0x14-0x17).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x14_0x17[ ( 0x17 - 0x14 ) + 1 ];
+
+        /**
+         * \brief Compare/Capture (CC) registers.
+         */
+        Register<std::uint32_t> cc[ 2 ];
+
+        COUNT32() = delete;
+
+        COUNT32( COUNT32 && ) = delete;
+
+        COUNT32( COUNT32 const & ) = delete;
+
+        ~COUNT32() = delete;
+
+        auto operator=( COUNT32 && ) = delete;
+
+        auto operator=( COUNT32 const & ) = delete;
+    };
+
+    union {
+        /**
+         * \brief COUNT8.
+         */
+        COUNT8 count8;
+
+        /**
+         * \brief COUNT16.
+         */
+        COUNT16 count16;
+
+        /**
+         * \brief COUNT32.
+         */
+        COUNT32 count32;
+    };
+
+    TC() = delete;
+
+    TC( TC && ) = delete;
+
+    TC( TC const & ) = delete;
+
+    ~TC() = delete;
+
+    auto operator=( TC && ) = delete;
+
+    auto operator=( TC const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_TC_H
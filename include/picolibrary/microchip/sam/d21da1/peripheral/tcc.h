@@ -0,0 +1,2242 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Peripheral::TCC interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_TCC_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_TCC_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Peripheral {
+
+/**
+ * \brief Microchip SAM D21/DA1 Timer/Counter for Control Applications (TCC) peripheral.
+ */
+class TCC {
+  public:
+    /**
+     * \brief Control A (CTRLA) register.
+     *
+     * This register has the following fields:
+     * - Software Reset (SWRST)
+     * - Enable (ENABLE)
+     * - Enhanced Resolution (RESOLUTION)
+     * - Prescaler (PRESCALER)
+     * - Run in Standby (RUNSTDBY)
+     * - Prescaler and Counter Synchronization Selection (PRESCSYNC)
+     * - Auto Lock (ALOCK)
+     * - Capture Channel Enable 0 (CPTEN0)
+     * - Capture Channel Enable 1 (CPTEN1)
+     * - Capture Channel Enable 2 (CPTEN2)
+     * - Capture Channel Enable 3 (CPTEN3)
+     */
+    class CTRLA : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SWRST      = std::uint_fast8_t{ 1 }; ///< SWRST.
+            static constexpr auto ENABLE     = std::uint_fast8_t{ 1 }; ///< ENABLE.
+            static constexpr auto RESERVED2  = std::uint_fast8_t{ 3 }; ///< RESERVED2.
+            static constexpr auto RESOLUTION = std::uint_fast8_t{ 2 }; ///< RESOLUTION.
+            static constexpr auto RESERVED7  = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+            static constexpr auto PRESCALER  = std::uint_fast8_t{ 3 }; ///< PRESCALER.
+            static constexpr auto RUNSTDBY   = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+            static constexpr auto PRESCSYNC  = std::uint_fast8_t{ 2 }; ///< PRESCSYNC.
+            static constexpr auto ALOCK      = std::uint_fast8_t{ 1 }; ///< ALOCK.
+            static constexpr auto RESERVED15 = std::uint_fast8_t{ 9 }; ///< RESERVED15.
+            static constexpr auto CPTEN0     = std::uint_fast8_t{ 1 }; ///< CPTEN0.
+            static constexpr auto CPTEN1     = std::uint_fast8_t{ 1 }; ///< CPTEN1.
+            static constexpr auto CPTEN2     = std::uint_fast8_t{ 1 }; ///< CPTEN2.
+            static constexpr auto CPTEN3     = std::uint_fast8_t{ 1 }; ///< CPTEN3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+            static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< RESERVED2.
+            static constexpr auto RESOLUTION = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< RESOLUTION.
+            static constexpr auto RESERVED7 = std::uint_fast8_t{ RESOLUTION + Size::RESOLUTION }; ///< RESERVED7.
+            static constexpr auto PRESCALER = std::uint_fast8_t{ RESERVED7 + Size::RESERVED7 }; ///< PRESCALER.
+            static constexpr auto RUNSTDBY = std::uint_fast8_t{ PRESCALER + Size::PRESCALER }; ///< RUNSTDBY.
+            static constexpr auto PRESCSYNC = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< PRESCSYNC.
+            static constexpr auto ALOCK = std::uint_fast8_t{ PRESCSYNC + Size::PRESCSYNC }; ///< ALOCK.
+            static constexpr auto RESERVED15 = std::uint_fast8_t{ ALOCK + Size::ALOCK }; ///< RESERVED15.
+            static constexpr auto CPTEN0 = std::uint_fast8_t{ RESERVED15 + Size::RESERVED15 }; ///< CPTEN0.
+            static constexpr auto CPTEN1 = std::uint_fast8_t{ CPTEN0 + Size::CPTEN0 }; ///< CPTEN1.
+            static constexpr auto CPTEN2 = std::uint_fast8_t{ CPTEN1 + Size::CPTEN1 }; ///< CPTEN2.
+            static constexpr auto CPTEN3 = std::uint_fast8_t{ CPTEN2 + Size::CPTEN2 }; ///< CPTEN3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ CPTEN3 + Size::CPTEN3 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SWRST = mask<std::uint32_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+            static constexpr auto ENABLE = mask<std::uint32_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+            static constexpr auto RESERVED2 = mask<std::uint32_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            static constexpr auto RESOLUTION = mask<std::uint32_t>( Size::RESOLUTION, Bit::RESOLUTION ); ///< RESOLUTION.
+            static constexpr auto RESERVED7 = mask<std::uint32_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+            static constexpr auto PRESCALER = mask<std::uint32_t>( Size::PRESCALER, Bit::PRESCALER ); ///< PRESCALER.
+            static constexpr auto RUNSTDBY = mask<std::uint32_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+            static constexpr auto PRESCSYNC = mask<std::uint32_t>( Size::PRESCSYNC, Bit::PRESCSYNC ); ///< PRESCSYNC.
+            static constexpr auto ALOCK = mask<std::uint32_t>( Size::ALOCK, Bit::ALOCK ); ///< ALOCK.
+            static constexpr auto RESERVED15 = mask<std::uint32_t>( Size::RESERVED15, Bit::RESERVED15 ); ///< RESERVED15.
+            static constexpr auto CPTEN0 = mask<std::uint32_t>( Size::CPTEN0, Bit::CPTEN0 ); ///< CPTEN0.
+            static constexpr auto CPTEN1 = mask<std::uint32_t>( Size::CPTEN1, Bit::CPTEN1 ); ///< CPTEN1.
+            static constexpr auto CPTEN2 = mask<std::uint32_t>( Size::CPTEN2, Bit::CPTEN2 ); ///< CPTEN2.
+            static constexpr auto CPTEN3 = mask<std::uint32_t>( Size::CPTEN3, Bit::CPTEN3 ); ///< CPTEN3.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        /**
+         * \brief RESOLUTION.
+         */
+        enum RESOLUTION : std::uint32_t {
+            RESOLUTION_NONE = 0x0 << Bit::RESOLUTION, ///< Dithering is disabled.
+            RESOLUTION_DITH4 = 0x1 << Bit::RESOLUTION, ///< Dithering is done every 16 PWM frames.
+            RESOLUTION_DITH5 = 0x2 << Bit::RESOLUTION, ///< Dithering is done every 32 PWM frames.
+            RESOLUTION_DITH6 = 0x3 << Bit::RESOLUTION, ///< Dithering is done every 64 PWM frames.
+        };
+
+        /**
+         * \brief PRESCALER.
+         */
+        enum PRESCALER : std::uint32_t {
+            PRESCALER_DIV1    = 0x0 << Bit::PRESCALER, ///< Prescaler: GCLK_TCC.
+            PRESCALER_DIV2    = 0x1 << Bit::PRESCALER, ///< Prescaler: GCLK_TCC/2.
+            PRESCALER_DIV4    = 0x2 << Bit::PRESCALER, ///< Prescaler: GCLK_TCC/4.
+            PRESCALER_DIV8    = 0x3 << Bit::PRESCALER, ///< Prescaler: GCLK_TCC/8.
+            PRESCALER_DIV16   = 0x4 << Bit::PRESCALER, ///< Prescaler: GCLK_TCC/16.
+            PRESCALER_DIV64   = 0x5 << Bit::PRESCALER, ///< Prescaler: GCLK_TCC/64.
+            PRESCALER_DIV256  = 0x6 << Bit::PRESCALER, ///< Prescaler: GCLK_TCC/256.
+            PRESCALER_DIV1024 = 0x7 << Bit::PRESCALER, ///< Prescaler: GCLK_TCC/1024.
+        };
+
+        /**
+         * \brief PRESCSYNC.
+         */
+        enum PRESCSYNC : std::uint32_t {
+            PRESCSYNC_GCLK = 0x0 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next generic clock.
+            PRESCSYNC_PRESC = 0x1 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next prescaler clock.
+            PRESCSYNC_RESYNC = 0x2 << Bit::PRESCSYNC, ///< Reload or reset the counter on the next generic clock, and reset the prescaler counter.
+        };
+
+        CTRLA() = delete;
+
+        CTRLA( CTRLA && ) = delete;
+
+        CTRLA( CTRLA const & ) = delete;
+
+        ~CTRLA() = delete;
+
+        auto operator=( CTRLA && ) = delete;
+
+        auto operator=( CTRLA const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Control B Clear (CTRLBCLR) register.
+     *
+     * This register has the following fields:
+     * - Counter Direction (DIR)
+     * - Lock Update (LUPD)
+     * - One-Shot (ONESHOT)
+     * - Ramp Index Command (IDXCMD)
+     * - TCC Command (CMD)
+     */
+    class CTRLBCLR : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto DIR     = std::uint_fast8_t{ 1 }; ///< DIR.
+            static constexpr auto LUPD    = std::uint_fast8_t{ 1 }; ///< LUPD.
+            static constexpr auto ONESHOT = std::uint_fast8_t{ 1 }; ///< ONESHOT.
+            static constexpr auto IDXCMD  = std::uint_fast8_t{ 2 }; ///< IDXCMD.
+            static constexpr auto CMD     = std::uint_fast8_t{ 3 }; ///< CMD.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto DIR  = std::uint_fast8_t{};                  ///< DIR.
+            static constexpr auto LUPD = std::uint_fast8_t{ DIR + Size::DIR }; ///< LUPD.
+            static constexpr auto ONESHOT = std::uint_fast8_t{ LUPD + Size::LUPD }; ///< ONESHOT.
+            static constexpr auto IDXCMD = std::uint_fast8_t{ ONESHOT + Size::ONESHOT }; ///< IDXCMD.
+            static constexpr auto CMD = std::uint_fast8_t{ IDXCMD + Size::IDXCMD }; ///< CMD.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto DIR = mask<std::uint8_t>( Size::DIR, Bit::DIR ); ///< DIR.
+            static constexpr auto LUPD = mask<std::uint8_t>( Size::LUPD, Bit::LUPD ); ///< LUPD.
+            static constexpr auto ONESHOT = mask<std::uint8_t>( Size::ONESHOT, Bit::ONESHOT ); ///< ONESHOT.
+            static constexpr auto IDXCMD = mask<std::uint8_t>( Size::IDXCMD, Bit::IDXCMD ); ///< IDXCMD.
+            static constexpr auto CMD = mask<std::uint8_t>( Size::CMD, Bit::CMD ); ///< CMD.
+        };
+
+        /**
+         * \brief IDXCMD.
+         */
+        enum IDXCMD : std::uint8_t {
+            IDXCMD_DISABLE = 0x0 << Bit::IDXCMD, ///< Command disabled: index toggles between cycles A and B.
+            IDXCMD_SET = 0x1 << Bit::IDXCMD, ///< Set index: cycle B will be forced in the next cycle.
+            IDXCMD_CLEAR = 0x2 << Bit::IDXCMD, ///< Clear index: cycle A will be forced in the next cycle.
+            IDXCMD_HOLD = 0x3 << Bit::IDXCMD, ///< Hold index: the next cycle will be the same as the current cycle.
+        };
+
+        /**
+         * \brief CMD.
+         */
+        enum CMD : std::uint8_t {
+            CMD_NONE      = 0x0 << Bit::CMD, ///< No action.
+            CMD_RETRIGGER = 0x1 << Bit::CMD, ///< Clear start, restart, or retrigger.
+            CMD_STOP      = 0x2 << Bit::CMD, ///< Force stop.
+            CMD_UPDATE = 0x3 << Bit::CMD, ///< Force update of double buffered registers.
+            CMD_READSYNC = 0x4 << Bit::CMD, ///< Force COUNT read synchronization.
+        };
+
+        CTRLBCLR() = delete;
+
+        CTRLBCLR( CTRLBCLR && ) = delete;
+
+        CTRLBCLR( CTRLBCLR const & ) = delete;
+
+        ~CTRLBCLR() = delete;
+
+        auto operator=( CTRLBCLR && ) = delete;
+
+        auto operator=( CTRLBCLR const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Control B Set (CTRLBSET) register.
+     *
+     * This register has the following fields:
+     * - Counter Direction (DIR)
+     * - Lock Update (LUPD)
+     * - One-Shot (ONESHOT)
+     * - Ramp Index Command (IDXCMD)
+     * - TCC Command (CMD)
+     */
+    class CTRLBSET : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto DIR     = std::uint_fast8_t{ 1 }; ///< DIR.
+            static constexpr auto LUPD    = std::uint_fast8_t{ 1 }; ///< LUPD.
+            static constexpr auto ONESHOT = std::uint_fast8_t{ 1 }; ///< ONESHOT.
+            static constexpr auto IDXCMD  = std::uint_fast8_t{ 2 }; ///< IDXCMD.
+            static constexpr auto CMD     = std::uint_fast8_t{ 3 }; ///< CMD.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto DIR  = std::uint_fast8_t{};                  ///< DIR.
+            static constexpr auto LUPD = std::uint_fast8_t{ DIR + Size::DIR }; ///< LUPD.
+            static constexpr auto ONESHOT = std::uint_fast8_t{ LUPD + Size::LUPD }; ///< ONESHOT.
+            static constexpr auto IDXCMD = std::uint_fast8_t{ ONESHOT + Size::ONESHOT }; ///< IDXCMD.
+            static constexpr auto CMD = std::uint_fast8_t{ IDXCMD + Size::IDXCMD }; ///< CMD.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto DIR = mask<std::uint8_t>( Size::DIR, Bit::DIR ); ///< DIR.
+            static constexpr auto LUPD = mask<std::uint8_t>( Size::LUPD, Bit::LUPD ); ///< LUPD.
+            static constexpr auto ONESHOT = mask<std::uint8_t>( Size::ONESHOT, Bit::ONESHOT ); ///< ONESHOT.
+            static constexpr auto IDXCMD = mask<std::uint8_t>( Size::IDXCMD, Bit::IDXCMD ); ///< IDXCMD.
+            static constexpr auto CMD = mask<std::uint8_t>( Size::CMD, Bit::CMD ); ///< CMD.
+        };
+
+        /**
+         * \brief IDXCMD.
+         */
+        enum IDXCMD : std::uint8_t {
+            IDXCMD_DISABLE = 0x0 << Bit::IDXCMD, ///< Command disabled: index toggles between cycles A and B.
+            IDXCMD_SET = 0x1 << Bit::IDXCMD, ///< Set index: cycle B will be forced in the next cycle.
+            IDXCMD_CLEAR = 0x2 << Bit::IDXCMD, ///< Clear index: cycle A will be forced in the next cycle.
+            IDXCMD_HOLD = 0x3 << Bit::IDXCMD, ///< Hold index: the next cycle will be the same as the current cycle.
+        };
+
+        /**
+         * \brief CMD.
+         */
+        enum CMD : std::uint8_t {
+            CMD_NONE      = 0x0 << Bit::CMD, ///< No action.
+            CMD_RETRIGGER = 0x1 << Bit::CMD, ///< Clear start, restart, or retrigger.
+            CMD_STOP      = 0x2 << Bit::CMD, ///< Force stop.
+            CMD_UPDATE = 0x3 << Bit::CMD, ///< Force update of double buffered registers.
+            CMD_READSYNC = 0x4 << Bit::CMD, ///< Force COUNT read synchronization.
+        };
+
+        CTRLBSET() = delete;
+
+        CTRLBSET( CTRLBSET && ) = delete;
+
+        CTRLBSET( CTRLBSET const & ) = delete;
+
+        ~CTRLBSET() = delete;
+
+        auto operator=( CTRLBSET && ) = delete;
+
+        auto operator=( CTRLBSET const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Synchronization Busy (SYNCBUSY) register.
+     *
+     * This register has the following fields:
+     * - Software Reset Busy (SWRST)
+     * - Enable Busy (ENABLE)
+     * - CTRLB Busy (CTRLB)
+     * - STATUS Busy (STATUS)
+     * - COUNT Busy (COUNT)
+     * - PATT Busy (PATT)
+     * - WAVE Busy (WAVE)
+     * - PER Busy (PER)
+     * - Compare Channel Busy 0 (CC0)
+     * - Compare Channel Busy 1 (CC1)
+     * - Compare Channel Busy 2 (CC2)
+     * - Compare Channel Busy 3 (CC3)
+     * - PATTB Busy (PATTB)
+     * - WAVEB Busy (WAVEB)
+     * - PERB Busy (PERB)
+     * - Compare Channel Buffer Busy 0 (CCB0)
+     * - Compare Channel Buffer Busy 1 (CCB1)
+     * - Compare Channel Buffer Busy 2 (CCB2)
+     * - Compare Channel Buffer Busy 3 (CCB3)
+     */
+    class SYNCBUSY : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SWRST      = std::uint_fast8_t{ 1 }; ///< SWRST.
+            static constexpr auto ENABLE     = std::uint_fast8_t{ 1 }; ///< ENABLE.
+            static constexpr auto CTRLB      = std::uint_fast8_t{ 1 }; ///< CTRLB.
+            static constexpr auto STATUS     = std::uint_fast8_t{ 1 }; ///< STATUS.
+            static constexpr auto COUNT      = std::uint_fast8_t{ 1 }; ///< COUNT.
+            static constexpr auto PATT       = std::uint_fast8_t{ 1 }; ///< PATT.
+            static constexpr auto WAVE       = std::uint_fast8_t{ 1 }; ///< WAVE.
+            static constexpr auto PER        = std::uint_fast8_t{ 1 }; ///< PER.
+            static constexpr auto CC0        = std::uint_fast8_t{ 1 }; ///< CC0.
+            static constexpr auto CC1        = std::uint_fast8_t{ 1 }; ///< CC1.
+            static constexpr auto CC2        = std::uint_fast8_t{ 1 }; ///< CC2.
+            static constexpr auto CC3        = std::uint_fast8_t{ 1 }; ///< CC3.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 4 }; ///< RESERVED12.
+            static constexpr auto PATTB      = std::uint_fast8_t{ 1 }; ///< PATTB.
+            static constexpr auto WAVEB      = std::uint_fast8_t{ 1 }; ///< WAVEB.
+            static constexpr auto PERB       = std::uint_fast8_t{ 1 }; ///< PERB.
+            static constexpr auto CCB0       = std::uint_fast8_t{ 1 }; ///< CCB0.
+            static constexpr auto CCB1       = std::uint_fast8_t{ 1 }; ///< CCB1.
+            static constexpr auto CCB2       = std::uint_fast8_t{ 1 }; ///< CCB2.
+            static constexpr auto CCB3       = std::uint_fast8_t{ 1 }; ///< CCB3.
+            static constexpr auto RESERVED23 = std::uint_fast8_t{ 9 }; ///< RESERVED23.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+            static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+            static constexpr auto CTRLB = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< CTRLB.
+            static constexpr auto STATUS = std::uint_fast8_t{ CTRLB + Size::CTRLB }; ///< STATUS.
+            static constexpr auto COUNT = std::uint_fast8_t{ STATUS + Size::STATUS }; ///< COUNT.
+            static constexpr auto PATT = std::uint_fast8_t{ COUNT + Size::COUNT }; ///< PATT.
+            static constexpr auto WAVE = std::uint_fast8_t{ PATT + Size::PATT }; ///< WAVE.
+            static constexpr auto PER  = std::uint_fast8_t{ WAVE + Size::WAVE }; ///< PER.
+            static constexpr auto CC0  = std::uint_fast8_t{ PER + Size::PER };   ///< CC0.
+            static constexpr auto CC1  = std::uint_fast8_t{ CC0 + Size::CC0 };   ///< CC1.
+            static constexpr auto CC2  = std::uint_fast8_t{ CC1 + Size::CC1 };   ///< CC2.
+            static constexpr auto CC3  = std::uint_fast8_t{ CC2 + Size::CC2 };   ///< CC3.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ CC3 + Size::CC3 }; ///< RESERVED12.
+            static constexpr auto PATTB = std::uint_fast8_t{ RESERVED12 + Size::RESERVED12 }; ///< PATTB.
+            static constexpr auto WAVEB = std::uint_fast8_t{ PATTB + Size::PATTB }; ///< WAVEB.
+            static constexpr auto PERB = std::uint_fast8_t{ WAVEB + Size::WAVEB }; ///< PERB.
+            static constexpr auto CCB0 = std::uint_fast8_t{ PERB + Size::PERB }; ///< CCB0.
+            static constexpr auto CCB1 = std::uint_fast8_t{ CCB0 + Size::CCB0 }; ///< CCB1.
+            static constexpr auto CCB2 = std::uint_fast8_t{ CCB1 + Size::CCB1 }; ///< CCB2.
+            static constexpr auto CCB3 = std::uint_fast8_t{ CCB2 + Size::CCB2 }; ///< CCB3.
+            static constexpr auto RESERVED23 = std::uint_fast8_t{ CCB3 + Size::CCB3 }; ///< RESERVED23.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SWRST = mask<std::uint32_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+            static constexpr auto ENABLE = mask<std::uint32_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+            static constexpr auto CTRLB = mask<std::uint32_t>( Size::CTRLB, Bit::CTRLB ); ///< CTRLB.
+            static constexpr auto STATUS = mask<std::uint32_t>( Size::STATUS, Bit::STATUS ); ///< STATUS.
+            static constexpr auto COUNT = mask<std::uint32_t>( Size::COUNT, Bit::COUNT ); ///< COUNT.
+            static constexpr auto PATT = mask<std::uint32_t>( Size::PATT, Bit::PATT ); ///< PATT.
+            static constexpr auto WAVE = mask<std::uint32_t>( Size::WAVE, Bit::WAVE ); ///< WAVE.
+            static constexpr auto PER = mask<std::uint32_t>( Size::PER, Bit::PER ); ///< PER.
+            static constexpr auto CC0 = mask<std::uint32_t>( Size::CC0, Bit::CC0 ); ///< CC0.
+            static constexpr auto CC1 = mask<std::uint32_t>( Size::CC1, Bit::CC1 ); ///< CC1.
+            static constexpr auto CC2 = mask<std::uint32_t>( Size::CC2, Bit::CC2 ); ///< CC2.
+            static constexpr auto CC3 = mask<std::uint32_t>( Size::CC3, Bit::CC3 ); ///< CC3.
+            static constexpr auto RESERVED12 = mask<std::uint32_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+            static constexpr auto PATTB = mask<std::uint32_t>( Size::PATTB, Bit::PATTB ); ///< PATTB.
+            static constexpr auto WAVEB = mask<std::uint32_t>( Size::WAVEB, Bit::WAVEB ); ///< WAVEB.
+            static constexpr auto PERB = mask<std::uint32_t>( Size::PERB, Bit::PERB ); ///< PERB.
+            static constexpr auto CCB0 = mask<std::uint32_t>( Size::CCB0, Bit::CCB0 ); ///< CCB0.
+            static constexpr auto CCB1 = mask<std::uint32_t>( Size::CCB1, Bit::CCB1 ); ///< CCB1.
+            static constexpr auto CCB2 = mask<std::uint32_t>( Size::CCB2, Bit::CCB2 ); ///< CCB2.
+            static constexpr auto CCB3 = mask<std::uint32_t>( Size::CCB3, Bit::CCB3 ); ///< CCB3.
+            static constexpr auto RESERVED23 = mask<std::uint32_t>( Size::RESERVED23, Bit::RESERVED23 ); ///< RESERVED23.
+        };
+
+        SYNCBUSY() = delete;
+
+        SYNCBUSY( SYNCBUSY && ) = delete;
+
+        SYNCBUSY( SYNCBUSY const & ) = delete;
+
+        ~SYNCBUSY() = delete;
+
+        auto operator=( SYNCBUSY && ) = delete;
+
+        auto operator=( SYNCBUSY const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Recoverable Fault A Configuration (FCTRLA) register.
+     *
+     * This register has the following fields:
+     * - Fault Source (SRC)
+     * - Fault Keeper (KEEP)
+     * - Fault Qualification (QUAL)
+     * - Fault Blanking Mode (BLANK)
+     * - Fault Restart (RESTART)
+     * - Fault Halt Mode (HALT)
+     * - Fault Capture Channel (CHSEL)
+     * - Fault Capture Action (CAPTURE)
+     * - Fault Blanking Time (BLANKVAL)
+     * - Fault Filter Value (FILTERVAL)
+     */
+    class FCTRLA : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SRC        = std::uint_fast8_t{ 2 }; ///< SRC.
+            static constexpr auto RESERVED2  = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+            static constexpr auto KEEP       = std::uint_fast8_t{ 1 }; ///< KEEP.
+            static constexpr auto QUAL       = std::uint_fast8_t{ 1 }; ///< QUAL.
+            static constexpr auto BLANK      = std::uint_fast8_t{ 2 }; ///< BLANK.
+            static constexpr auto RESTART    = std::uint_fast8_t{ 1 }; ///< RESTART.
+            static constexpr auto HALT       = std::uint_fast8_t{ 2 }; ///< HALT.
+            static constexpr auto CHSEL      = std::uint_fast8_t{ 2 }; ///< CHSEL.
+            static constexpr auto CAPTURE    = std::uint_fast8_t{ 3 }; ///< CAPTURE.
+            static constexpr auto RESERVED15 = std::uint_fast8_t{ 1 }; ///< RESERVED15.
+            static constexpr auto BLANKVAL   = std::uint_fast8_t{ 8 }; ///< BLANKVAL.
+            static constexpr auto FILTERVAL  = std::uint_fast8_t{ 4 }; ///< FILTERVAL.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SRC = std::uint_fast8_t{}; ///< SRC.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ SRC + Size::SRC }; ///< RESERVED2.
+            static constexpr auto KEEP = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< KEEP.
+            static constexpr auto QUAL = std::uint_fast8_t{ KEEP + Size::KEEP }; ///< QUAL.
+            static constexpr auto BLANK = std::uint_fast8_t{ QUAL + Size::QUAL }; ///< BLANK.
+            static constexpr auto RESTART = std::uint_fast8_t{ BLANK + Size::BLANK }; ///< RESTART.
+            static constexpr auto HALT = std::uint_fast8_t{ RESTART + Size::RESTART }; ///< HALT.
+            static constexpr auto CHSEL = std::uint_fast8_t{ HALT + Size::HALT }; ///< CHSEL.
+            static constexpr auto CAPTURE = std::uint_fast8_t{ CHSEL + Size::CHSEL }; ///< CAPTURE.
+            static constexpr auto RESERVED15 = std::uint_fast8_t{ CAPTURE + Size::CAPTURE }; ///< RESERVED15.
+            static constexpr auto BLANKVAL = std::uint_fast8_t{ RESERVED15 + Size::RESERVED15 }; ///< BLANKVAL.
+            static constexpr auto FILTERVAL = std::uint_fast8_t{ BLANKVAL + Size::BLANKVAL }; ///< FILTERVAL.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ FILTERVAL + Size::FILTERVAL }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SRC = mask<std::uint32_t>( Size::SRC, Bit::SRC ); ///< SRC.
+            static constexpr auto RESERVED2 = mask<std::uint32_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            static constexpr auto KEEP = mask<std::uint32_t>( Size::KEEP, Bit::KEEP ); ///< KEEP.
+            static constexpr auto QUAL = mask<std::uint32_t>( Size::QUAL, Bit::QUAL ); ///< QUAL.
+            static constexpr auto BLANK = mask<std::uint32_t>( Size::BLANK, Bit::BLANK ); ///< BLANK.
+            static constexpr auto RESTART = mask<std::uint32_t>( Size::RESTART, Bit::RESTART ); ///< RESTART.
+            static constexpr auto HALT = mask<std::uint32_t>( Size::HALT, Bit::HALT ); ///< HALT.
+            static constexpr auto CHSEL = mask<std::uint32_t>( Size::CHSEL, Bit::CHSEL ); ///< CHSEL.
+            static constexpr auto CAPTURE = mask<std::uint32_t>( Size::CAPTURE, Bit::CAPTURE ); ///< CAPTURE.
+            static constexpr auto RESERVED15 = mask<std::uint32_t>( Size::RESERVED15, Bit::RESERVED15 ); ///< RESERVED15.
+            static constexpr auto BLANKVAL = mask<std::uint32_t>( Size::BLANKVAL, Bit::BLANKVAL ); ///< BLANKVAL.
+            static constexpr auto FILTERVAL = mask<std::uint32_t>( Size::FILTERVAL, Bit::FILTERVAL ); ///< FILTERVAL.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        /**
+         * \brief SRC.
+         */
+        enum SRC : std::uint32_t {
+            SRC_DISABLE = 0x0 << Bit::SRC, ///< Fault input disabled.
+            SRC_ENABLE  = 0x1 << Bit::SRC, ///< MCEx (x=0,1) event input.
+            SRC_INVERT  = 0x2 << Bit::SRC, ///< Inverted MCEx (x=0,1) event input.
+            SRC_ALTFAULT = 0x3 << Bit::SRC, ///< Alternate fault (A or B) state at the end of the previous period.
+        };
+
+        /**
+         * \brief BLANK.
+         */
+        enum BLANK : std::uint32_t {
+            BLANK_NONE = 0x0 << Bit::BLANK, ///< No blanking applied.
+            BLANK_RISE = 0x1 << Bit::BLANK, ///< Blanking applied from rising edge of the output waveform.
+            BLANK_FALL = 0x2 << Bit::BLANK, ///< Blanking applied from falling edge of the output waveform.
+            BLANK_BOTH = 0x3 << Bit::BLANK, ///< Blanking applied from each toggle of the output waveform.
+        };
+
+        /**
+         * \brief HALT.
+         */
+        enum HALT : std::uint32_t {
+            HALT_DISABLE = 0x0 << Bit::HALT, ///< Halt action disabled.
+            HALT_HW      = 0x1 << Bit::HALT, ///< Hardware halt action.
+            HALT_SW      = 0x2 << Bit::HALT, ///< Software halt action.
+            HALT_NR      = 0x3 << Bit::HALT, ///< Non-recoverable fault.
+        };
+
+        /**
+         * \brief CHSEL.
+         */
+        enum CHSEL : std::uint32_t {
+            CHSEL_CC0 = 0x0 << Bit::CHSEL, ///< Capture value stored in channel 0.
+            CHSEL_CC1 = 0x1 << Bit::CHSEL, ///< Capture value stored in channel 1.
+            CHSEL_CC2 = 0x2 << Bit::CHSEL, ///< Capture value stored in channel 2.
+            CHSEL_CC3 = 0x3 << Bit::CHSEL, ///< Capture value stored in channel 3.
+        };
+
+        /**
+         * \brief CAPTURE.
+         */
+        enum CAPTURE : std::uint32_t {
+            CAPTURE_DISABLE = 0x0 << Bit::CAPTURE, ///< No capture.
+            CAPTURE_CAPT    = 0x1 << Bit::CAPTURE, ///< Capture on fault.
+            CAPTURE_CAPTMIN = 0x2 << Bit::CAPTURE, ///< Minimum capture.
+            CAPTURE_CAPTMAX = 0x3 << Bit::CAPTURE, ///< Maximum capture.
+            CAPTURE_LOCMIN  = 0x4 << Bit::CAPTURE, ///< Minimum local detection.
+            CAPTURE_LOCMAX  = 0x5 << Bit::CAPTURE, ///< Maximum local detection.
+            CAPTURE_DERIV0 = 0x6 << Bit::CAPTURE, ///< Minimum and maximum local detection.
+        };
+
+        FCTRLA() = delete;
+
+        FCTRLA( FCTRLA && ) = delete;
+
+        FCTRLA( FCTRLA const & ) = delete;
+
+        ~FCTRLA() = delete;
+
+        auto operator=( FCTRLA && ) = delete;
+
+        auto operator=( FCTRLA const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Recoverable Fault B Configuration (FCTRLB) register.
+     *
+     * This register has the following fields:
+     * - Fault Source (SRC)
+     * - Fault Keeper (KEEP)
+     * - Fault Qualification (QUAL)
+     * - Fault Blanking Mode (BLANK)
+     * - Fault Restart (RESTART)
+     * - Fault Halt Mode (HALT)
+     * - Fault Capture Channel (CHSEL)
+     * - Fault Capture Action (CAPTURE)
+     * - Fault Blanking Time (BLANKVAL)
+     * - Fault Filter Value (FILTERVAL)
+     */
+    class FCTRLB : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto SRC        = std::uint_fast8_t{ 2 }; ///< SRC.
+            static constexpr auto RESERVED2  = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+            static constexpr auto KEEP       = std::uint_fast8_t{ 1 }; ///< KEEP.
+            static constexpr auto QUAL       = std::uint_fast8_t{ 1 }; ///< QUAL.
+            static constexpr auto BLANK      = std::uint_fast8_t{ 2 }; ///< BLANK.
+            static constexpr auto RESTART    = std::uint_fast8_t{ 1 }; ///< RESTART.
+            static constexpr auto HALT       = std::uint_fast8_t{ 2 }; ///< HALT.
+            static constexpr auto CHSEL      = std::uint_fast8_t{ 2 }; ///< CHSEL.
+            static constexpr auto CAPTURE    = std::uint_fast8_t{ 3 }; ///< CAPTURE.
+            static constexpr auto RESERVED15 = std::uint_fast8_t{ 1 }; ///< RESERVED15.
+            static constexpr auto BLANKVAL   = std::uint_fast8_t{ 8 }; ///< BLANKVAL.
+            static constexpr auto FILTERVAL  = std::uint_fast8_t{ 4 }; ///< FILTERVAL.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto SRC = std::uint_fast8_t{}; ///< SRC.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ SRC + Size::SRC }; ///< RESERVED2.
+            static constexpr auto KEEP = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< KEEP.
+            static constexpr auto QUAL = std::uint_fast8_t{ KEEP + Size::KEEP }; ///< QUAL.
+            static constexpr auto BLANK = std::uint_fast8_t{ QUAL + Size::QUAL }; ///< BLANK.
+            static constexpr auto RESTART = std::uint_fast8_t{ BLANK + Size::BLANK }; ///< RESTART.
+            static constexpr auto HALT = std::uint_fast8_t{ RESTART + Size::RESTART }; ///< HALT.
+            static constexpr auto CHSEL = std::uint_fast8_t{ HALT + Size::HALT }; ///< CHSEL.
+            static constexpr auto CAPTURE = std::uint_fast8_t{ CHSEL + Size::CHSEL }; ///< CAPTURE.
+            static constexpr auto RESERVED15 = std::uint_fast8_t{ CAPTURE + Size::CAPTURE }; ///< RESERVED15.
+            static constexpr auto BLANKVAL = std::uint_fast8_t{ RESERVED15 + Size::RESERVED15 }; ///< BLANKVAL.
+            static constexpr auto FILTERVAL = std::uint_fast8_t{ BLANKVAL + Size::BLANKVAL }; ///< FILTERVAL.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ FILTERVAL + Size::FILTERVAL }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto SRC = mask<std::uint32_t>( Size::SRC, Bit::SRC ); ///< SRC.
+            static constexpr auto RESERVED2 = mask<std::uint32_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            static constexpr auto KEEP = mask<std::uint32_t>( Size::KEEP, Bit::KEEP ); ///< KEEP.
+            static constexpr auto QUAL = mask<std::uint32_t>( Size::QUAL, Bit::QUAL ); ///< QUAL.
+            static constexpr auto BLANK = mask<std::uint32_t>( Size::BLANK, Bit::BLANK ); ///< BLANK.
+            static constexpr auto RESTART = mask<std::uint32_t>( Size::RESTART, Bit::RESTART ); ///< RESTART.
+            static constexpr auto HALT = mask<std::uint32_t>( Size::HALT, Bit::HALT ); ///< HALT.
+            static constexpr auto CHSEL = mask<std::uint32_t>( Size::CHSEL, Bit::CHSEL ); ///< CHSEL.
+            static constexpr auto CAPTURE = mask<std::uint32_t>( Size::CAPTURE, Bit::CAPTURE ); ///< CAPTURE.
+            static constexpr auto RESERVED15 = mask<std::uint32_t>( Size::RESERVED15, Bit::RESERVED15 ); ///< RESERVED15.
+            static constexpr auto BLANKVAL = mask<std::uint32_t>( Size::BLANKVAL, Bit::BLANKVAL ); ///< BLANKVAL.
+            static constexpr auto FILTERVAL = mask<std::uint32_t>( Size::FILTERVAL, Bit::FILTERVAL ); ///< FILTERVAL.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        /**
+         * \brief SRC.
+         */
+        enum SRC : std::uint32_t {
+            SRC_DISABLE = 0x0 << Bit::SRC, ///< Fault input disabled.
+            SRC_ENABLE  = 0x1 << Bit::SRC, ///< MCEx (x=0,1) event input.
+            SRC_INVERT  = 0x2 << Bit::SRC, ///< Inverted MCEx (x=0,1) event input.
+            SRC_ALTFAULT = 0x3 << Bit::SRC, ///< Alternate fault (A or B) state at the end of the previous period.
+        };
+
+        /**
+         * \brief BLANK.
+         */
+        enum BLANK : std::uint32_t {
+            BLANK_NONE = 0x0 << Bit::BLANK, ///< No blanking applied.
+            BLANK_RISE = 0x1 << Bit::BLANK, ///< Blanking applied from rising edge of the output waveform.
+            BLANK_FALL = 0x2 << Bit::BLANK, ///< Blanking applied from falling edge of the output waveform.
+            BLANK_BOTH = 0x3 << Bit::BLANK, ///< Blanking applied from each toggle of the output waveform.
+        };
+
+        /**
+         * \brief HALT.
+         */
+        enum HALT : std::uint32_t {
+            HALT_DISABLE = 0x0 << Bit::HALT, ///< Halt action disabled.
+            HALT_HW      = 0x1 << Bit::HALT, ///< Hardware halt action.
+            HALT_SW      = 0x2 << Bit::HALT, ///< Software halt action.
+            HALT_NR      = 0x3 << Bit::HALT, ///< Non-recoverable fault.
+        };
+
+        /**
+         * \brief CHSEL.
+         */
+        enum CHSEL : std::uint32_t {
+            CHSEL_CC0 = 0x0 << Bit::CHSEL, ///< Capture value stored in channel 0.
+            CHSEL_CC1 = 0x1 << Bit::CHSEL, ///< Capture value stored in channel 1.
+            CHSEL_CC2 = 0x2 << Bit::CHSEL, ///< Capture value stored in channel 2.
+            CHSEL_CC3 = 0x3 << Bit::CHSEL, ///< Capture value stored in channel 3.
+        };
+
+        /**
+         * \brief CAPTURE.
+         */
+        enum CAPTURE : std::uint32_t {
+            CAPTURE_DISABLE = 0x0 << Bit::CAPTURE, ///< No capture.
+            CAPTURE_CAPT    = 0x1 << Bit::CAPTURE, ///< Capture on fault.
+            CAPTURE_CAPTMIN = 0x2 << Bit::CAPTURE, ///< Minimum capture.
+            CAPTURE_CAPTMAX = 0x3 << Bit::CAPTURE, ///< Maximum capture.
+            CAPTURE_LOCMIN  = 0x4 << Bit::CAPTURE, ///< Minimum local detection.
+            CAPTURE_LOCMAX  = 0x5 << Bit::CAPTURE, ///< Maximum local detection.
+            CAPTURE_DERIV0 = 0x6 << Bit::CAPTURE, ///< Minimum and maximum local detection.
+        };
+
+        FCTRLB() = delete;
+
+        FCTRLB( FCTRLB && ) = delete;
+
+        FCTRLB( FCTRLB const & ) = delete;
+
+        ~FCTRLB() = delete;
+
+        auto operator=( FCTRLB && ) = delete;
+
+        auto operator=( FCTRLB const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Waveform Extension Configuration (WEXCTRL) register.
+     *
+     * This register has the following fields:
+     * - Output Matrix (OTMX)
+     * - Dead-time Insertion Generator Enable 0 (DTIEN0)
+     * - Dead-time Insertion Generator Enable 1 (DTIEN1)
+     * - Dead-time Insertion Generator Enable 2 (DTIEN2)
+     * - Dead-time Insertion Generator Enable 3 (DTIEN3)
+     * - Dead-time Low Side Outputs Value (DTLS)
+     * - Dead-time High Side Outputs Value (DTHS)
+     */
+    class WEXCTRL : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto OTMX       = std::uint_fast8_t{ 2 }; ///< OTMX.
+            static constexpr auto RESERVED2  = std::uint_fast8_t{ 6 }; ///< RESERVED2.
+            static constexpr auto DTIEN0     = std::uint_fast8_t{ 1 }; ///< DTIEN0.
+            static constexpr auto DTIEN1     = std::uint_fast8_t{ 1 }; ///< DTIEN1.
+            static constexpr auto DTIEN2     = std::uint_fast8_t{ 1 }; ///< DTIEN2.
+            static constexpr auto DTIEN3     = std::uint_fast8_t{ 1 }; ///< DTIEN3.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 4 }; ///< RESERVED12.
+            static constexpr auto DTLS       = std::uint_fast8_t{ 8 }; ///< DTLS.
+            static constexpr auto DTHS       = std::uint_fast8_t{ 8 }; ///< DTHS.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto OTMX = std::uint_fast8_t{}; ///< OTMX.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ OTMX + Size::OTMX }; ///< RESERVED2.
+            static constexpr auto DTIEN0 = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< DTIEN0.
+            static constexpr auto DTIEN1 = std::uint_fast8_t{ DTIEN0 + Size::DTIEN0 }; ///< DTIEN1.
+            static constexpr auto DTIEN2 = std::uint_fast8_t{ DTIEN1 + Size::DTIEN1 }; ///< DTIEN2.
+            static constexpr auto DTIEN3 = std::uint_fast8_t{ DTIEN2 + Size::DTIEN2 }; ///< DTIEN3.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ DTIEN3 + Size::DTIEN3 }; ///< RESERVED12.
+            static constexpr auto DTLS = std::uint_fast8_t{ RESERVED12 + Size::RESERVED12 }; ///< DTLS.
+            static constexpr auto DTHS = std::uint_fast8_t{ DTLS + Size::DTLS }; ///< DTHS.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto OTMX = mask<std::uint32_t>( Size::OTMX, Bit::OTMX ); ///< OTMX.
+            static constexpr auto RESERVED2 = mask<std::uint32_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            static constexpr auto DTIEN0 = mask<std::uint32_t>( Size::DTIEN0, Bit::DTIEN0 ); ///< DTIEN0.
+            static constexpr auto DTIEN1 = mask<std::uint32_t>( Size::DTIEN1, Bit::DTIEN1 ); ///< DTIEN1.
+            static constexpr auto DTIEN2 = mask<std::uint32_t>( Size::DTIEN2, Bit::DTIEN2 ); ///< DTIEN2.
+            static constexpr auto DTIEN3 = mask<std::uint32_t>( Size::DTIEN3, Bit::DTIEN3 ); ///< DTIEN3.
+            static constexpr auto RESERVED12 = mask<std::uint32_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+            static constexpr auto DTLS = mask<std::uint32_t>( Size::DTLS, Bit::DTLS ); ///< DTLS.
+            static constexpr auto DTHS = mask<std::uint32_t>( Size::DTHS, Bit::DTHS ); ///< DTHS.
+        };
+
+        WEXCTRL() = delete;
+
+        WEXCTRL( WEXCTRL && ) = delete;
+
+        WEXCTRL( WEXCTRL const & ) = delete;
+
+        ~WEXCTRL() = delete;
+
+        auto operator=( WEXCTRL && ) = delete;
+
+        auto operator=( WEXCTRL const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Driver Control (DRVCTRL) register.
+     *
+     * This register has the following fields:
+     * - Non-Recoverable State Output Enable 0 (NRE0)
+     * - Non-Recoverable State Output Enable 1 (NRE1)
+     * - Non-Recoverable State Output Enable 2 (NRE2)
+     * - Non-Recoverable State Output Enable 3 (NRE3)
+     * - Non-Recoverable State Output Enable 4 (NRE4)
+     * - Non-Recoverable State Output Enable 5 (NRE5)
+     * - Non-Recoverable State Output Enable 6 (NRE6)
+     * - Non-Recoverable State Output Enable 7 (NRE7)
+     * - Non-Recoverable State Output Value 0 (NRV0)
+     * - Non-Recoverable State Output Value 1 (NRV1)
+     * - Non-Recoverable State Output Value 2 (NRV2)
+     * - Non-Recoverable State Output Value 3 (NRV3)
+     * - Non-Recoverable State Output Value 4 (NRV4)
+     * - Non-Recoverable State Output Value 5 (NRV5)
+     * - Non-Recoverable State Output Value 6 (NRV6)
+     * - Non-Recoverable State Output Value 7 (NRV7)
+     * - Output Waveform Invert Enable 0 (INVEN0)
+     * - Output Waveform Invert Enable 1 (INVEN1)
+     * - Output Waveform Invert Enable 2 (INVEN2)
+     * - Output Waveform Invert Enable 3 (INVEN3)
+     * - Output Waveform Invert Enable 4 (INVEN4)
+     * - Output Waveform Invert Enable 5 (INVEN5)
+     * - Output Waveform Invert Enable 6 (INVEN6)
+     * - Output Waveform Invert Enable 7 (INVEN7)
+     * - Non-Recoverable Fault Input 0 Filter Value (FILTERVAL0)
+     * - Non-Recoverable Fault Input 1 Filter Value (FILTERVAL1)
+     */
+    class DRVCTRL : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto NRE0       = std::uint_fast8_t{ 1 }; ///< NRE0.
+            static constexpr auto NRE1       = std::uint_fast8_t{ 1 }; ///< NRE1.
+            static constexpr auto NRE2       = std::uint_fast8_t{ 1 }; ///< NRE2.
+            static constexpr auto NRE3       = std::uint_fast8_t{ 1 }; ///< NRE3.
+            static constexpr auto NRE4       = std::uint_fast8_t{ 1 }; ///< NRE4.
+            static constexpr auto NRE5       = std::uint_fast8_t{ 1 }; ///< NRE5.
+            static constexpr auto NRE6       = std::uint_fast8_t{ 1 }; ///< NRE6.
+            static constexpr auto NRE7       = std::uint_fast8_t{ 1 }; ///< NRE7.
+            static constexpr auto NRV0       = std::uint_fast8_t{ 1 }; ///< NRV0.
+            static constexpr auto NRV1       = std::uint_fast8_t{ 1 }; ///< NRV1.
+            static constexpr auto NRV2       = std::uint_fast8_t{ 1 }; ///< NRV2.
+            static constexpr auto NRV3       = std::uint_fast8_t{ 1 }; ///< NRV3.
+            static constexpr auto NRV4       = std::uint_fast8_t{ 1 }; ///< NRV4.
+            static constexpr auto NRV5       = std::uint_fast8_t{ 1 }; ///< NRV5.
+            static constexpr auto NRV6       = std::uint_fast8_t{ 1 }; ///< NRV6.
+            static constexpr auto NRV7       = std::uint_fast8_t{ 1 }; ///< NRV7.
+            static constexpr auto INVEN0     = std::uint_fast8_t{ 1 }; ///< INVEN0.
+            static constexpr auto INVEN1     = std::uint_fast8_t{ 1 }; ///< INVEN1.
+            static constexpr auto INVEN2     = std::uint_fast8_t{ 1 }; ///< INVEN2.
+            static constexpr auto INVEN3     = std::uint_fast8_t{ 1 }; ///< INVEN3.
+            static constexpr auto INVEN4     = std::uint_fast8_t{ 1 }; ///< INVEN4.
+            static constexpr auto INVEN5     = std::uint_fast8_t{ 1 }; ///< INVEN5.
+            static constexpr auto INVEN6     = std::uint_fast8_t{ 1 }; ///< INVEN6.
+            static constexpr auto INVEN7     = std::uint_fast8_t{ 1 }; ///< INVEN7.
+            static constexpr auto FILTERVAL0 = std::uint_fast8_t{ 4 }; ///< FILTERVAL0.
+            static constexpr auto FILTERVAL1 = std::uint_fast8_t{ 4 }; ///< FILTERVAL1.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto NRE0 = std::uint_fast8_t{}; ///< NRE0.
+            static constexpr auto NRE1 = std::uint_fast8_t{ NRE0 + Size::NRE0 }; ///< NRE1.
+            static constexpr auto NRE2 = std::uint_fast8_t{ NRE1 + Size::NRE1 }; ///< NRE2.
+            static constexpr auto NRE3 = std::uint_fast8_t{ NRE2 + Size::NRE2 }; ///< NRE3.
+            static constexpr auto NRE4 = std::uint_fast8_t{ NRE3 + Size::NRE3 }; ///< NRE4.
+            static constexpr auto NRE5 = std::uint_fast8_t{ NRE4 + Size::NRE4 }; ///< NRE5.
+            static constexpr auto NRE6 = std::uint_fast8_t{ NRE5 + Size::NRE5 }; ///< NRE6.
+            static constexpr auto NRE7 = std::uint_fast8_t{ NRE6 + Size::NRE6 }; ///< NRE7.
+            static constexpr auto NRV0 = std::uint_fast8_t{ NRE7 + Size::NRE7 }; ///< NRV0.
+            static constexpr auto NRV1 = std::uint_fast8_t{ NRV0 + Size::NRV0 }; ///< NRV1.
+            static constexpr auto NRV2 = std::uint_fast8_t{ NRV1 + Size::NRV1 }; ///< NRV2.
+            static constexpr auto NRV3 = std::uint_fast8_t{ NRV2 + Size::NRV2 }; ///< NRV3.
+            static constexpr auto NRV4 = std::uint_fast8_t{ NRV3 + Size::NRV3 }; ///< NRV4.
+            static constexpr auto NRV5 = std::uint_fast8_t{ NRV4 + Size::NRV4 }; ///< NRV5.
+            static constexpr auto NRV6 = std::uint_fast8_t{ NRV5 + Size::NRV5 }; ///< NRV6.
+            static constexpr auto NRV7 = std::uint_fast8_t{ NRV6 + Size::NRV6 }; ///< NRV7.
+            static constexpr auto INVEN0 = std::uint_fast8_t{ NRV7 + Size::NRV7 }; ///< INVEN0.
+            static constexpr auto INVEN1 = std::uint_fast8_t{ INVEN0 + Size::INVEN0 }; ///< INVEN1.
+            static constexpr auto INVEN2 = std::uint_fast8_t{ INVEN1 + Size::INVEN1 }; ///< INVEN2.
+            static constexpr auto INVEN3 = std::uint_fast8_t{ INVEN2 + Size::INVEN2 }; ///< INVEN3.
+            static constexpr auto INVEN4 = std::uint_fast8_t{ INVEN3 + Size::INVEN3 }; ///< INVEN4.
+            static constexpr auto INVEN5 = std::uint_fast8_t{ INVEN4 + Size::INVEN4 }; ///< INVEN5.
+            static constexpr auto INVEN6 = std::uint_fast8_t{ INVEN5 + Size::INVEN5 }; ///< INVEN6.
+            static constexpr auto INVEN7 = std::uint_fast8_t{ INVEN6 + Size::INVEN6 }; ///< INVEN7.
+            static constexpr auto FILTERVAL0 = std::uint_fast8_t{ INVEN7 + Size::INVEN7 }; ///< FILTERVAL0.
+            static constexpr auto FILTERVAL1 = std::uint_fast8_t{ FILTERVAL0 + Size::FILTERVAL0 }; ///< FILTERVAL1.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto NRE0 = mask<std::uint32_t>( Size::NRE0, Bit::NRE0 ); ///< NRE0.
+            static constexpr auto NRE1 = mask<std::uint32_t>( Size::NRE1, Bit::NRE1 ); ///< NRE1.
+            static constexpr auto NRE2 = mask<std::uint32_t>( Size::NRE2, Bit::NRE2 ); ///< NRE2.
+            static constexpr auto NRE3 = mask<std::uint32_t>( Size::NRE3, Bit::NRE3 ); ///< NRE3.
+            static constexpr auto NRE4 = mask<std::uint32_t>( Size::NRE4, Bit::NRE4 ); ///< NRE4.
+            static constexpr auto NRE5 = mask<std::uint32_t>( Size::NRE5, Bit::NRE5 ); ///< NRE5.
+            static constexpr auto NRE6 = mask<std::uint32_t>( Size::NRE6, Bit::NRE6 ); ///< NRE6.
+            static constexpr auto NRE7 = mask<std::uint32_t>( Size::NRE7, Bit::NRE7 ); ///< NRE7.
+            static constexpr auto NRV0 = mask<std::uint32_t>( Size::NRV0, Bit::NRV0 ); ///< NRV0.
+            static constexpr auto NRV1 = mask<std::uint32_t>( Size::NRV1, Bit::NRV1 ); ///< NRV1.
+            static constexpr auto NRV2 = mask<std::uint32_t>( Size::NRV2, Bit::NRV2 ); ///< NRV2.
+            static constexpr auto NRV3 = mask<std::uint32_t>( Size::NRV3, Bit::NRV3 ); ///< NRV3.
+            static constexpr auto NRV4 = mask<std::uint32_t>( Size::NRV4, Bit::NRV4 ); ///< NRV4.
+            static constexpr auto NRV5 = mask<std::uint32_t>( Size::NRV5, Bit::NRV5 ); ///< NRV5.
+            static constexpr auto NRV6 = mask<std::uint32_t>( Size::NRV6, Bit::NRV6 ); ///< NRV6.
+            static constexpr auto NRV7 = mask<std::uint32_t>( Size::NRV7, Bit::NRV7 ); ///< NRV7.
+            static constexpr auto INVEN0 = mask<std::uint32_t>( Size::INVEN0, Bit::INVEN0 ); ///< INVEN0.
+            static constexpr auto INVEN1 = mask<std::uint32_t>( Size::INVEN1, Bit::INVEN1 ); ///< INVEN1.
+            static constexpr auto INVEN2 = mask<std::uint32_t>( Size::INVEN2, Bit::INVEN2 ); ///< INVEN2.
+            static constexpr auto INVEN3 = mask<std::uint32_t>( Size::INVEN3, Bit::INVEN3 ); ///< INVEN3.
+            static constexpr auto INVEN4 = mask<std::uint32_t>( Size::INVEN4, Bit::INVEN4 ); ///< INVEN4.
+            static constexpr auto INVEN5 = mask<std::uint32_t>( Size::INVEN5, Bit::INVEN5 ); ///< INVEN5.
+            static constexpr auto INVEN6 = mask<std::uint32_t>( Size::INVEN6, Bit::INVEN6 ); ///< INVEN6.
+            static constexpr auto INVEN7 = mask<std::uint32_t>( Size::INVEN7, Bit::INVEN7 ); ///< INVEN7.
+            static constexpr auto FILTERVAL0 = mask<std::uint32_t>( Size::FILTERVAL0, Bit::FILTERVAL0 ); ///< FILTERVAL0.
+            static constexpr auto FILTERVAL1 = mask<std::uint32_t>( Size::FILTERVAL1, Bit::FILTERVAL1 ); ///< FILTERVAL1.
+        };
+
+        DRVCTRL() = delete;
+
+        DRVCTRL( DRVCTRL && ) = delete;
+
+        DRVCTRL( DRVCTRL const & ) = delete;
+
+        ~DRVCTRL() = delete;
+
+        auto operator=( DRVCTRL && ) = delete;
+
+        auto operator=( DRVCTRL const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Debug Control (DBGCTRL) register.
+     *
+     * This register has the following fields:
+     * - Debug Running Mode (DBGRUN)
+     * - Fault Detection on Debug Break Detection (FDDBD)
+     */
+    class DBGCTRL : public Register<std::uint8_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto DBGRUN    = std::uint_fast8_t{ 1 }; ///< DBGRUN.
+            static constexpr auto RESERVED1 = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+            static constexpr auto FDDBD     = std::uint_fast8_t{ 1 }; ///< FDDBD.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ 5 }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto DBGRUN = std::uint_fast8_t{}; ///< DBGRUN.
+            static constexpr auto RESERVED1 = std::uint_fast8_t{ DBGRUN + Size::DBGRUN }; ///< RESERVED1.
+            static constexpr auto FDDBD = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< FDDBD.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ FDDBD + Size::FDDBD }; ///< RESERVED3.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto DBGRUN = mask<std::uint8_t>( Size::DBGRUN, Bit::DBGRUN ); ///< DBGRUN.
+            static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+            static constexpr auto FDDBD = mask<std::uint8_t>( Size::FDDBD, Bit::FDDBD ); ///< FDDBD.
+            static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+        };
+
+        DBGCTRL() = delete;
+
+        DBGCTRL( DBGCTRL && ) = delete;
+
+        DBGCTRL( DBGCTRL const & ) = delete;
+
+        ~DBGCTRL() = delete;
+
+        auto operator=( DBGCTRL && ) = delete;
+
+        auto operator=( DBGCTRL const & ) = delete;
+
+        using Register<std::uint8_t>::operator=;
+    };
+
+    /**
+     * \brief Event Control (EVCTRL) register.
+     *
+     * This register has the following fields:
+     * - Timer/Counter Input Event 0 Action (EVACT0)
+     * - Timer/Counter Input Event 1 Action (EVACT1)
+     * - Timer/Counter Output Event Mode (CNTSEL)
+     * - Overflow/Underflow Output Event Enable (OVFEO)
+     * - Retrigger Output Event Enable (TRGEO)
+     * - Timer/Counter Output Event Enable (CNTEO)
+     * - Inverted Event Input Enable 0 (TCINV0)
+     * - Inverted Event Input Enable 1 (TCINV1)
+     * - Timer/Counter Event Input Enable 0 (TCEI0)
+     * - Timer/Counter Event Input Enable 1 (TCEI1)
+     * - Match or Capture Channel Event Input Enable 0 (MCEI0)
+     * - Match or Capture Channel Event Input Enable 1 (MCEI1)
+     * - Match or Capture Channel Event Input Enable 2 (MCEI2)
+     * - Match or Capture Channel Event Input Enable 3 (MCEI3)
+     * - Match or Capture Channel Event Output Enable 0 (MCEO0)
+     * - Match or Capture Channel Event Output Enable 1 (MCEO1)
+     * - Match or Capture Channel Event Output Enable 2 (MCEO2)
+     * - Match or Capture Channel Event Output Enable 3 (MCEO3)
+     */
+    class EVCTRL : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto EVACT0     = std::uint_fast8_t{ 3 }; ///< EVACT0.
+            static constexpr auto EVACT1     = std::uint_fast8_t{ 3 }; ///< EVACT1.
+            static constexpr auto CNTSEL     = std::uint_fast8_t{ 2 }; ///< CNTSEL.
+            static constexpr auto OVFEO      = std::uint_fast8_t{ 1 }; ///< OVFEO.
+            static constexpr auto TRGEO      = std::uint_fast8_t{ 1 }; ///< TRGEO.
+            static constexpr auto CNTEO      = std::uint_fast8_t{ 1 }; ///< CNTEO.
+            static constexpr auto RESERVED11 = std::uint_fast8_t{ 1 }; ///< RESERVED11.
+            static constexpr auto TCINV0     = std::uint_fast8_t{ 1 }; ///< TCINV0.
+            static constexpr auto TCINV1     = std::uint_fast8_t{ 1 }; ///< TCINV1.
+            static constexpr auto TCEI0      = std::uint_fast8_t{ 1 }; ///< TCEI0.
+            static constexpr auto TCEI1      = std::uint_fast8_t{ 1 }; ///< TCEI1.
+            static constexpr auto MCEI0      = std::uint_fast8_t{ 1 }; ///< MCEI0.
+            static constexpr auto MCEI1      = std::uint_fast8_t{ 1 }; ///< MCEI1.
+            static constexpr auto MCEI2      = std::uint_fast8_t{ 1 }; ///< MCEI2.
+            static constexpr auto MCEI3      = std::uint_fast8_t{ 1 }; ///< MCEI3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 4 }; ///< RESERVED20.
+            static constexpr auto MCEO0      = std::uint_fast8_t{ 1 }; ///< MCEO0.
+            static constexpr auto MCEO1      = std::uint_fast8_t{ 1 }; ///< MCEO1.
+            static constexpr auto MCEO2      = std::uint_fast8_t{ 1 }; ///< MCEO2.
+            static constexpr auto MCEO3      = std::uint_fast8_t{ 1 }; ///< MCEO3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto EVACT0 = std::uint_fast8_t{}; ///< EVACT0.
+            static constexpr auto EVACT1 = std::uint_fast8_t{ EVACT0 + Size::EVACT0 }; ///< EVACT1.
+            static constexpr auto CNTSEL = std::uint_fast8_t{ EVACT1 + Size::EVACT1 }; ///< CNTSEL.
+            static constexpr auto OVFEO = std::uint_fast8_t{ CNTSEL + Size::CNTSEL }; ///< OVFEO.
+            static constexpr auto TRGEO = std::uint_fast8_t{ OVFEO + Size::OVFEO }; ///< TRGEO.
+            static constexpr auto CNTEO = std::uint_fast8_t{ TRGEO + Size::TRGEO }; ///< CNTEO.
+            static constexpr auto RESERVED11 = std::uint_fast8_t{ CNTEO + Size::CNTEO }; ///< RESERVED11.
+            static constexpr auto TCINV0 = std::uint_fast8_t{ RESERVED11 + Size::RESERVED11 }; ///< TCINV0.
+            static constexpr auto TCINV1 = std::uint_fast8_t{ TCINV0 + Size::TCINV0 }; ///< TCINV1.
+            static constexpr auto TCEI0 = std::uint_fast8_t{ TCINV1 + Size::TCINV1 }; ///< TCEI0.
+            static constexpr auto TCEI1 = std::uint_fast8_t{ TCEI0 + Size::TCEI0 }; ///< TCEI1.
+            static constexpr auto MCEI0 = std::uint_fast8_t{ TCEI1 + Size::TCEI1 }; ///< MCEI0.
+            static constexpr auto MCEI1 = std::uint_fast8_t{ MCEI0 + Size::MCEI0 }; ///< MCEI1.
+            static constexpr auto MCEI2 = std::uint_fast8_t{ MCEI1 + Size::MCEI1 }; ///< MCEI2.
+            static constexpr auto MCEI3 = std::uint_fast8_t{ MCEI2 + Size::MCEI2 }; ///< MCEI3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ MCEI3 + Size::MCEI3 }; ///< RESERVED20.
+            static constexpr auto MCEO0 = std::uint_fast8_t{ RESERVED20 + Size::RESERVED20 }; ///< MCEO0.
+            static constexpr auto MCEO1 = std::uint_fast8_t{ MCEO0 + Size::MCEO0 }; ///< MCEO1.
+            static constexpr auto MCEO2 = std::uint_fast8_t{ MCEO1 + Size::MCEO1 }; ///< MCEO2.
+            static constexpr auto MCEO3 = std::uint_fast8_t{ MCEO2 + Size::MCEO2 }; ///< MCEO3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ MCEO3 + Size::MCEO3 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto EVACT0 = mask<std::uint32_t>( Size::EVACT0, Bit::EVACT0 ); ///< EVACT0.
+            static constexpr auto EVACT1 = mask<std::uint32_t>( Size::EVACT1, Bit::EVACT1 ); ///< EVACT1.
+            static constexpr auto CNTSEL = mask<std::uint32_t>( Size::CNTSEL, Bit::CNTSEL ); ///< CNTSEL.
+            static constexpr auto OVFEO = mask<std::uint32_t>( Size::OVFEO, Bit::OVFEO ); ///< OVFEO.
+            static constexpr auto TRGEO = mask<std::uint32_t>( Size::TRGEO, Bit::TRGEO ); ///< TRGEO.
+            static constexpr auto CNTEO = mask<std::uint32_t>( Size::CNTEO, Bit::CNTEO ); ///< CNTEO.
+            static constexpr auto RESERVED11 = mask<std::uint32_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+            static constexpr auto TCINV0 = mask<std::uint32_t>( Size::TCINV0, Bit::TCINV0 ); ///< TCINV0.
+            static constexpr auto TCINV1 = mask<std::uint32_t>( Size::TCINV1, Bit::TCINV1 ); ///< TCINV1.
+            static constexpr auto TCEI0 = mask<std::uint32_t>( Size::TCEI0, Bit::TCEI0 ); ///< TCEI0.
+            static constexpr auto TCEI1 = mask<std::uint32_t>( Size::TCEI1, Bit::TCEI1 ); ///< TCEI1.
+            static constexpr auto MCEI0 = mask<std::uint32_t>( Size::MCEI0, Bit::MCEI0 ); ///< MCEI0.
+            static constexpr auto MCEI1 = mask<std::uint32_t>( Size::MCEI1, Bit::MCEI1 ); ///< MCEI1.
+            static constexpr auto MCEI2 = mask<std::uint32_t>( Size::MCEI2, Bit::MCEI2 ); ///< MCEI2.
+            static constexpr auto MCEI3 = mask<std::uint32_t>( Size::MCEI3, Bit::MCEI3 ); ///< MCEI3.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+            static constexpr auto MCEO0 = mask<std::uint32_t>( Size::MCEO0, Bit::MCEO0 ); ///< MCEO0.
+            static constexpr auto MCEO1 = mask<std::uint32_t>( Size::MCEO1, Bit::MCEO1 ); ///< MCEO1.
+            static constexpr auto MCEO2 = mask<std::uint32_t>( Size::MCEO2, Bit::MCEO2 ); ///< MCEO2.
+            static constexpr auto MCEO3 = mask<std::uint32_t>( Size::MCEO3, Bit::MCEO3 ); ///< MCEO3.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        /**
+         * \brief EVACT0.
+         */
+        enum EVACT0 : std::uint32_t {
+            EVACT0_OFF = 0x0 << Bit::EVACT0, ///< Event action disabled.
+            EVACT0_RETRIGGER = 0x1 << Bit::EVACT0, ///< Start, restart, or re-trigger counter on event.
+            EVACT0_COUNTEV = 0x2 << Bit::EVACT0,   ///< Count on event.
+            EVACT0_START   = 0x3 << Bit::EVACT0,   ///< Start counter on event.
+            EVACT0_INC     = 0x4 << Bit::EVACT0,   ///< Increment counter on event.
+            EVACT0_COUNT = 0x5 << Bit::EVACT0, ///< Count on active state of asynchronous event.
+            EVACT0_FAULT = 0x7 << Bit::EVACT0, ///< Non-recoverable fault.
+        };
+
+        /**
+         * \brief EVACT1.
+         */
+        enum EVACT1 : std::uint32_t {
+            EVACT1_OFF       = 0x0 << Bit::EVACT1, ///< Event action disabled.
+            EVACT1_RETRIGGER = 0x1 << Bit::EVACT1, ///< Re-trigger counter on event.
+            EVACT1_DIR       = 0x2 << Bit::EVACT1, ///< Direction control.
+            EVACT1_STOP      = 0x3 << Bit::EVACT1, ///< Stop counter on event.
+            EVACT1_DEC       = 0x4 << Bit::EVACT1, ///< Decrement counter on event.
+            EVACT1_PPW = 0x5 << Bit::EVACT1, ///< Period captured value in CC0 register, pulse width captured value in CC1 register.
+            EVACT1_PWP = 0x6 << Bit::EVACT1, ///< Period captured value in CC1 register, pulse width captured value in CC0 register.
+            EVACT1_FAULT = 0x7 << Bit::EVACT1, ///< Non-recoverable fault.
+        };
+
+        /**
+         * \brief CNTSEL.
+         */
+        enum CNTSEL : std::uint32_t {
+            CNTSEL_START = 0x0 << Bit::CNTSEL, ///< An interrupt/event is generated when a new counter cycle starts.
+            CNTSEL_END = 0x1 << Bit::CNTSEL, ///< An interrupt/event is generated when a counter cycle ends.
+            CNTSEL_BETWEEN = 0x2 << Bit::CNTSEL, ///< An interrupt/event is generated when a counter cycle ends, except for the first and last cycles.
+            CNTSEL_BOUNDARY = 0x3 << Bit::CNTSEL, ///< An interrupt/event is generated when a new counter cycle starts or a counter cycle ends.
+        };
+
+        EVCTRL() = delete;
+
+        EVCTRL( EVCTRL && ) = delete;
+
+        EVCTRL( EVCTRL const & ) = delete;
+
+        ~EVCTRL() = delete;
+
+        auto operator=( EVCTRL && ) = delete;
+
+        auto operator=( EVCTRL const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Enable Clear (INTENCLR) register.
+     *
+     * This register has the following fields:
+     * - Overflow Interrupt Enable (OVF)
+     * - Retrigger Interrupt Enable (TRG)
+     * - Counter Interrupt Enable (CNT)
+     * - Error Interrupt Enable (ERR)
+     * - Non-Recoverable Debug Fault Interrupt Enable (DFS)
+     * - Recoverable Fault A Interrupt Enable (FAULTA)
+     * - Recoverable Fault B Interrupt Enable (FAULTB)
+     * - Non-Recoverable Fault 0 Interrupt Enable (FAULT0)
+     * - Non-Recoverable Fault 1 Interrupt Enable (FAULT1)
+     * - Match or Capture Channel 0 Interrupt Enable (MC0)
+     * - Match or Capture Channel 1 Interrupt Enable (MC1)
+     * - Match or Capture Channel 2 Interrupt Enable (MC2)
+     * - Match or Capture Channel 3 Interrupt Enable (MC3)
+     */
+    class INTENCLR : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto OVF        = std::uint_fast8_t{ 1 };  ///< OVF.
+            static constexpr auto TRG        = std::uint_fast8_t{ 1 };  ///< TRG.
+            static constexpr auto CNT        = std::uint_fast8_t{ 1 };  ///< CNT.
+            static constexpr auto ERR        = std::uint_fast8_t{ 1 };  ///< ERR.
+            static constexpr auto RESERVED4  = std::uint_fast8_t{ 7 };  ///< RESERVED4.
+            static constexpr auto DFS        = std::uint_fast8_t{ 1 };  ///< DFS.
+            static constexpr auto FAULTA     = std::uint_fast8_t{ 1 };  ///< FAULTA.
+            static constexpr auto FAULTB     = std::uint_fast8_t{ 1 };  ///< FAULTB.
+            static constexpr auto FAULT0     = std::uint_fast8_t{ 1 };  ///< FAULT0.
+            static constexpr auto FAULT1     = std::uint_fast8_t{ 1 };  ///< FAULT1.
+            static constexpr auto MC0        = std::uint_fast8_t{ 1 };  ///< MC0.
+            static constexpr auto MC1        = std::uint_fast8_t{ 1 };  ///< MC1.
+            static constexpr auto MC2        = std::uint_fast8_t{ 1 };  ///< MC2.
+            static constexpr auto MC3        = std::uint_fast8_t{ 1 };  ///< MC3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 12 }; ///< RESERVED20.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto OVF = std::uint_fast8_t{};                  ///< OVF.
+            static constexpr auto TRG = std::uint_fast8_t{ OVF + Size::OVF }; ///< TRG.
+            static constexpr auto CNT = std::uint_fast8_t{ TRG + Size::TRG }; ///< CNT.
+            static constexpr auto ERR = std::uint_fast8_t{ CNT + Size::CNT }; ///< ERR.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED4.
+            static constexpr auto DFS = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< DFS.
+            static constexpr auto FAULTA = std::uint_fast8_t{ DFS + Size::DFS }; ///< FAULTA.
+            static constexpr auto FAULTB = std::uint_fast8_t{ FAULTA + Size::FAULTA }; ///< FAULTB.
+            static constexpr auto FAULT0 = std::uint_fast8_t{ FAULTB + Size::FAULTB }; ///< FAULT0.
+            static constexpr auto FAULT1 = std::uint_fast8_t{ FAULT0 + Size::FAULT0 }; ///< FAULT1.
+            static constexpr auto MC0 = std::uint_fast8_t{ FAULT1 + Size::FAULT1 }; ///< MC0.
+            static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+            static constexpr auto MC2 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< MC2.
+            static constexpr auto MC3 = std::uint_fast8_t{ MC2 + Size::MC2 }; ///< MC3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ MC3 + Size::MC3 }; ///< RESERVED20.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto OVF = mask<std::uint32_t>( Size::OVF, Bit::OVF ); ///< OVF.
+            static constexpr auto TRG = mask<std::uint32_t>( Size::TRG, Bit::TRG ); ///< TRG.
+            static constexpr auto CNT = mask<std::uint32_t>( Size::CNT, Bit::CNT ); ///< CNT.
+            static constexpr auto ERR = mask<std::uint32_t>( Size::ERR, Bit::ERR ); ///< ERR.
+            static constexpr auto RESERVED4 = mask<std::uint32_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto DFS = mask<std::uint32_t>( Size::DFS, Bit::DFS ); ///< DFS.
+            static constexpr auto FAULTA = mask<std::uint32_t>( Size::FAULTA, Bit::FAULTA ); ///< FAULTA.
+            static constexpr auto FAULTB = mask<std::uint32_t>( Size::FAULTB, Bit::FAULTB ); ///< FAULTB.
+            static constexpr auto FAULT0 = mask<std::uint32_t>( Size::FAULT0, Bit::FAULT0 ); ///< FAULT0.
+            static constexpr auto FAULT1 = mask<std::uint32_t>( Size::FAULT1, Bit::FAULT1 ); ///< FAULT1.
+            static constexpr auto MC0 = mask<std::uint32_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+            static constexpr auto MC1 = mask<std::uint32_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+            static constexpr auto MC2 = mask<std::uint32_t>( Size::MC2, Bit::MC2 ); ///< MC2.
+            static constexpr auto MC3 = mask<std::uint32_t>( Size::MC3, Bit::MC3 ); ///< MC3.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+        };
+
+        INTENCLR() = delete;
+
+        INTENCLR( INTENCLR && ) = delete;
+
+        INTENCLR( INTENCLR const & ) = delete;
+
+        ~INTENCLR() = delete;
+
+        auto operator=( INTENCLR && ) = delete;
+
+        auto operator=( INTENCLR const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Enable Set (INTENSET) register.
+     *
+     * This register has the following fields:
+     * - Overflow Interrupt Enable (OVF)
+     * - Retrigger Interrupt Enable (TRG)
+     * - Counter Interrupt Enable (CNT)
+     * - Error Interrupt Enable (ERR)
+     * - Non-Recoverable Debug Fault Interrupt Enable (DFS)
+     * - Recoverable Fault A Interrupt Enable (FAULTA)
+     * - Recoverable Fault B Interrupt Enable (FAULTB)
+     * - Non-Recoverable Fault 0 Interrupt Enable (FAULT0)
+     * - Non-Recoverable Fault 1 Interrupt Enable (FAULT1)
+     * - Match or Capture Channel 0 Interrupt Enable (MC0)
+     * - Match or Capture Channel 1 Interrupt Enable (MC1)
+     * - Match or Capture Channel 2 Interrupt Enable (MC2)
+     * - Match or Capture Channel 3 Interrupt Enable (MC3)
+     */
+    class INTENSET : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto OVF        = std::uint_fast8_t{ 1 };  ///< OVF.
+            static constexpr auto TRG        = std::uint_fast8_t{ 1 };  ///< TRG.
+            static constexpr auto CNT        = std::uint_fast8_t{ 1 };  ///< CNT.
+            static constexpr auto ERR        = std::uint_fast8_t{ 1 };  ///< ERR.
+            static constexpr auto RESERVED4  = std::uint_fast8_t{ 7 };  ///< RESERVED4.
+            static constexpr auto DFS        = std::uint_fast8_t{ 1 };  ///< DFS.
+            static constexpr auto FAULTA     = std::uint_fast8_t{ 1 };  ///< FAULTA.
+            static constexpr auto FAULTB     = std::uint_fast8_t{ 1 };  ///< FAULTB.
+            static constexpr auto FAULT0     = std::uint_fast8_t{ 1 };  ///< FAULT0.
+            static constexpr auto FAULT1     = std::uint_fast8_t{ 1 };  ///< FAULT1.
+            static constexpr auto MC0        = std::uint_fast8_t{ 1 };  ///< MC0.
+            static constexpr auto MC1        = std::uint_fast8_t{ 1 };  ///< MC1.
+            static constexpr auto MC2        = std::uint_fast8_t{ 1 };  ///< MC2.
+            static constexpr auto MC3        = std::uint_fast8_t{ 1 };  ///< MC3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 12 }; ///< RESERVED20.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto OVF = std::uint_fast8_t{};                  ///< OVF.
+            static constexpr auto TRG = std::uint_fast8_t{ OVF + Size::OVF }; ///< TRG.
+            static constexpr auto CNT = std::uint_fast8_t{ TRG + Size::TRG }; ///< CNT.
+            static constexpr auto ERR = std::uint_fast8_t{ CNT + Size::CNT }; ///< ERR.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED4.
+            static constexpr auto DFS = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< DFS.
+            static constexpr auto FAULTA = std::uint_fast8_t{ DFS + Size::DFS }; ///< FAULTA.
+            static constexpr auto FAULTB = std::uint_fast8_t{ FAULTA + Size::FAULTA }; ///< FAULTB.
+            static constexpr auto FAULT0 = std::uint_fast8_t{ FAULTB + Size::FAULTB }; ///< FAULT0.
+            static constexpr auto FAULT1 = std::uint_fast8_t{ FAULT0 + Size::FAULT0 }; ///< FAULT1.
+            static constexpr auto MC0 = std::uint_fast8_t{ FAULT1 + Size::FAULT1 }; ///< MC0.
+            static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+            static constexpr auto MC2 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< MC2.
+            static constexpr auto MC3 = std::uint_fast8_t{ MC2 + Size::MC2 }; ///< MC3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ MC3 + Size::MC3 }; ///< RESERVED20.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto OVF = mask<std::uint32_t>( Size::OVF, Bit::OVF ); ///< OVF.
+            static constexpr auto TRG = mask<std::uint32_t>( Size::TRG, Bit::TRG ); ///< TRG.
+            static constexpr auto CNT = mask<std::uint32_t>( Size::CNT, Bit::CNT ); ///< CNT.
+            static constexpr auto ERR = mask<std::uint32_t>( Size::ERR, Bit::ERR ); ///< ERR.
+            static constexpr auto RESERVED4 = mask<std::uint32_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto DFS = mask<std::uint32_t>( Size::DFS, Bit::DFS ); ///< DFS.
+            static constexpr auto FAULTA = mask<std::uint32_t>( Size::FAULTA, Bit::FAULTA ); ///< FAULTA.
+            static constexpr auto FAULTB = mask<std::uint32_t>( Size::FAULTB, Bit::FAULTB ); ///< FAULTB.
+            static constexpr auto FAULT0 = mask<std::uint32_t>( Size::FAULT0, Bit::FAULT0 ); ///< FAULT0.
+            static constexpr auto FAULT1 = mask<std::uint32_t>( Size::FAULT1, Bit::FAULT1 ); ///< FAULT1.
+            static constexpr auto MC0 = mask<std::uint32_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+            static constexpr auto MC1 = mask<std::uint32_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+            static constexpr auto MC2 = mask<std::uint32_t>( Size::MC2, Bit::MC2 ); ///< MC2.
+            static constexpr auto MC3 = mask<std::uint32_t>( Size::MC3, Bit::MC3 ); ///< MC3.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+        };
+
+        INTENSET() = delete;
+
+        INTENSET( INTENSET && ) = delete;
+
+        INTENSET( INTENSET const & ) = delete;
+
+        ~INTENSET() = delete;
+
+        auto operator=( INTENSET && ) = delete;
+
+        auto operator=( INTENSET const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+     *
+     * This register has the following fields:
+     * - Overflow (OVF)
+     * - Retrigger (TRG)
+     * - Counter (CNT)
+     * - Error (ERR)
+     * - Non-Recoverable Debug Fault (DFS)
+     * - Recoverable Fault A (FAULTA)
+     * - Recoverable Fault B (FAULTB)
+     * - Non-Recoverable Fault 0 (FAULT0)
+     * - Non-Recoverable Fault 1 (FAULT1)
+     * - Match or Capture Channel 0 (MC0)
+     * - Match or Capture Channel 1 (MC1)
+     * - Match or Capture Channel 2 (MC2)
+     * - Match or Capture Channel 3 (MC3)
+     */
+    class INTFLAG : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto OVF        = std::uint_fast8_t{ 1 };  ///< OVF.
+            static constexpr auto TRG        = std::uint_fast8_t{ 1 };  ///< TRG.
+            static constexpr auto CNT        = std::uint_fast8_t{ 1 };  ///< CNT.
+            static constexpr auto ERR        = std::uint_fast8_t{ 1 };  ///< ERR.
+            static constexpr auto RESERVED4  = std::uint_fast8_t{ 7 };  ///< RESERVED4.
+            static constexpr auto DFS        = std::uint_fast8_t{ 1 };  ///< DFS.
+            static constexpr auto FAULTA     = std::uint_fast8_t{ 1 };  ///< FAULTA.
+            static constexpr auto FAULTB     = std::uint_fast8_t{ 1 };  ///< FAULTB.
+            static constexpr auto FAULT0     = std::uint_fast8_t{ 1 };  ///< FAULT0.
+            static constexpr auto FAULT1     = std::uint_fast8_t{ 1 };  ///< FAULT1.
+            static constexpr auto MC0        = std::uint_fast8_t{ 1 };  ///< MC0.
+            static constexpr auto MC1        = std::uint_fast8_t{ 1 };  ///< MC1.
+            static constexpr auto MC2        = std::uint_fast8_t{ 1 };  ///< MC2.
+            static constexpr auto MC3        = std::uint_fast8_t{ 1 };  ///< MC3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 12 }; ///< RESERVED20.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto OVF = std::uint_fast8_t{};                  ///< OVF.
+            static constexpr auto TRG = std::uint_fast8_t{ OVF + Size::OVF }; ///< TRG.
+            static constexpr auto CNT = std::uint_fast8_t{ TRG + Size::TRG }; ///< CNT.
+            static constexpr auto ERR = std::uint_fast8_t{ CNT + Size::CNT }; ///< ERR.
+            static constexpr auto RESERVED4 = std::uint_fast8_t{ ERR + Size::ERR }; ///< RESERVED4.
+            static constexpr auto DFS = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< DFS.
+            static constexpr auto FAULTA = std::uint_fast8_t{ DFS + Size::DFS }; ///< FAULTA.
+            static constexpr auto FAULTB = std::uint_fast8_t{ FAULTA + Size::FAULTA }; ///< FAULTB.
+            static constexpr auto FAULT0 = std::uint_fast8_t{ FAULTB + Size::FAULTB }; ///< FAULT0.
+            static constexpr auto FAULT1 = std::uint_fast8_t{ FAULT0 + Size::FAULT0 }; ///< FAULT1.
+            static constexpr auto MC0 = std::uint_fast8_t{ FAULT1 + Size::FAULT1 }; ///< MC0.
+            static constexpr auto MC1 = std::uint_fast8_t{ MC0 + Size::MC0 }; ///< MC1.
+            static constexpr auto MC2 = std::uint_fast8_t{ MC1 + Size::MC1 }; ///< MC2.
+            static constexpr auto MC3 = std::uint_fast8_t{ MC2 + Size::MC2 }; ///< MC3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ MC3 + Size::MC3 }; ///< RESERVED20.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto OVF = mask<std::uint32_t>( Size::OVF, Bit::OVF ); ///< OVF.
+            static constexpr auto TRG = mask<std::uint32_t>( Size::TRG, Bit::TRG ); ///< TRG.
+            static constexpr auto CNT = mask<std::uint32_t>( Size::CNT, Bit::CNT ); ///< CNT.
+            static constexpr auto ERR = mask<std::uint32_t>( Size::ERR, Bit::ERR ); ///< ERR.
+            static constexpr auto RESERVED4 = mask<std::uint32_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            static constexpr auto DFS = mask<std::uint32_t>( Size::DFS, Bit::DFS ); ///< DFS.
+            static constexpr auto FAULTA = mask<std::uint32_t>( Size::FAULTA, Bit::FAULTA ); ///< FAULTA.
+            static constexpr auto FAULTB = mask<std::uint32_t>( Size::FAULTB, Bit::FAULTB ); ///< FAULTB.
+            static constexpr auto FAULT0 = mask<std::uint32_t>( Size::FAULT0, Bit::FAULT0 ); ///< FAULT0.
+            static constexpr auto FAULT1 = mask<std::uint32_t>( Size::FAULT1, Bit::FAULT1 ); ///< FAULT1.
+            static constexpr auto MC0 = mask<std::uint32_t>( Size::MC0, Bit::MC0 ); ///< MC0.
+            static constexpr auto MC1 = mask<std::uint32_t>( Size::MC1, Bit::MC1 ); ///< MC1.
+            static constexpr auto MC2 = mask<std::uint32_t>( Size::MC2, Bit::MC2 ); ///< MC2.
+            static constexpr auto MC3 = mask<std::uint32_t>( Size::MC3, Bit::MC3 ); ///< MC3.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+        };
+
+        INTFLAG() = delete;
+
+        INTFLAG( INTFLAG && ) = delete;
+
+        INTFLAG( INTFLAG const & ) = delete;
+
+        ~INTFLAG() = delete;
+
+        auto operator=( INTFLAG && ) = delete;
+
+        auto operator=( INTFLAG const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Status (STATUS) register.
+     *
+     * This register has the following fields:
+     * - Stop (STOP)
+     * - Ramp (IDX)
+     * - Non-Recoverable Debug Fault State (DFS)
+     * - Slave (SLAVE)
+     * - Pattern Buffer Valid (PATTBV)
+     * - Wave Buffer Valid (WAVEBV)
+     * - Period Buffer Valid (PERBV)
+     * - Recoverable Fault A Input (FAULTAIN)
+     * - Recoverable Fault B Input (FAULTBIN)
+     * - Non-Recoverable Fault 0 Input (FAULT0IN)
+     * - Non-Recoverable Fault 1 Input (FAULT1IN)
+     * - Recoverable Fault A State (FAULTA)
+     * - Recoverable Fault B State (FAULTB)
+     * - Non-Recoverable Fault 0 State (FAULT0)
+     * - Non-Recoverable Fault 1 State (FAULT1)
+     * - Compare Channel Buffer Valid 0 (CCBV0)
+     * - Compare Channel Buffer Valid 1 (CCBV1)
+     * - Compare Channel Buffer Valid 2 (CCBV2)
+     * - Compare Channel Buffer Valid 3 (CCBV3)
+     * - Compare Channel Value 0 (CMP0)
+     * - Compare Channel Value 1 (CMP1)
+     * - Compare Channel Value 2 (CMP2)
+     * - Compare Channel Value 3 (CMP3)
+     */
+    class STATUS : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto STOP       = std::uint_fast8_t{ 1 }; ///< STOP.
+            static constexpr auto IDX        = std::uint_fast8_t{ 1 }; ///< IDX.
+            static constexpr auto RESERVED2  = std::uint_fast8_t{ 1 }; ///< RESERVED2.
+            static constexpr auto DFS        = std::uint_fast8_t{ 1 }; ///< DFS.
+            static constexpr auto SLAVE      = std::uint_fast8_t{ 1 }; ///< SLAVE.
+            static constexpr auto PATTBV     = std::uint_fast8_t{ 1 }; ///< PATTBV.
+            static constexpr auto WAVEBV     = std::uint_fast8_t{ 1 }; ///< WAVEBV.
+            static constexpr auto PERBV      = std::uint_fast8_t{ 1 }; ///< PERBV.
+            static constexpr auto FAULTAIN   = std::uint_fast8_t{ 1 }; ///< FAULTAIN.
+            static constexpr auto FAULTBIN   = std::uint_fast8_t{ 1 }; ///< FAULTBIN.
+            static constexpr auto FAULT0IN   = std::uint_fast8_t{ 1 }; ///< FAULT0IN.
+            static constexpr auto FAULT1IN   = std::uint_fast8_t{ 1 }; ///< FAULT1IN.
+            static constexpr auto FAULTA     = std::uint_fast8_t{ 1 }; ///< FAULTA.
+            static constexpr auto FAULTB     = std::uint_fast8_t{ 1 }; ///< FAULTB.
+            static constexpr auto FAULT0     = std::uint_fast8_t{ 1 }; ///< FAULT0.
+            static constexpr auto FAULT1     = std::uint_fast8_t{ 1 }; ///< FAULT1.
+            static constexpr auto CCBV0      = std::uint_fast8_t{ 1 }; ///< CCBV0.
+            static constexpr auto CCBV1      = std::uint_fast8_t{ 1 }; ///< CCBV1.
+            static constexpr auto CCBV2      = std::uint_fast8_t{ 1 }; ///< CCBV2.
+            static constexpr auto CCBV3      = std::uint_fast8_t{ 1 }; ///< CCBV3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 4 }; ///< RESERVED20.
+            static constexpr auto CMP0       = std::uint_fast8_t{ 1 }; ///< CMP0.
+            static constexpr auto CMP1       = std::uint_fast8_t{ 1 }; ///< CMP1.
+            static constexpr auto CMP2       = std::uint_fast8_t{ 1 }; ///< CMP2.
+            static constexpr auto CMP3       = std::uint_fast8_t{ 1 }; ///< CMP3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto STOP = std::uint_fast8_t{}; ///< STOP.
+            static constexpr auto IDX  = std::uint_fast8_t{ STOP + Size::STOP }; ///< IDX.
+            static constexpr auto RESERVED2 = std::uint_fast8_t{ IDX + Size::IDX }; ///< RESERVED2.
+            static constexpr auto DFS = std::uint_fast8_t{ RESERVED2 + Size::RESERVED2 }; ///< DFS.
+            static constexpr auto SLAVE = std::uint_fast8_t{ DFS + Size::DFS }; ///< SLAVE.
+            static constexpr auto PATTBV = std::uint_fast8_t{ SLAVE + Size::SLAVE }; ///< PATTBV.
+            static constexpr auto WAVEBV = std::uint_fast8_t{ PATTBV + Size::PATTBV }; ///< WAVEBV.
+            static constexpr auto PERBV = std::uint_fast8_t{ WAVEBV + Size::WAVEBV }; ///< PERBV.
+            static constexpr auto FAULTAIN = std::uint_fast8_t{ PERBV + Size::PERBV }; ///< FAULTAIN.
+            static constexpr auto FAULTBIN = std::uint_fast8_t{ FAULTAIN + Size::FAULTAIN }; ///< FAULTBIN.
+            static constexpr auto FAULT0IN = std::uint_fast8_t{ FAULTBIN + Size::FAULTBIN }; ///< FAULT0IN.
+            static constexpr auto FAULT1IN = std::uint_fast8_t{ FAULT0IN + Size::FAULT0IN }; ///< FAULT1IN.
+            static constexpr auto FAULTA = std::uint_fast8_t{ FAULT1IN + Size::FAULT1IN }; ///< FAULTA.
+            static constexpr auto FAULTB = std::uint_fast8_t{ FAULTA + Size::FAULTA }; ///< FAULTB.
+            static constexpr auto FAULT0 = std::uint_fast8_t{ FAULTB + Size::FAULTB }; ///< FAULT0.
+            static constexpr auto FAULT1 = std::uint_fast8_t{ FAULT0 + Size::FAULT0 }; ///< FAULT1.
+            static constexpr auto CCBV0 = std::uint_fast8_t{ FAULT1 + Size::FAULT1 }; ///< CCBV0.
+            static constexpr auto CCBV1 = std::uint_fast8_t{ CCBV0 + Size::CCBV0 }; ///< CCBV1.
+            static constexpr auto CCBV2 = std::uint_fast8_t{ CCBV1 + Size::CCBV1 }; ///< CCBV2.
+            static constexpr auto CCBV3 = std::uint_fast8_t{ CCBV2 + Size::CCBV2 }; ///< CCBV3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ CCBV3 + Size::CCBV3 }; ///< RESERVED20.
+            static constexpr auto CMP0 = std::uint_fast8_t{ RESERVED20 + Size::RESERVED20 }; ///< CMP0.
+            static constexpr auto CMP1 = std::uint_fast8_t{ CMP0 + Size::CMP0 }; ///< CMP1.
+            static constexpr auto CMP2 = std::uint_fast8_t{ CMP1 + Size::CMP1 }; ///< CMP2.
+            static constexpr auto CMP3 = std::uint_fast8_t{ CMP2 + Size::CMP2 }; ///< CMP3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ CMP3 + Size::CMP3 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto STOP = mask<std::uint32_t>( Size::STOP, Bit::STOP ); ///< STOP.
+            static constexpr auto IDX = mask<std::uint32_t>( Size::IDX, Bit::IDX ); ///< IDX.
+            static constexpr auto RESERVED2 = mask<std::uint32_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            static constexpr auto DFS = mask<std::uint32_t>( Size::DFS, Bit::DFS ); ///< DFS.
+            static constexpr auto SLAVE = mask<std::uint32_t>( Size::SLAVE, Bit::SLAVE ); ///< SLAVE.
+            static constexpr auto PATTBV = mask<std::uint32_t>( Size::PATTBV, Bit::PATTBV ); ///< PATTBV.
+            static constexpr auto WAVEBV = mask<std::uint32_t>( Size::WAVEBV, Bit::WAVEBV ); ///< WAVEBV.
+            static constexpr auto PERBV = mask<std::uint32_t>( Size::PERBV, Bit::PERBV ); ///< PERBV.
+            static constexpr auto FAULTAIN = mask<std::uint32_t>( Size::FAULTAIN, Bit::FAULTAIN ); ///< FAULTAIN.
+            static constexpr auto FAULTBIN = mask<std::uint32_t>( Size::FAULTBIN, Bit::FAULTBIN ); ///< FAULTBIN.
+            static constexpr auto FAULT0IN = mask<std::uint32_t>( Size::FAULT0IN, Bit::FAULT0IN ); ///< FAULT0IN.
+            static constexpr auto FAULT1IN = mask<std::uint32_t>( Size::FAULT1IN, Bit::FAULT1IN ); ///< FAULT1IN.
+            static constexpr auto FAULTA = mask<std::uint32_t>( Size::FAULTA, Bit::FAULTA ); ///< FAULTA.
+            static constexpr auto FAULTB = mask<std::uint32_t>( Size::FAULTB, Bit::FAULTB ); ///< FAULTB.
+            static constexpr auto FAULT0 = mask<std::uint32_t>( Size::FAULT0, Bit::FAULT0 ); ///< FAULT0.
+            static constexpr auto FAULT1 = mask<std::uint32_t>( Size::FAULT1, Bit::FAULT1 ); ///< FAULT1.
+            static constexpr auto CCBV0 = mask<std::uint32_t>( Size::CCBV0, Bit::CCBV0 ); ///< CCBV0.
+            static constexpr auto CCBV1 = mask<std::uint32_t>( Size::CCBV1, Bit::CCBV1 ); ///< CCBV1.
+            static constexpr auto CCBV2 = mask<std::uint32_t>( Size::CCBV2, Bit::CCBV2 ); ///< CCBV2.
+            static constexpr auto CCBV3 = mask<std::uint32_t>( Size::CCBV3, Bit::CCBV3 ); ///< CCBV3.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+            static constexpr auto CMP0 = mask<std::uint32_t>( Size::CMP0, Bit::CMP0 ); ///< CMP0.
+            static constexpr auto CMP1 = mask<std::uint32_t>( Size::CMP1, Bit::CMP1 ); ///< CMP1.
+            static constexpr auto CMP2 = mask<std::uint32_t>( Size::CMP2, Bit::CMP2 ); ///< CMP2.
+            static constexpr auto CMP3 = mask<std::uint32_t>( Size::CMP3, Bit::CMP3 ); ///< CMP3.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        STATUS() = delete;
+
+        STATUS( STATUS && ) = delete;
+
+        STATUS( STATUS const & ) = delete;
+
+        ~STATUS() = delete;
+
+        auto operator=( STATUS && ) = delete;
+
+        auto operator=( STATUS const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Pattern (PATT) register.
+     *
+     * This register has the following fields:
+     * - Pattern Generator Output Enable 0 (PGE0)
+     * - Pattern Generator Output Enable 1 (PGE1)
+     * - Pattern Generator Output Enable 2 (PGE2)
+     * - Pattern Generator Output Enable 3 (PGE3)
+     * - Pattern Generator Output Enable 4 (PGE4)
+     * - Pattern Generator Output Enable 5 (PGE5)
+     * - Pattern Generator Output Enable 6 (PGE6)
+     * - Pattern Generator Output Enable 7 (PGE7)
+     * - Pattern Generator Output Value 0 (PGV0)
+     * - Pattern Generator Output Value 1 (PGV1)
+     * - Pattern Generator Output Value 2 (PGV2)
+     * - Pattern Generator Output Value 3 (PGV3)
+     * - Pattern Generator Output Value 4 (PGV4)
+     * - Pattern Generator Output Value 5 (PGV5)
+     * - Pattern Generator Output Value 6 (PGV6)
+     * - Pattern Generator Output Value 7 (PGV7)
+     */
+    class PATT : public Register<std::uint16_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto PGE0 = std::uint_fast8_t{ 1 }; ///< PGE0.
+            static constexpr auto PGE1 = std::uint_fast8_t{ 1 }; ///< PGE1.
+            static constexpr auto PGE2 = std::uint_fast8_t{ 1 }; ///< PGE2.
+            static constexpr auto PGE3 = std::uint_fast8_t{ 1 }; ///< PGE3.
+            static constexpr auto PGE4 = std::uint_fast8_t{ 1 }; ///< PGE4.
+            static constexpr auto PGE5 = std::uint_fast8_t{ 1 }; ///< PGE5.
+            static constexpr auto PGE6 = std::uint_fast8_t{ 1 }; ///< PGE6.
+            static constexpr auto PGE7 = std::uint_fast8_t{ 1 }; ///< PGE7.
+            static constexpr auto PGV0 = std::uint_fast8_t{ 1 }; ///< PGV0.
+            static constexpr auto PGV1 = std::uint_fast8_t{ 1 }; ///< PGV1.
+            static constexpr auto PGV2 = std::uint_fast8_t{ 1 }; ///< PGV2.
+            static constexpr auto PGV3 = std::uint_fast8_t{ 1 }; ///< PGV3.
+            static constexpr auto PGV4 = std::uint_fast8_t{ 1 }; ///< PGV4.
+            static constexpr auto PGV5 = std::uint_fast8_t{ 1 }; ///< PGV5.
+            static constexpr auto PGV6 = std::uint_fast8_t{ 1 }; ///< PGV6.
+            static constexpr auto PGV7 = std::uint_fast8_t{ 1 }; ///< PGV7.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto PGE0 = std::uint_fast8_t{}; ///< PGE0.
+            static constexpr auto PGE1 = std::uint_fast8_t{ PGE0 + Size::PGE0 }; ///< PGE1.
+            static constexpr auto PGE2 = std::uint_fast8_t{ PGE1 + Size::PGE1 }; ///< PGE2.
+            static constexpr auto PGE3 = std::uint_fast8_t{ PGE2 + Size::PGE2 }; ///< PGE3.
+            static constexpr auto PGE4 = std::uint_fast8_t{ PGE3 + Size::PGE3 }; ///< PGE4.
+            static constexpr auto PGE5 = std::uint_fast8_t{ PGE4 + Size::PGE4 }; ///< PGE5.
+            static constexpr auto PGE6 = std::uint_fast8_t{ PGE5 + Size::PGE5 }; ///< PGE6.
+            static constexpr auto PGE7 = std::uint_fast8_t{ PGE6 + Size::PGE6 }; ///< PGE7.
+            static constexpr auto PGV0 = std::uint_fast8_t{ PGE7 + Size::PGE7 }; ///< PGV0.
+            static constexpr auto PGV1 = std::uint_fast8_t{ PGV0 + Size::PGV0 }; ///< PGV1.
+            static constexpr auto PGV2 = std::uint_fast8_t{ PGV1 + Size::PGV1 }; ///< PGV2.
+            static constexpr auto PGV3 = std::uint_fast8_t{ PGV2 + Size::PGV2 }; ///< PGV3.
+            static constexpr auto PGV4 = std::uint_fast8_t{ PGV3 + Size::PGV3 }; ///< PGV4.
+            static constexpr auto PGV5 = std::uint_fast8_t{ PGV4 + Size::PGV4 }; ///< PGV5.
+            static constexpr auto PGV6 = std::uint_fast8_t{ PGV5 + Size::PGV5 }; ///< PGV6.
+            static constexpr auto PGV7 = std::uint_fast8_t{ PGV6 + Size::PGV6 }; ///< PGV7.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto PGE0 = mask<std::uint16_t>( Size::PGE0, Bit::PGE0 ); ///< PGE0.
+            static constexpr auto PGE1 = mask<std::uint16_t>( Size::PGE1, Bit::PGE1 ); ///< PGE1.
+            static constexpr auto PGE2 = mask<std::uint16_t>( Size::PGE2, Bit::PGE2 ); ///< PGE2.
+            static constexpr auto PGE3 = mask<std::uint16_t>( Size::PGE3, Bit::PGE3 ); ///< PGE3.
+            static constexpr auto PGE4 = mask<std::uint16_t>( Size::PGE4, Bit::PGE4 ); ///< PGE4.
+            static constexpr auto PGE5 = mask<std::uint16_t>( Size::PGE5, Bit::PGE5 ); ///< PGE5.
+            static constexpr auto PGE6 = mask<std::uint16_t>( Size::PGE6, Bit::PGE6 ); ///< PGE6.
+            static constexpr auto PGE7 = mask<std::uint16_t>( Size::PGE7, Bit::PGE7 ); ///< PGE7.
+            static constexpr auto PGV0 = mask<std::uint16_t>( Size::PGV0, Bit::PGV0 ); ///< PGV0.
+            static constexpr auto PGV1 = mask<std::uint16_t>( Size::PGV1, Bit::PGV1 ); ///< PGV1.
+            static constexpr auto PGV2 = mask<std::uint16_t>( Size::PGV2, Bit::PGV2 ); ///< PGV2.
+            static constexpr auto PGV3 = mask<std::uint16_t>( Size::PGV3, Bit::PGV3 ); ///< PGV3.
+            static constexpr auto PGV4 = mask<std::uint16_t>( Size::PGV4, Bit::PGV4 ); ///< PGV4.
+            static constexpr auto PGV5 = mask<std::uint16_t>( Size::PGV5, Bit::PGV5 ); ///< PGV5.
+            static constexpr auto PGV6 = mask<std::uint16_t>( Size::PGV6, Bit::PGV6 ); ///< PGV6.
+            static constexpr auto PGV7 = mask<std::uint16_t>( Size::PGV7, Bit::PGV7 ); ///< PGV7.
+        };
+
+        PATT() = delete;
+
+        PATT( PATT && ) = delete;
+
+        PATT( PATT const & ) = delete;
+
+        ~PATT() = delete;
+
+        auto operator=( PATT && ) = delete;
+
+        auto operator=( PATT const & ) = delete;
+
+        using Register<std::uint16_t>::operator=;
+    };
+
+    /**
+     * \brief Waveform Control (WAVE) register.
+     *
+     * This register has the following fields:
+     * - Waveform Generation (WAVEGEN)
+     * - Ramp Mode (RAMP)
+     * - Circular Period Enable (CIPEREN)
+     * - Circular Channel Enable 0 (CICCEN0)
+     * - Circular Channel Enable 1 (CICCEN1)
+     * - Circular Channel Enable 2 (CICCEN2)
+     * - Circular Channel Enable 3 (CICCEN3)
+     * - Channel Polarity 0 (POL0)
+     * - Channel Polarity 1 (POL1)
+     * - Channel Polarity 2 (POL2)
+     * - Channel Polarity 3 (POL3)
+     * - Swap Dead-time Insertion Outputs 0 (SWAP0)
+     * - Swap Dead-time Insertion Outputs 1 (SWAP1)
+     * - Swap Dead-time Insertion Outputs 2 (SWAP2)
+     * - Swap Dead-time Insertion Outputs 3 (SWAP3)
+     */
+    class WAVE : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto WAVEGEN    = std::uint_fast8_t{ 3 }; ///< WAVEGEN.
+            static constexpr auto RESERVED3  = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+            static constexpr auto RAMP       = std::uint_fast8_t{ 2 }; ///< RAMP.
+            static constexpr auto RESERVED6  = std::uint_fast8_t{ 1 }; ///< RESERVED6.
+            static constexpr auto CIPEREN    = std::uint_fast8_t{ 1 }; ///< CIPEREN.
+            static constexpr auto CICCEN0    = std::uint_fast8_t{ 1 }; ///< CICCEN0.
+            static constexpr auto CICCEN1    = std::uint_fast8_t{ 1 }; ///< CICCEN1.
+            static constexpr auto CICCEN2    = std::uint_fast8_t{ 1 }; ///< CICCEN2.
+            static constexpr auto CICCEN3    = std::uint_fast8_t{ 1 }; ///< CICCEN3.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 4 }; ///< RESERVED12.
+            static constexpr auto POL0       = std::uint_fast8_t{ 1 }; ///< POL0.
+            static constexpr auto POL1       = std::uint_fast8_t{ 1 }; ///< POL1.
+            static constexpr auto POL2       = std::uint_fast8_t{ 1 }; ///< POL2.
+            static constexpr auto POL3       = std::uint_fast8_t{ 1 }; ///< POL3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 4 }; ///< RESERVED20.
+            static constexpr auto SWAP0      = std::uint_fast8_t{ 1 }; ///< SWAP0.
+            static constexpr auto SWAP1      = std::uint_fast8_t{ 1 }; ///< SWAP1.
+            static constexpr auto SWAP2      = std::uint_fast8_t{ 1 }; ///< SWAP2.
+            static constexpr auto SWAP3      = std::uint_fast8_t{ 1 }; ///< SWAP3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto WAVEGEN = std::uint_fast8_t{}; ///< WAVEGEN.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ WAVEGEN + Size::WAVEGEN }; ///< RESERVED3.
+            static constexpr auto RAMP = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< RAMP.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ RAMP + Size::RAMP }; ///< RESERVED6.
+            static constexpr auto CIPEREN = std::uint_fast8_t{ RESERVED6 + Size::RESERVED6 }; ///< CIPEREN.
+            static constexpr auto CICCEN0 = std::uint_fast8_t{ CIPEREN + Size::CIPEREN }; ///< CICCEN0.
+            static constexpr auto CICCEN1 = std::uint_fast8_t{ CICCEN0 + Size::CICCEN0 }; ///< CICCEN1.
+            static constexpr auto CICCEN2 = std::uint_fast8_t{ CICCEN1 + Size::CICCEN1 }; ///< CICCEN2.
+            static constexpr auto CICCEN3 = std::uint_fast8_t{ CICCEN2 + Size::CICCEN2 }; ///< CICCEN3.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ CICCEN3 + Size::CICCEN3 }; ///< RESERVED12.
+            static constexpr auto POL0 = std::uint_fast8_t{ RESERVED12 + Size::RESERVED12 }; ///< POL0.
+            static constexpr auto POL1 = std::uint_fast8_t{ POL0 + Size::POL0 }; ///< POL1.
+            static constexpr auto POL2 = std::uint_fast8_t{ POL1 + Size::POL1 }; ///< POL2.
+            static constexpr auto POL3 = std::uint_fast8_t{ POL2 + Size::POL2 }; ///< POL3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ POL3 + Size::POL3 }; ///< RESERVED20.
+            static constexpr auto SWAP0 = std::uint_fast8_t{ RESERVED20 + Size::RESERVED20 }; ///< SWAP0.
+            static constexpr auto SWAP1 = std::uint_fast8_t{ SWAP0 + Size::SWAP0 }; ///< SWAP1.
+            static constexpr auto SWAP2 = std::uint_fast8_t{ SWAP1 + Size::SWAP1 }; ///< SWAP2.
+            static constexpr auto SWAP3 = std::uint_fast8_t{ SWAP2 + Size::SWAP2 }; ///< SWAP3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ SWAP3 + Size::SWAP3 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto WAVEGEN = mask<std::uint32_t>( Size::WAVEGEN, Bit::WAVEGEN ); ///< WAVEGEN.
+            static constexpr auto RESERVED3 = mask<std::uint32_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+            static constexpr auto RAMP = mask<std::uint32_t>( Size::RAMP, Bit::RAMP ); ///< RAMP.
+            static constexpr auto RESERVED6 = mask<std::uint32_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            static constexpr auto CIPEREN = mask<std::uint32_t>( Size::CIPEREN, Bit::CIPEREN ); ///< CIPEREN.
+            static constexpr auto CICCEN0 = mask<std::uint32_t>( Size::CICCEN0, Bit::CICCEN0 ); ///< CICCEN0.
+            static constexpr auto CICCEN1 = mask<std::uint32_t>( Size::CICCEN1, Bit::CICCEN1 ); ///< CICCEN1.
+            static constexpr auto CICCEN2 = mask<std::uint32_t>( Size::CICCEN2, Bit::CICCEN2 ); ///< CICCEN2.
+            static constexpr auto CICCEN3 = mask<std::uint32_t>( Size::CICCEN3, Bit::CICCEN3 ); ///< CICCEN3.
+            static constexpr auto RESERVED12 = mask<std::uint32_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+            static constexpr auto POL0 = mask<std::uint32_t>( Size::POL0, Bit::POL0 ); ///< POL0.
+            static constexpr auto POL1 = mask<std::uint32_t>( Size::POL1, Bit::POL1 ); ///< POL1.
+            static constexpr auto POL2 = mask<std::uint32_t>( Size::POL2, Bit::POL2 ); ///< POL2.
+            static constexpr auto POL3 = mask<std::uint32_t>( Size::POL3, Bit::POL3 ); ///< POL3.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+            static constexpr auto SWAP0 = mask<std::uint32_t>( Size::SWAP0, Bit::SWAP0 ); ///< SWAP0.
+            static constexpr auto SWAP1 = mask<std::uint32_t>( Size::SWAP1, Bit::SWAP1 ); ///< SWAP1.
+            static constexpr auto SWAP2 = mask<std::uint32_t>( Size::SWAP2, Bit::SWAP2 ); ///< SWAP2.
+            static constexpr auto SWAP3 = mask<std::uint32_t>( Size::SWAP3, Bit::SWAP3 ); ///< SWAP3.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        /**
+         * \brief WAVEGEN.
+         */
+        enum WAVEGEN : std::uint32_t {
+            WAVEGEN_NFRQ       = 0x0 << Bit::WAVEGEN, ///< Normal frequency.
+            WAVEGEN_MFRQ       = 0x1 << Bit::WAVEGEN, ///< Match frequency.
+            WAVEGEN_NPWM       = 0x2 << Bit::WAVEGEN, ///< Normal PWM.
+            WAVEGEN_DSCRITICAL = 0x4 << Bit::WAVEGEN, ///< Dual-slope critical.
+            WAVEGEN_DSBOTTOM = 0x5 << Bit::WAVEGEN, ///< Dual-slope with interrupt/event condition when COUNT reaches ZERO.
+            WAVEGEN_DSBOTH = 0x6 << Bit::WAVEGEN, ///< Dual-slope with interrupt/event condition when COUNT reaches ZERO or TOP.
+            WAVEGEN_DSTOP = 0x7 << Bit::WAVEGEN, ///< Dual-slope with interrupt/event condition when COUNT reaches TOP.
+        };
+
+        /**
+         * \brief RAMP.
+         */
+        enum RAMP : std::uint32_t {
+            RAMP_RAMP1  = 0x0 << Bit::RAMP, ///< RAMP1 operation.
+            RAMP_RAMP2A = 0x1 << Bit::RAMP, ///< Alternative RAMP2 operation.
+            RAMP_RAMP2  = 0x2 << Bit::RAMP, ///< RAMP2 operation.
+        };
+
+        WAVE() = delete;
+
+        WAVE( WAVE && ) = delete;
+
+        WAVE( WAVE const & ) = delete;
+
+        ~WAVE() = delete;
+
+        auto operator=( WAVE && ) = delete;
+
+        auto operator=( WAVE const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief Pattern Buffer (PATTB) register.
+     *
+     * This register has the following fields:
+     * - Pattern Generator Output Enable Buffer 0 (PGEB0)
+     * - Pattern Generator Output Enable Buffer 1 (PGEB1)
+     * - Pattern Generator Output Enable Buffer 2 (PGEB2)
+     * - Pattern Generator Output Enable Buffer 3 (PGEB3)
+     * - Pattern Generator Output Enable Buffer 4 (PGEB4)
+     * - Pattern Generator Output Enable Buffer 5 (PGEB5)
+     * - Pattern Generator Output Enable Buffer 6 (PGEB6)
+     * - Pattern Generator Output Enable Buffer 7 (PGEB7)
+     * - Pattern Generator Output Value Buffer 0 (PGVB0)
+     * - Pattern Generator Output Value Buffer 1 (PGVB1)
+     * - Pattern Generator Output Value Buffer 2 (PGVB2)
+     * - Pattern Generator Output Value Buffer 3 (PGVB3)
+     * - Pattern Generator Output Value Buffer 4 (PGVB4)
+     * - Pattern Generator Output Value Buffer 5 (PGVB5)
+     * - Pattern Generator Output Value Buffer 6 (PGVB6)
+     * - Pattern Generator Output Value Buffer 7 (PGVB7)
+     */
+    class PATTB : public Register<std::uint16_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto PGEB0 = std::uint_fast8_t{ 1 }; ///< PGEB0.
+            static constexpr auto PGEB1 = std::uint_fast8_t{ 1 }; ///< PGEB1.
+            static constexpr auto PGEB2 = std::uint_fast8_t{ 1 }; ///< PGEB2.
+            static constexpr auto PGEB3 = std::uint_fast8_t{ 1 }; ///< PGEB3.
+            static constexpr auto PGEB4 = std::uint_fast8_t{ 1 }; ///< PGEB4.
+            static constexpr auto PGEB5 = std::uint_fast8_t{ 1 }; ///< PGEB5.
+            static constexpr auto PGEB6 = std::uint_fast8_t{ 1 }; ///< PGEB6.
+            static constexpr auto PGEB7 = std::uint_fast8_t{ 1 }; ///< PGEB7.
+            static constexpr auto PGVB0 = std::uint_fast8_t{ 1 }; ///< PGVB0.
+            static constexpr auto PGVB1 = std::uint_fast8_t{ 1 }; ///< PGVB1.
+            static constexpr auto PGVB2 = std::uint_fast8_t{ 1 }; ///< PGVB2.
+            static constexpr auto PGVB3 = std::uint_fast8_t{ 1 }; ///< PGVB3.
+            static constexpr auto PGVB4 = std::uint_fast8_t{ 1 }; ///< PGVB4.
+            static constexpr auto PGVB5 = std::uint_fast8_t{ 1 }; ///< PGVB5.
+            static constexpr auto PGVB6 = std::uint_fast8_t{ 1 }; ///< PGVB6.
+            static constexpr auto PGVB7 = std::uint_fast8_t{ 1 }; ///< PGVB7.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto PGEB0 = std::uint_fast8_t{}; ///< PGEB0.
+            static constexpr auto PGEB1 = std::uint_fast8_t{ PGEB0 + Size::PGEB0 }; ///< PGEB1.
+            static constexpr auto PGEB2 = std::uint_fast8_t{ PGEB1 + Size::PGEB1 }; ///< PGEB2.
+            static constexpr auto PGEB3 = std::uint_fast8_t{ PGEB2 + Size::PGEB2 }; ///< PGEB3.
+            static constexpr auto PGEB4 = std::uint_fast8_t{ PGEB3 + Size::PGEB3 }; ///< PGEB4.
+            static constexpr auto PGEB5 = std::uint_fast8_t{ PGEB4 + Size::PGEB4 }; ///< PGEB5.
+            static constexpr auto PGEB6 = std::uint_fast8_t{ PGEB5 + Size::PGEB5 }; ///< PGEB6.
+            static constexpr auto PGEB7 = std::uint_fast8_t{ PGEB6 + Size::PGEB6 }; ///< PGEB7.
+            static constexpr auto PGVB0 = std::uint_fast8_t{ PGEB7 + Size::PGEB7 }; ///< PGVB0.
+            static constexpr auto PGVB1 = std::uint_fast8_t{ PGVB0 + Size::PGVB0 }; ///< PGVB1.
+            static constexpr auto PGVB2 = std::uint_fast8_t{ PGVB1 + Size::PGVB1 }; ///< PGVB2.
+            static constexpr auto PGVB3 = std::uint_fast8_t{ PGVB2 + Size::PGVB2 }; ///< PGVB3.
+            static constexpr auto PGVB4 = std::uint_fast8_t{ PGVB3 + Size::PGVB3 }; ///< PGVB4.
+            static constexpr auto PGVB5 = std::uint_fast8_t{ PGVB4 + Size::PGVB4 }; ///< PGVB5.
+            static constexpr auto PGVB6 = std::uint_fast8_t{ PGVB5 + Size::PGVB5 }; ///< PGVB6.
+            static constexpr auto PGVB7 = std::uint_fast8_t{ PGVB6 + Size::PGVB6 }; ///< PGVB7.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto PGEB0 = mask<std::uint16_t>( Size::PGEB0, Bit::PGEB0 ); ///< PGEB0.
+            static constexpr auto PGEB1 = mask<std::uint16_t>( Size::PGEB1, Bit::PGEB1 ); ///< PGEB1.
+            static constexpr auto PGEB2 = mask<std::uint16_t>( Size::PGEB2, Bit::PGEB2 ); ///< PGEB2.
+            static constexpr auto PGEB3 = mask<std::uint16_t>( Size::PGEB3, Bit::PGEB3 ); ///< PGEB3.
+            static constexpr auto PGEB4 = mask<std::uint16_t>( Size::PGEB4, Bit::PGEB4 ); ///< PGEB4.
+            static constexpr auto PGEB5 = mask<std::uint16_t>( Size::PGEB5, Bit::PGEB5 ); ///< PGEB5.
+            static constexpr auto PGEB6 = mask<std::uint16_t>( Size::PGEB6, Bit::PGEB6 ); ///< PGEB6.
+            static constexpr auto PGEB7 = mask<std::uint16_t>( Size::PGEB7, Bit::PGEB7 ); ///< PGEB7.
+            static constexpr auto PGVB0 = mask<std::uint16_t>( Size::PGVB0, Bit::PGVB0 ); ///< PGVB0.
+            static constexpr auto PGVB1 = mask<std::uint16_t>( Size::PGVB1, Bit::PGVB1 ); ///< PGVB1.
+            static constexpr auto PGVB2 = mask<std::uint16_t>( Size::PGVB2, Bit::PGVB2 ); ///< PGVB2.
+            static constexpr auto PGVB3 = mask<std::uint16_t>( Size::PGVB3, Bit::PGVB3 ); ///< PGVB3.
+            static constexpr auto PGVB4 = mask<std::uint16_t>( Size::PGVB4, Bit::PGVB4 ); ///< PGVB4.
+            static constexpr auto PGVB5 = mask<std::uint16_t>( Size::PGVB5, Bit::PGVB5 ); ///< PGVB5.
+            static constexpr auto PGVB6 = mask<std::uint16_t>( Size::PGVB6, Bit::PGVB6 ); ///< PGVB6.
+            static constexpr auto PGVB7 = mask<std::uint16_t>( Size::PGVB7, Bit::PGVB7 ); ///< PGVB7.
+        };
+
+        PATTB() = delete;
+
+        PATTB( PATTB && ) = delete;
+
+        PATTB( PATTB const & ) = delete;
+
+        ~PATTB() = delete;
+
+        auto operator=( PATTB && ) = delete;
+
+        auto operator=( PATTB const & ) = delete;
+
+        using Register<std::uint16_t>::operator=;
+    };
+
+    /**
+     * \brief Waveform Control Buffer (WAVEB) register.
+     *
+     * This register has the following fields:
+     * - Waveform Generation Buffer (WAVEGENB)
+     * - Ramp Mode Buffer (RAMPB)
+     * - Circular Period Enable Buffer (CIPERENB)
+     * - Circular Channel Enable Buffer 0 (CICCENB0)
+     * - Circular Channel Enable Buffer 1 (CICCENB1)
+     * - Circular Channel Enable Buffer 2 (CICCENB2)
+     * - Circular Channel Enable Buffer 3 (CICCENB3)
+     * - Channel Polarity Buffer 0 (POLB0)
+     * - Channel Polarity Buffer 1 (POLB1)
+     * - Channel Polarity Buffer 2 (POLB2)
+     * - Channel Polarity Buffer 3 (POLB3)
+     * - Swap Dead-time Insertion Outputs Buffer 0 (SWAPB0)
+     * - Swap Dead-time Insertion Outputs Buffer 1 (SWAPB1)
+     * - Swap Dead-time Insertion Outputs Buffer 2 (SWAPB2)
+     * - Swap Dead-time Insertion Outputs Buffer 3 (SWAPB3)
+     */
+    class WAVEB : public Register<std::uint32_t> {
+      public:
+        /**
+         * \brief Field sizes.
+         */
+        struct Size {
+            static constexpr auto WAVEGENB   = std::uint_fast8_t{ 3 }; ///< WAVEGENB.
+            static constexpr auto RESERVED3  = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+            static constexpr auto RAMPB      = std::uint_fast8_t{ 2 }; ///< RAMPB.
+            static constexpr auto RESERVED6  = std::uint_fast8_t{ 1 }; ///< RESERVED6.
+            static constexpr auto CIPERENB   = std::uint_fast8_t{ 1 }; ///< CIPERENB.
+            static constexpr auto CICCENB0   = std::uint_fast8_t{ 1 }; ///< CICCENB0.
+            static constexpr auto CICCENB1   = std::uint_fast8_t{ 1 }; ///< CICCENB1.
+            static constexpr auto CICCENB2   = std::uint_fast8_t{ 1 }; ///< CICCENB2.
+            static constexpr auto CICCENB3   = std::uint_fast8_t{ 1 }; ///< CICCENB3.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ 4 }; ///< RESERVED12.
+            static constexpr auto POLB0      = std::uint_fast8_t{ 1 }; ///< POLB0.
+            static constexpr auto POLB1      = std::uint_fast8_t{ 1 }; ///< POLB1.
+            static constexpr auto POLB2      = std::uint_fast8_t{ 1 }; ///< POLB2.
+            static constexpr auto POLB3      = std::uint_fast8_t{ 1 }; ///< POLB3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ 4 }; ///< RESERVED20.
+            static constexpr auto SWAPB0     = std::uint_fast8_t{ 1 }; ///< SWAPB0.
+            static constexpr auto SWAPB1     = std::uint_fast8_t{ 1 }; ///< SWAPB1.
+            static constexpr auto SWAPB2     = std::uint_fast8_t{ 1 }; ///< SWAPB2.
+            static constexpr auto SWAPB3     = std::uint_fast8_t{ 1 }; ///< SWAPB3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ 4 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit positions.
+         */
+        struct Bit {
+            static constexpr auto WAVEGENB = std::uint_fast8_t{}; ///< WAVEGENB.
+            static constexpr auto RESERVED3 = std::uint_fast8_t{ WAVEGENB + Size::WAVEGENB }; ///< RESERVED3.
+            static constexpr auto RAMPB = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< RAMPB.
+            static constexpr auto RESERVED6 = std::uint_fast8_t{ RAMPB + Size::RAMPB }; ///< RESERVED6.
+            static constexpr auto CIPERENB = std::uint_fast8_t{ RESERVED6 + Size::RESERVED6 }; ///< CIPERENB.
+            static constexpr auto CICCENB0 = std::uint_fast8_t{ CIPERENB + Size::CIPERENB }; ///< CICCENB0.
+            static constexpr auto CICCENB1 = std::uint_fast8_t{ CICCENB0 + Size::CICCENB0 }; ///< CICCENB1.
+            static constexpr auto CICCENB2 = std::uint_fast8_t{ CICCENB1 + Size::CICCENB1 }; ///< CICCENB2.
+            static constexpr auto CICCENB3 = std::uint_fast8_t{ CICCENB2 + Size::CICCENB2 }; ///< CICCENB3.
+            static constexpr auto RESERVED12 = std::uint_fast8_t{ CICCENB3 + Size::CICCENB3 }; ///< RESERVED12.
+            static constexpr auto POLB0 = std::uint_fast8_t{ RESERVED12 + Size::RESERVED12 }; ///< POLB0.
+            static constexpr auto POLB1 = std::uint_fast8_t{ POLB0 + Size::POLB0 }; ///< POLB1.
+            static constexpr auto POLB2 = std::uint_fast8_t{ POLB1 + Size::POLB1 }; ///< POLB2.
+            static constexpr auto POLB3 = std::uint_fast8_t{ POLB2 + Size::POLB2 }; ///< POLB3.
+            static constexpr auto RESERVED20 = std::uint_fast8_t{ POLB3 + Size::POLB3 }; ///< RESERVED20.
+            static constexpr auto SWAPB0 = std::uint_fast8_t{ RESERVED20 + Size::RESERVED20 }; ///< SWAPB0.
+            static constexpr auto SWAPB1 = std::uint_fast8_t{ SWAPB0 + Size::SWAPB0 }; ///< SWAPB1.
+            static constexpr auto SWAPB2 = std::uint_fast8_t{ SWAPB1 + Size::SWAPB1 }; ///< SWAPB2.
+            static constexpr auto SWAPB3 = std::uint_fast8_t{ SWAPB2 + Size::SWAPB2 }; ///< SWAPB3.
+            static constexpr auto RESERVED28 = std::uint_fast8_t{ SWAPB3 + Size::SWAPB3 }; ///< RESERVED28.
+        };
+
+        /**
+         * \brief Field bit masks.
+         */
+        struct Mask {
+            static constexpr auto WAVEGENB = mask<std::uint32_t>( Size::WAVEGENB, Bit::WAVEGENB ); ///< WAVEGENB.
+            static constexpr auto RESERVED3 = mask<std::uint32_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+            static constexpr auto RAMPB = mask<std::uint32_t>( Size::RAMPB, Bit::RAMPB ); ///< RAMPB.
+            static constexpr auto RESERVED6 = mask<std::uint32_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+            static constexpr auto CIPERENB = mask<std::uint32_t>( Size::CIPERENB, Bit::CIPERENB ); ///< CIPERENB.
+            static constexpr auto CICCENB0 = mask<std::uint32_t>( Size::CICCENB0, Bit::CICCENB0 ); ///< CICCENB0.
+            static constexpr auto CICCENB1 = mask<std::uint32_t>( Size::CICCENB1, Bit::CICCENB1 ); ///< CICCENB1.
+            static constexpr auto CICCENB2 = mask<std::uint32_t>( Size::CICCENB2, Bit::CICCENB2 ); ///< CICCENB2.
+            static constexpr auto CICCENB3 = mask<std::uint32_t>( Size::CICCENB3, Bit::CICCENB3 ); ///< CICCENB3.
+            static constexpr auto RESERVED12 = mask<std::uint32_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+            static constexpr auto POLB0 = mask<std::uint32_t>( Size::POLB0, Bit::POLB0 ); ///< POLB0.
+            static constexpr auto POLB1 = mask<std::uint32_t>( Size::POLB1, Bit::POLB1 ); ///< POLB1.
+            static constexpr auto POLB2 = mask<std::uint32_t>( Size::POLB2, Bit::POLB2 ); ///< POLB2.
+            static constexpr auto POLB3 = mask<std::uint32_t>( Size::POLB3, Bit::POLB3 ); ///< POLB3.
+            static constexpr auto RESERVED20 = mask<std::uint32_t>( Size::RESERVED20, Bit::RESERVED20 ); ///< RESERVED20.
+            static constexpr auto SWAPB0 = mask<std::uint32_t>( Size::SWAPB0, Bit::SWAPB0 ); ///< SWAPB0.
+            static constexpr auto SWAPB1 = mask<std::uint32_t>( Size::SWAPB1, Bit::SWAPB1 ); ///< SWAPB1.
+            static constexpr auto SWAPB2 = mask<std::uint32_t>( Size::SWAPB2, Bit::SWAPB2 ); ///< SWAPB2.
+            static constexpr auto SWAPB3 = mask<std::uint32_t>( Size::SWAPB3, Bit::SWAPB3 ); ///< SWAPB3.
+            static constexpr auto RESERVED28 = mask<std::uint32_t>( Size::RESERVED28, Bit::RESERVED28 ); ///< RESERVED28.
+        };
+
+        /**
+         * \brief WAVEGENB.
+         */
+        enum WAVEGENB : std::uint32_t {
+            WAVEGENB_NFRQ       = 0x0 << Bit::WAVEGENB, ///< Normal frequency.
+            WAVEGENB_MFRQ       = 0x1 << Bit::WAVEGENB, ///< Match frequency.
+            WAVEGENB_NPWM       = 0x2 << Bit::WAVEGENB, ///< Normal PWM.
+            WAVEGENB_DSCRITICAL = 0x4 << Bit::WAVEGENB, ///< Dual-slope critical.
+            WAVEGENB_DSBOTTOM = 0x5 << Bit::WAVEGENB, ///< Dual-slope with interrupt/event condition when COUNT reaches ZERO.
+            WAVEGENB_DSBOTH = 0x6 << Bit::WAVEGENB, ///< Dual-slope with interrupt/event condition when COUNT reaches ZERO or TOP.
+            WAVEGENB_DSTOP = 0x7 << Bit::WAVEGENB, ///< Dual-slope with interrupt/event condition when COUNT reaches TOP.
+        };
+
+        /**
+         * \brief RAMPB.
+         */
+        enum RAMPB : std::uint32_t {
+            RAMPB_RAMP1  = 0x0 << Bit::RAMPB, ///< RAMP1 operation.
+            RAMPB_RAMP2A = 0x1 << Bit::RAMPB, ///< Alternative RAMP2 operation.
+            RAMPB_RAMP2  = 0x2 << Bit::RAMPB, ///< RAMP2 operation.
+        };
+
+        WAVEB() = delete;
+
+        WAVEB( WAVEB && ) = delete;
+
+        WAVEB( WAVEB const & ) = delete;
+
+        ~WAVEB() = delete;
+
+        auto operator=( WAVEB && ) = delete;
+
+        auto operator=( WAVEB const & ) = delete;
+
+        using Register<std::uint32_t>::operator=;
+    };
+
+    /**
+     * \brief CTRLA.
+     */
+    CTRLA ctrla;
+
+    /**
+     * \brief CTRLBCLR.
+     */
+    CTRLBCLR ctrlbclr;
+
+    /**
+     * \brief CTRLBSET.
+     */
+    CTRLBSET ctrlbset;
+
+    /**
+     * \brief Reserved registers (offset 0x06-0x07).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x06_0x07[ ( 0x07 - 0x06 ) + 1 ];
+
+    /**
+     * \brief SYNCBUSY.
+     */
+    SYNCBUSY const syncbusy;
+
+    /**
+     * \brief FCTRLA.
+     */
+    FCTRLA fctrla;
+
+    /**
+     * \brief FCTRLB.
+     */
+    FCTRLB fctrlb;
+
+    /**
+     * \brief WEXCTRL.
+     */
+    WEXCTRL wexctrl;
+
+    /**
+     * \brief DRVCTRL.
+     */
+    DRVCTRL drvctrl;
+
+    /**
+     * \brief Reserved registers (offset 0x1C-0x1D).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x1C_0x1D[ ( 0x1D - 0x1C ) + 1 ];
+
+    /**
+     * \brief DBGCTRL.
+     */
+    DBGCTRL dbgctrl;
+
+    /**
+     * \brief Reserved registers (offset 0x1F-0x1F).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x1F_0x1F[ ( 0x1F - 0x1F ) + 1 ];
+
+    /**
+     * \brief EVCTRL.
+     */
+    EVCTRL evctrl;
+
+    /**
+     * \brief INTENCLR.
+     */
+    INTENCLR intenclr;
+
+    /**
+     * \brief INTENSET.
+     */
+    INTENSET intenset;
+
+    /**
+     * \brief INTFLAG.
+     */
+    INTFLAG intflag;
+
+    /**
+     * \brief STATUS.
+     */
+    STATUS status;
+
+    /**
+     * \brief Count (COUNT) register.
+     */
+    Register<std::uint32_t> count;
+
+    /**
+     * \brief PATT.
+     */
+    PATT patt;
+
+    /**
+     * \brief Reserved registers (offset 0x3A-0x3B).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x3A_0x3B[ ( 0x3B - 0x3A ) + 1 ];
+
+    /**
+     * \brief WAVE.
+     */
+    WAVE wave;
+
+    /**
+     * \brief Period (PER) register.
+     */
+    Register<std::uint32_t> per;
+
+    /**
+     * \brief Compare/Capture (CC) registers.
+     */
+    Register<std::uint32_t> cc[ 4 ];
+
+    /**
+     * \brief Reserved registers (offset 0x54-0x63).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x54_0x63[ ( 0x63 - 0x54 ) + 1 ];
+
+    /**
+     * \brief PATTB.
+     */
+    PATTB pattb;
+
+    /**
+     * \brief Reserved registers (offset 0x66-0x67).
+     */
+    Reserved_Register<std::uint8_t> const reserved_0x66_0x67[ ( 0x67 - 0x66 ) + 1 ];
+
+    /**
+     * \brief WAVEB.
+     */
+    WAVEB waveb;
+
+    /**
+     * \brief Period Buffer (PERB) register.
+     */
+    Register<std::uint32_t> perb;
+
+    /**
+     * \brief Compare/Capture Buffer (CCB) registers.
+     */
+    Register<std::uint32_t> ccb[ 4 ];
+
+    TCC() = delete;
+
+    TCC( TCC && ) = delete;
+
+    TCC( TCC const & ) = delete;
+
+    ~TCC() = delete;
+
+    auto operator=( TCC && ) = delete;
+
+    auto operator=( TCC const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_TCC_H
@@ -0,0 +1,3673 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Peripheral::USB interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_USB_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_USB_H
+
+#include <cstdint>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/register.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Peripheral {
+
+/**
+ * \brief Microchip SAM D21/DA1 Universal Serial Bus (USB) peripheral.
+ */
+class USB {
+  public:
+    /**
+     * \brief Device mode.
+     */
+    class DEVICE {
+      public:
+        /**
+         * \brief Control A (CTRLA) register.
+         *
+         * This register has the following fields:
+         * - Software Reset (SWRST)
+         * - Enable (ENABLE)
+         * - Run in Standby (RUNSTDBY)
+         * - Operating Mode (MODE)
+         */
+        class CTRLA : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST     = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE    = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto RUNSTDBY  = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 4 }; ///< RESERVED3.
+                static constexpr auto MODE      = std::uint_fast8_t{ 1 }; ///< MODE.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto RUNSTDBY = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< RUNSTDBY.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< RESERVED3.
+                static constexpr auto MODE = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< MODE.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint8_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint8_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto RUNSTDBY = mask<std::uint8_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto MODE = mask<std::uint8_t>( Size::MODE, Bit::MODE ); ///< MODE.
+            };
+
+            /**
+             * \brief MODE.
+             */
+            enum MODE : std::uint8_t {
+                MODE_DEVICE = 0x0 << Bit::MODE, ///< Device mode.
+            };
+
+            CTRLA() = delete;
+
+            CTRLA( CTRLA && ) = delete;
+
+            CTRLA( CTRLA const & ) = delete;
+
+            ~CTRLA() = delete;
+
+            auto operator=( CTRLA && ) = delete;
+
+            auto operator=( CTRLA const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Synchronization Busy (SYNCBUSY) register.
+         *
+         * This register has the following fields:
+         * - Software Reset Synchronization Busy (SWRST)
+         * - Enable Synchronization Busy (ENABLE)
+         */
+        class SYNCBUSY : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST     = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE    = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 6 }; ///< RESERVED2.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< RESERVED2.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint8_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint8_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            };
+
+            SYNCBUSY() = delete;
+
+            SYNCBUSY( SYNCBUSY && ) = delete;
+
+            SYNCBUSY( SYNCBUSY const & ) = delete;
+
+            ~SYNCBUSY() = delete;
+
+            auto operator=( SYNCBUSY && ) = delete;
+
+            auto operator=( SYNCBUSY const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Quality of Service (QOSCTRL) register.
+         *
+         * This register has the following fields:
+         * - Configuration Quality of Service (CQOS)
+         * - Data Quality of Service (DQOS)
+         */
+        class QOSCTRL : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto CQOS      = std::uint_fast8_t{ 2 }; ///< CQOS.
+                static constexpr auto DQOS      = std::uint_fast8_t{ 2 }; ///< DQOS.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ 4 }; ///< RESERVED4.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto CQOS = std::uint_fast8_t{}; ///< CQOS.
+                static constexpr auto DQOS = std::uint_fast8_t{ CQOS + Size::CQOS }; ///< DQOS.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ DQOS + Size::DQOS }; ///< RESERVED4.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto CQOS = mask<std::uint8_t>( Size::CQOS, Bit::CQOS ); ///< CQOS.
+                static constexpr auto DQOS = mask<std::uint8_t>( Size::DQOS, Bit::DQOS ); ///< DQOS.
+                static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            };
+
+            /**
+             * \brief CQOS.
+             */
+            enum CQOS : std::uint8_t {
+                CQOS_DISABLE = 0x0 << Bit::CQOS, ///< Background (no sensitive operation).
+                CQOS_LOW     = 0x1 << Bit::CQOS, ///< Sensitive bandwidth.
+                CQOS_MEDIUM  = 0x2 << Bit::CQOS, ///< Sensitive latency.
+                CQOS_HIGH    = 0x3 << Bit::CQOS, ///< Critical latency.
+            };
+
+            /**
+             * \brief DQOS.
+             */
+            enum DQOS : std::uint8_t {
+                DQOS_DISABLE = 0x0 << Bit::DQOS, ///< Background (no sensitive operation).
+                DQOS_LOW     = 0x1 << Bit::DQOS, ///< Sensitive bandwidth.
+                DQOS_MEDIUM  = 0x2 << Bit::DQOS, ///< Sensitive latency.
+                DQOS_HIGH    = 0x3 << Bit::DQOS, ///< Critical latency.
+            };
+
+            QOSCTRL() = delete;
+
+            QOSCTRL( QOSCTRL && ) = delete;
+
+            QOSCTRL( QOSCTRL const & ) = delete;
+
+            ~QOSCTRL() = delete;
+
+            auto operator=( QOSCTRL && ) = delete;
+
+            auto operator=( QOSCTRL const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Control B (CTRLB) register.
+         *
+         * This register has the following fields:
+         * - Detach (DETACH)
+         * - Upstream Resume (UPRSM)
+         * - Speed Configuration (SPDCONF)
+         * - No Reply (NREPLY)
+         * - Test Mode J (TSTJ)
+         * - Test Mode K (TSTK)
+         * - Test Packet Mode (TSTPCKT)
+         * - Specific Operational Mode (OPMODE2)
+         * - Global NAK (GNAK)
+         * - Link Power Management Handshake (LPMHDSK)
+         */
+        class CTRLB : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DETACH     = std::uint_fast8_t{ 1 }; ///< DETACH.
+                static constexpr auto UPRSM      = std::uint_fast8_t{ 1 }; ///< UPRSM.
+                static constexpr auto SPDCONF    = std::uint_fast8_t{ 2 }; ///< SPDCONF.
+                static constexpr auto NREPLY     = std::uint_fast8_t{ 1 }; ///< NREPLY.
+                static constexpr auto TSTJ       = std::uint_fast8_t{ 1 }; ///< TSTJ.
+                static constexpr auto TSTK       = std::uint_fast8_t{ 1 }; ///< TSTK.
+                static constexpr auto TSTPCKT    = std::uint_fast8_t{ 1 }; ///< TSTPCKT.
+                static constexpr auto OPMODE2    = std::uint_fast8_t{ 1 }; ///< OPMODE2.
+                static constexpr auto GNAK       = std::uint_fast8_t{ 1 }; ///< GNAK.
+                static constexpr auto LPMHDSK    = std::uint_fast8_t{ 2 }; ///< LPMHDSK.
+                static constexpr auto RESERVED12 = std::uint_fast8_t{ 4 }; ///< RESERVED12.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DETACH = std::uint_fast8_t{}; ///< DETACH.
+                static constexpr auto UPRSM = std::uint_fast8_t{ DETACH + Size::DETACH }; ///< UPRSM.
+                static constexpr auto SPDCONF = std::uint_fast8_t{ UPRSM + Size::UPRSM }; ///< SPDCONF.
+                static constexpr auto NREPLY = std::uint_fast8_t{ SPDCONF + Size::SPDCONF }; ///< NREPLY.
+                static constexpr auto TSTJ = std::uint_fast8_t{ NREPLY + Size::NREPLY }; ///< TSTJ.
+                static constexpr auto TSTK = std::uint_fast8_t{ TSTJ + Size::TSTJ }; ///< TSTK.
+                static constexpr auto TSTPCKT = std::uint_fast8_t{ TSTK + Size::TSTK }; ///< TSTPCKT.
+                static constexpr auto OPMODE2 = std::uint_fast8_t{ TSTPCKT + Size::TSTPCKT }; ///< OPMODE2.
+                static constexpr auto GNAK = std::uint_fast8_t{ OPMODE2 + Size::OPMODE2 }; ///< GNAK.
+                static constexpr auto LPMHDSK = std::uint_fast8_t{ GNAK + Size::GNAK }; ///< LPMHDSK.
+                static constexpr auto RESERVED12 = std::uint_fast8_t{ LPMHDSK + Size::LPMHDSK }; ///< RESERVED12.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DETACH = mask<std::uint16_t>( Size::DETACH, Bit::DETACH ); ///< DETACH.
+                static constexpr auto UPRSM = mask<std::uint16_t>( Size::UPRSM, Bit::UPRSM ); ///< UPRSM.
+                static constexpr auto SPDCONF = mask<std::uint16_t>( Size::SPDCONF, Bit::SPDCONF ); ///< SPDCONF.
+                static constexpr auto NREPLY = mask<std::uint16_t>( Size::NREPLY, Bit::NREPLY ); ///< NREPLY.
+                static constexpr auto TSTJ = mask<std::uint16_t>( Size::TSTJ, Bit::TSTJ ); ///< TSTJ.
+                static constexpr auto TSTK = mask<std::uint16_t>( Size::TSTK, Bit::TSTK ); ///< TSTK.
+                static constexpr auto TSTPCKT = mask<std::uint16_t>( Size::TSTPCKT, Bit::TSTPCKT ); ///< TSTPCKT.
+                static constexpr auto OPMODE2 = mask<std::uint16_t>( Size::OPMODE2, Bit::OPMODE2 ); ///< OPMODE2.
+                static constexpr auto GNAK = mask<std::uint16_t>( Size::GNAK, Bit::GNAK ); ///< GNAK.
+                static constexpr auto LPMHDSK = mask<std::uint16_t>( Size::LPMHDSK, Bit::LPMHDSK ); ///< LPMHDSK.
+                static constexpr auto RESERVED12 = mask<std::uint16_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+            };
+
+            /**
+             * \brief SPDCONF.
+             */
+            enum SPDCONF : std::uint16_t {
+                SPDCONF_FS = 0x0 << Bit::SPDCONF, ///< Full-speed.
+                SPDCONF_LS = 0x1 << Bit::SPDCONF, ///< Low-speed.
+            };
+
+            /**
+             * \brief LPMHDSK.
+             */
+            enum LPMHDSK : std::uint16_t {
+                LPMHDSK_NO = 0x0 << Bit::LPMHDSK, ///< No handshake (LPM is not supported).
+                LPMHDSK_ACK  = 0x1 << Bit::LPMHDSK, ///< ACK.
+                LPMHDSK_NYET = 0x2 << Bit::LPMHDSK, ///< NYET.
+            };
+
+            CTRLB() = delete;
+
+            CTRLB( CTRLB && ) = delete;
+
+            CTRLB( CTRLB const & ) = delete;
+
+            ~CTRLB() = delete;
+
+            auto operator=( CTRLB && ) = delete;
+
+            auto operator=( CTRLB const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Device Address (DADD) register.
+         *
+         * This register has the following fields:
+         * - Device Address (DADD)
+         * - Device Address Enable (ADDEN)
+         */
+        class DADD : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto DADD  = std::uint_fast8_t{ 7 }; ///< DADD.
+                static constexpr auto ADDEN = std::uint_fast8_t{ 1 }; ///< ADDEN.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto DADD = std::uint_fast8_t{}; ///< DADD.
+                static constexpr auto ADDEN = std::uint_fast8_t{ DADD + Size::DADD }; ///< ADDEN.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto DADD = mask<std::uint8_t>( Size::DADD, Bit::DADD ); ///< DADD.
+                static constexpr auto ADDEN = mask<std::uint8_t>( Size::ADDEN, Bit::ADDEN ); ///< ADDEN.
+            };
+
+            DADD() = delete;
+
+            DADD( DADD && ) = delete;
+
+            DADD( DADD const & ) = delete;
+
+            ~DADD() = delete;
+
+            auto operator=( DADD && ) = delete;
+
+            auto operator=( DADD const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Status (STATUS) register.
+         *
+         * This register has the following fields:
+         * - Speed Status (SPEED)
+         * - USB Line State Status (LINESTATE)
+         */
+        class STATUS : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{ 2 }; ///< RESERVED0.
+                static constexpr auto SPEED     = std::uint_fast8_t{ 2 }; ///< SPEED.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ 2 }; ///< RESERVED4.
+                static constexpr auto LINESTATE = std::uint_fast8_t{ 2 }; ///< LINESTATE.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto SPEED = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< SPEED.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ SPEED + Size::SPEED }; ///< RESERVED4.
+                static constexpr auto LINESTATE = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< LINESTATE.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint8_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto SPEED = mask<std::uint8_t>( Size::SPEED, Bit::SPEED ); ///< SPEED.
+                static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+                static constexpr auto LINESTATE = mask<std::uint8_t>( Size::LINESTATE, Bit::LINESTATE ); ///< LINESTATE.
+            };
+
+            /**
+             * \brief LINESTATE.
+             */
+            enum LINESTATE : std::uint8_t {
+                LINESTATE_SE0 = 0x0 << Bit::LINESTATE, ///< SE0/RESET.
+                LINESTATE_J   = 0x1 << Bit::LINESTATE, ///< FS-J or LS-K state.
+                LINESTATE_K   = 0x2 << Bit::LINESTATE, ///< FS-K or LS-J state.
+            };
+
+            STATUS() = delete;
+
+            STATUS( STATUS && ) = delete;
+
+            STATUS( STATUS const & ) = delete;
+
+            ~STATUS() = delete;
+
+            auto operator=( STATUS && ) = delete;
+
+            auto operator=( STATUS const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Finite State Machine Status (FSMSTATUS) register.
+         *
+         * This register has the following fields:
+         * - Fine State Machine Status (FSMSTATE)
+         */
+        class FSMSTATUS : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto FSMSTATE  = std::uint_fast8_t{ 7 }; ///< FSMSTATE.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto FSMSTATE = std::uint_fast8_t{}; ///< FSMSTATE.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ FSMSTATE + Size::FSMSTATE }; ///< RESERVED7.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto FSMSTATE = mask<std::uint8_t>( Size::FSMSTATE, Bit::FSMSTATE ); ///< FSMSTATE.
+                static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+            };
+
+            /**
+             * \brief FSMSTATE.
+             */
+            enum FSMSTATE : std::uint8_t {
+                FSMSTATE_OFF      = 0x01 << Bit::FSMSTATE, ///< OFF (L3).
+                FSMSTATE_ON       = 0x02 << Bit::FSMSTATE, ///< ON (L0).
+                FSMSTATE_SUSPEND  = 0x04 << Bit::FSMSTATE, ///< SUSPEND (L2).
+                FSMSTATE_SLEEP    = 0x08 << Bit::FSMSTATE, ///< SLEEP (L1).
+                FSMSTATE_DNRESUME = 0x10 << Bit::FSMSTATE, ///< DNRESUME.
+                FSMSTATE_UPRESUME = 0x20 << Bit::FSMSTATE, ///< UPRESUME.
+                FSMSTATE_RESET    = 0x40 << Bit::FSMSTATE, ///< RESET.
+            };
+
+            FSMSTATUS() = delete;
+
+            FSMSTATUS( FSMSTATUS && ) = delete;
+
+            FSMSTATUS( FSMSTATUS const & ) = delete;
+
+            ~FSMSTATUS() = delete;
+
+            auto operator=( FSMSTATUS && ) = delete;
+
+            auto operator=( FSMSTATUS const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Frame Number (FNUM) register.
+         *
+         * This register has the following fields:
+         * - Micro Frame Number (MFNUM)
+         * - Frame Number (FNUM)
+         * - Frame Number CRC Error (FNCERR)
+         */
+        class FNUM : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto MFNUM      = std::uint_fast8_t{ 3 };  ///< MFNUM.
+                static constexpr auto FNUM       = std::uint_fast8_t{ 11 }; ///< FNUM.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ 1 }; ///< RESERVED14.
+                static constexpr auto FNCERR     = std::uint_fast8_t{ 1 }; ///< FNCERR.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto MFNUM = std::uint_fast8_t{}; ///< MFNUM.
+                static constexpr auto FNUM = std::uint_fast8_t{ MFNUM + Size::MFNUM }; ///< FNUM.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ FNUM + Size::FNUM }; ///< RESERVED14.
+                static constexpr auto FNCERR = std::uint_fast8_t{ RESERVED14 + Size::RESERVED14 }; ///< FNCERR.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto MFNUM = mask<std::uint16_t>( Size::MFNUM, Bit::MFNUM ); ///< MFNUM.
+                static constexpr auto FNUM = mask<std::uint16_t>( Size::FNUM, Bit::FNUM ); ///< FNUM.
+                static constexpr auto RESERVED14 = mask<std::uint16_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+                static constexpr auto FNCERR = mask<std::uint16_t>( Size::FNCERR, Bit::FNCERR ); ///< FNCERR.
+            };
+
+            FNUM() = delete;
+
+            FNUM( FNUM && ) = delete;
+
+            FNUM( FNUM const & ) = delete;
+
+            ~FNUM() = delete;
+
+            auto operator=( FNUM && ) = delete;
+
+            auto operator=( FNUM const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Clear (INTENCLR) register.
+         *
+         * This register has the following fields:
+         * - Suspend Interrupt Enable (SUSPEND)
+         * - Start-of-Frame Interrupt Enable (SOF)
+         * - End of Reset Interrupt Enable (EORST)
+         * - Wake Up Interrupt Enable (WAKEUP)
+         * - End of Resume Interrupt Enable (EORSM)
+         * - Upstream Resume Interrupt Enable (UPRSM)
+         * - RAM Access Interrupt Enable (RAMACER)
+         * - Link Power Management Not Yet Interrupt Enable (LPMNYET)
+         * - Link Power Management Suspend Interrupt Enable (LPMSUSP)
+         */
+        class INTENCLR : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SUSPEND    = std::uint_fast8_t{ 1 }; ///< SUSPEND.
+                static constexpr auto RESERVED1  = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                static constexpr auto SOF        = std::uint_fast8_t{ 1 }; ///< SOF.
+                static constexpr auto EORST      = std::uint_fast8_t{ 1 }; ///< EORST.
+                static constexpr auto WAKEUP     = std::uint_fast8_t{ 1 }; ///< WAKEUP.
+                static constexpr auto EORSM      = std::uint_fast8_t{ 1 }; ///< EORSM.
+                static constexpr auto UPRSM      = std::uint_fast8_t{ 1 }; ///< UPRSM.
+                static constexpr auto RAMACER    = std::uint_fast8_t{ 1 }; ///< RAMACER.
+                static constexpr auto LPMNYET    = std::uint_fast8_t{ 1 }; ///< LPMNYET.
+                static constexpr auto LPMSUSP    = std::uint_fast8_t{ 1 }; ///< LPMSUSP.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ 6 }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SUSPEND = std::uint_fast8_t{}; ///< SUSPEND.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ SUSPEND + Size::SUSPEND }; ///< RESERVED1.
+                static constexpr auto SOF = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< SOF.
+                static constexpr auto EORST = std::uint_fast8_t{ SOF + Size::SOF }; ///< EORST.
+                static constexpr auto WAKEUP = std::uint_fast8_t{ EORST + Size::EORST }; ///< WAKEUP.
+                static constexpr auto EORSM = std::uint_fast8_t{ WAKEUP + Size::WAKEUP }; ///< EORSM.
+                static constexpr auto UPRSM = std::uint_fast8_t{ EORSM + Size::EORSM }; ///< UPRSM.
+                static constexpr auto RAMACER = std::uint_fast8_t{ UPRSM + Size::UPRSM }; ///< RAMACER.
+                static constexpr auto LPMNYET = std::uint_fast8_t{ RAMACER + Size::RAMACER }; ///< LPMNYET.
+                static constexpr auto LPMSUSP = std::uint_fast8_t{ LPMNYET + Size::LPMNYET }; ///< LPMSUSP.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ LPMSUSP + Size::LPMSUSP }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SUSPEND = mask<std::uint16_t>( Size::SUSPEND, Bit::SUSPEND ); ///< SUSPEND.
+                static constexpr auto RESERVED1 = mask<std::uint16_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                static constexpr auto SOF = mask<std::uint16_t>( Size::SOF, Bit::SOF ); ///< SOF.
+                static constexpr auto EORST = mask<std::uint16_t>( Size::EORST, Bit::EORST ); ///< EORST.
+                static constexpr auto WAKEUP = mask<std::uint16_t>( Size::WAKEUP, Bit::WAKEUP ); ///< WAKEUP.
+                static constexpr auto EORSM = mask<std::uint16_t>( Size::EORSM, Bit::EORSM ); ///< EORSM.
+                static constexpr auto UPRSM = mask<std::uint16_t>( Size::UPRSM, Bit::UPRSM ); ///< UPRSM.
+                static constexpr auto RAMACER = mask<std::uint16_t>( Size::RAMACER, Bit::RAMACER ); ///< RAMACER.
+                static constexpr auto LPMNYET = mask<std::uint16_t>( Size::LPMNYET, Bit::LPMNYET ); ///< LPMNYET.
+                static constexpr auto LPMSUSP = mask<std::uint16_t>( Size::LPMSUSP, Bit::LPMSUSP ); ///< LPMSUSP.
+                static constexpr auto RESERVED10 = mask<std::uint16_t>( Size::RESERVED10, Bit::RESERVED10 ); ///< RESERVED10.
+            };
+
+            INTENCLR() = delete;
+
+            INTENCLR( INTENCLR && ) = delete;
+
+            INTENCLR( INTENCLR const & ) = delete;
+
+            ~INTENCLR() = delete;
+
+            auto operator=( INTENCLR && ) = delete;
+
+            auto operator=( INTENCLR const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Set (INTENSET) register.
+         *
+         * This register has the following fields:
+         * - Suspend Interrupt Enable (SUSPEND)
+         * - Start-of-Frame Interrupt Enable (SOF)
+         * - End of Reset Interrupt Enable (EORST)
+         * - Wake Up Interrupt Enable (WAKEUP)
+         * - End of Resume Interrupt Enable (EORSM)
+         * - Upstream Resume Interrupt Enable (UPRSM)
+         * - RAM Access Interrupt Enable (RAMACER)
+         * - Link Power Management Not Yet Interrupt Enable (LPMNYET)
+         * - Link Power Management Suspend Interrupt Enable (LPMSUSP)
+         */
+        class INTENSET : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SUSPEND    = std::uint_fast8_t{ 1 }; ///< SUSPEND.
+                static constexpr auto RESERVED1  = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                static constexpr auto SOF        = std::uint_fast8_t{ 1 }; ///< SOF.
+                static constexpr auto EORST      = std::uint_fast8_t{ 1 }; ///< EORST.
+                static constexpr auto WAKEUP     = std::uint_fast8_t{ 1 }; ///< WAKEUP.
+                static constexpr auto EORSM      = std::uint_fast8_t{ 1 }; ///< EORSM.
+                static constexpr auto UPRSM      = std::uint_fast8_t{ 1 }; ///< UPRSM.
+                static constexpr auto RAMACER    = std::uint_fast8_t{ 1 }; ///< RAMACER.
+                static constexpr auto LPMNYET    = std::uint_fast8_t{ 1 }; ///< LPMNYET.
+                static constexpr auto LPMSUSP    = std::uint_fast8_t{ 1 }; ///< LPMSUSP.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ 6 }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SUSPEND = std::uint_fast8_t{}; ///< SUSPEND.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ SUSPEND + Size::SUSPEND }; ///< RESERVED1.
+                static constexpr auto SOF = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< SOF.
+                static constexpr auto EORST = std::uint_fast8_t{ SOF + Size::SOF }; ///< EORST.
+                static constexpr auto WAKEUP = std::uint_fast8_t{ EORST + Size::EORST }; ///< WAKEUP.
+                static constexpr auto EORSM = std::uint_fast8_t{ WAKEUP + Size::WAKEUP }; ///< EORSM.
+                static constexpr auto UPRSM = std::uint_fast8_t{ EORSM + Size::EORSM }; ///< UPRSM.
+                static constexpr auto RAMACER = std::uint_fast8_t{ UPRSM + Size::UPRSM }; ///< RAMACER.
+                static constexpr auto LPMNYET = std::uint_fast8_t{ RAMACER + Size::RAMACER }; ///< LPMNYET.
+                static constexpr auto LPMSUSP = std::uint_fast8_t{ LPMNYET + Size::LPMNYET }; ///< LPMSUSP.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ LPMSUSP + Size::LPMSUSP }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SUSPEND = mask<std::uint16_t>( Size::SUSPEND, Bit::SUSPEND ); ///< SUSPEND.
+                static constexpr auto RESERVED1 = mask<std::uint16_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                static constexpr auto SOF = mask<std::uint16_t>( Size::SOF, Bit::SOF ); ///< SOF.
+                static constexpr auto EORST = mask<std::uint16_t>( Size::EORST, Bit::EORST ); ///< EORST.
+                static constexpr auto WAKEUP = mask<std::uint16_t>( Size::WAKEUP, Bit::WAKEUP ); ///< WAKEUP.
+                static constexpr auto EORSM = mask<std::uint16_t>( Size::EORSM, Bit::EORSM ); ///< EORSM.
+                static constexpr auto UPRSM = mask<std::uint16_t>( Size::UPRSM, Bit::UPRSM ); ///< UPRSM.
+                static constexpr auto RAMACER = mask<std::uint16_t>( Size::RAMACER, Bit::RAMACER ); ///< RAMACER.
+                static constexpr auto LPMNYET = mask<std::uint16_t>( Size::LPMNYET, Bit::LPMNYET ); ///< LPMNYET.
+                static constexpr auto LPMSUSP = mask<std::uint16_t>( Size::LPMSUSP, Bit::LPMSUSP ); ///< LPMSUSP.
+                static constexpr auto RESERVED10 = mask<std::uint16_t>( Size::RESERVED10, Bit::RESERVED10 ); ///< RESERVED10.
+            };
+
+            INTENSET() = delete;
+
+            INTENSET( INTENSET && ) = delete;
+
+            INTENSET( INTENSET const & ) = delete;
+
+            ~INTENSET() = delete;
+
+            auto operator=( INTENSET && ) = delete;
+
+            auto operator=( INTENSET const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+         *
+         * This register has the following fields:
+         * - Suspend Interrupt (SUSPEND)
+         * - Start-of-Frame Interrupt (SOF)
+         * - End of Reset Interrupt (EORST)
+         * - Wake Up Interrupt (WAKEUP)
+         * - End of Resume Interrupt (EORSM)
+         * - Upstream Resume Interrupt (UPRSM)
+         * - RAM Access Interrupt (RAMACER)
+         * - Link Power Management Not Yet Interrupt (LPMNYET)
+         * - Link Power Management Suspend Interrupt (LPMSUSP)
+         */
+        class INTFLAG : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SUSPEND    = std::uint_fast8_t{ 1 }; ///< SUSPEND.
+                static constexpr auto RESERVED1  = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                static constexpr auto SOF        = std::uint_fast8_t{ 1 }; ///< SOF.
+                static constexpr auto EORST      = std::uint_fast8_t{ 1 }; ///< EORST.
+                static constexpr auto WAKEUP     = std::uint_fast8_t{ 1 }; ///< WAKEUP.
+                static constexpr auto EORSM      = std::uint_fast8_t{ 1 }; ///< EORSM.
+                static constexpr auto UPRSM      = std::uint_fast8_t{ 1 }; ///< UPRSM.
+                static constexpr auto RAMACER    = std::uint_fast8_t{ 1 }; ///< RAMACER.
+                static constexpr auto LPMNYET    = std::uint_fast8_t{ 1 }; ///< LPMNYET.
+                static constexpr auto LPMSUSP    = std::uint_fast8_t{ 1 }; ///< LPMSUSP.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ 6 }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SUSPEND = std::uint_fast8_t{}; ///< SUSPEND.
+                static constexpr auto RESERVED1 = std::uint_fast8_t{ SUSPEND + Size::SUSPEND }; ///< RESERVED1.
+                static constexpr auto SOF = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< SOF.
+                static constexpr auto EORST = std::uint_fast8_t{ SOF + Size::SOF }; ///< EORST.
+                static constexpr auto WAKEUP = std::uint_fast8_t{ EORST + Size::EORST }; ///< WAKEUP.
+                static constexpr auto EORSM = std::uint_fast8_t{ WAKEUP + Size::WAKEUP }; ///< EORSM.
+                static constexpr auto UPRSM = std::uint_fast8_t{ EORSM + Size::EORSM }; ///< UPRSM.
+                static constexpr auto RAMACER = std::uint_fast8_t{ UPRSM + Size::UPRSM }; ///< RAMACER.
+                static constexpr auto LPMNYET = std::uint_fast8_t{ RAMACER + Size::RAMACER }; ///< LPMNYET.
+                static constexpr auto LPMSUSP = std::uint_fast8_t{ LPMNYET + Size::LPMNYET }; ///< LPMSUSP.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ LPMSUSP + Size::LPMSUSP }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SUSPEND = mask<std::uint16_t>( Size::SUSPEND, Bit::SUSPEND ); ///< SUSPEND.
+                static constexpr auto RESERVED1 = mask<std::uint16_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                static constexpr auto SOF = mask<std::uint16_t>( Size::SOF, Bit::SOF ); ///< SOF.
+                static constexpr auto EORST = mask<std::uint16_t>( Size::EORST, Bit::EORST ); ///< EORST.
+                static constexpr auto WAKEUP = mask<std::uint16_t>( Size::WAKEUP, Bit::WAKEUP ); ///< WAKEUP.
+                static constexpr auto EORSM = mask<std::uint16_t>( Size::EORSM, Bit::EORSM ); ///< EORSM.
+                static constexpr auto UPRSM = mask<std::uint16_t>( Size::UPRSM, Bit::UPRSM ); ///< UPRSM.
+                static constexpr auto RAMACER = mask<std::uint16_t>( Size::RAMACER, Bit::RAMACER ); ///< RAMACER.
+                static constexpr auto LPMNYET = mask<std::uint16_t>( Size::LPMNYET, Bit::LPMNYET ); ///< LPMNYET.
+                static constexpr auto LPMSUSP = mask<std::uint16_t>( Size::LPMSUSP, Bit::LPMSUSP ); ///< LPMSUSP.
+                static constexpr auto RESERVED10 = mask<std::uint16_t>( Size::RESERVED10, Bit::RESERVED10 ); ///< RESERVED10.
+            };
+
+            INTFLAG() = delete;
+
+            INTFLAG( INTFLAG && ) = delete;
+
+            INTFLAG( INTFLAG const & ) = delete;
+
+            ~INTFLAG() = delete;
+
+            auto operator=( INTFLAG && ) = delete;
+
+            auto operator=( INTFLAG const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Endpoint Interrupt Summary (EPINTSMRY) register.
+         *
+         * This register has the following fields:
+         * - Endpoint Interrupt 0 (EPINT0)
+         * - Endpoint Interrupt 1 (EPINT1)
+         * - Endpoint Interrupt 2 (EPINT2)
+         * - Endpoint Interrupt 3 (EPINT3)
+         * - Endpoint Interrupt 4 (EPINT4)
+         * - Endpoint Interrupt 5 (EPINT5)
+         * - Endpoint Interrupt 6 (EPINT6)
+         * - Endpoint Interrupt 7 (EPINT7)
+         */
+        class EPINTSMRY : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto EPINT0    = std::uint_fast8_t{ 1 }; ///< EPINT0.
+                static constexpr auto EPINT1    = std::uint_fast8_t{ 1 }; ///< EPINT1.
+                static constexpr auto EPINT2    = std::uint_fast8_t{ 1 }; ///< EPINT2.
+                static constexpr auto EPINT3    = std::uint_fast8_t{ 1 }; ///< EPINT3.
+                static constexpr auto EPINT4    = std::uint_fast8_t{ 1 }; ///< EPINT4.
+                static constexpr auto EPINT5    = std::uint_fast8_t{ 1 }; ///< EPINT5.
+                static constexpr auto EPINT6    = std::uint_fast8_t{ 1 }; ///< EPINT6.
+                static constexpr auto EPINT7    = std::uint_fast8_t{ 1 }; ///< EPINT7.
+                static constexpr auto RESERVED8 = std::uint_fast8_t{ 8 }; ///< RESERVED8.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto EPINT0 = std::uint_fast8_t{}; ///< EPINT0.
+                static constexpr auto EPINT1 = std::uint_fast8_t{ EPINT0 + Size::EPINT0 }; ///< EPINT1.
+                static constexpr auto EPINT2 = std::uint_fast8_t{ EPINT1 + Size::EPINT1 }; ///< EPINT2.
+                static constexpr auto EPINT3 = std::uint_fast8_t{ EPINT2 + Size::EPINT2 }; ///< EPINT3.
+                static constexpr auto EPINT4 = std::uint_fast8_t{ EPINT3 + Size::EPINT3 }; ///< EPINT4.
+                static constexpr auto EPINT5 = std::uint_fast8_t{ EPINT4 + Size::EPINT4 }; ///< EPINT5.
+                static constexpr auto EPINT6 = std::uint_fast8_t{ EPINT5 + Size::EPINT5 }; ///< EPINT6.
+                static constexpr auto EPINT7 = std::uint_fast8_t{ EPINT6 + Size::EPINT6 }; ///< EPINT7.
+                static constexpr auto RESERVED8 = std::uint_fast8_t{ EPINT7 + Size::EPINT7 }; ///< RESERVED8.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto EPINT0 = mask<std::uint16_t>( Size::EPINT0, Bit::EPINT0 ); ///< EPINT0.
+                static constexpr auto EPINT1 = mask<std::uint16_t>( Size::EPINT1, Bit::EPINT1 ); ///< EPINT1.
+                static constexpr auto EPINT2 = mask<std::uint16_t>( Size::EPINT2, Bit::EPINT2 ); ///< EPINT2.
+                static constexpr auto EPINT3 = mask<std::uint16_t>( Size::EPINT3, Bit::EPINT3 ); ///< EPINT3.
+                static constexpr auto EPINT4 = mask<std::uint16_t>( Size::EPINT4, Bit::EPINT4 ); ///< EPINT4.
+                static constexpr auto EPINT5 = mask<std::uint16_t>( Size::EPINT5, Bit::EPINT5 ); ///< EPINT5.
+                static constexpr auto EPINT6 = mask<std::uint16_t>( Size::EPINT6, Bit::EPINT6 ); ///< EPINT6.
+                static constexpr auto EPINT7 = mask<std::uint16_t>( Size::EPINT7, Bit::EPINT7 ); ///< EPINT7.
+                static constexpr auto RESERVED8 = mask<std::uint16_t>( Size::RESERVED8, Bit::RESERVED8 ); ///< RESERVED8.
+            };
+
+            EPINTSMRY() = delete;
+
+            EPINTSMRY( EPINTSMRY && ) = delete;
+
+            EPINTSMRY( EPINTSMRY const & ) = delete;
+
+            ~EPINTSMRY() = delete;
+
+            auto operator=( EPINTSMRY && ) = delete;
+
+            auto operator=( EPINTSMRY const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Pad Calibration (PADCAL) register.
+         *
+         * This register has the following fields:
+         * - USB Pad Transp Calibration (TRANSP)
+         * - USB Pad Transn Calibration (TRANSN)
+         * - USB Pad Trim Calibration (TRIM)
+         */
+        class PADCAL : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto TRANSP     = std::uint_fast8_t{ 5 }; ///< TRANSP.
+                static constexpr auto RESERVED5  = std::uint_fast8_t{ 1 }; ///< RESERVED5.
+                static constexpr auto TRANSN     = std::uint_fast8_t{ 5 }; ///< TRANSN.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ 1 }; ///< RESERVED11.
+                static constexpr auto TRIM       = std::uint_fast8_t{ 3 }; ///< TRIM.
+                static constexpr auto RESERVED15 = std::uint_fast8_t{ 1 }; ///< RESERVED15.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto TRANSP = std::uint_fast8_t{}; ///< TRANSP.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ TRANSP + Size::TRANSP }; ///< RESERVED5.
+                static constexpr auto TRANSN = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< TRANSN.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ TRANSN + Size::TRANSN }; ///< RESERVED11.
+                static constexpr auto TRIM = std::uint_fast8_t{ RESERVED11 + Size::RESERVED11 }; ///< TRIM.
+                static constexpr auto RESERVED15 = std::uint_fast8_t{ TRIM + Size::TRIM }; ///< RESERVED15.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto TRANSP = mask<std::uint16_t>( Size::TRANSP, Bit::TRANSP ); ///< TRANSP.
+                static constexpr auto RESERVED5 = mask<std::uint16_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto TRANSN = mask<std::uint16_t>( Size::TRANSN, Bit::TRANSN ); ///< TRANSN.
+                static constexpr auto RESERVED11 = mask<std::uint16_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+                static constexpr auto TRIM = mask<std::uint16_t>( Size::TRIM, Bit::TRIM ); ///< TRIM.
+                static constexpr auto RESERVED15 = mask<std::uint16_t>( Size::RESERVED15, Bit::RESERVED15 ); ///< RESERVED15.
+            };
+
+            PADCAL() = delete;
+
+            PADCAL( PADCAL && ) = delete;
+
+            PADCAL( PADCAL const & ) = delete;
+
+            ~PADCAL() = delete;
+
+            auto operator=( PADCAL && ) = delete;
+
+            auto operator=( PADCAL const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Endpoint registers.
+         */
+        class ENDPOINT {
+          public:
+            /**
+             * \brief Endpoint Configuration (EPCFG) register.
+             *
+             * This register has the following fields:
+             * - Endpoint Type for OUT Direction (EPTYPE0)
+             * - Endpoint Type for IN Direction (EPTYPE1)
+             */
+            class EPCFG : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto EPTYPE0 = std::uint_fast8_t{ 3 }; ///< EPTYPE0.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                    static constexpr auto EPTYPE1 = std::uint_fast8_t{ 3 }; ///< EPTYPE1.
+                    static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto EPTYPE0 = std::uint_fast8_t{}; ///< EPTYPE0.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ EPTYPE0 + Size::EPTYPE0 }; ///< RESERVED3.
+                    static constexpr auto EPTYPE1 = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< EPTYPE1.
+                    static constexpr auto RESERVED7 = std::uint_fast8_t{ EPTYPE1 + Size::EPTYPE1 }; ///< RESERVED7.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto EPTYPE0 = mask<std::uint8_t>( Size::EPTYPE0, Bit::EPTYPE0 ); ///< EPTYPE0.
+                    static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                    static constexpr auto EPTYPE1 = mask<std::uint8_t>( Size::EPTYPE1, Bit::EPTYPE1 ); ///< EPTYPE1.
+                    static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                };
+
+                /**
+                 * \brief EPTYPE0.
+                 */
+                enum EPTYPE0 : std::uint8_t {
+                    EPTYPE0_DISABLED = 0x0 << Bit::EPTYPE0, ///< Endpoint bank disabled.
+                    EPTYPE0_CONTROL  = 0x1 << Bit::EPTYPE0, ///< Control endpoint bank.
+                    EPTYPE0_ISOCHRONOUS = 0x2 << Bit::EPTYPE0, ///< Isochronous endpoint bank.
+                    EPTYPE0_BULK        = 0x3 << Bit::EPTYPE0, ///< Bulk endpoint bank.
+                    EPTYPE0_INTERRUPT = 0x4 << Bit::EPTYPE0, ///< Interrupt endpoint bank.
+                    EPTYPE0_DUAL_BANK = 0x5 << Bit::EPTYPE0, ///< Second bank of the other bank's (same direction) endpoint.
+                };
+
+                /**
+                 * \brief EPTYPE1.
+                 */
+                enum EPTYPE1 : std::uint8_t {
+                    EPTYPE1_DISABLED = 0x0 << Bit::EPTYPE1, ///< Endpoint bank disabled.
+                    EPTYPE1_CONTROL  = 0x1 << Bit::EPTYPE1, ///< Control endpoint bank.
+                    EPTYPE1_ISOCHRONOUS = 0x2 << Bit::EPTYPE1, ///< Isochronous endpoint bank.
+                    EPTYPE1_BULK        = 0x3 << Bit::EPTYPE1, ///< Bulk endpoint bank.
+                    EPTYPE1_INTERRUPT = 0x4 << Bit::EPTYPE1, ///< Interrupt endpoint bank.
+                    EPTYPE1_DUAL_BANK = 0x5 << Bit::EPTYPE1, ///< Second bank of the other bank's (same direction) endpoint.
+                };
+
+                EPCFG() = delete;
+
+                EPCFG( EPCFG && ) = delete;
+
+                EPCFG( EPCFG const & ) = delete;
+
+                ~EPCFG() = delete;
+
+                auto operator=( EPCFG && ) = delete;
+
+                auto operator=( EPCFG const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Endpoint Status Clear (EPSTATUSCLR) register.
+             *
+             * This register has the following fields:
+             * - Data Toggle OUT (DTGLOUT)
+             * - Data Toggle IN (DTGLIN)
+             * - Current Bank (CURBK)
+             * - Stall Bank 0 Request (STALLRQ0)
+             * - Stall Bank 1 Request (STALLRQ1)
+             * - Bank 0 Ready (BK0RDY)
+             * - Bank 1 Ready (BK1RDY)
+             */
+            class EPSTATUSCLR : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto DTGLOUT = std::uint_fast8_t{ 1 }; ///< DTGLOUT.
+                    static constexpr auto DTGLIN  = std::uint_fast8_t{ 1 }; ///< DTGLIN.
+                    static constexpr auto CURBK   = std::uint_fast8_t{ 1 }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                    static constexpr auto STALLRQ0 = std::uint_fast8_t{ 1 }; ///< STALLRQ0.
+                    static constexpr auto STALLRQ1 = std::uint_fast8_t{ 1 }; ///< STALLRQ1.
+                    static constexpr auto BK0RDY   = std::uint_fast8_t{ 1 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY   = std::uint_fast8_t{ 1 }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto DTGLOUT = std::uint_fast8_t{}; ///< DTGLOUT.
+                    static constexpr auto DTGLIN = std::uint_fast8_t{ DTGLOUT + Size::DTGLOUT }; ///< DTGLIN.
+                    static constexpr auto CURBK = std::uint_fast8_t{ DTGLIN + Size::DTGLIN }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ CURBK + Size::CURBK }; ///< RESERVED3.
+                    static constexpr auto STALLRQ0 = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< STALLRQ0.
+                    static constexpr auto STALLRQ1 = std::uint_fast8_t{ STALLRQ0 + Size::STALLRQ0 }; ///< STALLRQ1.
+                    static constexpr auto BK0RDY = std::uint_fast8_t{ STALLRQ1 + Size::STALLRQ1 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY = std::uint_fast8_t{ BK0RDY + Size::BK0RDY }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto DTGLOUT = mask<std::uint8_t>( Size::DTGLOUT, Bit::DTGLOUT ); ///< DTGLOUT.
+                    static constexpr auto DTGLIN = mask<std::uint8_t>( Size::DTGLIN, Bit::DTGLIN ); ///< DTGLIN.
+                    static constexpr auto CURBK = mask<std::uint8_t>( Size::CURBK, Bit::CURBK ); ///< CURBK.
+                    static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                    static constexpr auto STALLRQ0 = mask<std::uint8_t>( Size::STALLRQ0, Bit::STALLRQ0 ); ///< STALLRQ0.
+                    static constexpr auto STALLRQ1 = mask<std::uint8_t>( Size::STALLRQ1, Bit::STALLRQ1 ); ///< STALLRQ1.
+                    static constexpr auto BK0RDY = mask<std::uint8_t>( Size::BK0RDY, Bit::BK0RDY ); ///< BK0RDY.
+                    static constexpr auto BK1RDY = mask<std::uint8_t>( Size::BK1RDY, Bit::BK1RDY ); ///< BK1RDY.
+                };
+
+                EPSTATUSCLR() = delete;
+
+                EPSTATUSCLR( EPSTATUSCLR && ) = delete;
+
+                EPSTATUSCLR( EPSTATUSCLR const & ) = delete;
+
+                ~EPSTATUSCLR() = delete;
+
+                auto operator=( EPSTATUSCLR && ) = delete;
+
+                auto operator=( EPSTATUSCLR const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Endpoint Status Set (EPSTATUSSET) register.
+             *
+             * This register has the following fields:
+             * - Data Toggle OUT (DTGLOUT)
+             * - Data Toggle IN (DTGLIN)
+             * - Current Bank (CURBK)
+             * - Stall Bank 0 Request (STALLRQ0)
+             * - Stall Bank 1 Request (STALLRQ1)
+             * - Bank 0 Ready (BK0RDY)
+             * - Bank 1 Ready (BK1RDY)
+             */
+            class EPSTATUSSET : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto DTGLOUT = std::uint_fast8_t{ 1 }; ///< DTGLOUT.
+                    static constexpr auto DTGLIN  = std::uint_fast8_t{ 1 }; ///< DTGLIN.
+                    static constexpr auto CURBK   = std::uint_fast8_t{ 1 }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                    static constexpr auto STALLRQ0 = std::uint_fast8_t{ 1 }; ///< STALLRQ0.
+                    static constexpr auto STALLRQ1 = std::uint_fast8_t{ 1 }; ///< STALLRQ1.
+                    static constexpr auto BK0RDY   = std::uint_fast8_t{ 1 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY   = std::uint_fast8_t{ 1 }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto DTGLOUT = std::uint_fast8_t{}; ///< DTGLOUT.
+                    static constexpr auto DTGLIN = std::uint_fast8_t{ DTGLOUT + Size::DTGLOUT }; ///< DTGLIN.
+                    static constexpr auto CURBK = std::uint_fast8_t{ DTGLIN + Size::DTGLIN }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ CURBK + Size::CURBK }; ///< RESERVED3.
+                    static constexpr auto STALLRQ0 = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< STALLRQ0.
+                    static constexpr auto STALLRQ1 = std::uint_fast8_t{ STALLRQ0 + Size::STALLRQ0 }; ///< STALLRQ1.
+                    static constexpr auto BK0RDY = std::uint_fast8_t{ STALLRQ1 + Size::STALLRQ1 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY = std::uint_fast8_t{ BK0RDY + Size::BK0RDY }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto DTGLOUT = mask<std::uint8_t>( Size::DTGLOUT, Bit::DTGLOUT ); ///< DTGLOUT.
+                    static constexpr auto DTGLIN = mask<std::uint8_t>( Size::DTGLIN, Bit::DTGLIN ); ///< DTGLIN.
+                    static constexpr auto CURBK = mask<std::uint8_t>( Size::CURBK, Bit::CURBK ); ///< CURBK.
+                    static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                    static constexpr auto STALLRQ0 = mask<std::uint8_t>( Size::STALLRQ0, Bit::STALLRQ0 ); ///< STALLRQ0.
+                    static constexpr auto STALLRQ1 = mask<std::uint8_t>( Size::STALLRQ1, Bit::STALLRQ1 ); ///< STALLRQ1.
+                    static constexpr auto BK0RDY = mask<std::uint8_t>( Size::BK0RDY, Bit::BK0RDY ); ///< BK0RDY.
+                    static constexpr auto BK1RDY = mask<std::uint8_t>( Size::BK1RDY, Bit::BK1RDY ); ///< BK1RDY.
+                };
+
+                EPSTATUSSET() = delete;
+
+                EPSTATUSSET( EPSTATUSSET && ) = delete;
+
+                EPSTATUSSET( EPSTATUSSET const & ) = delete;
+
+                ~EPSTATUSSET() = delete;
+
+                auto operator=( EPSTATUSSET && ) = delete;
+
+                auto operator=( EPSTATUSSET const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Endpoint Status (EPSTATUS) register.
+             *
+             * This register has the following fields:
+             * - Data Toggle OUT (DTGLOUT)
+             * - Data Toggle IN (DTGLIN)
+             * - Current Bank (CURBK)
+             * - Stall Bank 0 Request (STALLRQ0)
+             * - Stall Bank 1 Request (STALLRQ1)
+             * - Bank 0 Ready (BK0RDY)
+             * - Bank 1 Ready (BK1RDY)
+             */
+            class EPSTATUS : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto DTGLOUT = std::uint_fast8_t{ 1 }; ///< DTGLOUT.
+                    static constexpr auto DTGLIN  = std::uint_fast8_t{ 1 }; ///< DTGLIN.
+                    static constexpr auto CURBK   = std::uint_fast8_t{ 1 }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                    static constexpr auto STALLRQ0 = std::uint_fast8_t{ 1 }; ///< STALLRQ0.
+                    static constexpr auto STALLRQ1 = std::uint_fast8_t{ 1 }; ///< STALLRQ1.
+                    static constexpr auto BK0RDY   = std::uint_fast8_t{ 1 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY   = std::uint_fast8_t{ 1 }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto DTGLOUT = std::uint_fast8_t{}; ///< DTGLOUT.
+                    static constexpr auto DTGLIN = std::uint_fast8_t{ DTGLOUT + Size::DTGLOUT }; ///< DTGLIN.
+                    static constexpr auto CURBK = std::uint_fast8_t{ DTGLIN + Size::DTGLIN }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ CURBK + Size::CURBK }; ///< RESERVED3.
+                    static constexpr auto STALLRQ0 = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< STALLRQ0.
+                    static constexpr auto STALLRQ1 = std::uint_fast8_t{ STALLRQ0 + Size::STALLRQ0 }; ///< STALLRQ1.
+                    static constexpr auto BK0RDY = std::uint_fast8_t{ STALLRQ1 + Size::STALLRQ1 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY = std::uint_fast8_t{ BK0RDY + Size::BK0RDY }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto DTGLOUT = mask<std::uint8_t>( Size::DTGLOUT, Bit::DTGLOUT ); ///< DTGLOUT.
+                    static constexpr auto DTGLIN = mask<std::uint8_t>( Size::DTGLIN, Bit::DTGLIN ); ///< DTGLIN.
+                    static constexpr auto CURBK = mask<std::uint8_t>( Size::CURBK, Bit::CURBK ); ///< CURBK.
+                    static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                    static constexpr auto STALLRQ0 = mask<std::uint8_t>( Size::STALLRQ0, Bit::STALLRQ0 ); ///< STALLRQ0.
+                    static constexpr auto STALLRQ1 = mask<std::uint8_t>( Size::STALLRQ1, Bit::STALLRQ1 ); ///< STALLRQ1.
+                    static constexpr auto BK0RDY = mask<std::uint8_t>( Size::BK0RDY, Bit::BK0RDY ); ///< BK0RDY.
+                    static constexpr auto BK1RDY = mask<std::uint8_t>( Size::BK1RDY, Bit::BK1RDY ); ///< BK1RDY.
+                };
+
+                EPSTATUS() = delete;
+
+                EPSTATUS( EPSTATUS && ) = delete;
+
+                EPSTATUS( EPSTATUS const & ) = delete;
+
+                ~EPSTATUS() = delete;
+
+                auto operator=( EPSTATUS && ) = delete;
+
+                auto operator=( EPSTATUS const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Endpoint Interrupt Flag (EPINTFLAG) register.
+             *
+             * This register has the following fields:
+             * - Transfer Complete 0 Interrupt (TRCPT0)
+             * - Transfer Complete 1 Interrupt (TRCPT1)
+             * - Transfer Fail 0 Interrupt (TRFAIL0)
+             * - Transfer Fail 1 Interrupt (TRFAIL1)
+             * - Received Setup Interrupt (RXSTP)
+             * - Stall 0 Interrupt (STALL0)
+             * - Stall 1 Interrupt (STALL1)
+             */
+            class EPINTFLAG : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto TRCPT0  = std::uint_fast8_t{ 1 }; ///< TRCPT0.
+                    static constexpr auto TRCPT1  = std::uint_fast8_t{ 1 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL0 = std::uint_fast8_t{ 1 }; ///< TRFAIL0.
+                    static constexpr auto TRFAIL1 = std::uint_fast8_t{ 1 }; ///< TRFAIL1.
+                    static constexpr auto RXSTP   = std::uint_fast8_t{ 1 }; ///< RXSTP.
+                    static constexpr auto STALL0  = std::uint_fast8_t{ 1 }; ///< STALL0.
+                    static constexpr auto STALL1  = std::uint_fast8_t{ 1 }; ///< STALL1.
+                    static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto TRCPT0 = std::uint_fast8_t{}; ///< TRCPT0.
+                    static constexpr auto TRCPT1 = std::uint_fast8_t{ TRCPT0 + Size::TRCPT0 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL0 = std::uint_fast8_t{ TRCPT1 + Size::TRCPT1 }; ///< TRFAIL0.
+                    static constexpr auto TRFAIL1 = std::uint_fast8_t{ TRFAIL0 + Size::TRFAIL0 }; ///< TRFAIL1.
+                    static constexpr auto RXSTP = std::uint_fast8_t{ TRFAIL1 + Size::TRFAIL1 }; ///< RXSTP.
+                    static constexpr auto STALL0 = std::uint_fast8_t{ RXSTP + Size::RXSTP }; ///< STALL0.
+                    static constexpr auto STALL1 = std::uint_fast8_t{ STALL0 + Size::STALL0 }; ///< STALL1.
+                    static constexpr auto RESERVED7 = std::uint_fast8_t{ STALL1 + Size::STALL1 }; ///< RESERVED7.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto TRCPT0 = mask<std::uint8_t>( Size::TRCPT0, Bit::TRCPT0 ); ///< TRCPT0.
+                    static constexpr auto TRCPT1 = mask<std::uint8_t>( Size::TRCPT1, Bit::TRCPT1 ); ///< TRCPT1.
+                    static constexpr auto TRFAIL0 = mask<std::uint8_t>( Size::TRFAIL0, Bit::TRFAIL0 ); ///< TRFAIL0.
+                    static constexpr auto TRFAIL1 = mask<std::uint8_t>( Size::TRFAIL1, Bit::TRFAIL1 ); ///< TRFAIL1.
+                    static constexpr auto RXSTP = mask<std::uint8_t>( Size::RXSTP, Bit::RXSTP ); ///< RXSTP.
+                    static constexpr auto STALL0 = mask<std::uint8_t>( Size::STALL0, Bit::STALL0 ); ///< STALL0.
+                    static constexpr auto STALL1 = mask<std::uint8_t>( Size::STALL1, Bit::STALL1 ); ///< STALL1.
+                    static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                };
+
+                EPINTFLAG() = delete;
+
+                EPINTFLAG( EPINTFLAG && ) = delete;
+
+                EPINTFLAG( EPINTFLAG const & ) = delete;
+
+                ~EPINTFLAG() = delete;
+
+                auto operator=( EPINTFLAG && ) = delete;
+
+                auto operator=( EPINTFLAG const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Endpoint Interrupt Enable Clear (EPINTENCLR) register.
+             *
+             * This register has the following fields:
+             * - Transfer Complete 0 Interrupt Enable (TRCPT0)
+             * - Transfer Complete 1 Interrupt Enable (TRCPT1)
+             * - Transfer Fail 0 Interrupt Enable (TRFAIL0)
+             * - Transfer Fail 1 Interrupt Enable (TRFAIL1)
+             * - Received Setup Interrupt Enable (RXSTP)
+             * - Stall 0 Interrupt Enable (STALL0)
+             * - Stall 1 Interrupt Enable (STALL1)
+             */
+            class EPINTENCLR : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto TRCPT0  = std::uint_fast8_t{ 1 }; ///< TRCPT0.
+                    static constexpr auto TRCPT1  = std::uint_fast8_t{ 1 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL0 = std::uint_fast8_t{ 1 }; ///< TRFAIL0.
+                    static constexpr auto TRFAIL1 = std::uint_fast8_t{ 1 }; ///< TRFAIL1.
+                    static constexpr auto RXSTP   = std::uint_fast8_t{ 1 }; ///< RXSTP.
+                    static constexpr auto STALL0  = std::uint_fast8_t{ 1 }; ///< STALL0.
+                    static constexpr auto STALL1  = std::uint_fast8_t{ 1 }; ///< STALL1.
+                    static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto TRCPT0 = std::uint_fast8_t{}; ///< TRCPT0.
+                    static constexpr auto TRCPT1 = std::uint_fast8_t{ TRCPT0 + Size::TRCPT0 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL0 = std::uint_fast8_t{ TRCPT1 + Size::TRCPT1 }; ///< TRFAIL0.
+                    static constexpr auto TRFAIL1 = std::uint_fast8_t{ TRFAIL0 + Size::TRFAIL0 }; ///< TRFAIL1.
+                    static constexpr auto RXSTP = std::uint_fast8_t{ TRFAIL1 + Size::TRFAIL1 }; ///< RXSTP.
+                    static constexpr auto STALL0 = std::uint_fast8_t{ RXSTP + Size::RXSTP }; ///< STALL0.
+                    static constexpr auto STALL1 = std::uint_fast8_t{ STALL0 + Size::STALL0 }; ///< STALL1.
+                    static constexpr auto RESERVED7 = std::uint_fast8_t{ STALL1 + Size::STALL1 }; ///< RESERVED7.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto TRCPT0 = mask<std::uint8_t>( Size::TRCPT0, Bit::TRCPT0 ); ///< TRCPT0.
+                    static constexpr auto TRCPT1 = mask<std::uint8_t>( Size::TRCPT1, Bit::TRCPT1 ); ///< TRCPT1.
+                    static constexpr auto TRFAIL0 = mask<std::uint8_t>( Size::TRFAIL0, Bit::TRFAIL0 ); ///< TRFAIL0.
+                    static constexpr auto TRFAIL1 = mask<std::uint8_t>( Size::TRFAIL1, Bit::TRFAIL1 ); ///< TRFAIL1.
+                    static constexpr auto RXSTP = mask<std::uint8_t>( Size::RXSTP, Bit::RXSTP ); ///< RXSTP.
+                    static constexpr auto STALL0 = mask<std::uint8_t>( Size::STALL0, Bit::STALL0 ); ///< STALL0.
+                    static constexpr auto STALL1 = mask<std::uint8_t>( Size::STALL1, Bit::STALL1 ); ///< STALL1.
+                    static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                };
+
+                EPINTENCLR() = delete;
+
+                EPINTENCLR( EPINTENCLR && ) = delete;
+
+                EPINTENCLR( EPINTENCLR const & ) = delete;
+
+                ~EPINTENCLR() = delete;
+
+                auto operator=( EPINTENCLR && ) = delete;
+
+                auto operator=( EPINTENCLR const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Endpoint Interrupt Enable Set (EPINTENSET) register.
+             *
+             * This register has the following fields:
+             * - Transfer Complete 0 Interrupt Enable (TRCPT0)
+             * - Transfer Complete 1 Interrupt Enable (TRCPT1)
+             * - Transfer Fail 0 Interrupt Enable (TRFAIL0)
+             * - Transfer Fail 1 Interrupt Enable (TRFAIL1)
+             * - Received Setup Interrupt Enable (RXSTP)
+             * - Stall 0 Interrupt Enable (STALL0)
+             * - Stall 1 Interrupt Enable (STALL1)
+             */
+            class EPINTENSET : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto TRCPT0  = std::uint_fast8_t{ 1 }; ///< TRCPT0.
+                    static constexpr auto TRCPT1  = std::uint_fast8_t{ 1 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL0 = std::uint_fast8_t{ 1 }; ///< TRFAIL0.
+                    static constexpr auto TRFAIL1 = std::uint_fast8_t{ 1 }; ///< TRFAIL1.
+                    static constexpr auto RXSTP   = std::uint_fast8_t{ 1 }; ///< RXSTP.
+                    static constexpr auto STALL0  = std::uint_fast8_t{ 1 }; ///< STALL0.
+                    static constexpr auto STALL1  = std::uint_fast8_t{ 1 }; ///< STALL1.
+                    static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto TRCPT0 = std::uint_fast8_t{}; ///< TRCPT0.
+                    static constexpr auto TRCPT1 = std::uint_fast8_t{ TRCPT0 + Size::TRCPT0 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL0 = std::uint_fast8_t{ TRCPT1 + Size::TRCPT1 }; ///< TRFAIL0.
+                    static constexpr auto TRFAIL1 = std::uint_fast8_t{ TRFAIL0 + Size::TRFAIL0 }; ///< TRFAIL1.
+                    static constexpr auto RXSTP = std::uint_fast8_t{ TRFAIL1 + Size::TRFAIL1 }; ///< RXSTP.
+                    static constexpr auto STALL0 = std::uint_fast8_t{ RXSTP + Size::RXSTP }; ///< STALL0.
+                    static constexpr auto STALL1 = std::uint_fast8_t{ STALL0 + Size::STALL0 }; ///< STALL1.
+                    static constexpr auto RESERVED7 = std::uint_fast8_t{ STALL1 + Size::STALL1 }; ///< RESERVED7.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto TRCPT0 = mask<std::uint8_t>( Size::TRCPT0, Bit::TRCPT0 ); ///< TRCPT0.
+                    static constexpr auto TRCPT1 = mask<std::uint8_t>( Size::TRCPT1, Bit::TRCPT1 ); ///< TRCPT1.
+                    static constexpr auto TRFAIL0 = mask<std::uint8_t>( Size::TRFAIL0, Bit::TRFAIL0 ); ///< TRFAIL0.
+                    static constexpr auto TRFAIL1 = mask<std::uint8_t>( Size::TRFAIL1, Bit::TRFAIL1 ); ///< TRFAIL1.
+                    static constexpr auto RXSTP = mask<std::uint8_t>( Size::RXSTP, Bit::RXSTP ); ///< RXSTP.
+                    static constexpr auto STALL0 = mask<std::uint8_t>( Size::STALL0, Bit::STALL0 ); ///< STALL0.
+                    static constexpr auto STALL1 = mask<std::uint8_t>( Size::STALL1, Bit::STALL1 ); ///< STALL1.
+                    static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                };
+
+                EPINTENSET() = delete;
+
+                EPINTENSET( EPINTENSET && ) = delete;
+
+                EPINTENSET( EPINTENSET const & ) = delete;
+
+                ~EPINTENSET() = delete;
+
+                auto operator=( EPINTENSET && ) = delete;
+
+                auto operator=( EPINTENSET const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief EPCFG.
+             */
+            EPCFG epcfg;
+
+            /**
+             * \brief Reserved registers (offset 0x01-0x03).
+             */
+            Reserved_Register<std::uint8_t> const
+                reserved_0x01_0x03[ ( 0x03 - 0x01 ) + 1 ];
+
+            /**
+             * \brief EPSTATUSCLR.
+             */
+            EPSTATUSCLR epstatusclr;
+
+            /**
+             * \brief EPSTATUSSET.
+             */
+            EPSTATUSSET epstatusset;
+
+            /**
+             * \brief EPSTATUS.
+             */
+            EPSTATUS const epstatus;
+
+            /**
+             * \brief EPINTFLAG.
+             */
+            EPINTFLAG epintflag;
+
+            /**
+             * \brief EPINTENCLR.
+             */
+            EPINTENCLR epintenclr;
+
+            /**
+             * \brief EPINTENSET.
+             */
+            EPINTENSET epintenset;
+
+            /**
+             * \brief Reserved registers (offset 0x0A-0x1F).
+             */
+            Reserved_Register<std::uint8_t> const
+                reserved_0x0A_0x1F[ ( 0x1F - 0x0A ) + 1 ];
+
+            ENDPOINT() = delete;
+
+            ENDPOINT( ENDPOINT && ) = delete;
+
+            ENDPOINT( ENDPOINT const & ) = delete;
+
+            ~ENDPOINT() = delete;
+
+            auto operator=( ENDPOINT && ) = delete;
+
+            auto operator=( ENDPOINT const & ) = delete;
+        };
+
+        /**
+         * \brief Endpoint bank descriptor (located in SRAM, must be 32-bit aligned).
+         *
+         * Descriptors for all enabled endpoints are stored in a table (two descriptors,
+         * bank 0 and bank 1, per endpoint) whose address is stored in the Descriptor
+         * Address (DESCADD) register.
+         */
+        struct Descriptor {
+            /**
+             * \brief Packet Size (PCKSIZE) register.
+             *
+             * This register has the following fields:
+             * - Byte Count (BYTE_COUNT)
+             * - Multi Packet Size (MULTI_PACKET_SIZE)
+             * - Packet Size (SIZE)
+             * - Automatic Zero Length Packet (AUTO_ZLP)
+             */
+            struct PCKSIZE {
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto BYTE_COUNT = std::uint_fast8_t{ 14 }; ///< BYTE_COUNT.
+                    static constexpr auto MULTI_PACKET_SIZE = std::uint_fast8_t{ 14 }; ///< MULTI_PACKET_SIZE.
+                    static constexpr auto SIZE     = std::uint_fast8_t{ 3 }; ///< SIZE.
+                    static constexpr auto AUTO_ZLP = std::uint_fast8_t{ 1 }; ///< AUTO_ZLP.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto BYTE_COUNT = std::uint_fast8_t{}; ///< BYTE_COUNT.
+                    static constexpr auto MULTI_PACKET_SIZE = std::uint_fast8_t{ BYTE_COUNT + Size::BYTE_COUNT }; ///< MULTI_PACKET_SIZE.
+                    static constexpr auto SIZE = std::uint_fast8_t{ MULTI_PACKET_SIZE + Size::MULTI_PACKET_SIZE }; ///< SIZE.
+                    static constexpr auto AUTO_ZLP = std::uint_fast8_t{ SIZE + Size::SIZE }; ///< AUTO_ZLP.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto BYTE_COUNT = mask<std::uint32_t>( Size::BYTE_COUNT, Bit::BYTE_COUNT ); ///< BYTE_COUNT.
+                    static constexpr auto MULTI_PACKET_SIZE = mask<std::uint32_t>( Size::MULTI_PACKET_SIZE, Bit::MULTI_PACKET_SIZE ); ///< MULTI_PACKET_SIZE.
+                    static constexpr auto SIZE = mask<std::uint32_t>( Size::SIZE, Bit::SIZE ); ///< SIZE.
+                    static constexpr auto AUTO_ZLP = mask<std::uint32_t>( Size::AUTO_ZLP, Bit::AUTO_ZLP ); ///< AUTO_ZLP.
+                };
+
+                /**
+                 * \brief SIZE.
+                 */
+                enum SIZE : std::uint32_t {
+                    SIZE_8    = 0x0 << Bit::SIZE, ///< 8 bytes.
+                    SIZE_16   = 0x1 << Bit::SIZE, ///< 16 bytes.
+                    SIZE_32   = 0x2 << Bit::SIZE, ///< 32 bytes.
+                    SIZE_64   = 0x3 << Bit::SIZE, ///< 64 bytes.
+                    SIZE_128  = 0x4 << Bit::SIZE, ///< 128 bytes.
+                    SIZE_256  = 0x5 << Bit::SIZE, ///< 256 bytes.
+                    SIZE_512  = 0x6 << Bit::SIZE, ///< 512 bytes.
+                    SIZE_1023 = 0x7 << Bit::SIZE, ///< 1023 bytes.
+                };
+            };
+
+            /**
+             * \brief Extended Register (EXTREG) register.
+             *
+             * This register has the following fields:
+             * - SUBPID (SUBPID)
+             * - VARIABLE (VARIABLE)
+             */
+            struct EXTREG {
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto SUBPID   = std::uint_fast8_t{ 4 }; ///< SUBPID.
+                    static constexpr auto VARIABLE = std::uint_fast8_t{ 11 }; ///< VARIABLE.
+                    static constexpr auto RESERVED15 = std::uint_fast8_t{ 1 }; ///< RESERVED15.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto SUBPID = std::uint_fast8_t{}; ///< SUBPID.
+                    static constexpr auto VARIABLE = std::uint_fast8_t{ SUBPID + Size::SUBPID }; ///< VARIABLE.
+                    static constexpr auto RESERVED15 = std::uint_fast8_t{ VARIABLE + Size::VARIABLE }; ///< RESERVED15.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto SUBPID = mask<std::uint16_t>( Size::SUBPID, Bit::SUBPID ); ///< SUBPID.
+                    static constexpr auto VARIABLE = mask<std::uint16_t>( Size::VARIABLE, Bit::VARIABLE ); ///< VARIABLE.
+                    static constexpr auto RESERVED15 = mask<std::uint16_t>( Size::RESERVED15, Bit::RESERVED15 ); ///< RESERVED15.
+                };
+            };
+
+            /**
+             * \brief Bank Status (STATUS_BK) register.
+             *
+             * This register has the following fields:
+             * - CRC Error (CRCERR)
+             * - Error Flow (ERRORFLOW)
+             */
+            struct STATUS_BK {
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto CRCERR    = std::uint_fast8_t{ 1 }; ///< CRCERR.
+                    static constexpr auto ERRORFLOW = std::uint_fast8_t{ 1 }; ///< ERRORFLOW.
+                    static constexpr auto RESERVED2 = std::uint_fast8_t{ 6 }; ///< RESERVED2.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto CRCERR = std::uint_fast8_t{}; ///< CRCERR.
+                    static constexpr auto ERRORFLOW = std::uint_fast8_t{ CRCERR + Size::CRCERR }; ///< ERRORFLOW.
+                    static constexpr auto RESERVED2 = std::uint_fast8_t{ ERRORFLOW + Size::ERRORFLOW }; ///< RESERVED2.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto CRCERR = mask<std::uint8_t>( Size::CRCERR, Bit::CRCERR ); ///< CRCERR.
+                    static constexpr auto ERRORFLOW = mask<std::uint8_t>( Size::ERRORFLOW, Bit::ERRORFLOW ); ///< ERRORFLOW.
+                    static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                };
+            };
+
+            /**
+             * \brief Address of Data Buffer (ADDR) (must be 32-bit aligned).
+             */
+            std::uint32_t addr;
+
+            /**
+             * \brief Packet Size (PCKSIZE).
+             */
+            std::uint32_t pcksize;
+
+            /**
+             * \brief Extended Register (EXTREG).
+             */
+            std::uint16_t extreg;
+
+            /**
+             * \brief Bank Status (STATUS_BK).
+             */
+            std::uint8_t status_bk;
+
+            /**
+             * \brief Reserved.
+             */
+            std::uint8_t reserved[ 5 ];
+        };
+
+        /**
+         * \brief CTRLA.
+         */
+        CTRLA ctrla;
+
+        /**
+         * \brief Reserved registers (offset 0x01-0x01).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x01_0x01[ ( 0x01 - 0x01 ) + 1 ];
+
+        /**
+         * \brief SYNCBUSY.
+         */
+        SYNCBUSY const syncbusy;
+
+        /**
+         * \brief QOSCTRL.
+         */
+        QOSCTRL qosctrl;
+
+        /**
+         * \brief Reserved registers (offset 0x04-0x07).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x04_0x07[ ( 0x07 - 0x04 ) + 1 ];
+
+        /**
+         * \brief CTRLB.
+         */
+        CTRLB ctrlb;
+
+        /**
+         * \brief DADD.
+         */
+        DADD dadd;
+
+        /**
+         * \brief Reserved registers (offset 0x0B-0x0B).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x0B_0x0B[ ( 0x0B - 0x0B ) + 1 ];
+
+        /**
+         * \brief STATUS.
+         */
+        STATUS const status;
+
+        /**
+         * \brief FSMSTATUS.
+         */
+        FSMSTATUS const fsmstatus;
+
+        /**
+         * \brief Reserved registers (offset 0x0E-0x0F).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x0E_0x0F[ ( 0x0F - 0x0E ) + 1 ];
+
+        /**
+         * \brief FNUM.
+         */
+        FNUM const fnum;
+
+        /**
+         * \brief Reserved registers (offset 0x12-0x13).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x12_0x13[ ( 0x13 - 0x12 ) + 1 ];
+
+        /**
+         * \brief INTENCLR.
+         */
+        INTENCLR intenclr;
+
+        /**
+         * \brief Reserved registers (offset 0x16-0x17).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x16_0x17[ ( 0x17 - 0x16 ) + 1 ];
+
+        /**
+         * \brief INTENSET.
+         */
+        INTENSET intenset;
+
+        /**
+         * \brief Reserved registers (offset 0x1A-0x1B).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x1A_0x1B[ ( 0x1B - 0x1A ) + 1 ];
+
+        /**
+         * \brief INTFLAG.
+         */
+        INTFLAG intflag;
+
+        /**
+         * \brief Reserved registers (offset 0x1E-0x1F).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x1E_0x1F[ ( 0x1F - 0x1E ) + 1 ];
+
+        /**
+         * \brief EPINTSMRY.
+         */
+        EPINTSMRY const epintsmry;
+
+        /**
+         * \brief Reserved registers (offset 0x22-0x23).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x22_0x23[ ( 0x23 - 0x22 ) + 1 ];
+
+        /**
+         * \brief Descriptor Address (DESCADD) register.
+         */
+        Register<std::uint32_t> descadd;
+
+        /**
+         * \brief PADCAL.
+         */
+        PADCAL padcal;
+
+        /**
+         * \brief Reserved registers (offset 0x2A-0xFF).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x2A_0xFF[ ( 0xFF - 0x2A ) + 1 ];
+
+        /**
+         * \brief The endpoints.
+         */
+        ENDPOINT endpoint[ 8 ];
+
+        DEVICE() = delete;
+
+        DEVICE( DEVICE && ) = delete;
+
+        DEVICE( DEVICE const & ) = delete;
+
+        ~DEVICE() = delete;
+
+        auto operator=( DEVICE && ) = delete;
+
+        auto operator=( DEVICE const & ) = delete;
+    };
+
+    /**
+     * \brief Host mode.
+     */
+    class HOST {
+      public:
+        /**
+         * \brief Control A (CTRLA) register.
+         *
+         * This register has the following fields:
+         * - Software Reset (SWRST)
+         * - Enable (ENABLE)
+         * - Run in Standby (RUNSTDBY)
+         * - Operating Mode (MODE)
+         */
+        class CTRLA : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST     = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE    = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto RUNSTDBY  = std::uint_fast8_t{ 1 }; ///< RUNSTDBY.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ 4 }; ///< RESERVED3.
+                static constexpr auto MODE      = std::uint_fast8_t{ 1 }; ///< MODE.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto RUNSTDBY = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< RUNSTDBY.
+                static constexpr auto RESERVED3 = std::uint_fast8_t{ RUNSTDBY + Size::RUNSTDBY }; ///< RESERVED3.
+                static constexpr auto MODE = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< MODE.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint8_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint8_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto RUNSTDBY = mask<std::uint8_t>( Size::RUNSTDBY, Bit::RUNSTDBY ); ///< RUNSTDBY.
+                static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                static constexpr auto MODE = mask<std::uint8_t>( Size::MODE, Bit::MODE ); ///< MODE.
+            };
+
+            /**
+             * \brief MODE.
+             */
+            enum MODE : std::uint8_t {
+                MODE_HOST = 0x1 << Bit::MODE, ///< Host mode.
+            };
+
+            CTRLA() = delete;
+
+            CTRLA( CTRLA && ) = delete;
+
+            CTRLA( CTRLA const & ) = delete;
+
+            ~CTRLA() = delete;
+
+            auto operator=( CTRLA && ) = delete;
+
+            auto operator=( CTRLA const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Synchronization Busy (SYNCBUSY) register.
+         *
+         * This register has the following fields:
+         * - Software Reset Synchronization Busy (SWRST)
+         * - Enable Synchronization Busy (ENABLE)
+         */
+        class SYNCBUSY : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto SWRST     = std::uint_fast8_t{ 1 }; ///< SWRST.
+                static constexpr auto ENABLE    = std::uint_fast8_t{ 1 }; ///< ENABLE.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ 6 }; ///< RESERVED2.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto SWRST = std::uint_fast8_t{}; ///< SWRST.
+                static constexpr auto ENABLE = std::uint_fast8_t{ SWRST + Size::SWRST }; ///< ENABLE.
+                static constexpr auto RESERVED2 = std::uint_fast8_t{ ENABLE + Size::ENABLE }; ///< RESERVED2.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto SWRST = mask<std::uint8_t>( Size::SWRST, Bit::SWRST ); ///< SWRST.
+                static constexpr auto ENABLE = mask<std::uint8_t>( Size::ENABLE, Bit::ENABLE ); ///< ENABLE.
+                static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+            };
+
+            SYNCBUSY() = delete;
+
+            SYNCBUSY( SYNCBUSY && ) = delete;
+
+            SYNCBUSY( SYNCBUSY const & ) = delete;
+
+            ~SYNCBUSY() = delete;
+
+            auto operator=( SYNCBUSY && ) = delete;
+
+            auto operator=( SYNCBUSY const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Quality of Service (QOSCTRL) register.
+         *
+         * This register has the following fields:
+         * - Configuration Quality of Service (CQOS)
+         * - Data Quality of Service (DQOS)
+         */
+        class QOSCTRL : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto CQOS      = std::uint_fast8_t{ 2 }; ///< CQOS.
+                static constexpr auto DQOS      = std::uint_fast8_t{ 2 }; ///< DQOS.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ 4 }; ///< RESERVED4.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto CQOS = std::uint_fast8_t{}; ///< CQOS.
+                static constexpr auto DQOS = std::uint_fast8_t{ CQOS + Size::CQOS }; ///< DQOS.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ DQOS + Size::DQOS }; ///< RESERVED4.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto CQOS = mask<std::uint8_t>( Size::CQOS, Bit::CQOS ); ///< CQOS.
+                static constexpr auto DQOS = mask<std::uint8_t>( Size::DQOS, Bit::DQOS ); ///< DQOS.
+                static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+            };
+
+            /**
+             * \brief CQOS.
+             */
+            enum CQOS : std::uint8_t {
+                CQOS_DISABLE = 0x0 << Bit::CQOS, ///< Background (no sensitive operation).
+                CQOS_LOW     = 0x1 << Bit::CQOS, ///< Sensitive bandwidth.
+                CQOS_MEDIUM  = 0x2 << Bit::CQOS, ///< Sensitive latency.
+                CQOS_HIGH    = 0x3 << Bit::CQOS, ///< Critical latency.
+            };
+
+            /**
+             * \brief DQOS.
+             */
+            enum DQOS : std::uint8_t {
+                DQOS_DISABLE = 0x0 << Bit::DQOS, ///< Background (no sensitive operation).
+                DQOS_LOW     = 0x1 << Bit::DQOS, ///< Sensitive bandwidth.
+                DQOS_MEDIUM  = 0x2 << Bit::DQOS, ///< Sensitive latency.
+                DQOS_HIGH    = 0x3 << Bit::DQOS, ///< Critical latency.
+            };
+
+            QOSCTRL() = delete;
+
+            QOSCTRL( QOSCTRL && ) = delete;
+
+            QOSCTRL( QOSCTRL const & ) = delete;
+
+            ~QOSCTRL() = delete;
+
+            auto operator=( QOSCTRL && ) = delete;
+
+            auto operator=( QOSCTRL const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Control B (CTRLB) register.
+         *
+         * This register has the following fields:
+         * - Send USB Resume (RESUME)
+         * - Speed Configuration (SPDCONF)
+         * - Test Mode J (TSTJ)
+         * - Test Mode K (TSTK)
+         * - Start-of-Frame Generation Enable (SOFE)
+         * - Send USB Reset (BUSRESET)
+         * - VBUS is OK (VBUSOK)
+         * - Send L1 Resume (L1RESUME)
+         */
+        class CTRLB : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0  = std::uint_fast8_t{ 1 }; ///< RESERVED0.
+                static constexpr auto RESUME     = std::uint_fast8_t{ 1 }; ///< RESUME.
+                static constexpr auto SPDCONF    = std::uint_fast8_t{ 2 }; ///< SPDCONF.
+                static constexpr auto RESERVED4  = std::uint_fast8_t{ 1 }; ///< RESERVED4.
+                static constexpr auto TSTJ       = std::uint_fast8_t{ 1 }; ///< TSTJ.
+                static constexpr auto TSTK       = std::uint_fast8_t{ 1 }; ///< TSTK.
+                static constexpr auto RESERVED7  = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+                static constexpr auto SOFE       = std::uint_fast8_t{ 1 }; ///< SOFE.
+                static constexpr auto BUSRESET   = std::uint_fast8_t{ 1 }; ///< BUSRESET.
+                static constexpr auto VBUSOK     = std::uint_fast8_t{ 1 }; ///< VBUSOK.
+                static constexpr auto L1RESUME   = std::uint_fast8_t{ 1 }; ///< L1RESUME.
+                static constexpr auto RESERVED12 = std::uint_fast8_t{ 4 }; ///< RESERVED12.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto RESUME = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< RESUME.
+                static constexpr auto SPDCONF = std::uint_fast8_t{ RESUME + Size::RESUME }; ///< SPDCONF.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ SPDCONF + Size::SPDCONF }; ///< RESERVED4.
+                static constexpr auto TSTJ = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< TSTJ.
+                static constexpr auto TSTK = std::uint_fast8_t{ TSTJ + Size::TSTJ }; ///< TSTK.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ TSTK + Size::TSTK }; ///< RESERVED7.
+                static constexpr auto SOFE = std::uint_fast8_t{ RESERVED7 + Size::RESERVED7 }; ///< SOFE.
+                static constexpr auto BUSRESET = std::uint_fast8_t{ SOFE + Size::SOFE }; ///< BUSRESET.
+                static constexpr auto VBUSOK = std::uint_fast8_t{ BUSRESET + Size::BUSRESET }; ///< VBUSOK.
+                static constexpr auto L1RESUME = std::uint_fast8_t{ VBUSOK + Size::VBUSOK }; ///< L1RESUME.
+                static constexpr auto RESERVED12 = std::uint_fast8_t{ L1RESUME + Size::L1RESUME }; ///< RESERVED12.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint16_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto RESUME = mask<std::uint16_t>( Size::RESUME, Bit::RESUME ); ///< RESUME.
+                static constexpr auto SPDCONF = mask<std::uint16_t>( Size::SPDCONF, Bit::SPDCONF ); ///< SPDCONF.
+                static constexpr auto RESERVED4 = mask<std::uint16_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+                static constexpr auto TSTJ = mask<std::uint16_t>( Size::TSTJ, Bit::TSTJ ); ///< TSTJ.
+                static constexpr auto TSTK = mask<std::uint16_t>( Size::TSTK, Bit::TSTK ); ///< TSTK.
+                static constexpr auto RESERVED7 = mask<std::uint16_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                static constexpr auto SOFE = mask<std::uint16_t>( Size::SOFE, Bit::SOFE ); ///< SOFE.
+                static constexpr auto BUSRESET = mask<std::uint16_t>( Size::BUSRESET, Bit::BUSRESET ); ///< BUSRESET.
+                static constexpr auto VBUSOK = mask<std::uint16_t>( Size::VBUSOK, Bit::VBUSOK ); ///< VBUSOK.
+                static constexpr auto L1RESUME = mask<std::uint16_t>( Size::L1RESUME, Bit::L1RESUME ); ///< L1RESUME.
+                static constexpr auto RESERVED12 = mask<std::uint16_t>( Size::RESERVED12, Bit::RESERVED12 ); ///< RESERVED12.
+            };
+
+            /**
+             * \brief SPDCONF.
+             */
+            enum SPDCONF : std::uint16_t {
+                SPDCONF_NORMAL = 0x0 << Bit::SPDCONF, ///< Low-speed and full-speed capable.
+            };
+
+            CTRLB() = delete;
+
+            CTRLB( CTRLB && ) = delete;
+
+            CTRLB( CTRLB const & ) = delete;
+
+            ~CTRLB() = delete;
+
+            auto operator=( CTRLB && ) = delete;
+
+            auto operator=( CTRLB const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Host Start-of-Frame Control (HSOFC) register.
+         *
+         * This register has the following fields:
+         * - Frame Length Control (FLENC)
+         * - Frame Length Control Enable (FLENCE)
+         */
+        class HSOFC : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto FLENC     = std::uint_fast8_t{ 4 }; ///< FLENC.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ 3 }; ///< RESERVED4.
+                static constexpr auto FLENCE    = std::uint_fast8_t{ 1 }; ///< FLENCE.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto FLENC = std::uint_fast8_t{}; ///< FLENC.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ FLENC + Size::FLENC }; ///< RESERVED4.
+                static constexpr auto FLENCE = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< FLENCE.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto FLENC = mask<std::uint8_t>( Size::FLENC, Bit::FLENC ); ///< FLENC.
+                static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+                static constexpr auto FLENCE = mask<std::uint8_t>( Size::FLENCE, Bit::FLENCE ); ///< FLENCE.
+            };
+
+            HSOFC() = delete;
+
+            HSOFC( HSOFC && ) = delete;
+
+            HSOFC( HSOFC const & ) = delete;
+
+            ~HSOFC() = delete;
+
+            auto operator=( HSOFC && ) = delete;
+
+            auto operator=( HSOFC const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Status (STATUS) register.
+         *
+         * This register has the following fields:
+         * - Speed Status (SPEED)
+         * - USB Line State Status (LINESTATE)
+         */
+        class STATUS : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{ 2 }; ///< RESERVED0.
+                static constexpr auto SPEED     = std::uint_fast8_t{ 2 }; ///< SPEED.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ 2 }; ///< RESERVED4.
+                static constexpr auto LINESTATE = std::uint_fast8_t{ 2 }; ///< LINESTATE.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto SPEED = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< SPEED.
+                static constexpr auto RESERVED4 = std::uint_fast8_t{ SPEED + Size::SPEED }; ///< RESERVED4.
+                static constexpr auto LINESTATE = std::uint_fast8_t{ RESERVED4 + Size::RESERVED4 }; ///< LINESTATE.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint8_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto SPEED = mask<std::uint8_t>( Size::SPEED, Bit::SPEED ); ///< SPEED.
+                static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
+                static constexpr auto LINESTATE = mask<std::uint8_t>( Size::LINESTATE, Bit::LINESTATE ); ///< LINESTATE.
+            };
+
+            /**
+             * \brief LINESTATE.
+             */
+            enum LINESTATE : std::uint8_t {
+                LINESTATE_SE0 = 0x0 << Bit::LINESTATE, ///< SE0/RESET.
+                LINESTATE_J   = 0x1 << Bit::LINESTATE, ///< FS-J or LS-K state.
+                LINESTATE_K   = 0x2 << Bit::LINESTATE, ///< FS-K or LS-J state.
+            };
+
+            STATUS() = delete;
+
+            STATUS( STATUS && ) = delete;
+
+            STATUS( STATUS const & ) = delete;
+
+            ~STATUS() = delete;
+
+            auto operator=( STATUS && ) = delete;
+
+            auto operator=( STATUS const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Finite State Machine Status (FSMSTATUS) register.
+         *
+         * This register has the following fields:
+         * - Fine State Machine Status (FSMSTATE)
+         */
+        class FSMSTATUS : public Register<std::uint8_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto FSMSTATE  = std::uint_fast8_t{ 7 }; ///< FSMSTATE.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto FSMSTATE = std::uint_fast8_t{}; ///< FSMSTATE.
+                static constexpr auto RESERVED7 = std::uint_fast8_t{ FSMSTATE + Size::FSMSTATE }; ///< RESERVED7.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto FSMSTATE = mask<std::uint8_t>( Size::FSMSTATE, Bit::FSMSTATE ); ///< FSMSTATE.
+                static constexpr auto RESERVED7 = mask<std::uint8_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+            };
+
+            /**
+             * \brief FSMSTATE.
+             */
+            enum FSMSTATE : std::uint8_t {
+                FSMSTATE_OFF      = 0x01 << Bit::FSMSTATE, ///< OFF (L3).
+                FSMSTATE_ON       = 0x02 << Bit::FSMSTATE, ///< ON (L0).
+                FSMSTATE_SUSPEND  = 0x04 << Bit::FSMSTATE, ///< SUSPEND (L2).
+                FSMSTATE_SLEEP    = 0x08 << Bit::FSMSTATE, ///< SLEEP (L1).
+                FSMSTATE_DNRESUME = 0x10 << Bit::FSMSTATE, ///< DNRESUME.
+                FSMSTATE_UPRESUME = 0x20 << Bit::FSMSTATE, ///< UPRESUME.
+                FSMSTATE_RESET    = 0x40 << Bit::FSMSTATE, ///< RESET.
+            };
+
+            FSMSTATUS() = delete;
+
+            FSMSTATUS( FSMSTATUS && ) = delete;
+
+            FSMSTATUS( FSMSTATUS const & ) = delete;
+
+            ~FSMSTATUS() = delete;
+
+            auto operator=( FSMSTATUS && ) = delete;
+
+            auto operator=( FSMSTATUS const & ) = delete;
+
+            using Register<std::uint8_t>::operator=;
+        };
+
+        /**
+         * \brief Frame Number (FNUM) register.
+         *
+         * This register has the following fields:
+         * - Micro Frame Number (MFNUM)
+         * - Frame Number (FNUM)
+         */
+        class FNUM : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto MFNUM      = std::uint_fast8_t{ 3 };  ///< MFNUM.
+                static constexpr auto FNUM       = std::uint_fast8_t{ 11 }; ///< FNUM.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ 2 }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto MFNUM = std::uint_fast8_t{}; ///< MFNUM.
+                static constexpr auto FNUM = std::uint_fast8_t{ MFNUM + Size::MFNUM }; ///< FNUM.
+                static constexpr auto RESERVED14 = std::uint_fast8_t{ FNUM + Size::FNUM }; ///< RESERVED14.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto MFNUM = mask<std::uint16_t>( Size::MFNUM, Bit::MFNUM ); ///< MFNUM.
+                static constexpr auto FNUM = mask<std::uint16_t>( Size::FNUM, Bit::FNUM ); ///< FNUM.
+                static constexpr auto RESERVED14 = mask<std::uint16_t>( Size::RESERVED14, Bit::RESERVED14 ); ///< RESERVED14.
+            };
+
+            FNUM() = delete;
+
+            FNUM( FNUM && ) = delete;
+
+            FNUM( FNUM const & ) = delete;
+
+            ~FNUM() = delete;
+
+            auto operator=( FNUM && ) = delete;
+
+            auto operator=( FNUM const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Clear (INTENCLR) register.
+         *
+         * This register has the following fields:
+         * - Host Start-of-Frame Interrupt Enable (HSOF)
+         * - Bus Reset Interrupt Enable (RST)
+         * - Wake Up Interrupt Enable (WAKEUP)
+         * - Downstream Resume Interrupt Enable (DNRSM)
+         * - Upstream Resume from Device Interrupt Enable (UPRSM)
+         * - RAM Access Interrupt Enable (RAMACER)
+         * - Device Connection Interrupt Enable (DCONN)
+         * - Device Disconnection Interrupt Enable (DDISC)
+         */
+        class INTENCLR : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0  = std::uint_fast8_t{ 2 }; ///< RESERVED0.
+                static constexpr auto HSOF       = std::uint_fast8_t{ 1 }; ///< HSOF.
+                static constexpr auto RST        = std::uint_fast8_t{ 1 }; ///< RST.
+                static constexpr auto WAKEUP     = std::uint_fast8_t{ 1 }; ///< WAKEUP.
+                static constexpr auto DNRSM      = std::uint_fast8_t{ 1 }; ///< DNRSM.
+                static constexpr auto UPRSM      = std::uint_fast8_t{ 1 }; ///< UPRSM.
+                static constexpr auto RAMACER    = std::uint_fast8_t{ 1 }; ///< RAMACER.
+                static constexpr auto DCONN      = std::uint_fast8_t{ 1 }; ///< DCONN.
+                static constexpr auto DDISC      = std::uint_fast8_t{ 1 }; ///< DDISC.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ 6 }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto HSOF = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< HSOF.
+                static constexpr auto RST = std::uint_fast8_t{ HSOF + Size::HSOF }; ///< RST.
+                static constexpr auto WAKEUP = std::uint_fast8_t{ RST + Size::RST }; ///< WAKEUP.
+                static constexpr auto DNRSM = std::uint_fast8_t{ WAKEUP + Size::WAKEUP }; ///< DNRSM.
+                static constexpr auto UPRSM = std::uint_fast8_t{ DNRSM + Size::DNRSM }; ///< UPRSM.
+                static constexpr auto RAMACER = std::uint_fast8_t{ UPRSM + Size::UPRSM }; ///< RAMACER.
+                static constexpr auto DCONN = std::uint_fast8_t{ RAMACER + Size::RAMACER }; ///< DCONN.
+                static constexpr auto DDISC = std::uint_fast8_t{ DCONN + Size::DCONN }; ///< DDISC.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ DDISC + Size::DDISC }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint16_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto HSOF = mask<std::uint16_t>( Size::HSOF, Bit::HSOF ); ///< HSOF.
+                static constexpr auto RST = mask<std::uint16_t>( Size::RST, Bit::RST ); ///< RST.
+                static constexpr auto WAKEUP = mask<std::uint16_t>( Size::WAKEUP, Bit::WAKEUP ); ///< WAKEUP.
+                static constexpr auto DNRSM = mask<std::uint16_t>( Size::DNRSM, Bit::DNRSM ); ///< DNRSM.
+                static constexpr auto UPRSM = mask<std::uint16_t>( Size::UPRSM, Bit::UPRSM ); ///< UPRSM.
+                static constexpr auto RAMACER = mask<std::uint16_t>( Size::RAMACER, Bit::RAMACER ); ///< RAMACER.
+                static constexpr auto DCONN = mask<std::uint16_t>( Size::DCONN, Bit::DCONN ); ///< DCONN.
+                static constexpr auto DDISC = mask<std::uint16_t>( Size::DDISC, Bit::DDISC ); ///< DDISC.
+                static constexpr auto RESERVED10 = mask<std::uint16_t>( Size::RESERVED10, Bit::RESERVED10 ); ///< RESERVED10.
+            };
+
+            INTENCLR() = delete;
+
+            INTENCLR( INTENCLR && ) = delete;
+
+            INTENCLR( INTENCLR const & ) = delete;
+
+            ~INTENCLR() = delete;
+
+            auto operator=( INTENCLR && ) = delete;
+
+            auto operator=( INTENCLR const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Enable Set (INTENSET) register.
+         *
+         * This register has the following fields:
+         * - Host Start-of-Frame Interrupt Enable (HSOF)
+         * - Bus Reset Interrupt Enable (RST)
+         * - Wake Up Interrupt Enable (WAKEUP)
+         * - Downstream Resume Interrupt Enable (DNRSM)
+         * - Upstream Resume from Device Interrupt Enable (UPRSM)
+         * - RAM Access Interrupt Enable (RAMACER)
+         * - Device Connection Interrupt Enable (DCONN)
+         * - Device Disconnection Interrupt Enable (DDISC)
+         */
+        class INTENSET : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0  = std::uint_fast8_t{ 2 }; ///< RESERVED0.
+                static constexpr auto HSOF       = std::uint_fast8_t{ 1 }; ///< HSOF.
+                static constexpr auto RST        = std::uint_fast8_t{ 1 }; ///< RST.
+                static constexpr auto WAKEUP     = std::uint_fast8_t{ 1 }; ///< WAKEUP.
+                static constexpr auto DNRSM      = std::uint_fast8_t{ 1 }; ///< DNRSM.
+                static constexpr auto UPRSM      = std::uint_fast8_t{ 1 }; ///< UPRSM.
+                static constexpr auto RAMACER    = std::uint_fast8_t{ 1 }; ///< RAMACER.
+                static constexpr auto DCONN      = std::uint_fast8_t{ 1 }; ///< DCONN.
+                static constexpr auto DDISC      = std::uint_fast8_t{ 1 }; ///< DDISC.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ 6 }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto HSOF = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< HSOF.
+                static constexpr auto RST = std::uint_fast8_t{ HSOF + Size::HSOF }; ///< RST.
+                static constexpr auto WAKEUP = std::uint_fast8_t{ RST + Size::RST }; ///< WAKEUP.
+                static constexpr auto DNRSM = std::uint_fast8_t{ WAKEUP + Size::WAKEUP }; ///< DNRSM.
+                static constexpr auto UPRSM = std::uint_fast8_t{ DNRSM + Size::DNRSM }; ///< UPRSM.
+                static constexpr auto RAMACER = std::uint_fast8_t{ UPRSM + Size::UPRSM }; ///< RAMACER.
+                static constexpr auto DCONN = std::uint_fast8_t{ RAMACER + Size::RAMACER }; ///< DCONN.
+                static constexpr auto DDISC = std::uint_fast8_t{ DCONN + Size::DCONN }; ///< DDISC.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ DDISC + Size::DDISC }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint16_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto HSOF = mask<std::uint16_t>( Size::HSOF, Bit::HSOF ); ///< HSOF.
+                static constexpr auto RST = mask<std::uint16_t>( Size::RST, Bit::RST ); ///< RST.
+                static constexpr auto WAKEUP = mask<std::uint16_t>( Size::WAKEUP, Bit::WAKEUP ); ///< WAKEUP.
+                static constexpr auto DNRSM = mask<std::uint16_t>( Size::DNRSM, Bit::DNRSM ); ///< DNRSM.
+                static constexpr auto UPRSM = mask<std::uint16_t>( Size::UPRSM, Bit::UPRSM ); ///< UPRSM.
+                static constexpr auto RAMACER = mask<std::uint16_t>( Size::RAMACER, Bit::RAMACER ); ///< RAMACER.
+                static constexpr auto DCONN = mask<std::uint16_t>( Size::DCONN, Bit::DCONN ); ///< DCONN.
+                static constexpr auto DDISC = mask<std::uint16_t>( Size::DDISC, Bit::DDISC ); ///< DDISC.
+                static constexpr auto RESERVED10 = mask<std::uint16_t>( Size::RESERVED10, Bit::RESERVED10 ); ///< RESERVED10.
+            };
+
+            INTENSET() = delete;
+
+            INTENSET( INTENSET && ) = delete;
+
+            INTENSET( INTENSET const & ) = delete;
+
+            ~INTENSET() = delete;
+
+            auto operator=( INTENSET && ) = delete;
+
+            auto operator=( INTENSET const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Interrupt Flag Status and Clear (INTFLAG) register.
+         *
+         * This register has the following fields:
+         * - Host Start-of-Frame Interrupt (HSOF)
+         * - Bus Reset Interrupt (RST)
+         * - Wake Up Interrupt (WAKEUP)
+         * - Downstream Resume Interrupt (DNRSM)
+         * - Upstream Resume from Device Interrupt (UPRSM)
+         * - RAM Access Interrupt (RAMACER)
+         * - Device Connection Interrupt (DCONN)
+         * - Device Disconnection Interrupt (DDISC)
+         */
+        class INTFLAG : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto RESERVED0  = std::uint_fast8_t{ 2 }; ///< RESERVED0.
+                static constexpr auto HSOF       = std::uint_fast8_t{ 1 }; ///< HSOF.
+                static constexpr auto RST        = std::uint_fast8_t{ 1 }; ///< RST.
+                static constexpr auto WAKEUP     = std::uint_fast8_t{ 1 }; ///< WAKEUP.
+                static constexpr auto DNRSM      = std::uint_fast8_t{ 1 }; ///< DNRSM.
+                static constexpr auto UPRSM      = std::uint_fast8_t{ 1 }; ///< UPRSM.
+                static constexpr auto RAMACER    = std::uint_fast8_t{ 1 }; ///< RAMACER.
+                static constexpr auto DCONN      = std::uint_fast8_t{ 1 }; ///< DCONN.
+                static constexpr auto DDISC      = std::uint_fast8_t{ 1 }; ///< DDISC.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ 6 }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto RESERVED0 = std::uint_fast8_t{}; ///< RESERVED0.
+                static constexpr auto HSOF = std::uint_fast8_t{ RESERVED0 + Size::RESERVED0 }; ///< HSOF.
+                static constexpr auto RST = std::uint_fast8_t{ HSOF + Size::HSOF }; ///< RST.
+                static constexpr auto WAKEUP = std::uint_fast8_t{ RST + Size::RST }; ///< WAKEUP.
+                static constexpr auto DNRSM = std::uint_fast8_t{ WAKEUP + Size::WAKEUP }; ///< DNRSM.
+                static constexpr auto UPRSM = std::uint_fast8_t{ DNRSM + Size::DNRSM }; ///< UPRSM.
+                static constexpr auto RAMACER = std::uint_fast8_t{ UPRSM + Size::UPRSM }; ///< RAMACER.
+                static constexpr auto DCONN = std::uint_fast8_t{ RAMACER + Size::RAMACER }; ///< DCONN.
+                static constexpr auto DDISC = std::uint_fast8_t{ DCONN + Size::DCONN }; ///< DDISC.
+                static constexpr auto RESERVED10 = std::uint_fast8_t{ DDISC + Size::DDISC }; ///< RESERVED10.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto RESERVED0 = mask<std::uint16_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< RESERVED0.
+                static constexpr auto HSOF = mask<std::uint16_t>( Size::HSOF, Bit::HSOF ); ///< HSOF.
+                static constexpr auto RST = mask<std::uint16_t>( Size::RST, Bit::RST ); ///< RST.
+                static constexpr auto WAKEUP = mask<std::uint16_t>( Size::WAKEUP, Bit::WAKEUP ); ///< WAKEUP.
+                static constexpr auto DNRSM = mask<std::uint16_t>( Size::DNRSM, Bit::DNRSM ); ///< DNRSM.
+                static constexpr auto UPRSM = mask<std::uint16_t>( Size::UPRSM, Bit::UPRSM ); ///< UPRSM.
+                static constexpr auto RAMACER = mask<std::uint16_t>( Size::RAMACER, Bit::RAMACER ); ///< RAMACER.
+                static constexpr auto DCONN = mask<std::uint16_t>( Size::DCONN, Bit::DCONN ); ///< DCONN.
+                static constexpr auto DDISC = mask<std::uint16_t>( Size::DDISC, Bit::DDISC ); ///< DDISC.
+                static constexpr auto RESERVED10 = mask<std::uint16_t>( Size::RESERVED10, Bit::RESERVED10 ); ///< RESERVED10.
+            };
+
+            INTFLAG() = delete;
+
+            INTFLAG( INTFLAG && ) = delete;
+
+            INTFLAG( INTFLAG const & ) = delete;
+
+            ~INTFLAG() = delete;
+
+            auto operator=( INTFLAG && ) = delete;
+
+            auto operator=( INTFLAG const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Pipe Interrupt Summary (PINTSMRY) register.
+         *
+         * This register has the following fields:
+         * - Pipe Interrupt 0 (EPINT0)
+         * - Pipe Interrupt 1 (EPINT1)
+         * - Pipe Interrupt 2 (EPINT2)
+         * - Pipe Interrupt 3 (EPINT3)
+         * - Pipe Interrupt 4 (EPINT4)
+         * - Pipe Interrupt 5 (EPINT5)
+         * - Pipe Interrupt 6 (EPINT6)
+         * - Pipe Interrupt 7 (EPINT7)
+         */
+        class PINTSMRY : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto EPINT0    = std::uint_fast8_t{ 1 }; ///< EPINT0.
+                static constexpr auto EPINT1    = std::uint_fast8_t{ 1 }; ///< EPINT1.
+                static constexpr auto EPINT2    = std::uint_fast8_t{ 1 }; ///< EPINT2.
+                static constexpr auto EPINT3    = std::uint_fast8_t{ 1 }; ///< EPINT3.
+                static constexpr auto EPINT4    = std::uint_fast8_t{ 1 }; ///< EPINT4.
+                static constexpr auto EPINT5    = std::uint_fast8_t{ 1 }; ///< EPINT5.
+                static constexpr auto EPINT6    = std::uint_fast8_t{ 1 }; ///< EPINT6.
+                static constexpr auto EPINT7    = std::uint_fast8_t{ 1 }; ///< EPINT7.
+                static constexpr auto RESERVED8 = std::uint_fast8_t{ 8 }; ///< RESERVED8.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto EPINT0 = std::uint_fast8_t{}; ///< EPINT0.
+                static constexpr auto EPINT1 = std::uint_fast8_t{ EPINT0 + Size::EPINT0 }; ///< EPINT1.
+                static constexpr auto EPINT2 = std::uint_fast8_t{ EPINT1 + Size::EPINT1 }; ///< EPINT2.
+                static constexpr auto EPINT3 = std::uint_fast8_t{ EPINT2 + Size::EPINT2 }; ///< EPINT3.
+                static constexpr auto EPINT4 = std::uint_fast8_t{ EPINT3 + Size::EPINT3 }; ///< EPINT4.
+                static constexpr auto EPINT5 = std::uint_fast8_t{ EPINT4 + Size::EPINT4 }; ///< EPINT5.
+                static constexpr auto EPINT6 = std::uint_fast8_t{ EPINT5 + Size::EPINT5 }; ///< EPINT6.
+                static constexpr auto EPINT7 = std::uint_fast8_t{ EPINT6 + Size::EPINT6 }; ///< EPINT7.
+                static constexpr auto RESERVED8 = std::uint_fast8_t{ EPINT7 + Size::EPINT7 }; ///< RESERVED8.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto EPINT0 = mask<std::uint16_t>( Size::EPINT0, Bit::EPINT0 ); ///< EPINT0.
+                static constexpr auto EPINT1 = mask<std::uint16_t>( Size::EPINT1, Bit::EPINT1 ); ///< EPINT1.
+                static constexpr auto EPINT2 = mask<std::uint16_t>( Size::EPINT2, Bit::EPINT2 ); ///< EPINT2.
+                static constexpr auto EPINT3 = mask<std::uint16_t>( Size::EPINT3, Bit::EPINT3 ); ///< EPINT3.
+                static constexpr auto EPINT4 = mask<std::uint16_t>( Size::EPINT4, Bit::EPINT4 ); ///< EPINT4.
+                static constexpr auto EPINT5 = mask<std::uint16_t>( Size::EPINT5, Bit::EPINT5 ); ///< EPINT5.
+                static constexpr auto EPINT6 = mask<std::uint16_t>( Size::EPINT6, Bit::EPINT6 ); ///< EPINT6.
+                static constexpr auto EPINT7 = mask<std::uint16_t>( Size::EPINT7, Bit::EPINT7 ); ///< EPINT7.
+                static constexpr auto RESERVED8 = mask<std::uint16_t>( Size::RESERVED8, Bit::RESERVED8 ); ///< RESERVED8.
+            };
+
+            PINTSMRY() = delete;
+
+            PINTSMRY( PINTSMRY && ) = delete;
+
+            PINTSMRY( PINTSMRY const & ) = delete;
+
+            ~PINTSMRY() = delete;
+
+            auto operator=( PINTSMRY && ) = delete;
+
+            auto operator=( PINTSMRY const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Pad Calibration (PADCAL) register.
+         *
+         * This register has the following fields:
+         * - USB Pad Transp Calibration (TRANSP)
+         * - USB Pad Transn Calibration (TRANSN)
+         * - USB Pad Trim Calibration (TRIM)
+         */
+        class PADCAL : public Register<std::uint16_t> {
+          public:
+            /**
+             * \brief Field sizes.
+             */
+            struct Size {
+                static constexpr auto TRANSP     = std::uint_fast8_t{ 5 }; ///< TRANSP.
+                static constexpr auto RESERVED5  = std::uint_fast8_t{ 1 }; ///< RESERVED5.
+                static constexpr auto TRANSN     = std::uint_fast8_t{ 5 }; ///< TRANSN.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ 1 }; ///< RESERVED11.
+                static constexpr auto TRIM       = std::uint_fast8_t{ 3 }; ///< TRIM.
+                static constexpr auto RESERVED15 = std::uint_fast8_t{ 1 }; ///< RESERVED15.
+            };
+
+            /**
+             * \brief Field bit positions.
+             */
+            struct Bit {
+                static constexpr auto TRANSP = std::uint_fast8_t{}; ///< TRANSP.
+                static constexpr auto RESERVED5 = std::uint_fast8_t{ TRANSP + Size::TRANSP }; ///< RESERVED5.
+                static constexpr auto TRANSN = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< TRANSN.
+                static constexpr auto RESERVED11 = std::uint_fast8_t{ TRANSN + Size::TRANSN }; ///< RESERVED11.
+                static constexpr auto TRIM = std::uint_fast8_t{ RESERVED11 + Size::RESERVED11 }; ///< TRIM.
+                static constexpr auto RESERVED15 = std::uint_fast8_t{ TRIM + Size::TRIM }; ///< RESERVED15.
+            };
+
+            /**
+             * \brief Field bit masks.
+             */
+            struct Mask {
+                static constexpr auto TRANSP = mask<std::uint16_t>( Size::TRANSP, Bit::TRANSP ); ///< TRANSP.
+                static constexpr auto RESERVED5 = mask<std::uint16_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                static constexpr auto TRANSN = mask<std::uint16_t>( Size::TRANSN, Bit::TRANSN ); ///< TRANSN.
+                static constexpr auto RESERVED11 = mask<std::uint16_t>( Size::RESERVED11, Bit::RESERVED11 ); ///< RESERVED11.
+                static constexpr auto TRIM = mask<std::uint16_t>( Size::TRIM, Bit::TRIM ); ///< TRIM.
+                static constexpr auto RESERVED15 = mask<std::uint16_t>( Size::RESERVED15, Bit::RESERVED15 ); ///< RESERVED15.
+            };
+
+            PADCAL() = delete;
+
+            PADCAL( PADCAL && ) = delete;
+
+            PADCAL( PADCAL const & ) = delete;
+
+            ~PADCAL() = delete;
+
+            auto operator=( PADCAL && ) = delete;
+
+            auto operator=( PADCAL const & ) = delete;
+
+            using Register<std::uint16_t>::operator=;
+        };
+
+        /**
+         * \brief Pipe registers.
+         */
+        class PIPE {
+          public:
+            /**
+             * \brief Pipe Configuration (PCFG) register.
+             *
+             * This register has the following fields:
+             * - Pipe Token (PTOKEN)
+             * - Pipe Bank (BK)
+             * - Pipe Type (PTYPE)
+             */
+            class PCFG : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto PTOKEN    = std::uint_fast8_t{ 2 }; ///< PTOKEN.
+                    static constexpr auto BK        = std::uint_fast8_t{ 1 }; ///< BK.
+                    static constexpr auto PTYPE     = std::uint_fast8_t{ 3 }; ///< PTYPE.
+                    static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto PTOKEN = std::uint_fast8_t{}; ///< PTOKEN.
+                    static constexpr auto BK = std::uint_fast8_t{ PTOKEN + Size::PTOKEN }; ///< BK.
+                    static constexpr auto PTYPE = std::uint_fast8_t{ BK + Size::BK }; ///< PTYPE.
+                    static constexpr auto RESERVED6 = std::uint_fast8_t{ PTYPE + Size::PTYPE }; ///< RESERVED6.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto PTOKEN = mask<std::uint8_t>( Size::PTOKEN, Bit::PTOKEN ); ///< PTOKEN.
+                    static constexpr auto BK = mask<std::uint8_t>( Size::BK, Bit::BK ); ///< BK.
+                    static constexpr auto PTYPE = mask<std::uint8_t>( Size::PTYPE, Bit::PTYPE ); ///< PTYPE.
+                    static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+                };
+
+                /**
+                 * \brief PTOKEN.
+                 */
+                enum PTOKEN : std::uint8_t {
+                    PTOKEN_SETUP = 0x0 << Bit::PTOKEN, ///< SETUP.
+                    PTOKEN_IN    = 0x1 << Bit::PTOKEN, ///< IN.
+                    PTOKEN_OUT   = 0x2 << Bit::PTOKEN, ///< OUT.
+                };
+
+                /**
+                 * \brief PTYPE.
+                 */
+                enum PTYPE : std::uint8_t {
+                    PTYPE_DISABLE   = 0x0 << Bit::PTYPE, ///< Pipe disabled.
+                    PTYPE_CONTROL   = 0x1 << Bit::PTYPE, ///< Control pipe.
+                    PTYPE_ISO       = 0x2 << Bit::PTYPE, ///< Isochronous pipe.
+                    PTYPE_BULK      = 0x3 << Bit::PTYPE, ///< Bulk pipe.
+                    PTYPE_INTERRUPT = 0x4 << Bit::PTYPE, ///< Interrupt pipe.
+                    PTYPE_EXTENDED  = 0x5 << Bit::PTYPE, ///< Extended pipe.
+                };
+
+                PCFG() = delete;
+
+                PCFG( PCFG && ) = delete;
+
+                PCFG( PCFG const & ) = delete;
+
+                ~PCFG() = delete;
+
+                auto operator=( PCFG && ) = delete;
+
+                auto operator=( PCFG const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Pipe Status Clear (PSTATUSCLR) register.
+             *
+             * This register has the following fields:
+             * - Data Toggle (DTGL)
+             * - Current Bank (CURBK)
+             * - Pipe Freeze (PFREEZE)
+             * - Bank 0 Ready (BK0RDY)
+             * - Bank 1 Ready (BK1RDY)
+             */
+            class PSTATUSCLR : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto DTGL      = std::uint_fast8_t{ 1 }; ///< DTGL.
+                    static constexpr auto RESERVED1 = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                    static constexpr auto CURBK     = std::uint_fast8_t{ 1 }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                    static constexpr auto PFREEZE = std::uint_fast8_t{ 1 }; ///< PFREEZE.
+                    static constexpr auto RESERVED5 = std::uint_fast8_t{ 1 }; ///< RESERVED5.
+                    static constexpr auto BK0RDY    = std::uint_fast8_t{ 1 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY    = std::uint_fast8_t{ 1 }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto DTGL = std::uint_fast8_t{}; ///< DTGL.
+                    static constexpr auto RESERVED1 = std::uint_fast8_t{ DTGL + Size::DTGL }; ///< RESERVED1.
+                    static constexpr auto CURBK = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ CURBK + Size::CURBK }; ///< RESERVED3.
+                    static constexpr auto PFREEZE = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< PFREEZE.
+                    static constexpr auto RESERVED5 = std::uint_fast8_t{ PFREEZE + Size::PFREEZE }; ///< RESERVED5.
+                    static constexpr auto BK0RDY = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY = std::uint_fast8_t{ BK0RDY + Size::BK0RDY }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto DTGL = mask<std::uint8_t>( Size::DTGL, Bit::DTGL ); ///< DTGL.
+                    static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                    static constexpr auto CURBK = mask<std::uint8_t>( Size::CURBK, Bit::CURBK ); ///< CURBK.
+                    static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                    static constexpr auto PFREEZE = mask<std::uint8_t>( Size::PFREEZE, Bit::PFREEZE ); ///< PFREEZE.
+                    static constexpr auto RESERVED5 = mask<std::uint8_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                    static constexpr auto BK0RDY = mask<std::uint8_t>( Size::BK0RDY, Bit::BK0RDY ); ///< BK0RDY.
+                    static constexpr auto BK1RDY = mask<std::uint8_t>( Size::BK1RDY, Bit::BK1RDY ); ///< BK1RDY.
+                };
+
+                PSTATUSCLR() = delete;
+
+                PSTATUSCLR( PSTATUSCLR && ) = delete;
+
+                PSTATUSCLR( PSTATUSCLR const & ) = delete;
+
+                ~PSTATUSCLR() = delete;
+
+                auto operator=( PSTATUSCLR && ) = delete;
+
+                auto operator=( PSTATUSCLR const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Pipe Status Set (PSTATUSSET) register.
+             *
+             * This register has the following fields:
+             * - Data Toggle (DTGL)
+             * - Current Bank (CURBK)
+             * - Pipe Freeze (PFREEZE)
+             * - Bank 0 Ready (BK0RDY)
+             * - Bank 1 Ready (BK1RDY)
+             */
+            class PSTATUSSET : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto DTGL      = std::uint_fast8_t{ 1 }; ///< DTGL.
+                    static constexpr auto RESERVED1 = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                    static constexpr auto CURBK     = std::uint_fast8_t{ 1 }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                    static constexpr auto PFREEZE = std::uint_fast8_t{ 1 }; ///< PFREEZE.
+                    static constexpr auto RESERVED5 = std::uint_fast8_t{ 1 }; ///< RESERVED5.
+                    static constexpr auto BK0RDY    = std::uint_fast8_t{ 1 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY    = std::uint_fast8_t{ 1 }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto DTGL = std::uint_fast8_t{}; ///< DTGL.
+                    static constexpr auto RESERVED1 = std::uint_fast8_t{ DTGL + Size::DTGL }; ///< RESERVED1.
+                    static constexpr auto CURBK = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ CURBK + Size::CURBK }; ///< RESERVED3.
+                    static constexpr auto PFREEZE = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< PFREEZE.
+                    static constexpr auto RESERVED5 = std::uint_fast8_t{ PFREEZE + Size::PFREEZE }; ///< RESERVED5.
+                    static constexpr auto BK0RDY = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY = std::uint_fast8_t{ BK0RDY + Size::BK0RDY }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto DTGL = mask<std::uint8_t>( Size::DTGL, Bit::DTGL ); ///< DTGL.
+                    static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                    static constexpr auto CURBK = mask<std::uint8_t>( Size::CURBK, Bit::CURBK ); ///< CURBK.
+                    static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                    static constexpr auto PFREEZE = mask<std::uint8_t>( Size::PFREEZE, Bit::PFREEZE ); ///< PFREEZE.
+                    static constexpr auto RESERVED5 = mask<std::uint8_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                    static constexpr auto BK0RDY = mask<std::uint8_t>( Size::BK0RDY, Bit::BK0RDY ); ///< BK0RDY.
+                    static constexpr auto BK1RDY = mask<std::uint8_t>( Size::BK1RDY, Bit::BK1RDY ); ///< BK1RDY.
+                };
+
+                PSTATUSSET() = delete;
+
+                PSTATUSSET( PSTATUSSET && ) = delete;
+
+                PSTATUSSET( PSTATUSSET const & ) = delete;
+
+                ~PSTATUSSET() = delete;
+
+                auto operator=( PSTATUSSET && ) = delete;
+
+                auto operator=( PSTATUSSET const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Pipe Status (PSTATUS) register.
+             *
+             * This register has the following fields:
+             * - Data Toggle (DTGL)
+             * - Current Bank (CURBK)
+             * - Pipe Freeze (PFREEZE)
+             * - Bank 0 Ready (BK0RDY)
+             * - Bank 1 Ready (BK1RDY)
+             */
+            class PSTATUS : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto DTGL      = std::uint_fast8_t{ 1 }; ///< DTGL.
+                    static constexpr auto RESERVED1 = std::uint_fast8_t{ 1 }; ///< RESERVED1.
+                    static constexpr auto CURBK     = std::uint_fast8_t{ 1 }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ 1 }; ///< RESERVED3.
+                    static constexpr auto PFREEZE = std::uint_fast8_t{ 1 }; ///< PFREEZE.
+                    static constexpr auto RESERVED5 = std::uint_fast8_t{ 1 }; ///< RESERVED5.
+                    static constexpr auto BK0RDY    = std::uint_fast8_t{ 1 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY    = std::uint_fast8_t{ 1 }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto DTGL = std::uint_fast8_t{}; ///< DTGL.
+                    static constexpr auto RESERVED1 = std::uint_fast8_t{ DTGL + Size::DTGL }; ///< RESERVED1.
+                    static constexpr auto CURBK = std::uint_fast8_t{ RESERVED1 + Size::RESERVED1 }; ///< CURBK.
+                    static constexpr auto RESERVED3 = std::uint_fast8_t{ CURBK + Size::CURBK }; ///< RESERVED3.
+                    static constexpr auto PFREEZE = std::uint_fast8_t{ RESERVED3 + Size::RESERVED3 }; ///< PFREEZE.
+                    static constexpr auto RESERVED5 = std::uint_fast8_t{ PFREEZE + Size::PFREEZE }; ///< RESERVED5.
+                    static constexpr auto BK0RDY = std::uint_fast8_t{ RESERVED5 + Size::RESERVED5 }; ///< BK0RDY.
+                    static constexpr auto BK1RDY = std::uint_fast8_t{ BK0RDY + Size::BK0RDY }; ///< BK1RDY.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto DTGL = mask<std::uint8_t>( Size::DTGL, Bit::DTGL ); ///< DTGL.
+                    static constexpr auto RESERVED1 = mask<std::uint8_t>( Size::RESERVED1, Bit::RESERVED1 ); ///< RESERVED1.
+                    static constexpr auto CURBK = mask<std::uint8_t>( Size::CURBK, Bit::CURBK ); ///< CURBK.
+                    static constexpr auto RESERVED3 = mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< RESERVED3.
+                    static constexpr auto PFREEZE = mask<std::uint8_t>( Size::PFREEZE, Bit::PFREEZE ); ///< PFREEZE.
+                    static constexpr auto RESERVED5 = mask<std::uint8_t>( Size::RESERVED5, Bit::RESERVED5 ); ///< RESERVED5.
+                    static constexpr auto BK0RDY = mask<std::uint8_t>( Size::BK0RDY, Bit::BK0RDY ); ///< BK0RDY.
+                    static constexpr auto BK1RDY = mask<std::uint8_t>( Size::BK1RDY, Bit::BK1RDY ); ///< BK1RDY.
+                };
+
+                PSTATUS() = delete;
+
+                PSTATUS( PSTATUS && ) = delete;
+
+                PSTATUS( PSTATUS const & ) = delete;
+
+                ~PSTATUS() = delete;
+
+                auto operator=( PSTATUS && ) = delete;
+
+                auto operator=( PSTATUS const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Pipe Interrupt Flag (PINTFLAG) register.
+             *
+             * This register has the following fields:
+             * - Transfer Complete 0 Interrupt (TRCPT0)
+             * - Transfer Complete 1 Interrupt (TRCPT1)
+             * - Transfer Fail Interrupt (TRFAIL)
+             * - Pipe Error Interrupt (PERR)
+             * - Transmitted Setup Interrupt (TXSTP)
+             * - Stall Interrupt (STALL)
+             */
+            class PINTFLAG : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto TRCPT0    = std::uint_fast8_t{ 1 }; ///< TRCPT0.
+                    static constexpr auto TRCPT1    = std::uint_fast8_t{ 1 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL    = std::uint_fast8_t{ 1 }; ///< TRFAIL.
+                    static constexpr auto PERR      = std::uint_fast8_t{ 1 }; ///< PERR.
+                    static constexpr auto TXSTP     = std::uint_fast8_t{ 1 }; ///< TXSTP.
+                    static constexpr auto STALL     = std::uint_fast8_t{ 1 }; ///< STALL.
+                    static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto TRCPT0 = std::uint_fast8_t{}; ///< TRCPT0.
+                    static constexpr auto TRCPT1 = std::uint_fast8_t{ TRCPT0 + Size::TRCPT0 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL = std::uint_fast8_t{ TRCPT1 + Size::TRCPT1 }; ///< TRFAIL.
+                    static constexpr auto PERR = std::uint_fast8_t{ TRFAIL + Size::TRFAIL }; ///< PERR.
+                    static constexpr auto TXSTP = std::uint_fast8_t{ PERR + Size::PERR }; ///< TXSTP.
+                    static constexpr auto STALL = std::uint_fast8_t{ TXSTP + Size::TXSTP }; ///< STALL.
+                    static constexpr auto RESERVED6 = std::uint_fast8_t{ STALL + Size::STALL }; ///< RESERVED6.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto TRCPT0 = mask<std::uint8_t>( Size::TRCPT0, Bit::TRCPT0 ); ///< TRCPT0.
+                    static constexpr auto TRCPT1 = mask<std::uint8_t>( Size::TRCPT1, Bit::TRCPT1 ); ///< TRCPT1.
+                    static constexpr auto TRFAIL = mask<std::uint8_t>( Size::TRFAIL, Bit::TRFAIL ); ///< TRFAIL.
+                    static constexpr auto PERR = mask<std::uint8_t>( Size::PERR, Bit::PERR ); ///< PERR.
+                    static constexpr auto TXSTP = mask<std::uint8_t>( Size::TXSTP, Bit::TXSTP ); ///< TXSTP.
+                    static constexpr auto STALL = mask<std::uint8_t>( Size::STALL, Bit::STALL ); ///< STALL.
+                    static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+                };
+
+                PINTFLAG() = delete;
+
+                PINTFLAG( PINTFLAG && ) = delete;
+
+                PINTFLAG( PINTFLAG const & ) = delete;
+
+                ~PINTFLAG() = delete;
+
+                auto operator=( PINTFLAG && ) = delete;
+
+                auto operator=( PINTFLAG const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Pipe Interrupt Enable Clear (PINTENCLR) register.
+             *
+             * This register has the following fields:
+             * - Transfer Complete 0 Interrupt Enable (TRCPT0)
+             * - Transfer Complete 1 Interrupt Enable (TRCPT1)
+             * - Transfer Fail Interrupt Enable (TRFAIL)
+             * - Pipe Error Interrupt Enable (PERR)
+             * - Transmitted Setup Interrupt Enable (TXSTP)
+             * - Stall Interrupt Enable (STALL)
+             */
+            class PINTENCLR : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto TRCPT0    = std::uint_fast8_t{ 1 }; ///< TRCPT0.
+                    static constexpr auto TRCPT1    = std::uint_fast8_t{ 1 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL    = std::uint_fast8_t{ 1 }; ///< TRFAIL.
+                    static constexpr auto PERR      = std::uint_fast8_t{ 1 }; ///< PERR.
+                    static constexpr auto TXSTP     = std::uint_fast8_t{ 1 }; ///< TXSTP.
+                    static constexpr auto STALL     = std::uint_fast8_t{ 1 }; ///< STALL.
+                    static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto TRCPT0 = std::uint_fast8_t{}; ///< TRCPT0.
+                    static constexpr auto TRCPT1 = std::uint_fast8_t{ TRCPT0 + Size::TRCPT0 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL = std::uint_fast8_t{ TRCPT1 + Size::TRCPT1 }; ///< TRFAIL.
+                    static constexpr auto PERR = std::uint_fast8_t{ TRFAIL + Size::TRFAIL }; ///< PERR.
+                    static constexpr auto TXSTP = std::uint_fast8_t{ PERR + Size::PERR }; ///< TXSTP.
+                    static constexpr auto STALL = std::uint_fast8_t{ TXSTP + Size::TXSTP }; ///< STALL.
+                    static constexpr auto RESERVED6 = std::uint_fast8_t{ STALL + Size::STALL }; ///< RESERVED6.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto TRCPT0 = mask<std::uint8_t>( Size::TRCPT0, Bit::TRCPT0 ); ///< TRCPT0.
+                    static constexpr auto TRCPT1 = mask<std::uint8_t>( Size::TRCPT1, Bit::TRCPT1 ); ///< TRCPT1.
+                    static constexpr auto TRFAIL = mask<std::uint8_t>( Size::TRFAIL, Bit::TRFAIL ); ///< TRFAIL.
+                    static constexpr auto PERR = mask<std::uint8_t>( Size::PERR, Bit::PERR ); ///< PERR.
+                    static constexpr auto TXSTP = mask<std::uint8_t>( Size::TXSTP, Bit::TXSTP ); ///< TXSTP.
+                    static constexpr auto STALL = mask<std::uint8_t>( Size::STALL, Bit::STALL ); ///< STALL.
+                    static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+                };
+
+                PINTENCLR() = delete;
+
+                PINTENCLR( PINTENCLR && ) = delete;
+
+                PINTENCLR( PINTENCLR const & ) = delete;
+
+                ~PINTENCLR() = delete;
+
+                auto operator=( PINTENCLR && ) = delete;
+
+                auto operator=( PINTENCLR const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief Pipe Interrupt Enable Set (PINTENSET) register.
+             *
+             * This register has the following fields:
+             * - Transfer Complete 0 Interrupt Enable (TRCPT0)
+             * - Transfer Complete 1 Interrupt Enable (TRCPT1)
+             * - Transfer Fail Interrupt Enable (TRFAIL)
+             * - Pipe Error Interrupt Enable (PERR)
+             * - Transmitted Setup Interrupt Enable (TXSTP)
+             * - Stall Interrupt Enable (STALL)
+             */
+            class PINTENSET : public Register<std::uint8_t> {
+              public:
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto TRCPT0    = std::uint_fast8_t{ 1 }; ///< TRCPT0.
+                    static constexpr auto TRCPT1    = std::uint_fast8_t{ 1 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL    = std::uint_fast8_t{ 1 }; ///< TRFAIL.
+                    static constexpr auto PERR      = std::uint_fast8_t{ 1 }; ///< PERR.
+                    static constexpr auto TXSTP     = std::uint_fast8_t{ 1 }; ///< TXSTP.
+                    static constexpr auto STALL     = std::uint_fast8_t{ 1 }; ///< STALL.
+                    static constexpr auto RESERVED6 = std::uint_fast8_t{ 2 }; ///< RESERVED6.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto TRCPT0 = std::uint_fast8_t{}; ///< TRCPT0.
+                    static constexpr auto TRCPT1 = std::uint_fast8_t{ TRCPT0 + Size::TRCPT0 }; ///< TRCPT1.
+                    static constexpr auto TRFAIL = std::uint_fast8_t{ TRCPT1 + Size::TRCPT1 }; ///< TRFAIL.
+                    static constexpr auto PERR = std::uint_fast8_t{ TRFAIL + Size::TRFAIL }; ///< PERR.
+                    static constexpr auto TXSTP = std::uint_fast8_t{ PERR + Size::PERR }; ///< TXSTP.
+                    static constexpr auto STALL = std::uint_fast8_t{ TXSTP + Size::TXSTP }; ///< STALL.
+                    static constexpr auto RESERVED6 = std::uint_fast8_t{ STALL + Size::STALL }; ///< RESERVED6.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto TRCPT0 = mask<std::uint8_t>( Size::TRCPT0, Bit::TRCPT0 ); ///< TRCPT0.
+                    static constexpr auto TRCPT1 = mask<std::uint8_t>( Size::TRCPT1, Bit::TRCPT1 ); ///< TRCPT1.
+                    static constexpr auto TRFAIL = mask<std::uint8_t>( Size::TRFAIL, Bit::TRFAIL ); ///< TRFAIL.
+                    static constexpr auto PERR = mask<std::uint8_t>( Size::PERR, Bit::PERR ); ///< PERR.
+                    static constexpr auto TXSTP = mask<std::uint8_t>( Size::TXSTP, Bit::TXSTP ); ///< TXSTP.
+                    static constexpr auto STALL = mask<std::uint8_t>( Size::STALL, Bit::STALL ); ///< STALL.
+                    static constexpr auto RESERVED6 = mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< RESERVED6.
+                };
+
+                PINTENSET() = delete;
+
+                PINTENSET( PINTENSET && ) = delete;
+
+                PINTENSET( PINTENSET const & ) = delete;
+
+                ~PINTENSET() = delete;
+
+                auto operator=( PINTENSET && ) = delete;
+
+                auto operator=( PINTENSET const & ) = delete;
+
+                using Register<std::uint8_t>::operator=;
+            };
+
+            /**
+             * \brief PCFG.
+             */
+            PCFG pcfg;
+
+            /**
+             * \brief Reserved registers (offset 0x01-0x02).
+             */
+            Reserved_Register<std::uint8_t> const
+                reserved_0x01_0x02[ ( 0x02 - 0x01 ) + 1 ];
+
+            /**
+             * \brief Interval for the Bulk-Out/Ping Transaction (BINTERVAL) register.
+             */
+            Register<std::uint8_t> binterval;
+
+            /**
+             * \brief PSTATUSCLR.
+             */
+            PSTATUSCLR pstatusclr;
+
+            /**
+             * \brief PSTATUSSET.
+             */
+            PSTATUSSET pstatusset;
+
+            /**
+             * \brief PSTATUS.
+             */
+            PSTATUS const pstatus;
+
+            /**
+             * \brief PINTFLAG.
+             */
+            PINTFLAG pintflag;
+
+            /**
+             * \brief PINTENCLR.
+             */
+            PINTENCLR pintenclr;
+
+            /**
+             * \brief PINTENSET.
+             */
+            PINTENSET pintenset;
+
+            /**
+             * \brief Reserved registers (offset 0x0A-0x1F).
+             */
+            Reserved_Register<std::uint8_t> const
+                reserved_0x0A_0x1F[ ( 0x1F - 0x0A ) + 1 ];
+
+            PIPE() = delete;
+
+            PIPE( PIPE && ) = delete;
+
+            PIPE( PIPE const & ) = delete;
+
+            ~PIPE() = delete;
+
+            auto operator=( PIPE && ) = delete;
+
+            auto operator=( PIPE const & ) = delete;
+        };
+
+        /**
+         * \brief Pipe bank descriptor (located in SRAM, must be 32-bit aligned).
+         *
+         * Descriptors for all enabled pipes are stored in a table (two descriptors, bank
+         * 0 and bank 1, per pipe) whose address is stored in the Descriptor Address
+         * (DESCADD) register.
+         */
+        struct Descriptor {
+            /**
+             * \brief Packet Size (PCKSIZE) register.
+             *
+             * This register has the following fields:
+             * - Byte Count (BYTE_COUNT)
+             * - Multi Packet Size (MULTI_PACKET_SIZE)
+             * - Packet Size (SIZE)
+             * - Automatic Zero Length Packet (AUTO_ZLP)
+             */
+            struct PCKSIZE {
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto BYTE_COUNT = std::uint_fast8_t{ 14 }; ///< BYTE_COUNT.
+                    static constexpr auto MULTI_PACKET_SIZE = std::uint_fast8_t{ 14 }; ///< MULTI_PACKET_SIZE.
+                    static constexpr auto SIZE     = std::uint_fast8_t{ 3 }; ///< SIZE.
+                    static constexpr auto AUTO_ZLP = std::uint_fast8_t{ 1 }; ///< AUTO_ZLP.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto BYTE_COUNT = std::uint_fast8_t{}; ///< BYTE_COUNT.
+                    static constexpr auto MULTI_PACKET_SIZE = std::uint_fast8_t{ BYTE_COUNT + Size::BYTE_COUNT }; ///< MULTI_PACKET_SIZE.
+                    static constexpr auto SIZE = std::uint_fast8_t{ MULTI_PACKET_SIZE + Size::MULTI_PACKET_SIZE }; ///< SIZE.
+                    static constexpr auto AUTO_ZLP = std::uint_fast8_t{ SIZE + Size::SIZE }; ///< AUTO_ZLP.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto BYTE_COUNT = mask<std::uint32_t>( Size::BYTE_COUNT, Bit::BYTE_COUNT ); ///< BYTE_COUNT.
+                    static constexpr auto MULTI_PACKET_SIZE = mask<std::uint32_t>( Size::MULTI_PACKET_SIZE, Bit::MULTI_PACKET_SIZE ); ///< MULTI_PACKET_SIZE.
+                    static constexpr auto SIZE = mask<std::uint32_t>( Size::SIZE, Bit::SIZE ); ///< SIZE.
+                    static constexpr auto AUTO_ZLP = mask<std::uint32_t>( Size::AUTO_ZLP, Bit::AUTO_ZLP ); ///< AUTO_ZLP.
+                };
+
+                /**
+                 * \brief SIZE.
+                 */
+                enum SIZE : std::uint32_t {
+                    SIZE_8    = 0x0 << Bit::SIZE, ///< 8 bytes.
+                    SIZE_16   = 0x1 << Bit::SIZE, ///< 16 bytes.
+                    SIZE_32   = 0x2 << Bit::SIZE, ///< 32 bytes.
+                    SIZE_64   = 0x3 << Bit::SIZE, ///< 64 bytes.
+                    SIZE_128  = 0x4 << Bit::SIZE, ///< 128 bytes.
+                    SIZE_256  = 0x5 << Bit::SIZE, ///< 256 bytes.
+                    SIZE_512  = 0x6 << Bit::SIZE, ///< 512 bytes.
+                    SIZE_1023 = 0x7 << Bit::SIZE, ///< 1023 bytes.
+                };
+            };
+
+            /**
+             * \brief Extended Register (EXTREG) register.
+             *
+             * This register has the following fields:
+             * - SUBPID (SUBPID)
+             * - VARIABLE (VARIABLE)
+             */
+            struct EXTREG {
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto SUBPID   = std::uint_fast8_t{ 4 }; ///< SUBPID.
+                    static constexpr auto VARIABLE = std::uint_fast8_t{ 11 }; ///< VARIABLE.
+                    static constexpr auto RESERVED15 = std::uint_fast8_t{ 1 }; ///< RESERVED15.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto SUBPID = std::uint_fast8_t{}; ///< SUBPID.
+                    static constexpr auto VARIABLE = std::uint_fast8_t{ SUBPID + Size::SUBPID }; ///< VARIABLE.
+                    static constexpr auto RESERVED15 = std::uint_fast8_t{ VARIABLE + Size::VARIABLE }; ///< RESERVED15.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto SUBPID = mask<std::uint16_t>( Size::SUBPID, Bit::SUBPID ); ///< SUBPID.
+                    static constexpr auto VARIABLE = mask<std::uint16_t>( Size::VARIABLE, Bit::VARIABLE ); ///< VARIABLE.
+                    static constexpr auto RESERVED15 = mask<std::uint16_t>( Size::RESERVED15, Bit::RESERVED15 ); ///< RESERVED15.
+                };
+            };
+
+            /**
+             * \brief Bank Status (STATUS_BK) register.
+             *
+             * This register has the following fields:
+             * - CRC Error (CRCERR)
+             * - Error Flow (ERRORFLOW)
+             */
+            struct STATUS_BK {
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto CRCERR    = std::uint_fast8_t{ 1 }; ///< CRCERR.
+                    static constexpr auto ERRORFLOW = std::uint_fast8_t{ 1 }; ///< ERRORFLOW.
+                    static constexpr auto RESERVED2 = std::uint_fast8_t{ 6 }; ///< RESERVED2.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto CRCERR = std::uint_fast8_t{}; ///< CRCERR.
+                    static constexpr auto ERRORFLOW = std::uint_fast8_t{ CRCERR + Size::CRCERR }; ///< ERRORFLOW.
+                    static constexpr auto RESERVED2 = std::uint_fast8_t{ ERRORFLOW + Size::ERRORFLOW }; ///< RESERVED2.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto CRCERR = mask<std::uint8_t>( Size::CRCERR, Bit::CRCERR ); ///< CRCERR.
+                    static constexpr auto ERRORFLOW = mask<std::uint8_t>( Size::ERRORFLOW, Bit::ERRORFLOW ); ///< ERRORFLOW.
+                    static constexpr auto RESERVED2 = mask<std::uint8_t>( Size::RESERVED2, Bit::RESERVED2 ); ///< RESERVED2.
+                };
+            };
+
+            /**
+             * \brief Host Control Pipe (CTRL_PIPE) register.
+             *
+             * This register has the following fields:
+             * - Pipe Device Address (PDADDR)
+             * - Pipe Endpoint Number (PEPNUM)
+             * - Pipe Error Max Number (PERMAX)
+             */
+            struct CTRL_PIPE {
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto PDADDR    = std::uint_fast8_t{ 7 }; ///< PDADDR.
+                    static constexpr auto RESERVED7 = std::uint_fast8_t{ 1 }; ///< RESERVED7.
+                    static constexpr auto PEPNUM    = std::uint_fast8_t{ 4 }; ///< PEPNUM.
+                    static constexpr auto PERMAX    = std::uint_fast8_t{ 4 }; ///< PERMAX.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto PDADDR = std::uint_fast8_t{}; ///< PDADDR.
+                    static constexpr auto RESERVED7 = std::uint_fast8_t{ PDADDR + Size::PDADDR }; ///< RESERVED7.
+                    static constexpr auto PEPNUM = std::uint_fast8_t{ RESERVED7 + Size::RESERVED7 }; ///< PEPNUM.
+                    static constexpr auto PERMAX = std::uint_fast8_t{ PEPNUM + Size::PEPNUM }; ///< PERMAX.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto PDADDR = mask<std::uint16_t>( Size::PDADDR, Bit::PDADDR ); ///< PDADDR.
+                    static constexpr auto RESERVED7 = mask<std::uint16_t>( Size::RESERVED7, Bit::RESERVED7 ); ///< RESERVED7.
+                    static constexpr auto PEPNUM = mask<std::uint16_t>( Size::PEPNUM, Bit::PEPNUM ); ///< PEPNUM.
+                    static constexpr auto PERMAX = mask<std::uint16_t>( Size::PERMAX, Bit::PERMAX ); ///< PERMAX.
+                };
+            };
+
+            /**
+             * \brief Host Pipe Status (STATUS_PIPE) register.
+             *
+             * This register has the following fields:
+             * - Data Toggle Error (DTGLER)
+             * - Data PID Error (DAPIDER)
+             * - PID Error (PIDER)
+             * - Time Out Error (TOUTER)
+             * - CRC16 Error (CRC16ER)
+             * - Pipe Error Counter (ERCNT)
+             */
+            struct STATUS_PIPE {
+                /**
+                 * \brief Field sizes.
+                 */
+                struct Size {
+                    static constexpr auto DTGLER  = std::uint_fast8_t{ 1 }; ///< DTGLER.
+                    static constexpr auto DAPIDER = std::uint_fast8_t{ 1 }; ///< DAPIDER.
+                    static constexpr auto PIDER   = std::uint_fast8_t{ 1 }; ///< PIDER.
+                    static constexpr auto TOUTER  = std::uint_fast8_t{ 1 }; ///< TOUTER.
+                    static constexpr auto CRC16ER = std::uint_fast8_t{ 1 }; ///< CRC16ER.
+                    static constexpr auto ERCNT   = std::uint_fast8_t{ 3 }; ///< ERCNT.
+                    static constexpr auto RESERVED8 = std::uint_fast8_t{ 8 }; ///< RESERVED8.
+                };
+
+                /**
+                 * \brief Field bit positions.
+                 */
+                struct Bit {
+                    static constexpr auto DTGLER = std::uint_fast8_t{}; ///< DTGLER.
+                    static constexpr auto DAPIDER = std::uint_fast8_t{ DTGLER + Size::DTGLER }; ///< DAPIDER.
+                    static constexpr auto PIDER = std::uint_fast8_t{ DAPIDER + Size::DAPIDER }; ///< PIDER.
+                    static constexpr auto TOUTER = std::uint_fast8_t{ PIDER + Size::PIDER }; ///< TOUTER.
+                    static constexpr auto CRC16ER = std::uint_fast8_t{ TOUTER + Size::TOUTER }; ///< CRC16ER.
+                    static constexpr auto ERCNT = std::uint_fast8_t{ CRC16ER + Size::CRC16ER }; ///< ERCNT.
+                    static constexpr auto RESERVED8 = std::uint_fast8_t{ ERCNT + Size::ERCNT }; ///< RESERVED8.
+                };
+
+                /**
+                 * \brief Field bit masks.
+                 */
+                struct Mask {
+                    static constexpr auto DTGLER = mask<std::uint16_t>( Size::DTGLER, Bit::DTGLER ); ///< DTGLER.
+                    static constexpr auto DAPIDER = mask<std::uint16_t>( Size::DAPIDER, Bit::DAPIDER ); ///< DAPIDER.
+                    static constexpr auto PIDER = mask<std::uint16_t>( Size::PIDER, Bit::PIDER ); ///< PIDER.
+                    static constexpr auto TOUTER = mask<std::uint16_t>( Size::TOUTER, Bit::TOUTER ); ///< TOUTER.
+                    static constexpr auto CRC16ER = mask<std::uint16_t>( Size::CRC16ER, Bit::CRC16ER ); ///< CRC16ER.
+                    static constexpr auto ERCNT = mask<std::uint16_t>( Size::ERCNT, Bit::ERCNT ); ///< ERCNT.
+                    static constexpr auto RESERVED8 = mask<std::uint16_t>( Size::RESERVED8, Bit::RESERVED8 ); ///< RESERVED8.
+                };
+            };
+
+            /**
+             * \brief Address of Data Buffer (ADDR) (must be 32-bit aligned).
+             */
+            std::uint32_t addr;
+
+            /**
+             * \brief Packet Size (PCKSIZE).
+             */
+            std::uint32_t pcksize;
+
+            /**
+             * \brief Extended Register (EXTREG).
+             */
+            std::uint16_t extreg;
+
+            /**
+             * \brief Bank Status (STATUS_BK).
+             */
+            std::uint8_t status_bk;
+
+            /**
+             * \brief Reserved.
+             */
+            std::uint8_t reserved;
+
+            /**
+             * \brief Host Control Pipe (CTRL_PIPE).
+             */
+            std::uint16_t ctrl_pipe;
+
+            /**
+             * \brief Host Pipe Status (STATUS_PIPE).
+             */
+            std::uint16_t status_pipe;
+        };
+
+        /**
+         * \brief CTRLA.
+         */
+        CTRLA ctrla;
+
+        /**
+         * \brief Reserved registers (offset 0x01-0x01).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x01_0x01[ ( 0x01 - 0x01 ) + 1 ];
+
+        /**
+         * \brief SYNCBUSY.
+         */
+        SYNCBUSY const syncbusy;
+
+        /**
+         * \brief QOSCTRL.
+         */
+        QOSCTRL qosctrl;
+
+        /**
+         * \brief Reserved registers (offset 0x04-0x07).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x04_0x07[ ( 0x07 - 0x04 ) + 1 ];
+
+        /**
+         * \brief CTRLB.
+         */
+        CTRLB ctrlb;
+
+        /**
+         * \brief HSOFC.
+         */
+        HSOFC hsofc;
+
+        /**
+         * \brief Reserved registers (offset 0x0B-0x0B).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x0B_0x0B[ ( 0x0B - 0x0B ) + 1 ];
+
+        /**
+         * \brief STATUS.
+         */
+        STATUS const status;
+
+        /**
+         * \brief FSMSTATUS.
+         */
+        FSMSTATUS const fsmstatus;
+
+        /**
+         * \brief Reserved registers (offset 0x0E-0x0F).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x0E_0x0F[ ( 0x0F - 0x0E ) + 1 ];
+
+        /**
+         * \brief FNUM.
+         */
+        FNUM fnum;
+
+        /**
+         * \brief Frame Length (FLENHIGH) register.
+         */
+        Register<std::uint8_t> const flenhigh;
+
+        /**
+         * \brief Reserved registers (offset 0x13-0x13).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x13_0x13[ ( 0x13 - 0x13 ) + 1 ];
+
+        /**
+         * \brief INTENCLR.
+         */
+        INTENCLR intenclr;
+
+        /**
+         * \brief Reserved registers (offset 0x16-0x17).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x16_0x17[ ( 0x17 - 0x16 ) + 1 ];
+
+        /**
+         * \brief INTENSET.
+         */
+        INTENSET intenset;
+
+        /**
+         * \brief Reserved registers (offset 0x1A-0x1B).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x1A_0x1B[ ( 0x1B - 0x1A ) + 1 ];
+
+        /**
+         * \brief INTFLAG.
+         */
+        INTFLAG intflag;
+
+        /**
+         * \brief Reserved registers (offset 0x1E-0x1F).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x1E_0x1F[ ( 0x1F - 0x1E ) + 1 ];
+
+        /**
+         * \brief PINTSMRY.
+         */
+        PINTSMRY const pintsmry;
+
+        /**
+         * \brief Reserved registers (offset 0x22-0x23).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x22_0x23[ ( 0x23 - 0x22 ) + 1 ];
+
+        /**
+         * \brief Descriptor Address (DESCADD) register.
+         */
+        Register<std::uint32_t> descadd;
+
+        /**
+         * \brief PADCAL.
+         */
+        PADCAL padcal;
+
+        /**
+         * \brief Reserved registers (offset 0x2A-0xFF).
+         */
+        Reserved_Register<std::uint8_t> const reserved_0x2A_0xFF[ ( 0xFF - 0x2A ) + 1 ];
+
+        /**
+         * \brief The pipes.
+         */
+        PIPE pipe[ 8 ];
+
+        HOST() = delete;
+
+        HOST( HOST && ) = delete;
+
+        HOST( HOST const & ) = delete;
+
+        ~HOST() = delete;
+
+        auto operator=( HOST && ) = delete;
+
+        auto operator=( HOST const & ) = delete;
+    };
+
+    union {
+        /**
+         * \brief DEVICE.
+         */
+        DEVICE device;
+
+        /**
+         * \brief HOST.
+         */
+        HOST host;
+    };
+
+    USB() = delete;
+
+    USB( USB && ) = delete;
+
+    USB( USB const & ) = delete;
+
+    ~USB() = delete;
+
+    auto operator=( USB && ) = delete;
+
+    auto operator=( USB const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Peripheral
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_PERIPHERAL_USB_H
@@ -126,6 +126,42 @@ class WDT {
             static constexpr auto WINDOW = mask<std::uint8_t>( Size::WINDOW, Bit::WINDOW ); ///< WINDOW.
         };
 
+        /**
+         * \brief PER.
+         */
+        enum PER : std::uint8_t {
+            PER_8   = 0x0 << Bit::PER, ///< 8 clock cycles.
+            PER_16  = 0x1 << Bit::PER, ///< 16 clock cycles.
+            PER_32  = 0x2 << Bit::PER, ///< 32 clock cycles.
+            PER_64  = 0x3 << Bit::PER, ///< 64 clock cycles.
+            PER_128 = 0x4 << Bit::PER, ///< 128 clock cycles.
+            PER_256 = 0x5 << Bit::PER, ///< 256 clock cycles.
+            PER_512 = 0x6 << Bit::PER, ///< 512 clock cycles.
+            PER_1K  = 0x7 << Bit::PER, ///< 1024 clock cycles.
+            PER_2K  = 0x8 << Bit::PER, ///< 2048 clock cycles.
+            PER_4K  = 0x9 << Bit::PER, ///< 4096 clock cycles.
+            PER_8K  = 0xA << Bit::PER, ///< 8192 clock cycles.
+            PER_16K = 0xB << Bit::PER, ///< 16384 clock cycles.
+        };
+
+        /**
+         * \brief WINDOW.
+         */
+        enum WINDOW : std::uint8_t {
+            WINDOW_8   = 0x0 << Bit::WINDOW, ///< 8 clock cycles.
+            WINDOW_16  = 0x1 << Bit::WINDOW, ///< 16 clock cycles.
+            WINDOW_32  = 0x2 << Bit::WINDOW, ///< 32 clock cycles.
+            WINDOW_64  = 0x3 << Bit::WINDOW, ///< 64 clock cycles.
+            WINDOW_128 = 0x4 << Bit::WINDOW, ///< 128 clock cycles.
+            WINDOW_256 = 0x5 << Bit::WINDOW, ///< 256 clock cycles.
+            WINDOW_512 = 0x6 << Bit::WINDOW, ///< 512 clock cycles.
+            WINDOW_1K  = 0x7 << Bit::WINDOW, ///< 1024 clock cycles.
+            WINDOW_2K  = 0x8 << Bit::WINDOW, ///< 2048 clock cycles.
+            WINDOW_4K  = 0x9 << Bit::WINDOW, ///< 4096 clock cycles.
+            WINDOW_8K  = 0xA << Bit::WINDOW, ///< 8192 clock cycles.
+            WINDOW_16K = 0xB << Bit::WINDOW, ///< 16384 clock cycles.
+        };
+
         CONFIG() = delete;
 
         CONFIG( CONFIG && ) = delete;
@@ -173,6 +209,24 @@ class WDT {
             static constexpr auto RESERVED4 = mask<std::uint8_t>( Size::RESERVED4, Bit::RESERVED4 ); ///< RESERVED4.
         };
 
+        /**
+         * \brief EWOFFSET.
+         */
+        enum EWOFFSET : std::uint8_t {
+            EWOFFSET_8   = 0x0 << Bit::EWOFFSET, ///< 8 clock cycles.
+            EWOFFSET_16  = 0x1 << Bit::EWOFFSET, ///< 16 clock cycles.
+            EWOFFSET_32  = 0x2 << Bit::EWOFFSET, ///< 32 clock cycles.
+            EWOFFSET_64  = 0x3 << Bit::EWOFFSET, ///< 64 clock cycles.
+            EWOFFSET_128 = 0x4 << Bit::EWOFFSET, ///< 128 clock cycles.
+            EWOFFSET_256 = 0x5 << Bit::EWOFFSET, ///< 256 clock cycles.
+            EWOFFSET_512 = 0x6 << Bit::EWOFFSET, ///< 512 clock cycles.
+            EWOFFSET_1K  = 0x7 << Bit::EWOFFSET, ///< 1024 clock cycles.
+            EWOFFSET_2K  = 0x8 << Bit::EWOFFSET, ///< 2048 clock cycles.
+            EWOFFSET_4K  = 0x9 << Bit::EWOFFSET, ///< 4096 clock cycles.
+            EWOFFSET_8K  = 0xA << Bit::EWOFFSET, ///< 8192 clock cycles.
+            EWOFFSET_16K = 0xB << Bit::EWOFFSET, ///< 16384 clock cycles.
+        };
+
         EWCTRL() = delete;
 
         EWCTRL( EWCTRL && ) = delete;
@@ -0,0 +1,192 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::PWM interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_PWM_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_PWM_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/dma.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/dmac.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/tcc.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 PWM facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::PWM {
+
+/**
+ * \brief TCC based PWM engine.
+ *
+ * Period and duty cycle (compare) updates are written to the TCC peripheral's buffer
+ * registers (PERB and CCBx), which are copied to the PER and CCx registers by hardware
+ * at the end of the PWM period, so updates never truncate or extend the PWM period that
+ * is in progress. Updates of multiple channels can be applied in the same PWM period by
+ * locking the buffer register update while they are written.
+ *
+ * If dithering is enabled, period and compare values are expressed in fractions of a
+ * counter tick (1 / 2^dither_bits()): the integer part occupies the upper bits of the
+ * value and the fractional part (the number of PWM periods, out of every 2^dither_bits()
+ * PWM periods, that are one counter tick longer) occupies the lower dither_bits() bits,
+ * which matches the layout of the PER, PERB, CCx, and CCBx registers.
+ *
+ * Compare values can also be fed to a channel by a DMAC channel that is triggered by
+ * the TCC peripheral's overflow (one value per PWM period), so waveforms (e.g. motor
+ * commutation tables) can be generated without CPU involvement.
+ */
+class Engine {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \pre channels > 0
+     * \pre channels <= 4
+     *
+     * \param[in] tcc The TCC peripheral to use.
+     * \param[in] channels The number of compare channels the TCC peripheral has (4 for
+     *            TCC0 and TCC3, 2 for TCC1 and TCC2).
+     */
+    Engine( Peripheral::TCC & tcc, std::uint_fast8_t channels ) noexcept;
+
+    Engine( Engine && ) = delete;
+
+    Engine( Engine const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Engine() noexcept = default;
+
+    auto operator=( Engine && ) = delete;
+
+    auto operator=( Engine const & ) = delete;
+
+    /**
+     * \brief Configure and enable the PWM engine.
+     *
+     * All channels start with a compare value of 0.
+     *
+     * \pre the TCC peripheral's APB clock and GCLK have been enabled
+     *
+     * \param[in] prescaler The counter prescaler.
+     * \param[in] resolution The enhanced resolution (dithering) configuration.
+     * \param[in] wavegen The waveform generation operation (normal PWM or one of the
+     *            dual-slope PWM operations).
+     * \param[in] period The PWM period (in 1 / 2^dither_bits() counter ticks).
+     */
+    void enable(
+        Peripheral::TCC::CTRLA::PRESCALER  prescaler,
+        Peripheral::TCC::CTRLA::RESOLUTION resolution,
+        Peripheral::TCC::WAVE::WAVEGEN     wavegen,
+        std::uint32_t                      period ) noexcept;
+
+    /**
+     * \brief Disable the PWM engine.
+     */
+    void disable() noexcept;
+
+    /**
+     * \brief Get the number of dithering bits.
+     *
+     * \return The number of dithering bits (0 if dithering is disabled).
+     */
+    auto dither_bits() const noexcept -> std::uint_fast8_t
+    {
+        return m_dither_bits;
+    }
+
+    /**
+     * \brief Set the PWM period (takes effect at the end of the PWM period in progress).
+     *
+     * \param[in] period The PWM period (in 1 / 2^dither_bits() counter ticks).
+     */
+    void set_period( std::uint32_t period ) noexcept;
+
+    /**
+     * \brief Set a channel's compare value (takes effect at the end of the PWM period in
+     *        progress).
+     *
+     * \pre channel < the number of compare channels the TCC peripheral has
+     *
+     * \param[in] channel The channel.
+     * \param[in] compare The compare value (in 1 / 2^dither_bits() counter ticks).
+     */
+    void set_compare( std::uint_fast8_t channel, std::uint32_t compare ) noexcept;
+
+    /**
+     * \brief Set the compare values of all channels (take effect together at the end of
+     *        the same PWM period).
+     *
+     * \param[in] compare The compare values (one per compare channel the TCC peripheral
+     *            has, in 1 / 2^dither_bits() counter ticks).
+     */
+    void set_compare( std::uint32_t const * compare ) noexcept;
+
+    /**
+     * \brief Feed a channel's compare values from a waveform table using a DMAC channel
+     *        (one compare value per PWM period).
+     *
+     * The waveform table is repeated until the DMAC channel is aborted.
+     *
+     * \pre channel < the number of compare channels the TCC peripheral has
+     * \pre size > 0
+     * \pre the DMA controller has been enabled
+     *
+     * \param[in] dma The DMA controller to allocate the DMAC channel from.
+     * \param[in] overflow_trigger The TCC peripheral's overflow DMAC trigger source.
+     * \param[in] channel The channel.
+     * \param[in] waveform The waveform table (in 1 / 2^dither_bits() counter ticks).
+     * \param[in] size The number of compare values in the waveform table.
+     *
+     * \return The DMAC channel (which must be aborted and released when the waveform is
+     *         no longer needed).
+     *
+     * \attention The waveform table must remain valid until the DMAC channel is
+     *            aborted.
+     */
+    auto stream(
+        DMA::Controller &                  dma,
+        Peripheral::DMAC::CHCTRLB::TRIGSRC overflow_trigger,
+        std::uint_fast8_t                  channel,
+        std::uint32_t const *              waveform,
+        std::uint16_t                      size ) noexcept -> DMA::Channel;
+
+  private:
+    /**
+     * \brief The TCC peripheral.
+     */
+    Peripheral::TCC * m_tcc;
+
+    /**
+     * \brief The number of compare channels the TCC peripheral has.
+     */
+    std::uint_fast8_t m_channels;
+
+    /**
+     * \brief The number of dithering bits.
+     */
+    std::uint_fast8_t m_dither_bits{};
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::PWM
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_PWM_H
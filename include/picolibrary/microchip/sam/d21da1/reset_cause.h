@@ -0,0 +1,203 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Reset_Cause interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_RESET_CAUSE_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_RESET_CAUSE_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/peripheral/nvmctrl.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 reset cause facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::Reset_Cause {
+
+/**
+ * \brief Reset cause.
+ */
+enum class Cause : std::uint_fast8_t {
+    POR,     ///< Power on reset.
+    BOD12,   ///< Brown out 12 detector reset.
+    BOD33,   ///< Brown out 33 detector reset.
+    EXT,     ///< External reset.
+    WDT,     ///< Watchdog reset.
+    SYST,    ///< System reset request.
+    UNKNOWN, ///< Unknown (no reset cause flag set).
+};
+
+/**
+ * \brief The number of reset causes.
+ */
+constexpr auto CAUSES = std::uint_fast8_t{ 7 };
+
+/**
+ * \brief Decode a PM peripheral RCAUSE register value.
+ *
+ * If multiple reset cause flags are set, the first flag in RCAUSE register bit order is
+ * used.
+ *
+ * \param[in] rcause The PM peripheral RCAUSE register value.
+ *
+ * \return The reset cause.
+ */
+auto decode( std::uint8_t rcause ) noexcept -> Cause;
+
+/**
+ * \brief Persistent reset cause telemetry.
+ *
+ * Per reset cause counters and a short reset cause history are stored in a log
+ * structured region of NVM (e.g. the RWWEE area). Each boot appends a single record to
+ * the log, one record per page, so each row in the region is erased once every 4 boots
+ * times the number of rows in the region. The log is scanned once at boot, after which
+ * the counters and history are available in O(1).
+ *
+ * Boot path cost is bounded by a scan of every page in the region (4 pages per row), one
+ * page write, and one row erase every 4 boots.
+ */
+class Telemetry {
+  public:
+    /**
+     * \brief The number of entries in the reset cause history.
+     */
+    static constexpr auto HISTORY_SIZE = std::uint_fast8_t{ 8 };
+
+    /**
+     * \brief Constructor.
+     *
+     * \pre address is row aligned
+     * \pre rows >= 2
+     *
+     * \param[in] nvmctrl The NVMCTRL peripheral to use to update the log.
+     * \param[in] address The address of the log region.
+     * \param[in] rows The number of rows in the log region.
+     */
+    Telemetry(
+        Peripheral::NVMCTRL & nvmctrl,
+        std::uint32_t         address,
+        std::uint_fast8_t     rows ) noexcept;
+
+    Telemetry( Telemetry && ) = delete;
+
+    Telemetry( Telemetry const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Telemetry() noexcept = default;
+
+    auto operator=( Telemetry && ) = delete;
+
+    auto operator=( Telemetry const & ) = delete;
+
+    /**
+     * \brief Record the cause of the most recent reset.
+     *
+     * \attention This function must be called once per boot.
+     *
+     * \param[in] rcause The PM peripheral RCAUSE register value.
+     *
+     * \return The cause of the most recent reset.
+     */
+    auto record( std::uint8_t rcause ) noexcept -> Cause;
+
+    /**
+     * \brief Get the number of resets that had a particular cause.
+     *
+     * \param[in] cause The reset cause.
+     *
+     * \return The number of resets that had the reset cause.
+     */
+    auto count( Cause cause ) const noexcept -> std::uint32_t
+    {
+        return m_record.count[ static_cast<std::uint_fast8_t>( cause ) ];
+    }
+
+    /**
+     * \brief Get a reset cause history entry.
+     *
+     * \pre n < picolibrary::Microchip::SAM::D21DA1::Reset_Cause::Telemetry::HISTORY_SIZE
+     *
+     * \param[in] n The history entry (0 is the most recent reset).
+     *
+     * \return The cause of the reset.
+     * \return picolibrary::Microchip::SAM::D21DA1::Reset_Cause::Cause::UNKNOWN if fewer
+     *         than n + 1 resets have been recorded.
+     */
+    auto history( std::uint_fast8_t n ) const noexcept -> Cause
+    {
+        auto const cause = ( m_record.history >> ( 4 * n ) ) & 0xF;
+
+        return cause < CAUSES ? static_cast<Cause>( cause ) : Cause::UNKNOWN;
+    }
+
+  private:
+    /**
+     * \brief Log record.
+     */
+    struct Record {
+        /**
+         * \brief The record sequence number (0xFFFFFFFF if the page is erased).
+         */
+        std::uint32_t sequence;
+
+        /**
+         * \brief The per reset cause counters.
+         */
+        std::uint32_t count[ CAUSES ];
+
+        /**
+         * \brief The reset cause history (4 bits per entry, most recent entry in the
+         *        least significant bits).
+         */
+        std::uint32_t history;
+
+        /**
+         * \brief The record check value.
+         */
+        std::uint32_t check;
+    };
+
+    /**
+     * \brief The NVMCTRL peripheral to use to update the log.
+     */
+    Peripheral::NVMCTRL * m_nvmctrl;
+
+    /**
+     * \brief The address of the log region.
+     */
+    std::uint32_t m_address;
+
+    /**
+     * \brief The number of pages in the log region.
+     */
+    std::uint_fast16_t m_pages;
+
+    /**
+     * \brief The most recent record.
+     */
+    Record m_record{};
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Reset_Cause
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_RESET_CAUSE_H
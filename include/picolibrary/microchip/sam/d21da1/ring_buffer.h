@@ -0,0 +1,340 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Ring_Buffer interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_RING_BUFFER_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_RING_BUFFER_H
+
+#include <cstdint>
+
+namespace picolibrary::Microchip::SAM::D21DA1 {
+
+/**
+ * \brief Lock-free single-producer, single-consumer ring buffer.
+ *
+ * The producer (e.g. an interrupt handler) only writes the tail index and the consumer
+ * (e.g. thread mode code) only writes the head index. Both indices are free-running
+ * aligned 32-bit values, so they are read and written atomically by single load and
+ * store instructions, and compiler barriers ensure that element accesses are not
+ * reordered across index updates. Neither side disables interrupts.
+ *
+ * \attention Cortex-M0+ is an in-order single core processor, so compiler barriers are
+ *            sufficient. This ring buffer must not be shared between cores.
+ *
+ * \tparam T The element type.
+ * \tparam CAPACITY The ring buffer capacity (must be a power of two).
+ */
+template<typename T, std::uint32_t CAPACITY>
+class Ring_Buffer {
+  public:
+    static_assert(
+        CAPACITY and not( CAPACITY & ( CAPACITY - 1 ) ),
+        "CAPACITY must be a power of two" );
+
+    /**
+     * \brief Contiguous region of the ring buffer's storage.
+     */
+    struct Span {
+        /**
+         * \brief The first element in the region.
+         */
+        T * data;
+
+        /**
+         * \brief The number of elements in the region.
+         */
+        std::uint32_t size;
+    };
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Ring_Buffer() noexcept = default;
+
+    Ring_Buffer( Ring_Buffer && ) = delete;
+
+    Ring_Buffer( Ring_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Ring_Buffer() noexcept = default;
+
+    auto operator=( Ring_Buffer && ) = delete;
+
+    auto operator=( Ring_Buffer const & ) = delete;
+
+    /**
+     * \brief Get the ring buffer's capacity.
+     *
+     * \return The ring buffer's capacity.
+     */
+    static constexpr auto capacity() noexcept -> std::uint32_t
+    {
+        return CAPACITY;
+    }
+
+    /**
+     * \brief Get the number of elements in the ring buffer.
+     *
+     * \return The number of elements in the ring buffer.
+     */
+    auto size() const noexcept -> std::uint32_t
+    {
+        return m_tail - m_head;
+    }
+
+    /**
+     * \brief Check if the ring buffer is empty.
+     *
+     * \return true if the ring buffer is empty.
+     * \return false if the ring buffer is not empty.
+     */
+    auto empty() const noexcept -> bool
+    {
+        return size() == 0;
+    }
+
+    /**
+     * \brief Check if the ring buffer is full.
+     *
+     * \return true if the ring buffer is full.
+     * \return false if the ring buffer is not full.
+     */
+    auto full() const noexcept -> bool
+    {
+        return size() == CAPACITY;
+    }
+
+    /**
+     * \brief Push an element into the ring buffer (producer only).
+     *
+     * \param[in] value The element to push into the ring buffer.
+     *
+     * \return true if the element was pushed into the ring buffer.
+     * \return false if the ring buffer is full.
+     */
+    auto push( T const & value ) noexcept -> bool
+    {
+        auto const span = write_span();
+
+        if ( not span.size ) {
+            return false;
+        } // if
+
+        *span.data = value;
+
+        commit( 1 );
+
+        return true;
+    }
+
+    /**
+     * \brief Push elements into the ring buffer (producer only).
+     *
+     * \param[in] values The elements to push into the ring buffer.
+     * \param[in] n The number of elements to push into the ring buffer.
+     *
+     * \return The number of elements that were pushed into the ring buffer (less than n
+     *         if the ring buffer became full).
+     */
+    auto push( T const * values, std::uint32_t n ) noexcept -> std::uint32_t
+    {
+        auto pushed = std::uint32_t{};
+
+        // at most two contiguous regions (before and after the wrap)
+        for ( auto region = 0; region < 2 and pushed < n; ++region ) {
+            auto const span  = write_span();
+            auto const count = span.size < n - pushed ? span.size : n - pushed;
+
+            for ( auto i = std::uint32_t{}; i < count; ++i ) {
+                span.data[ i ] = values[ pushed + i ];
+            } // for
+
+            commit( count );
+
+            pushed += count;
+        } // for
+
+        return pushed;
+    }
+
+    /**
+     * \brief Pop an element from the ring buffer (consumer only).
+     *
+     * \param[out] value The element that was popped from the ring buffer.
+     *
+     * \return true if an element was popped from the ring buffer.
+     * \return false if the ring buffer is empty.
+     */
+    auto pop( T & value ) noexcept -> bool
+    {
+        auto const span = read_span();
+
+        if ( not span.size ) {
+            return false;
+        } // if
+
+        value = *span.data;
+
+        consume( 1 );
+
+        return true;
+    }
+
+    /**
+     * \brief Pop elements from the ring buffer (consumer only).
+     *
+     * \param[out] values The elements that were popped from the ring buffer.
+     * \param[in] n The maximum number of elements to pop from the ring buffer.
+     *
+     * \return The number of elements that were popped from the ring buffer (less than n
+     *         if the ring buffer became empty).
+     */
+    auto pop( T * values, std::uint32_t n ) noexcept -> std::uint32_t
+    {
+        auto popped = std::uint32_t{};
+
+        // at most two contiguous regions (before and after the wrap)
+        for ( auto region = 0; region < 2 and popped < n; ++region ) {
+            auto const span  = read_span();
+            auto const count = span.size < n - popped ? span.size : n - popped;
+
+            for ( auto i = std::uint32_t{}; i < count; ++i ) {
+                values[ popped + i ] = span.data[ i ];
+            } // for
+
+            consume( count );
+
+            popped += count;
+        } // for
+
+        return popped;
+    }
+
+    /**
+     * \brief Get the contiguous free region that starts at the tail of the ring buffer
+     *        (producer only).
+     *
+     * The region can be filled directly (e.g. by a DMA transfer) and then published using
+     * picolibrary::Microchip::SAM::D21DA1::Ring_Buffer::commit().
+     *
+     * \return The contiguous free region that starts at the tail of the ring buffer.
+     */
+    auto write_span() noexcept -> Span
+    {
+        std::uint32_t const tail = m_tail;
+        std::uint32_t const head = m_head;
+
+        // the consumer's reads of the free region must complete before it is reused
+        barrier();
+
+        auto const index      = tail & ( CAPACITY - 1 );
+        auto const free       = CAPACITY - ( tail - head );
+        auto const contiguous = CAPACITY - index;
+
+        return { &m_storage[ index ], free < contiguous ? free : contiguous };
+    }
+
+    /**
+     * \brief Publish elements that were written to the region returned by
+     *        picolibrary::Microchip::SAM::D21DA1::Ring_Buffer::write_span() (producer
+     *        only).
+     *
+     * \param[in] n The number of elements to publish.
+     */
+    void commit( std::uint32_t n ) noexcept
+    {
+        // the elements must be written before they are published
+        barrier();
+
+        m_tail = m_tail + n;
+    }
+
+    /**
+     * \brief Get the contiguous filled region that starts at the head of the ring buffer
+     *        (consumer only).
+     *
+     * The region can be read directly (e.g. by a DMA transfer) and then released using
+     * picolibrary::Microchip::SAM::D21DA1::Ring_Buffer::consume().
+     *
+     * \return The contiguous filled region that starts at the head of the ring buffer.
+     */
+    auto read_span() noexcept -> Span
+    {
+        std::uint32_t const head = m_head;
+        std::uint32_t const tail = m_tail;
+
+        // the elements must not be read before they are published
+        barrier();
+
+        auto const index      = head & ( CAPACITY - 1 );
+        auto const filled     = tail - head;
+        auto const contiguous = CAPACITY - index;
+
+        return { &m_storage[ index ], filled < contiguous ? filled : contiguous };
+    }
+
+    /**
+     * \brief Release elements that were read from the region returned by
+     *        picolibrary::Microchip::SAM::D21DA1::Ring_Buffer::read_span() (consumer
+     *        only).
+     *
+     * \param[in] n The number of elements to release.
+     */
+    void consume( std::uint32_t n ) noexcept
+    {
+        // the elements must be read before they are released
+        barrier();
+
+        m_head = m_head + n;
+    }
+
+  private:
+    /**
+     * \brief Compiler barrier.
+     */
+    static void barrier() noexcept
+    {
+        asm volatile( "" : : : "memory" );
+    }
+
+    /**
+     * \brief The free-running index of the next element to pop (written by the consumer
+     *        only).
+     */
+    alignas( 4 ) std::uint32_t volatile m_head{};
+
+    /**
+     * \brief The free-running index of the next element to push (written by the producer
+     *        only).
+     */
+    alignas( 4 ) std::uint32_t volatile m_tail{};
+
+    /**
+     * \brief The ring buffer's storage.
+     */
+    T m_storage[ CAPACITY ]{};
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_RING_BUFFER_H
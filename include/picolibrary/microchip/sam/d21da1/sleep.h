@@ -0,0 +1,200 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Sleep interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_SLEEP_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_SLEEP_H
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/pm.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 sleep facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::Sleep {
+
+/**
+ * \brief Sleep level (ordered from shallowest to deepest).
+ */
+enum class Level : std::uint_fast8_t {
+    IDLE0,   ///< Idle (CPU clock domain stopped).
+    IDLE1,   ///< Idle (CPU and AHB clock domains stopped).
+    IDLE2,   ///< Idle (CPU, AHB, and APB clock domains stopped).
+    STANDBY, ///< Standby (all clock domains stopped unless requested).
+};
+
+/**
+ * \brief The number of sleep levels.
+ */
+constexpr auto LEVELS = std::uint_fast8_t{ 4 };
+
+/**
+ * \brief Vote based sleep controller.
+ *
+ * Each subsystem votes for the deepest sleep level it can tolerate. When idle, the
+ * controller enters the deepest sleep level that is tolerated by every subsystem that
+ * has an active vote (standby if there are no active votes). Voting is O(1), and votes
+ * may be cast and withdrawn from interrupt handlers.
+ *
+ * The controller records the number of times each sleep level has been entered (each
+ * entry ends with a wake-up), and if a clock is provided, the time spent in each sleep
+ * level.
+ */
+class Controller {
+  public:
+    /**
+     * \brief Clock (returns the current time, with wraparound).
+     */
+    using Clock = std::uint32_t ( * )();
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] pm The PM peripheral.
+     * \param[in] scb The SCB peripheral.
+     * \param[in] clock The clock to use to measure the time spent in each sleep level
+     *            (nullptr if time spent in each sleep level should not be measured). The
+     *            clock must keep running in the deepest sleep level that is entered.
+     */
+    Controller(
+        Peripheral::PM &                                      pm,
+        ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB & scb,
+        Clock                                                 clock ) noexcept :
+        m_pm{ &pm },
+        m_scb{ &scb },
+        m_clock{ clock }
+    {
+    }
+
+    Controller( Controller && ) = delete;
+
+    Controller( Controller const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Controller() noexcept = default;
+
+    auto operator=( Controller && ) = delete;
+
+    auto operator=( Controller const & ) = delete;
+
+    /**
+     * \brief Cast a vote.
+     *
+     * \param[in] level The deepest sleep level that the voter can tolerate.
+     */
+    void vote( Level level ) noexcept;
+
+    /**
+     * \brief Withdraw a vote.
+     *
+     * \pre a vote for level has been cast and not withdrawn
+     *
+     * \param[in] level The sleep level of the vote to withdraw.
+     */
+    void withdraw( Level level ) noexcept;
+
+    /**
+     * \brief Get the deepest sleep level that is tolerated by every voter.
+     *
+     * \return The deepest sleep level that is tolerated by every voter.
+     */
+    auto allowed_level() const noexcept -> Level;
+
+    /**
+     * \brief Enter the deepest sleep level that is tolerated by every voter, and return
+     *        once woken up.
+     *
+     * Interrupts are disabled while the sleep level is selected and entered, so a vote
+     * that is cast by an interrupt handler cannot be missed. Any pending interrupt is
+     * handled before this function returns.
+     *
+     * \return The sleep level that was entered.
+     */
+    auto idle() noexcept -> Level;
+
+    /**
+     * \brief Get the number of times a sleep level has been entered (and woken up from).
+     *
+     * \param[in] level The sleep level.
+     *
+     * \return The number of times the sleep level has been entered.
+     */
+    auto wakes( Level level ) const noexcept -> std::uint32_t
+    {
+        return m_wakes[ static_cast<std::uint_fast8_t>( level ) ];
+    }
+
+    /**
+     * \brief Get the total time spent in a sleep level.
+     *
+     * \param[in] level The sleep level.
+     *
+     * \return The total time spent in the sleep level, in clock units.
+     */
+    auto time( Level level ) const noexcept -> std::uint32_t
+    {
+        return m_time[ static_cast<std::uint_fast8_t>( level ) ];
+    }
+
+    /**
+     * \brief Reset the sleep level statistics.
+     */
+    void reset_statistics() noexcept;
+
+  private:
+    /**
+     * \brief The PM peripheral.
+     */
+    Peripheral::PM * m_pm;
+
+    /**
+     * \brief The SCB peripheral.
+     */
+    ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB * m_scb;
+
+    /**
+     * \brief The clock.
+     */
+    Clock m_clock;
+
+    /**
+     * \brief The number of active votes for each sleep level.
+     */
+    std::uint8_t volatile m_votes[ LEVELS ]{};
+
+    /**
+     * \brief The number of times each sleep level has been entered.
+     */
+    std::uint32_t m_wakes[ LEVELS ]{};
+
+    /**
+     * \brief The total time spent in each sleep level.
+     */
+    std::uint32_t m_time[ LEVELS ]{};
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Sleep
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_SLEEP_H
@@ -0,0 +1,504 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::SPI interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_SPI_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_SPI_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/dma.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/dmac.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/sercom.h"
+#include "picolibrary/precondition.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 SPI facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::SPI {
+
+/**
+ * \brief Compute the BAUD register value for an SPI bit rate.
+ *
+ * The resulting bit rate is the highest bit rate that does not exceed the desired bit
+ * rate (or the lowest supported bit rate if the desired bit rate is too low).
+ *
+ * \pre bit_rate > 0
+ * \pre bit_rate * 2 <= gclk_frequency
+ *
+ * \param[in] gclk_frequency The frequency of the SERCOM peripheral's core GCLK, in Hz.
+ * \param[in] bit_rate The desired bit rate.
+ *
+ * \return The BAUD register value.
+ */
+auto baud( std::uint32_t gclk_frequency, std::uint32_t bit_rate ) noexcept
+    -> std::uint8_t;
+
+/**
+ * \brief Transaction segment (e.g. command, address, or payload).
+ */
+struct Segment {
+    /**
+     * \brief The data to transmit (nullptr to transmit 0xFF).
+     */
+    std::uint8_t const * tx;
+
+    /**
+     * \brief The location to write received data to (nullptr to discard received
+     *        data).
+     */
+    std::uint8_t * rx;
+
+    /**
+     * \brief The number of bytes to exchange.
+     */
+    std::uint16_t size;
+};
+
+/**
+ * \brief Chip select function.
+ */
+using Chip_Select = void ( * )( bool selected );
+
+/**
+ * \brief Transaction completion callback.
+ */
+using Callback = void ( * )( void * context, DMA::Completion completion );
+
+/**
+ * \brief Transaction.
+ */
+struct Transaction {
+    /**
+     * \brief The transaction's segments.
+     */
+    Segment const * segments;
+
+    /**
+     * \brief The number of segments in the transaction.
+     */
+    std::uint_fast8_t segment_count;
+
+    /**
+     * \brief The chip select function for the transaction's device (nullptr if chip
+     *        select is managed elsewhere).
+     */
+    Chip_Select chip_select;
+
+    /**
+     * \brief The transaction completion callback (nullptr if the transaction does not
+     *        have a completion callback).
+     */
+    Callback callback;
+
+    /**
+     * \brief The transaction completion callback context.
+     */
+    void * context;
+};
+
+/**
+ * \brief Zero-copy DMA scatter/gather SPI master.
+ *
+ * Each transaction segment references caller-owned buffers, which are chained together
+ * using linked DMAC descriptors (one transmit descriptor and one receive descriptor per
+ * segment), so segments are exchanged back-to-back without intermediate copies.
+ *
+ * Transactions are queued. The descriptor chains of a transaction are built when it is
+ * submitted, so when a transaction completes, the DMAC interrupt handler only has to
+ * deselect the completed transaction's device, call its completion callback, select the
+ * next transaction's device, and enable the DMAC channels.
+ *
+ * The SPI is configured for 8-bit characters (the SAM D21/DA1 SERCOM DATA register does
+ * not support 32-bit data transfers), MSB first.
+ *
+ * \tparam SEGMENTS_MAX The maximum number of segments in a transaction.
+ * \tparam QUEUE_CAPACITY The transaction queue capacity (must be a power of two no
+ *         greater than 128, so that the free-running 8-bit queue indices wrap cleanly).
+ *
+ * \attention The driver, transaction segments, and segment buffers must remain valid
+ *            until a transaction completes.
+ * \attention Transactions must be submitted from a single execution context.
+ */
+template<std::uint_fast8_t SEGMENTS_MAX, std::uint_fast8_t QUEUE_CAPACITY>
+class DMA_Master {
+  public:
+    static_assert( SEGMENTS_MAX > 0 );
+    static_assert(
+        QUEUE_CAPACITY and not( QUEUE_CAPACITY & ( QUEUE_CAPACITY - 1 ) )
+        and QUEUE_CAPACITY <= 128 );
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] sercom The SERCOM peripheral to use.
+     * \param[in] dma The DMA controller to allocate the transmit and receive channels
+     *            from.
+     * \param[in] rx_trigger The SERCOM peripheral's RX DMAC trigger source.
+     * \param[in] tx_trigger The SERCOM peripheral's TX DMAC trigger source.
+     */
+    constexpr DMA_Master(
+        Peripheral::SERCOM &               sercom,
+        DMA::Controller &                  dma,
+        Peripheral::DMAC::CHCTRLB::TRIGSRC rx_trigger,
+        Peripheral::DMAC::CHCTRLB::TRIGSRC tx_trigger ) noexcept :
+        m_sercom{ &sercom },
+        m_dma{ &dma },
+        m_rx_trigger{ rx_trigger },
+        m_tx_trigger{ tx_trigger }
+    {
+    }
+
+    DMA_Master( DMA_Master && ) = delete;
+
+    DMA_Master( DMA_Master const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~DMA_Master() noexcept = default;
+
+    auto operator=( DMA_Master && ) = delete;
+
+    auto operator=( DMA_Master const & ) = delete;
+
+    /**
+     * \brief Configure and enable the SPI master.
+     *
+     * \pre the SERCOM peripheral's APB clock and core GCLK have been enabled
+     * \pre the DMA controller has been enabled
+     *
+     * \param[in] dopo The data out pinout.
+     * \param[in] dipo The data in pinout.
+     * \param[in] cpol The clock polarity.
+     * \param[in] cpha The clock phase.
+     * \param[in] gclk_frequency The frequency of the SERCOM peripheral's core GCLK, in
+     *            Hz.
+     * \param[in] bit_rate The desired bit rate.
+     */
+    void enable(
+        Peripheral::SERCOM::SPI::CTRLA::DOPO dopo,
+        Peripheral::SERCOM::SPI::CTRLA::DIPO dipo,
+        Peripheral::SERCOM::SPI::CTRLA::CPOL cpol,
+        Peripheral::SERCOM::SPI::CTRLA::CPHA cpha,
+        std::uint32_t                        gclk_frequency,
+        std::uint32_t                        bit_rate ) noexcept
+    {
+        using DMAC = Peripheral::DMAC;
+        using SPI  = Peripheral::SERCOM::SPI;
+
+        auto & spi = m_sercom->spi;
+
+        spi.ctrla = SPI::CTRLA::Mask::SWRST;
+
+        while ( spi.syncbusy & SPI::SYNCBUSY::Mask::SWRST ) {} // while
+
+        spi.ctrla = SPI::CTRLA::MODE_SPI_MASTER | dopo | dipo | cpol | cpha
+                    | SPI::CTRLA::DORD_MSB;
+        spi.baud  = baud( gclk_frequency, bit_rate );
+        spi.ctrlb = SPI::CTRLB::Mask::RXEN;
+
+        while ( spi.syncbusy & SPI::SYNCBUSY::Mask::CTRLB ) {} // while
+
+        m_rx_channel = m_dma->allocate_channel();
+        m_tx_channel = m_dma->allocate_channel();
+
+        // the receive channel has the higher priority level so that received data is
+        // read before it can be overwritten
+        m_dma->configure_channel(
+            m_rx_channel,
+            m_rx_trigger | DMAC::CHCTRLB::LVL_LVL1 | DMAC::CHCTRLB::TRIGACT_BEAT,
+            handle_transaction_complete,
+            this );
+        m_dma->configure_channel(
+            m_tx_channel,
+            m_tx_trigger | DMAC::CHCTRLB::LVL_LVL0 | DMAC::CHCTRLB::TRIGACT_BEAT,
+            nullptr,
+            nullptr );
+
+        spi.ctrla |= SPI::CTRLA::Mask::ENABLE;
+
+        while ( spi.syncbusy & SPI::SYNCBUSY::Mask::ENABLE ) {} // while
+    }
+
+    /**
+     * \brief Submit a transaction.
+     *
+     * \pre transaction.segment_count > 0
+     * \pre transaction.segment_count <= SEGMENTS_MAX
+     *
+     * \param[in] transaction The transaction to submit.
+     *
+     * \return true if the transaction was queued.
+     * \return false if the transaction queue is full.
+     */
+    auto submit( Transaction const & transaction ) noexcept -> bool
+    {
+        PICOLIBRARY_EXPECT(
+            transaction.segment_count > 0 and transaction.segment_count <= SEGMENTS_MAX,
+            Generic_Error::INVALID_ARGUMENT );
+
+        std::uint8_t const tail = m_tail;
+
+        if ( static_cast<std::uint8_t>( tail - m_head ) >= QUEUE_CAPACITY ) {
+            return false;
+        } // if
+
+        build( m_queue[ tail & ( QUEUE_CAPACITY - 1 ) ], transaction );
+
+        Interrupt::Critical_Section const critical_section;
+
+        m_tail = tail + 1;
+
+        if ( not m_busy ) {
+            start();
+        } // if
+
+        return true;
+    }
+
+    /**
+     * \brief Check if a transaction is in progress.
+     *
+     * \return true if a transaction is in progress.
+     * \return false if a transaction is not in progress.
+     */
+    auto busy() const noexcept -> bool
+    {
+        return m_busy;
+    }
+
+  private:
+    /**
+     * \brief Queued transaction.
+     */
+    struct Queued_Transaction {
+        /**
+         * \brief The transmit descriptor chain.
+         */
+        alignas( 16 ) DMA::Descriptor tx[ SEGMENTS_MAX ];
+
+        /**
+         * \brief The receive descriptor chain.
+         */
+        alignas( 16 ) DMA::Descriptor rx[ SEGMENTS_MAX ];
+
+        /**
+         * \brief The chip select function.
+         */
+        Chip_Select chip_select;
+
+        /**
+         * \brief The transaction completion callback.
+         */
+        Callback callback;
+
+        /**
+         * \brief The transaction completion callback context.
+         */
+        void * context;
+    };
+
+    /**
+     * \brief The byte transmitted by segments that do not have transmit data.
+     */
+    static constexpr std::uint8_t FILL = 0xFF;
+
+    /**
+     * \brief The SERCOM peripheral.
+     */
+    Peripheral::SERCOM * m_sercom;
+
+    /**
+     * \brief The DMA controller.
+     */
+    DMA::Controller * m_dma;
+
+    /**
+     * \brief The SERCOM peripheral's RX DMAC trigger source.
+     */
+    Peripheral::DMAC::CHCTRLB::TRIGSRC m_rx_trigger;
+
+    /**
+     * \brief The SERCOM peripheral's TX DMAC trigger source.
+     */
+    Peripheral::DMAC::CHCTRLB::TRIGSRC m_tx_trigger;
+
+    /**
+     * \brief The receive DMAC channel.
+     */
+    DMA::Channel m_rx_channel{};
+
+    /**
+     * \brief The transmit DMAC channel.
+     */
+    DMA::Channel m_tx_channel{};
+
+    /**
+     * \brief The transaction queue.
+     */
+    Queued_Transaction m_queue[ QUEUE_CAPACITY ]{};
+
+    /**
+     * \brief The free-running index of the in progress (or next) transaction (written by
+     *        the DMAC interrupt handler only).
+     */
+    std::uint8_t volatile m_head{};
+
+    /**
+     * \brief The free-running index of the next transaction to queue (written by the
+     *        submitter only).
+     */
+    std::uint8_t volatile m_tail{};
+
+    /**
+     * \brief A transaction is in progress.
+     */
+    bool volatile m_busy{};
+
+    /**
+     * \brief The location received data that is discarded is written to.
+     */
+    std::uint8_t m_sink{};
+
+    /**
+     * \brief Build a queued transaction's descriptor chains.
+     *
+     * \param[out] queued_transaction The queued transaction.
+     * \param[in] transaction The transaction.
+     */
+    void build(
+        Queued_Transaction & queued_transaction,
+        Transaction const &  transaction ) noexcept
+    {
+        using BTCTRL = DMA::Descriptor::BTCTRL;
+
+        auto const data = DMA::address( &m_sercom->spi.data );
+
+        for ( auto i = std::uint_fast8_t{}; i < transaction.segment_count; ++i ) {
+            auto const & segment = transaction.segments[ i ];
+            auto const   last    = i + 1 == transaction.segment_count;
+
+            auto & tx = queued_transaction.tx[ i ];
+            auto & rx = queued_transaction.rx[ i ];
+
+            tx.btctrl = BTCTRL::Mask::VALID | BTCTRL::BEATSIZE_BYTE
+                        | ( segment.tx ? BTCTRL::Mask::SRCINC : 0 );
+            tx.btcnt   = segment.size;
+            tx.srcaddr = segment.tx ? DMA::address( segment.tx + segment.size )
+                                    : DMA::address( &FILL );
+            tx.dstaddr = data;
+
+            rx.btctrl = BTCTRL::Mask::VALID | BTCTRL::BEATSIZE_BYTE
+                        | ( last ? BTCTRL::BLOCKACT_INT : BTCTRL::BLOCKACT_NOACT )
+                        | ( segment.rx ? BTCTRL::Mask::DSTINC : 0 );
+            rx.btcnt   = segment.size;
+            rx.srcaddr = data;
+            rx.dstaddr = segment.rx ? DMA::address( segment.rx + segment.size )
+                                    : DMA::address( &m_sink );
+
+            if ( last ) {
+                tx.descaddr = 0;
+                rx.descaddr = 0;
+            } else {
+                DMA::link( tx, queued_transaction.tx[ i + 1 ] );
+                DMA::link( rx, queued_transaction.rx[ i + 1 ] );
+            } // else
+        }     // for
+
+        queued_transaction.chip_select = transaction.chip_select;
+        queued_transaction.callback    = transaction.callback;
+        queued_transaction.context     = transaction.context;
+    }
+
+    /**
+     * \brief Start the transaction at the head of the transaction queue.
+     *
+     * \attention This function must be called with interrupts disabled or by the DMAC
+     *            interrupt handler.
+     */
+    void start() noexcept
+    {
+        std::uint8_t const head = m_head;
+
+        if ( head == m_tail ) {
+            m_busy = false;
+
+            return;
+        } // if
+
+        m_busy = true;
+
+        auto const & queued_transaction = m_queue[ head & ( QUEUE_CAPACITY - 1 ) ];
+
+        if ( queued_transaction.chip_select ) {
+            queued_transaction.chip_select( true );
+        } // if
+
+        m_dma->descriptor( m_rx_channel ) = queued_transaction.rx[ 0 ];
+        m_dma->descriptor( m_tx_channel ) = queued_transaction.tx[ 0 ];
+
+        m_dma->start( m_rx_channel );
+        m_dma->start( m_tx_channel );
+    }
+
+    /**
+     * \brief Handle a transaction's completion.
+     *
+     * \param[in] context The driver.
+     * \param[in] completion The completion status.
+     */
+    static void handle_transaction_complete(
+        void *          context,
+        DMA::Completion completion ) noexcept
+    {
+        auto & driver = *static_cast<DMA_Master *>( context );
+
+        if ( completion == DMA::Completion::TRANSFER_ERROR ) {
+            driver.m_dma->abort( driver.m_tx_channel );
+        } // if
+
+        std::uint8_t const head = driver.m_head;
+
+        auto const & queued_transaction = driver.m_queue[ head & ( QUEUE_CAPACITY - 1 ) ];
+
+        if ( queued_transaction.chip_select ) {
+            queued_transaction.chip_select( false );
+        } // if
+
+        auto const callback         = queued_transaction.callback;
+        auto const callback_context = queued_transaction.context;
+
+        driver.m_head = head + 1;
+
+        driver.start();
+
+        if ( callback ) {
+            callback( callback_context, completion );
+        } // if
+    }
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::SPI
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_SPI_H
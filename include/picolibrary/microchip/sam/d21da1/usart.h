@@ -0,0 +1,532 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::USART interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_USART_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_USART_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/dma.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/dmac.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/sercom.h"
+#include "picolibrary/microchip/sam/d21da1/ring_buffer.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 USART facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::USART {
+
+/**
+ * \brief Baud rate configuration.
+ */
+struct Baud_Configuration {
+    /**
+     * \brief The CTRLA register SAMPR field value.
+     */
+    Peripheral::SERCOM::USART::CTRLA::SAMPR sampr;
+
+    /**
+     * \brief The BAUD register value.
+     */
+    std::uint16_t baud;
+};
+
+/**
+ * \brief Compute the arithmetic baud rate configuration for a baud rate.
+ *
+ * The highest over-sampling rate (16x, 8x, or 3x) that the GCLK frequency supports is
+ * used.
+ *
+ * \pre baud_rate > 0
+ * \pre baud_rate * 3 <= gclk_frequency
+ *
+ * \param[in] gclk_frequency The frequency of the SERCOM peripheral's core GCLK, in Hz.
+ * \param[in] baud_rate The desired baud rate.
+ *
+ * \return The baud rate configuration.
+ */
+auto baud_configuration( std::uint32_t gclk_frequency, std::uint32_t baud_rate ) noexcept
+    -> Baud_Configuration;
+
+/**
+ * \brief DMA backed USART driver.
+ *
+ * Transmitted data is queued in a ring buffer that is drained by a DMAC channel (one
+ * block transfer per contiguous region of queued data). Received data is written by a
+ * second DMAC channel into a circular receive buffer (a descriptor that is linked to
+ * itself), so receiving never requires the CPU. Data that has been written to the
+ * receive buffer can be read at any time, even if the current block transfer has not
+ * completed.
+ *
+ * Idle line detection is performed by periodically calling
+ * picolibrary::Microchip::SAM::D21DA1::USART::DMA_Driver::poll(). If data has been
+ * received since the previous poll but not since the poll before that, the idle callback
+ * is called, allowing the application to flush partially filled receive buffer regions
+ * without waiting for the receive buffer to fill. The poll period is the idle timeout.
+ *
+ * The USART is configured for 8 data bits, no parity, 1 stop bit, LSB first.
+ *
+ * \tparam TX_CAPACITY The transmit buffer capacity (must be a power of two).
+ * \tparam RX_CAPACITY The receive buffer capacity (must be a power of two, and no more
+ *         than 32768).
+ *
+ * \attention The driver must be located in SRAM.
+ * \attention picolibrary::Microchip::SAM::D21DA1::USART::DMA_Driver::read() and
+ *            picolibrary::Microchip::SAM::D21DA1::USART::DMA_Driver::poll() must not be
+ *            called from an interrupt handler whose priority is higher than the DMAC
+ *            interrupt's priority.
+ */
+template<std::uint32_t TX_CAPACITY, std::uint32_t RX_CAPACITY>
+class DMA_Driver {
+  public:
+    static_assert(
+        RX_CAPACITY and not( RX_CAPACITY & ( RX_CAPACITY - 1 ) ) and RX_CAPACITY <= 32768,
+        "RX_CAPACITY must be a power of two no larger than 32768" );
+
+    /**
+     * \brief Idle callback.
+     */
+    using Idle_Callback = void ( * )( void * context );
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] sercom The SERCOM peripheral to use.
+     * \param[in] dma The DMA controller to allocate the transmit and receive channels
+     *            from.
+     * \param[in] rx_trigger The SERCOM peripheral's RX DMAC trigger source.
+     * \param[in] tx_trigger The SERCOM peripheral's TX DMAC trigger source.
+     * \param[in] idle_callback The idle callback (nullptr if idle line detection is not
+     *            used).
+     * \param[in] context The idle callback context.
+     */
+    constexpr DMA_Driver(
+        Peripheral::SERCOM &               sercom,
+        DMA::Controller &                  dma,
+        Peripheral::DMAC::CHCTRLB::TRIGSRC rx_trigger,
+        Peripheral::DMAC::CHCTRLB::TRIGSRC tx_trigger,
+        Idle_Callback                      idle_callback,
+        void *                             context ) noexcept :
+        m_sercom{ &sercom },
+        m_dma{ &dma },
+        m_rx_trigger{ rx_trigger },
+        m_tx_trigger{ tx_trigger },
+        m_idle_callback{ idle_callback },
+        m_context{ context }
+    {
+    }
+
+    DMA_Driver( DMA_Driver && ) = delete;
+
+    DMA_Driver( DMA_Driver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~DMA_Driver() noexcept = default;
+
+    auto operator=( DMA_Driver && ) = delete;
+
+    auto operator=( DMA_Driver const & ) = delete;
+
+    /**
+     * \brief Configure and enable the USART, and start receiving.
+     *
+     * \pre the SERCOM peripheral's APB clock and core GCLK have been enabled
+     * \pre the DMA controller has been enabled
+     *
+     * \param[in] txpo The transmit data pinout.
+     * \param[in] rxpo The receive data pinout.
+     * \param[in] gclk_frequency The frequency of the SERCOM peripheral's core GCLK, in
+     *            Hz.
+     * \param[in] baud_rate The desired baud rate.
+     */
+    void enable(
+        Peripheral::SERCOM::USART::CTRLA::TXPO txpo,
+        Peripheral::SERCOM::USART::CTRLA::RXPO rxpo,
+        std::uint32_t                          gclk_frequency,
+        std::uint32_t                          baud_rate ) noexcept
+    {
+        using DMAC       = Peripheral::DMAC;
+        using USART      = Peripheral::SERCOM::USART;
+        using Descriptor = DMA::Descriptor;
+
+        auto & usart = m_sercom->usart;
+
+        usart.ctrla = USART::CTRLA::Mask::SWRST;
+
+        while ( usart.syncbusy & USART::SYNCBUSY::Mask::SWRST ) {} // while
+
+        auto const configuration = baud_configuration( gclk_frequency, baud_rate );
+
+        usart.ctrla = USART::CTRLA::MODE_USART_INT_CLK | configuration.sampr | txpo | rxpo
+                      | USART::CTRLA::DORD_LSB;
+        usart.baud  = configuration.baud;
+        usart.ctrlb = USART::CTRLB::Mask::TXEN | USART::CTRLB::Mask::RXEN;
+
+        while ( usart.syncbusy & USART::SYNCBUSY::Mask::CTRLB ) {} // while
+
+        m_rx_channel = m_dma->allocate_channel();
+        m_tx_channel = m_dma->allocate_channel();
+
+        auto & rx = m_dma->descriptor( m_rx_channel );
+
+        rx.btctrl  = Descriptor::BTCTRL::Mask::VALID | Descriptor::BTCTRL::BLOCKACT_INT
+                    | Descriptor::BTCTRL::BEATSIZE_BYTE
+                    | Descriptor::BTCTRL::Mask::DSTINC;
+        rx.btcnt   = RX_CAPACITY;
+        rx.srcaddr = DMA::address( &usart.data );
+        rx.dstaddr = DMA::address( m_rx_buffer + RX_CAPACITY );
+        DMA::link( rx, rx );
+
+        m_dma->configure_channel(
+            m_rx_channel,
+            m_rx_trigger | DMAC::CHCTRLB::LVL_LVL1 | DMAC::CHCTRLB::TRIGACT_BEAT,
+            handle_rx_block_complete,
+            this );
+        m_dma->configure_channel(
+            m_tx_channel,
+            m_tx_trigger | DMAC::CHCTRLB::LVL_LVL0 | DMAC::CHCTRLB::TRIGACT_BEAT,
+            handle_tx_complete,
+            this );
+
+        m_dma->start( m_rx_channel );
+
+        usart.ctrla |= USART::CTRLA::Mask::ENABLE;
+
+        while ( usart.syncbusy & USART::SYNCBUSY::Mask::ENABLE ) {} // while
+    }
+
+    /**
+     * \brief Queue data for transmission.
+     *
+     * \param[in] data The data to transmit.
+     * \param[in] n The number of bytes to transmit.
+     *
+     * \return The number of bytes that were queued (less than n if the transmit buffer
+     *         is full).
+     */
+    auto write( std::uint8_t const * data, std::uint32_t n ) noexcept -> std::uint32_t
+    {
+        auto const queued = m_tx.push( data, n );
+
+        Interrupt::Critical_Section const critical_section;
+
+        if ( not m_tx_in_flight ) {
+            transmit();
+        } // if
+
+        return queued;
+    }
+
+    /**
+     * \brief Check if data is being transmitted.
+     *
+     * \return true if data is being transmitted.
+     * \return false if data is not being transmitted.
+     */
+    auto transmitting() const noexcept -> bool
+    {
+        return m_tx_in_flight;
+    }
+
+    /**
+     * \brief Get the number of received bytes that have not been read.
+     *
+     * \return The number of received bytes that have not been read (greater than
+     *         RX_CAPACITY if received data has been overwritten).
+     */
+    auto available() const noexcept -> std::uint32_t
+    {
+        return received() - m_rx_read;
+    }
+
+    /**
+     * \brief Read received data.
+     *
+     * If received data has been overwritten before it was read, the receive buffer's
+     * contents are discarded and the overrun count is incremented.
+     *
+     * \param[out] data The location to write the received data to.
+     * \param[in] n The maximum number of bytes to read.
+     *
+     * \return The number of bytes that were read.
+     */
+    auto read( std::uint8_t * data, std::uint32_t n ) noexcept -> std::uint32_t
+    {
+        auto const total = received();
+
+        if ( total - m_rx_read > RX_CAPACITY ) {
+            ++m_rx_overruns;
+            m_rx_read = total;
+
+            return 0;
+        } // if
+
+        auto const available = total - m_rx_read;
+        auto const count     = n < available ? n : available;
+
+        for ( auto i = std::uint32_t{}; i < count; ++i ) {
+            data[ i ] = m_rx_buffer[ ( m_rx_read + i ) & ( RX_CAPACITY - 1 ) ];
+        } // for
+
+        m_rx_read += count;
+
+        return count;
+    }
+
+    /**
+     * \brief Get the number of receive buffer overruns.
+     *
+     * \return The number of receive buffer overruns.
+     */
+    auto overruns() const noexcept -> std::uint32_t
+    {
+        return m_rx_overruns;
+    }
+
+    /**
+     * \brief Perform idle line detection.
+     *
+     * \attention This function must be called periodically, with a period equal to the
+     *            idle timeout.
+     */
+    void poll() noexcept
+    {
+        auto const total = received();
+
+        if ( total != m_polled ) {
+            m_polled       = total;
+            m_idle_pending = true;
+
+            return;
+        } // if
+
+        if ( m_idle_pending ) {
+            m_idle_pending = false;
+
+            if ( m_idle_callback ) {
+                m_idle_callback( m_context );
+            } // if
+        }     // if
+    }
+
+    /**
+     * \brief Get and clear the USART's error flags.
+     *
+     * \return The STATUS register value (parity error, frame error, and buffer overflow
+     *         flags).
+     */
+    auto clear_errors() noexcept -> std::uint16_t
+    {
+        using USART = Peripheral::SERCOM::USART;
+
+        std::uint16_t const status = m_sercom->usart.status
+                                     & ( USART::STATUS::Mask::PERR
+                                         | USART::STATUS::Mask::FERR
+                                         | USART::STATUS::Mask::BUFOVF );
+
+        m_sercom->usart.status = status;
+
+        return status;
+    }
+
+  private:
+    /**
+     * \brief The SERCOM peripheral.
+     */
+    Peripheral::SERCOM * m_sercom;
+
+    /**
+     * \brief The DMA controller.
+     */
+    DMA::Controller * m_dma;
+
+    /**
+     * \brief The SERCOM peripheral's RX DMAC trigger source.
+     */
+    Peripheral::DMAC::CHCTRLB::TRIGSRC m_rx_trigger;
+
+    /**
+     * \brief The SERCOM peripheral's TX DMAC trigger source.
+     */
+    Peripheral::DMAC::CHCTRLB::TRIGSRC m_tx_trigger;
+
+    /**
+     * \brief The idle callback.
+     */
+    Idle_Callback m_idle_callback;
+
+    /**
+     * \brief The idle callback context.
+     */
+    void * m_context;
+
+    /**
+     * \brief The receive DMAC channel.
+     */
+    DMA::Channel m_rx_channel{};
+
+    /**
+     * \brief The transmit DMAC channel.
+     */
+    DMA::Channel m_tx_channel{};
+
+    /**
+     * \brief The transmit buffer.
+     */
+    Ring_Buffer<std::uint8_t, TX_CAPACITY> m_tx{};
+
+    /**
+     * \brief The number of bytes in the in flight transmit block transfer (0 if no
+     *        transmit block transfer is in flight).
+     */
+    std::uint32_t volatile m_tx_in_flight{};
+
+    /**
+     * \brief The receive buffer.
+     */
+    std::uint8_t m_rx_buffer[ RX_CAPACITY ]{};
+
+    /**
+     * \brief The number of completed receive block transfers.
+     */
+    std::uint32_t volatile m_rx_laps{};
+
+    /**
+     * \brief The free-running number of bytes that have been read.
+     */
+    std::uint32_t m_rx_read{};
+
+    /**
+     * \brief The number of receive buffer overruns.
+     */
+    std::uint32_t m_rx_overruns{};
+
+    /**
+     * \brief The free-running number of bytes that had been received at the previous
+     *        poll.
+     */
+    std::uint32_t m_polled{};
+
+    /**
+     * \brief Data has been received since the poll before the previous poll.
+     */
+    bool m_idle_pending{};
+
+    /**
+     * \brief Get the free-running number of bytes that have been received.
+     *
+     * \return The free-running number of bytes that have been received.
+     */
+    auto received() const noexcept -> std::uint32_t
+    {
+        Interrupt::Critical_Section const critical_section;
+
+        for ( ;; ) {
+            // a completed receive block transfer whose interrupt has not been handled has
+            // already been reloaded, and must be counted here
+            auto const lapped    = m_dma->transfer_complete_pending( m_rx_channel );
+            auto const remaining = m_dma->remaining( m_rx_channel );
+
+            if ( m_dma->transfer_complete_pending( m_rx_channel ) == lapped ) {
+                return ( m_rx_laps + lapped ) * RX_CAPACITY + ( RX_CAPACITY - remaining );
+            } // if
+        }     // for
+    }
+
+    /**
+     * \brief Start a transmit block transfer for the next contiguous region of queued
+     *        data.
+     *
+     * \attention This function must be called with interrupts disabled or by the DMAC
+     *            interrupt handler.
+     */
+    void transmit() noexcept
+    {
+        using Descriptor = DMA::Descriptor;
+
+        auto const span = m_tx.read_span();
+
+        if ( not span.size ) {
+            m_tx_in_flight = 0;
+
+            return;
+        } // if
+
+        auto const count = span.size < 0xFFFF ? span.size : std::uint32_t{ 0xFFFF };
+
+        auto & tx = m_dma->descriptor( m_tx_channel );
+
+        tx.btctrl   = Descriptor::BTCTRL::Mask::VALID | Descriptor::BTCTRL::BLOCKACT_INT
+                    | Descriptor::BTCTRL::BEATSIZE_BYTE
+                    | Descriptor::BTCTRL::Mask::SRCINC;
+        tx.btcnt    = count;
+        tx.srcaddr  = DMA::address( span.data + count );
+        tx.dstaddr  = DMA::address( &m_sercom->usart.data );
+        tx.descaddr = 0;
+
+        m_tx_in_flight = count;
+
+        m_dma->start( m_tx_channel );
+    }
+
+    /**
+     * \brief Handle a receive block transfer completion.
+     *
+     * \param[in] context The driver.
+     * \param[in] completion The completion status.
+     */
+    static void handle_rx_block_complete(
+        void *          context,
+        DMA::Completion completion ) noexcept
+    {
+        auto & driver = *static_cast<DMA_Driver *>( context );
+
+        if ( completion == DMA::Completion::TRANSFER_COMPLETE ) {
+            driver.m_rx_laps = driver.m_rx_laps + 1;
+        } // if
+    }
+
+    /**
+     * \brief Handle a transmit block transfer completion.
+     *
+     * \param[in] context The driver.
+     * \param[in] completion The completion status (transmit errors drop the in flight
+     *            data).
+     */
+    static void handle_tx_complete( void * context, DMA::Completion completion ) noexcept
+    {
+        static_cast<void>( completion );
+
+        auto & driver = *static_cast<DMA_Driver *>( context );
+
+        driver.m_tx.consume( driver.m_tx_in_flight );
+
+        driver.transmit();
+    }
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::USART
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_USART_H
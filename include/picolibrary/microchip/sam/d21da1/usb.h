@@ -0,0 +1,523 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::USB interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_USB_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_USB_H
+
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/peripheral/sysctrl.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/usb.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 USB facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::USB {
+
+/**
+ * \brief The number of endpoints (including the control endpoint).
+ */
+constexpr auto ENDPOINTS = std::uint_fast8_t{ 8 };
+
+/**
+ * \brief The maximum packet size of every endpoint (full-speed).
+ */
+constexpr auto PACKET_SIZE = std::uint16_t{ 64 };
+
+/**
+ * \brief The maximum size of a control transfer's data stage.
+ */
+constexpr auto CONTROL_BUFFER_SIZE = std::uint16_t{ 256 };
+
+/**
+ * \brief The maximum size of a bulk or interrupt endpoint transfer.
+ */
+constexpr auto TRANSFER_SIZE_MAX = std::uint16_t{ 0x3FFF };
+
+/**
+ * \brief Configure the DFLL48M to generate 48 MHz in USB clock recovery mode (locked to
+ *        the USB host's 1 kHz start-of-frame packets), which allows the USB peripheral to
+ *        be clocked without a crystal.
+ *
+ * The DFLL48M's coarse value is loaded from the NVM software calibration area, and the
+ * DFLL48M runs open loop at the calibrated frequency until the USB host starts sending
+ * start-of-frame packets.
+ *
+ * \pre the NVM controller has been configured with the wait states required to run the
+ *      CPU from a 48 MHz clock if the DFLL48M will be used as the CPU's clock source
+ *
+ * \param[in] sysctrl The SYSCTRL peripheral.
+ */
+void enable_clock_recovery( Peripheral::SYSCTRL & sysctrl ) noexcept;
+
+/**
+ * \brief Load the USB peripheral's factory pad calibration values from the NVM software
+ *        calibration area.
+ *
+ * \param[in] usb The USB peripheral.
+ */
+void load_calibration( Peripheral::USB & usb ) noexcept;
+
+/**
+ * \brief Setup packet.
+ */
+struct Setup_Packet {
+    /**
+     * \brief The request characteristics (bmRequestType).
+     */
+    std::uint8_t request_type;
+
+    /**
+     * \brief The request (bRequest).
+     */
+    std::uint8_t request;
+
+    /**
+     * \brief The request specific value (wValue).
+     */
+    std::uint16_t value;
+
+    /**
+     * \brief The request specific index or offset (wIndex).
+     */
+    std::uint16_t index;
+
+    /**
+     * \brief The number of bytes to transfer in the data stage (wLength).
+     */
+    std::uint16_t length;
+};
+
+/**
+ * \brief Endpoint type.
+ */
+enum class Endpoint_Type : std::uint_fast8_t {
+    BULK,      ///< Bulk.
+    INTERRUPT, ///< Interrupt.
+};
+
+/**
+ * \brief Endpoint buffering.
+ */
+enum class Buffering : std::uint_fast8_t {
+    SINGLE, ///< Single bank.
+    DOUBLE, ///< Double (ping-pong) bank.
+};
+
+/**
+ * \brief Request handler (returns true if the request has been handled).
+ *
+ * If the request is a device-to-host request, the request handler must reply using
+ * picolibrary::Microchip::SAM::D21DA1::USB::Device::control_send() before returning true.
+ * If the request is a host-to-device request with a data stage, data points to the data
+ * received in the data stage (nullptr otherwise).
+ */
+using Request_Handler =
+    bool ( * )( void * context, Setup_Packet const & setup, std::uint8_t const * data );
+
+/**
+ * \brief Configuration handler (configures the endpoints used by the selected
+ *        configuration, 0 if the device has been deconfigured).
+ */
+using Configuration_Handler = void ( * )( void * context, std::uint8_t configuration );
+
+/**
+ * \brief Transfer completion callback (called with the number of bytes transferred).
+ */
+using Transfer_Callback = void ( * )( void * context, std::uint16_t size );
+
+/**
+ * \brief Interrupt driven full-speed USB device driver.
+ *
+ * The driver handles the control endpoint (endpoint 0), and answers the standard requests
+ * that do not depend on the device's descriptors (SET_ADDRESS, GET_STATUS,
+ * CLEAR_FEATURE/SET_FEATURE(ENDPOINT_HALT), GET_CONFIGURATION, SET_CONFIGURATION,
+ * GET_INTERFACE, and SET_INTERFACE(0)). All other requests (including GET_DESCRIPTOR) are
+ * passed to the request handler, and the request is stalled if the request handler does
+ * not handle it. When the host selects a configuration, the configuration handler is
+ * called, and must configure the configuration's endpoints.
+ *
+ * Bulk and interrupt endpoint transfers are zero-copy: the USB peripheral reads IN data
+ * from, and writes OUT data to, the caller's buffer, and splits transfers into packets
+ * (and reassembles them) without CPU intervention. A double buffered endpoint uses both
+ * of its banks for the same direction, so that the USB peripheral switches to the
+ * transfer queued in the other bank as soon as the current transfer completes, and the
+ * completed bank can be refilled while the other bank is being transferred.
+ *
+ * \attention The driver and every submitted buffer must remain valid while the driver is
+ *            enabled.
+ */
+class Device {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] usb The USB peripheral to use.
+     * \param[in] request_handler The request handler.
+     * \param[in] configuration_handler The configuration handler.
+     * \param[in] context The request and configuration handler context.
+     */
+    Device(
+        Peripheral::USB &     usb,
+        Request_Handler       request_handler,
+        Configuration_Handler configuration_handler,
+        void *                context ) noexcept :
+        m_usb{ &usb },
+        m_request_handler{ request_handler },
+        m_configuration_handler{ configuration_handler },
+        m_context{ context }
+    {
+    }
+
+    Device( Device && ) = delete;
+
+    Device( Device const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Device() noexcept = default;
+
+    auto operator=( Device && ) = delete;
+
+    auto operator=( Device const & ) = delete;
+
+    /**
+     * \brief Configure and enable the USB peripheral in device mode, and attach to the
+     *        bus.
+     *
+     * The USB peripheral is reset, and its factory pad calibration is loaded.
+     *
+     * \pre the USB peripheral's APB and AHB clocks have been enabled
+     * \pre the USB peripheral's GCLK (48 MHz) has been enabled
+     * \pre the USB peripheral's D- and D+ pins have been configured to use the USB
+     *      peripheral
+     */
+    void enable() noexcept;
+
+    /**
+     * \brief Detach from the bus, and disable the USB peripheral.
+     */
+    void disable() noexcept;
+
+    /**
+     * \brief Get the configuration selected by the host.
+     *
+     * \return The configuration selected by the host (0 if the device is not
+     *         configured).
+     */
+    auto configuration() const noexcept -> std::uint8_t
+    {
+        return m_configuration;
+    }
+
+    /**
+     * \brief Configure a bulk or interrupt endpoint.
+     *
+     * \pre 0 < ( address & 0x0F ) < picolibrary::Microchip::SAM::D21DA1::USB::ENDPOINTS
+     *
+     * \param[in] address The endpoint address (bit 7 set for an IN endpoint).
+     * \param[in] type The endpoint type.
+     * \param[in] buffering The endpoint buffering.
+     */
+    void configure_endpoint(
+        std::uint8_t  address,
+        Endpoint_Type type,
+        Buffering     buffering ) noexcept;
+
+    /**
+     * \brief Queue a transfer in an endpoint's next bank.
+     *
+     * An IN transfer sends size bytes (a transfer of 0 bytes sends a zero length
+     * packet). Transfers are not terminated with a zero length packet: if the host
+     * expects a transfer whose size is a multiple of
+     * picolibrary::Microchip::SAM::D21DA1::USB::PACKET_SIZE to be terminated, a zero
+     * length transfer must be queued after it. An OUT transfer receives up to size bytes,
+     * and completes early if the host sends a short packet.
+     *
+     * \pre address has been configured
+     * \pre buffer is 32-bit aligned and located in SRAM
+     * \pre size <= picolibrary::Microchip::SAM::D21DA1::USB::TRANSFER_SIZE_MAX
+     * \pre if address is an OUT endpoint, size is a non-zero multiple of
+     *      picolibrary::Microchip::SAM::D21DA1::USB::PACKET_SIZE
+     *
+     * \param[in] address The endpoint address.
+     * \param[in] buffer The transfer buffer.
+     * \param[in] size The transfer size.
+     * \param[in] callback The transfer completion callback (called from the USB interrupt
+     *            handler, nullptr if the transfer does not have a completion callback).
+     * \param[in] context The transfer completion callback context.
+     *
+     * \return true if the transfer has been queued.
+     * \return false if the endpoint's next bank is busy.
+     */
+    auto submit(
+        std::uint8_t      address,
+        void *            buffer,
+        std::uint16_t     size,
+        Transfer_Callback callback,
+        void *            context ) noexcept -> bool;
+
+    /**
+     * \brief Stall an endpoint.
+     *
+     * \pre address has been configured
+     *
+     * \param[in] address The endpoint address.
+     */
+    void stall( std::uint8_t address ) noexcept;
+
+    /**
+     * \brief Clear an endpoint's stall, and reset its data toggle.
+     *
+     * \pre address has been configured
+     *
+     * \param[in] address The endpoint address.
+     */
+    void clear_stall( std::uint8_t address ) noexcept;
+
+    /**
+     * \brief Reply to a device-to-host request.
+     *
+     * The data is copied, and truncated to the length requested by the host.
+     *
+     * \attention This function must only be called by the request handler.
+     *
+     * \pre size <= picolibrary::Microchip::SAM::D21DA1::USB::CONTROL_BUFFER_SIZE
+     *
+     * \param[in] data The data to send.
+     * \param[in] size The size of the data to send.
+     */
+    void control_send( void const * data, std::uint16_t size ) noexcept;
+
+    /**
+     * \brief Handle a USB interrupt.
+     *
+     * Transfers that have been queued when the host resets the bus are abandoned (their
+     * transfer completion callbacks are not called).
+     *
+     * \attention This function must only be called by the USB interrupt handler.
+     */
+    void handle_interrupt() noexcept;
+
+  private:
+    /**
+     * \brief Control transfer state.
+     */
+    enum class Control_State : std::uint_fast8_t {
+        SETUP,     ///< Waiting for a setup packet.
+        DATA_OUT,  ///< Receiving the data stage.
+        DATA_IN,   ///< Sending the data stage (and waiting for the status stage).
+        STATUS_IN, ///< Sending the status stage.
+    };
+
+    /**
+     * \brief Endpoint bank transfer.
+     */
+    struct Transfer {
+        /**
+         * \brief The transfer completion callback.
+         */
+        Transfer_Callback callback;
+
+        /**
+         * \brief The transfer completion callback context.
+         */
+        void * context;
+    };
+
+    /**
+     * \brief Endpoint state.
+     */
+    struct Endpoint {
+        /**
+         * \brief The transfers queued in each bank.
+         */
+        Transfer transfer[ 2 ];
+
+        /**
+         * \brief The endpoint address (0 if the endpoint has not been configured).
+         */
+        std::uint8_t address;
+
+        /**
+         * \brief The endpoint's banks (bit n set if bank n is used).
+         */
+        std::uint8_t banks;
+
+        /**
+         * \brief The bank the next transfer will be queued in.
+         */
+        std::uint8_t next;
+
+        /**
+         * \brief The busy banks (bit n set if a transfer is queued in bank n).
+         */
+        std::uint8_t volatile busy;
+    };
+
+    /**
+     * \brief The USB peripheral.
+     */
+    Peripheral::USB * m_usb;
+
+    /**
+     * \brief The request handler.
+     */
+    Request_Handler m_request_handler;
+
+    /**
+     * \brief The configuration handler.
+     */
+    Configuration_Handler m_configuration_handler;
+
+    /**
+     * \brief The request and configuration handler context.
+     */
+    void * m_context;
+
+    /**
+     * \brief The endpoint bank descriptors (USB DESCADD SRAM, written by the USB
+     *        peripheral when a transfer completes).
+     */
+    alignas( 4 ) Peripheral::USB::DEVICE::Descriptor volatile
+        m_descriptors[ ENDPOINTS ][ 2 ]{};
+
+    /**
+     * \brief The endpoint states.
+     */
+    Endpoint m_endpoints[ ENDPOINTS ]{};
+
+    /**
+     * \brief The control endpoint OUT buffer (setup packets and data stages).
+     */
+    alignas( 4 ) std::uint8_t m_control_out[ CONTROL_BUFFER_SIZE ]{};
+
+    /**
+     * \brief The control endpoint IN buffer.
+     */
+    alignas( 4 ) std::uint8_t m_control_in[ CONTROL_BUFFER_SIZE ]{};
+
+    /**
+     * \brief The setup packet of the current control transfer.
+     */
+    Setup_Packet m_setup{};
+
+    /**
+     * \brief The control transfer state.
+     */
+    Control_State m_control_state{ Control_State::SETUP };
+
+    /**
+     * \brief The address assigned by the host (applied when the SET_ADDRESS request's
+     *        status stage completes).
+     */
+    std::uint8_t m_address{};
+
+    /**
+     * \brief The configuration selected by the host.
+     */
+    std::uint8_t volatile m_configuration{};
+
+    /**
+     * \brief Handle a bus reset.
+     */
+    void handle_reset() noexcept;
+
+    /**
+     * \brief Handle a control endpoint interrupt.
+     */
+    void handle_control() noexcept;
+
+    /**
+     * \brief Handle a setup packet.
+     */
+    void handle_setup() noexcept;
+
+    /**
+     * \brief Dispatch the current request.
+     *
+     * \param[in] data The data received in the request's data stage (nullptr if the
+     *            request does not have a host-to-device data stage).
+     */
+    void dispatch( std::uint8_t const * data ) noexcept;
+
+    /**
+     * \brief Handle the current request if it is a standard request that does not depend
+     *        on the device's descriptors.
+     *
+     * \return true if the request has been handled.
+     * \return false if the request has not been handled.
+     */
+    auto handle_standard_request() noexcept -> bool;
+
+    /**
+     * \brief Handle a bulk or interrupt endpoint interrupt.
+     *
+     * \param[in] number The endpoint number.
+     */
+    void handle_endpoint( std::uint_fast8_t number ) noexcept;
+
+    /**
+     * \brief Arm the control endpoint OUT bank.
+     *
+     * \param[in] size The number of bytes to receive.
+     */
+    void arm_control_out( std::uint16_t size ) noexcept;
+
+    /**
+     * \brief Send a control transfer's status stage (a zero length IN packet).
+     */
+    void send_status() noexcept;
+
+    /**
+     * \brief Stall the control endpoint (until the next setup packet is received).
+     */
+    void stall_control() noexcept;
+
+    /**
+     * \brief Disable every bulk and interrupt endpoint, and abandon their transfers.
+     */
+    void reset_endpoints() noexcept;
+
+    /**
+     * \brief Look up a configured endpoint.
+     *
+     * \param[in] address The endpoint address.
+     *
+     * \return The endpoint's state (nullptr if the endpoint has not been configured).
+     */
+    auto endpoint( std::uint8_t address ) noexcept -> Endpoint *;
+
+    /**
+     * \brief Get an endpoint's stall request mask.
+     *
+     * \param[in] endpoint The endpoint's state.
+     *
+     * \return The endpoint's stall request mask.
+     */
+    static auto stall_mask( Endpoint const & endpoint ) noexcept -> std::uint8_t;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::USB
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_USB_H
@@ -0,0 +1,467 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Watchdog interface.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_WATCHDOG_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_WATCHDOG_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/nvmctrl.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/wdt.h"
+#include "picolibrary/precondition.h"
+
+/**
+ * \brief Microchip SAM D21/DA1 watchdog facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::Watchdog {
+
+/**
+ * \brief The value that must be written to a WDT peripheral's CLEAR register to clear the
+ *        watchdog timer.
+ */
+constexpr auto CLEAR_KEY = std::uint8_t{ 0xA5 };
+
+/**
+ * \brief Multi-task watchdog supervisor.
+ *
+ * Each task that is registered with the supervisor is given a deadline, expressed as a
+ * number of supervisor service periods. A task must check in at least once every
+ * deadline service periods. The WDT peripheral is only cleared when every live task has
+ * met its deadline. Once a task misses its deadline, the supervisor stops clearing the
+ * WDT peripheral until the watchdog timer expires.
+ *
+ * The WDT peripheral is operated in window mode. The supervisor must be serviced after
+ * the closed window period has elapsed and before the open window period has elapsed.
+ * Servicing the supervisor too early (e.g. from a runaway loop) causes a watchdog reset.
+ *
+ * Task check-ins are a single byte store, allowing them to be performed from hot loops
+ * and interrupt handlers without disabling interrupts. A check-in that races with the
+ * servicing of the supervisor may be credited to the following service period, so task
+ * deadlines should include a service period of slack.
+ *
+ * \attention Tasks must be registered and retired, and the supervisor must be serviced,
+ *            from a single execution context.
+ */
+class Supervisor {
+  public:
+    /**
+     * \brief Task handle.
+     */
+    using Task = std::uint_fast8_t;
+
+    /**
+     * \brief The maximum number of tasks that can be registered with the supervisor.
+     */
+    static constexpr auto TASKS_MAX = Task{ 32 };
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] wdt The WDT peripheral to be supervised.
+     */
+    Supervisor( Peripheral::WDT & wdt ) noexcept : m_wdt{ &wdt }
+    {
+    }
+
+    Supervisor( Supervisor && ) = delete;
+
+    Supervisor( Supervisor const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Supervisor() noexcept = default;
+
+    auto operator=( Supervisor && ) = delete;
+
+    auto operator=( Supervisor const & ) = delete;
+
+    /**
+     * \brief Enable the WDT peripheral in window mode.
+     *
+     * \param[in] per The open window period.
+     * \param[in] window The closed window period.
+     */
+    void enable(
+        Peripheral::WDT::CONFIG::PER    per,
+        Peripheral::WDT::CONFIG::WINDOW window ) noexcept;
+
+    /**
+     * \brief Register a task with the supervisor.
+     *
+     * \pre deadline > 0
+     * \pre the number of live tasks is less than
+     *      picolibrary::Microchip::SAM::D21DA1::Watchdog::Supervisor::TASKS_MAX
+     *
+     * \param[in] deadline The maximum number of service periods that may elapse between
+     *            the task's check-ins.
+     *
+     * \return The task's handle.
+     */
+    auto register_task( std::uint_fast8_t deadline ) noexcept -> Task;
+
+    /**
+     * \brief Retire a task.
+     *
+     * \pre task is live
+     *
+     * \param[in] task The task to retire.
+     */
+    void retire_task( Task task ) noexcept;
+
+    /**
+     * \brief Check in a task.
+     *
+     * \attention This function does not check that task is live.
+     *
+     * \param[in] task The task to check in.
+     */
+    void check_in( Task task ) noexcept
+    {
+        m_check_in[ task ] = CHECKED_IN;
+    }
+
+    /**
+     * \brief Service the supervisor.
+     *
+     * \return true if every live task met its deadline and the WDT peripheral was
+     *         cleared.
+     * \return false if a live task has missed its deadline.
+     */
+    auto service() noexcept -> bool;
+
+    /**
+     * \brief Get the live tasks bitmap.
+     *
+     * \return The live tasks bitmap (bit n is set if task n is live).
+     */
+    auto live_tasks() const noexcept -> std::uint32_t
+    {
+        return m_live;
+    }
+
+    /**
+     * \brief Get the checked in tasks bitmap.
+     *
+     * \return The checked in tasks bitmap (bit n is set if task n has checked in since
+     *         the supervisor was last serviced).
+     */
+    auto checked_in_tasks() const noexcept -> std::uint32_t;
+
+    /**
+     * \brief Get the stalled tasks bitmap.
+     *
+     * \return The stalled tasks bitmap (bit n is set if task n has missed its deadline).
+     */
+    auto stalled_tasks() const noexcept -> std::uint32_t
+    {
+        return m_stalled;
+    }
+
+  private:
+    /**
+     * \brief Task checked in flag value.
+     */
+    static constexpr auto CHECKED_IN = std::uint8_t{ 1 };
+
+    /**
+     * \brief The supervised WDT peripheral.
+     */
+    Peripheral::WDT * m_wdt;
+
+    /**
+     * \brief The live tasks bitmap.
+     */
+    std::uint32_t m_live{};
+
+    /**
+     * \brief The stalled tasks bitmap.
+     */
+    std::uint32_t m_stalled{};
+
+    /**
+     * \brief The task deadlines.
+     */
+    std::uint8_t m_deadline[ TASKS_MAX ]{};
+
+    /**
+     * \brief The number of service periods remaining until each task's deadline.
+     */
+    std::uint8_t m_remaining[ TASKS_MAX ]{};
+
+    /**
+     * \brief The task checked in flags.
+     */
+    std::uint8_t volatile m_check_in[ TASKS_MAX ]{};
+};
+
+/**
+ * \brief Rate limited, synchronization free WDT peripheral clearing.
+ *
+ * Writing to a WDT peripheral's CLEAR register while a previous clear is still being
+ * synchronized to the WDT clock domain stalls the bus until synchronization completes,
+ * which takes several WDT clock cycles. The kicker skips the clear if a previous clear is
+ * still being synchronized, and limits clears to one per clear interval, so a hot loop
+ * that kicks the watchdog on every iteration never blocks on WDT synchronization.
+ *
+ * The clear interval should be a fraction of the WDT peripheral's timeout period (e.g.
+ * one quarter) that leaves enough slack for the loop's worst-case iteration time and the
+ * synchronization delay. If the WDT peripheral is operated in window mode, the clear
+ * interval must also be longer than the closed window period.
+ */
+class Kicker {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \pre divisor > 0
+     * \pre timeout >= divisor (a zero clear interval would clear the WDT peripheral on
+     *      every kick)
+     *
+     * \param[in] wdt The WDT peripheral to clear.
+     * \param[in] timeout The WDT peripheral's timeout period, expressed in the units of
+     *            the time values that are passed to
+     *            picolibrary::Microchip::SAM::D21DA1::Watchdog::Kicker::kick().
+     * \param[in] divisor The clear interval, expressed as a fraction of the timeout
+     *            period (the clear interval is timeout / divisor).
+     */
+    Kicker(
+        Peripheral::WDT & wdt,
+        std::uint32_t     timeout,
+        std::uint32_t     divisor = 4 ) noexcept :
+        m_wdt{ &wdt }
+    {
+        PICOLIBRARY_EXPECT( divisor > 0, Generic_Error::INVALID_ARGUMENT );
+
+        m_interval = timeout / divisor;
+
+        PICOLIBRARY_EXPECT( m_interval > 0, Generic_Error::INVALID_ARGUMENT );
+    }
+
+    Kicker( Kicker && ) = delete;
+
+    Kicker( Kicker const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Kicker() noexcept = default;
+
+    auto operator=( Kicker && ) = delete;
+
+    auto operator=( Kicker const & ) = delete;
+
+    /**
+     * \brief Kick the watchdog.
+     *
+     * The WDT peripheral is cleared if the clear interval has elapsed since the previous
+     * clear and the previous clear has finished synchronizing.
+     *
+     * \param[in] now The current time (wraparound is handled).
+     *
+     * \return true if the WDT peripheral was cleared.
+     * \return false if the clear was skipped.
+     */
+    auto kick( std::uint32_t now ) noexcept -> bool
+    {
+        if ( now - m_last_clear < m_interval
+             or m_wdt->status & Peripheral::WDT::STATUS::Mask::SYNCBUSY ) {
+            return false;
+        } // if
+
+        m_wdt->clear = CLEAR_KEY;
+
+        m_last_clear = now;
+
+        return true;
+    }
+
+  private:
+    /**
+     * \brief The WDT peripheral to clear.
+     */
+    Peripheral::WDT * m_wdt;
+
+    /**
+     * \brief The clear interval.
+     */
+    std::uint32_t m_interval{};
+
+    /**
+     * \brief The time of the previous clear.
+     */
+    std::uint32_t m_last_clear{};
+};
+
+/**
+ * \brief Crash snapshot.
+ *
+ * The crash snapshot is stored in the .noinit section so that it survives a watchdog
+ * reset.
+ */
+struct Crash_Snapshot {
+    /**
+     * \brief The number of entries in the reset cause history.
+     */
+    static constexpr auto RESET_CAUSE_HISTORY_SIZE = std::uint_fast8_t{ 8 };
+
+    /**
+     * \brief The number of entries in the trace ring.
+     */
+    static constexpr auto TRACE_SIZE = std::uint_fast8_t{ 16 };
+
+    /**
+     * \brief The crash snapshot signature (used to detect an uninitialized crash
+     *        snapshot).
+     */
+    std::uint32_t signature;
+
+    /**
+     * \brief The crash snapshot captured flag.
+     */
+    std::uint32_t captured;
+
+    /**
+     * \brief The stacked PC.
+     */
+    std::uint32_t pc;
+
+    /**
+     * \brief The stacked LR.
+     */
+    std::uint32_t lr;
+
+    /**
+     * \brief The supervisor's live tasks bitmap.
+     */
+    std::uint32_t live_tasks;
+
+    /**
+     * \brief The supervisor's checked in tasks bitmap.
+     */
+    std::uint32_t checked_in_tasks;
+
+    /**
+     * \brief The supervisor's stalled tasks bitmap.
+     */
+    std::uint32_t stalled_tasks;
+
+    /**
+     * \brief The PM peripheral RCAUSE register history (most recent first).
+     */
+    std::uint8_t reset_cause_history[ RESET_CAUSE_HISTORY_SIZE ];
+
+    /**
+     * \brief The index of the next trace ring entry to be written.
+     */
+    std::uint32_t trace_head;
+
+    /**
+     * \brief The trace ring.
+     */
+    std::uint32_t trace[ TRACE_SIZE ];
+};
+
+/**
+ * \brief Record the cause of the most recent reset in the crash snapshot's reset cause
+ *        history.
+ *
+ * If the crash snapshot has not been initialized (e.g. following a power on reset), it is
+ * initialized before the reset cause is recorded.
+ *
+ * \attention This function must be called once per boot, before the crash snapshot is
+ *            stored or traced to.
+ *
+ * \param[in] rcause The PM peripheral's RCAUSE register value.
+ */
+void record_reset_cause( std::uint8_t rcause ) noexcept;
+
+/**
+ * \brief Add a value to the crash snapshot's trace ring.
+ *
+ * \param[in] value The value to add to the trace ring.
+ */
+void trace( std::uint32_t value ) noexcept;
+
+/**
+ * \brief Enable capture of the crash snapshot from a WDT peripheral's early warning
+ *        interrupt.
+ *
+ * \attention The WDT peripheral's EWCTRL register is enable-protected, so this function
+ *            must be called before the WDT peripheral is enabled.
+ * \attention In window mode, the early warning interrupt is generated at the start of the
+ *            open window period and ewoffset is ignored. The crash snapshot is captured
+ *            every service period, and the snapshot captured before a watchdog reset
+ *            reflects the state at the start of the final open window period.
+ * \attention The early warning handler
+ *            (picolibrary-microchip-sam-d21da1-watchdog-early_warning_handler) must be
+ *            linked, and the WDT interrupt must be enabled in the NVIC.
+ *
+ * \param[in] wdt The WDT peripheral.
+ * \param[in] ewoffset The early warning interrupt time offset.
+ * \param[in] supervisor The supervisor whose task state is to be captured.
+ */
+void enable_early_warning(
+    Peripheral::WDT &                 wdt,
+    Peripheral::WDT::EWCTRL::EWOFFSET ewoffset,
+    Supervisor const &                supervisor ) noexcept;
+
+/**
+ * \brief Get the crash snapshot.
+ *
+ * \return The crash snapshot.
+ */
+auto crash_snapshot() noexcept -> Crash_Snapshot const &;
+
+/**
+ * \brief Store the crash snapshot in NVM if the most recent reset was a watchdog reset
+ *        and a crash snapshot was captured before the reset.
+ *
+ * \pre address is row aligned
+ *
+ * \param[in] nvmctrl The NVMCTRL peripheral to use to store the crash snapshot.
+ * \param[in] address The address of the NVM row(s) to store the crash snapshot in.
+ *
+ * \return true if the crash snapshot was stored.
+ * \return false if the crash snapshot was not stored.
+ */
+auto store_crash_snapshot( Peripheral::NVMCTRL & nvmctrl, std::uint32_t address ) noexcept
+    -> bool;
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Watchdog
+
+/**
+ * \brief Capture the crash snapshot.
+ *
+ * \attention This function is called by the early warning handler
+ *            (picolibrary-microchip-sam-d21da1-watchdog-early_warning_handler) and should
+ *            not be called directly.
+ *
+ * \param[in] frame The exception stack frame of the interrupted context.
+ */
+extern "C" void picolibrary_microchip_sam_d21da1_watchdog_capture_crash_snapshot(
+    ::picolibrary::Microchip::SAM::D21DA1::Interrupt::Exception_Frame const *
+        frame ) noexcept;
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_WATCHDOG_H
@@ -0,0 +1,211 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::ADC implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/adc.h"
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/dma.h"
+#include "picolibrary/microchip/sam/d21da1/nvm.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/adc.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/dmac.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::ADC {
+
+void load_calibration( Peripheral::ADC & adc ) noexcept
+{
+    using ADC = Peripheral::ADC;
+
+    auto const calibration = reinterpret_cast<std::uint32_t const volatile *>(
+        NVM::SOFTWARE_CALIBRATION_ADDRESS );
+
+    // the linearity calibration value occupies bits 34:27 and the bias calibration value
+    // occupies bits 37:35 of the software calibration area
+    auto const linearity = ( calibration[ 0 ] >> 27 )
+                           | ( ( calibration[ 1 ] & 0x7 ) << 5 );
+    auto const bias      = ( calibration[ 1 ] >> 3 ) & 0x7;
+
+    adc.calib = static_cast<std::uint16_t>(
+        ( linearity << ADC::CALIB::Bit::LINEARITY_CAL )
+        | ( bias << ADC::CALIB::Bit::BIAS_CAL ) );
+}
+
+Stream::Stream(
+    Peripheral::ADC & adc,
+    DMA::Controller & dma,
+    std::uint16_t *   buffer,
+    std::uint16_t     block_size,
+    Block_Callback    callback,
+    void *            context ) noexcept :
+    m_adc{ &adc },
+    m_dma{ &dma },
+    m_buffer{ buffer },
+    m_block_size{ block_size },
+    m_callback{ callback },
+    m_context{ context }
+{
+    PICOLIBRARY_EXPECT( block_size > 0, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT( callback, Generic_Error::INVALID_ARGUMENT );
+}
+
+void Stream::enable(
+    Peripheral::ADC::REFCTRL::REFSEL    reference,
+    Peripheral::ADC::CTRLB::PRESCALER   prescaler,
+    std::uint_fast8_t                   sampling_time,
+    Peripheral::ADC::AVGCTRL::SAMPLENUM samples,
+    Peripheral::ADC::INPUTCTRL::MUXPOS  first_input,
+    std::uint_fast8_t                   inputs,
+    Peripheral::ADC::INPUTCTRL::GAIN    gain,
+    Trigger                             trigger ) noexcept
+{
+    using ADC        = Peripheral::ADC;
+    using DMAC       = Peripheral::DMAC;
+    using Descriptor = DMA::Descriptor;
+
+    PICOLIBRARY_EXPECT( sampling_time < 64, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT( inputs > 0 and inputs <= 16, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT( m_block_size % inputs == 0, Generic_Error::INVALID_ARGUMENT );
+
+    m_adc->ctrla = ADC::CTRLA::Mask::SWRST;
+
+    synchronize();
+
+    load_calibration( *m_adc );
+
+    // 2^n samples accumulate into a 12 + n bit sum, which the hardware automatically
+    // right shifts by n - 4 if n > 4 so that it fits in 16 bits, so right shifting the
+    // accumulated result by min( n, 4 ) yields the 12 bit average
+    auto const log2_samples = static_cast<std::uint_fast8_t>(
+        samples >> ADC::AVGCTRL::Bit::SAMPLENUM );
+    auto const adjres = log2_samples < 4 ? log2_samples : std::uint_fast8_t{ 4 };
+
+    m_adc->refctrl  = reference;
+    m_adc->avgctrl  = samples | ( adjres << ADC::AVGCTRL::Bit::ADJRES );
+    m_adc->sampctrl = sampling_time << ADC::SAMPCTRL::Bit::SAMPLEN;
+    m_adc->ctrlb    = prescaler
+                   | ( log2_samples ? ADC::CTRLB::RESSEL_16BIT
+                                    : ADC::CTRLB::RESSEL_12BIT )
+                   | ( trigger == Trigger::FREE_RUNNING ? ADC::CTRLB::Mask::FREERUN
+                                                        : 0 );
+
+    synchronize();
+
+    m_adc->inputctrl = first_input | ADC::INPUTCTRL::MUXNEG_GND
+                       | ( ( inputs - 1U ) << ADC::INPUTCTRL::Bit::INPUTSCAN ) | gain;
+
+    synchronize();
+
+    m_adc->evctrl = trigger == Trigger::EVENT ? ADC::EVCTRL::Mask::STARTEI : 0;
+
+    m_channel    = m_dma->allocate_channel();
+    m_descriptor = &m_dma->allocate_descriptor();
+    m_block      = 0;
+
+    auto & first  = m_dma->descriptor( m_channel );
+    auto & second = *m_descriptor;
+
+    first.btctrl  = Descriptor::BTCTRL::Mask::VALID | Descriptor::BTCTRL::BLOCKACT_INT
+                   | Descriptor::BTCTRL::BEATSIZE_HWORD
+                   | Descriptor::BTCTRL::Mask::DSTINC;
+    first.btcnt   = m_block_size;
+    first.srcaddr = DMA::address( &m_adc->result );
+    first.dstaddr = DMA::address( m_buffer + m_block_size );
+    DMA::link( first, second );
+
+    second         = first;
+    second.dstaddr = DMA::address( m_buffer + 2 * m_block_size );
+    DMA::link( second, first );
+
+    m_dma->configure_channel(
+        m_channel,
+        DMAC::CHCTRLB::TRIGSRC_ADC_RESRDY | DMAC::CHCTRLB::LVL_LVL3
+            | DMAC::CHCTRLB::TRIGACT_BEAT,
+        handle_block_complete,
+        this );
+    m_dma->start( m_channel );
+
+    m_adc->intflag = ADC::INTFLAG::Mask::OVERRUN;
+    m_adc->ctrla   = ADC::CTRLA::Mask::ENABLE;
+
+    synchronize();
+
+    if ( trigger == Trigger::FREE_RUNNING ) {
+        m_adc->swtrig = ADC::SWTRIG::Mask::START;
+
+        synchronize();
+    } // if
+}
+
+void Stream::disable() noexcept
+{
+    using ADC = Peripheral::ADC;
+
+    m_adc->ctrla &= ~ADC::CTRLA::Mask::ENABLE;
+
+    synchronize();
+
+    m_dma->abort( m_channel );
+    m_dma->release_channel( m_channel );
+    m_dma->release_descriptor( *m_descriptor );
+}
+
+auto Stream::overrun() noexcept -> bool
+{
+    using ADC = Peripheral::ADC;
+
+    if ( m_adc->intflag & ADC::INTFLAG::Mask::OVERRUN ) {
+        m_adc->intflag = ADC::INTFLAG::Mask::OVERRUN;
+
+        return true;
+    } // if
+
+    return false;
+}
+
+void Stream::synchronize() const noexcept
+{
+    using ADC = Peripheral::ADC;
+
+    while ( m_adc->status & ADC::STATUS::Mask::SYNCBUSY ) {} // while
+}
+
+void Stream::handle_block_complete(
+    void *          context,
+    DMA::Completion completion ) noexcept
+{
+    auto & stream = *static_cast<Stream *>( context );
+
+    if ( completion == DMA::Completion::TRANSFER_COMPLETE ) {
+        auto const block = stream.m_block;
+
+        stream.m_block = block ^ 1;
+
+        stream.m_callback(
+            stream.m_context,
+            stream.m_buffer + block * stream.m_block_size,
+            stream.m_block_size );
+    } // if
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::ADC
@@ -0,0 +1,145 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Boot_Profiler implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/boot_profiler.h"
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral.h"
+#include "picolibrary/error.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Boot_Profiler {
+
+namespace {
+
+/**
+ * \brief Boot profile.
+ */
+struct Profile {
+    /**
+     * \brief The number of checkpoints that have been recorded.
+     */
+    std::uint_fast8_t checkpoints;
+
+    /**
+     * \brief The SysTick current value at the previous checkpoint.
+     */
+    std::uint32_t previous;
+
+    /**
+     * \brief The processor clock frequency, in Hz.
+     */
+    std::uint32_t frequency;
+
+    /**
+     * \brief The recorded checkpoints.
+     */
+    Checkpoint checkpoint[ CHECKPOINTS_MAX ];
+};
+
+/**
+ * \brief The boot profile (in the .noinit section so that it is not overwritten when the
+ *        .data and .bss sections are initialized).
+ */
+__attribute__( ( section( ".noinit" ) ) ) Profile profile;
+
+} // namespace
+
+void start( std::uint32_t frequency ) noexcept
+{
+    using ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SYSTICK;
+    using ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SYSTICK0;
+
+    auto & systick = SYSTICK0::instance();
+
+    if ( not( systick.csr & SYSTICK::CSR::Mask::ENABLE ) ) {
+        systick.rvr = SYSTICK::RVR::Mask::RELOAD;
+        systick.cvr = 0;
+        systick.csr = SYSTICK::CSR::Mask::CLKSOURCE | SYSTICK::CSR::Mask::ENABLE;
+    } // if
+
+    profile.checkpoints = 0;
+    profile.previous    = systick.cvr;
+    profile.frequency   = frequency;
+
+    stamp( Phase::RESET );
+}
+
+void stamp( Phase phase, std::uint8_t id ) noexcept
+{
+    auto & systick = ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SYSTICK0::instance();
+
+    std::uint32_t const now    = systick.cvr;
+    std::uint32_t const period = systick.rvr + 1;
+
+    if ( profile.checkpoints >= CHECKPOINTS_MAX ) {
+        return;
+    } // if
+
+    // SysTick counts down
+    auto const cycles = profile.previous >= now ? profile.previous - now
+                                                : profile.previous + period - now;
+
+    profile.checkpoint[ profile.checkpoints ] = Checkpoint{
+        phase, id, cycles, profile.frequency
+    };
+
+    ++profile.checkpoints;
+    profile.previous = now;
+}
+
+void clock_changed( std::uint32_t frequency ) noexcept
+{
+    stamp( Phase::CLOCK_CHANGED );
+
+    profile.frequency = frequency;
+}
+
+auto checkpoints() noexcept -> std::uint_fast8_t
+{
+    return profile.checkpoints;
+}
+
+auto checkpoint_record( std::uint_fast8_t n ) noexcept -> Checkpoint
+{
+    PICOLIBRARY_EXPECT( n < profile.checkpoints, Generic_Error::INVALID_ARGUMENT );
+
+    return profile.checkpoint[ n ];
+}
+
+auto elapsed_us( std::uint_fast8_t n ) noexcept -> std::uint32_t
+{
+    PICOLIBRARY_EXPECT( n < profile.checkpoints, Generic_Error::INVALID_ARGUMENT );
+
+    auto elapsed = std::uint64_t{};
+
+    for ( auto i = std::uint_fast8_t{}; i <= n; ++i ) {
+        auto const & checkpoint = profile.checkpoint[ i ];
+
+        elapsed += std::uint64_t{ checkpoint.cycles } * 1'000'000 / checkpoint.frequency;
+    } // for
+
+    return static_cast<std::uint32_t>( elapsed );
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Boot_Profiler
@@ -0,0 +1,292 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Capture implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/capture.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/dma.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/dmac.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/eic.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/evsys.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/tcc.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Capture {
+
+namespace {
+
+/**
+ * \brief The TCC counter prescaler divisors (indexed by CTRLA.PRESCALER).
+ */
+constexpr std::uint16_t PRESCALER_DIVISOR[]{ 1, 2, 4, 8, 16, 64, 256, 1024 };
+
+} // namespace
+
+void connect(
+    Peripheral::EIC &                eic,
+    std::uint_fast8_t                extint,
+    Peripheral::EVSYS &              evsys,
+    std::uint_fast8_t                channel,
+    Peripheral::EVSYS::USER::USER_ID user ) noexcept
+{
+    using EIC   = Peripheral::EIC;
+    using EVSYS = Peripheral::EVSYS;
+
+    PICOLIBRARY_EXPECT( extint < 16, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT( channel < 12, Generic_Error::INVALID_ARGUMENT );
+
+    // each CONFIG register holds the SENSEn/FILTENn fields of 8 external interrupts
+    auto const shift = ( extint % 8 ) * EIC::CONFIG::Bit::SENSE1;
+
+    auto & config = eic.config[ extint / 8 ];
+
+    config = ( config & ~( EIC::CONFIG::Mask::SENSE0 << shift ) )
+             | ( EIC::CONFIG::SENSE0_HIGH << shift );
+    eic.evctrl |= EIC::EVCTRL::Mask::EXTINTEO0 << extint;
+
+    // the USER register's CHANNEL field selects channel n with the value n + 1 (0
+    // disconnects the user)
+    evsys.user = user | ( ( channel + 1 ) << EVSYS::USER::Bit::CHANNEL );
+
+    // the asynchronous path passes the level of the event signal through (the
+    // resynchronized paths only pass edges), which the period and pulse width capture
+    // event actions require
+    evsys.channel = ( channel << EVSYS::CHANNEL::Bit::CHANNEL )
+                    | ( EVSYS::CHANNEL::EVGEN_EIC_EXTINT0
+                        + ( extint << EVSYS::CHANNEL::Bit::EVGEN ) )
+                    | EVSYS::CHANNEL::PATH_ASYNCHRONOUS;
+}
+
+Channel::Channel(
+    Peripheral::TCC &                  tcc,
+    DMA::Controller &                  dma,
+    Peripheral::DMAC::CHCTRLB::TRIGSRC period_trigger,
+    Peripheral::DMAC::CHCTRLB::TRIGSRC pulse_width_trigger,
+    std::uint32_t *                    periods,
+    std::uint32_t *                    pulse_widths,
+    std::uint16_t                      capacity ) noexcept :
+    m_tcc{ &tcc },
+    m_dma{ &dma },
+    m_periods{ period_trigger, periods, {}, {}, {} },
+    m_pulse_widths{ pulse_width_trigger, pulse_widths, {}, {}, {} },
+    m_capacity{ capacity }
+{
+    PICOLIBRARY_EXPECT( capacity > 1, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT(
+        not( capacity & ( capacity - 1 ) ), Generic_Error::INVALID_ARGUMENT );
+}
+
+void Channel::enable(
+    Peripheral::TCC::CTRLA::PRESCALER prescaler,
+    std::uint32_t                     gclk_frequency ) noexcept
+{
+    using TCC = Peripheral::TCC;
+
+    m_tick_frequency = gclk_frequency
+                       / PRESCALER_DIVISOR[ prescaler >> TCC::CTRLA::Bit::PRESCALER ];
+
+    m_tcc->ctrla = TCC::CTRLA::Mask::SWRST;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::SWRST ) {} // while
+
+    m_tcc->ctrla = prescaler | TCC::CTRLA::PRESCSYNC_PRESC | TCC::CTRLA::Mask::CPTEN0
+                   | TCC::CTRLA::Mask::CPTEN1;
+    m_tcc->evctrl = TCC::EVCTRL::EVACT1_PPW | TCC::EVCTRL::Mask::TCEI1;
+
+    // the first captures measure from an arbitrary point in the input signal's cycle
+    m_periods.laps           = 0;
+    m_periods.processed      = 1;
+    m_pulse_widths.laps      = 0;
+    m_pulse_widths.processed = 1;
+
+    start( m_periods, &m_tcc->cc[ 0 ], handle_period_lap );
+    start( m_pulse_widths, &m_tcc->cc[ 1 ], handle_pulse_width_lap );
+
+    m_tcc->ctrla |= TCC::CTRLA::Mask::ENABLE;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::ENABLE ) {} // while
+}
+
+void Channel::disable() noexcept
+{
+    using TCC = Peripheral::TCC;
+
+    m_tcc->ctrla &= ~TCC::CTRLA::Mask::ENABLE;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::ENABLE ) {} // while
+
+    for ( auto stream : { &m_periods, &m_pulse_widths } ) {
+        m_dma->abort( stream->channel );
+        m_dma->release_channel( stream->channel );
+    } // for
+}
+
+auto Channel::statistics() noexcept -> Statistics
+{
+    auto statistics = Statistics{};
+
+    // one slot is kept free since the DMAC may be overwriting the oldest unprocessed
+    // capture while the batch is being processed
+    auto const backlog_max = std::uint32_t{ m_capacity - 1U };
+
+    auto backlog = [ this, backlog_max ]( Stream & stream ) noexcept -> std::uint32_t {
+        auto const pending = captured( stream ) - stream.processed;
+
+        if ( pending > backlog_max ) {
+            stream.processed += pending - backlog_max;
+        } // if
+
+        return pending;
+    };
+
+    auto const periods      = backlog( m_periods );
+    auto const pulse_widths = backlog( m_pulse_widths );
+
+    statistics.dropped = periods > backlog_max ? periods - backlog_max : 0;
+
+    auto const samples = std::min( { periods, pulse_widths, backlog_max } );
+
+    if ( not samples ) {
+        return statistics;
+    } // if
+
+    auto period_sum      = std::uint64_t{};
+    auto pulse_width_sum = std::uint64_t{};
+
+    statistics.period_min = ~std::uint32_t{};
+
+    for ( auto i = std::uint32_t{}; i < samples; ++i ) {
+        auto const period = m_periods.buffer[ ( m_periods.processed + i ) % m_capacity ];
+        auto const pulse_width =
+            m_pulse_widths.buffer[ ( m_pulse_widths.processed + i ) % m_capacity ];
+
+        if ( period < statistics.period_min ) {
+            statistics.period_min = period;
+        } // if
+
+        if ( period > statistics.period_max ) {
+            statistics.period_max = period;
+        } // if
+
+        period_sum += period;
+        pulse_width_sum += pulse_width;
+    } // for
+
+    m_periods.processed += samples;
+    m_pulse_widths.processed += samples;
+
+    statistics.samples          = samples;
+    statistics.period_mean      = static_cast<std::uint32_t>( period_sum / samples );
+    statistics.pulse_width_mean = static_cast<std::uint32_t>( pulse_width_sum / samples );
+
+    if ( period_sum ) {
+        auto const duty_cycle = ( pulse_width_sum << 16 ) / period_sum;
+
+        statistics.frequency = std::uint64_t{ samples } * m_tick_frequency * 1000
+                               / period_sum;
+        statistics.duty_cycle = static_cast<std::uint16_t>(
+            duty_cycle > 0xFFFF ? 0xFFFF : duty_cycle );
+    } // if
+
+    return statistics;
+}
+
+auto Channel::max_input_frequency( std::uint32_t batch_interval ) const noexcept
+    -> std::uint32_t
+{
+    PICOLIBRARY_EXPECT( batch_interval > 0, Generic_Error::INVALID_ARGUMENT );
+
+    auto const resolution_limit = m_tick_frequency / 2;
+    auto const buffer_limit = std::uint64_t{ m_capacity - 1U } * 1'000'000
+                              / batch_interval;
+
+    return static_cast<std::uint32_t>(
+        std::min( buffer_limit, std::uint64_t{ resolution_limit } ) );
+}
+
+void Channel::start( Stream & stream, void const * source, DMA::Callback lap ) noexcept
+{
+    using DMAC       = Peripheral::DMAC;
+    using Descriptor = DMA::Descriptor;
+
+    stream.channel = m_dma->allocate_channel();
+
+    auto & descriptor = m_dma->descriptor( stream.channel );
+
+    descriptor.btctrl  = Descriptor::BTCTRL::Mask::VALID
+                        | Descriptor::BTCTRL::BLOCKACT_INT
+                        | Descriptor::BTCTRL::BEATSIZE_WORD
+                        | Descriptor::BTCTRL::Mask::DSTINC;
+    descriptor.btcnt   = m_capacity;
+    descriptor.srcaddr = DMA::address( source );
+    descriptor.dstaddr = DMA::address( stream.buffer + m_capacity );
+    DMA::link( descriptor, descriptor );
+
+    m_dma->configure_channel(
+        stream.channel,
+        stream.trigger | DMAC::CHCTRLB::LVL_LVL3 | DMAC::CHCTRLB::TRIGACT_BEAT,
+        lap,
+        this );
+    m_dma->start( stream.channel );
+}
+
+auto Channel::captured( Stream const & stream ) const noexcept -> std::uint32_t
+{
+    Interrupt::Critical_Section const critical_section;
+
+    for ( ;; ) {
+        // a completed block transfer whose interrupt has not been handled has already
+        // been reloaded, and must be counted here
+        auto const lapped    = m_dma->transfer_complete_pending( stream.channel );
+        auto const remaining = m_dma->remaining( stream.channel );
+
+        if ( m_dma->transfer_complete_pending( stream.channel ) == lapped ) {
+            return ( stream.laps + lapped ) * m_capacity + ( m_capacity - remaining );
+        } // if
+    }     // for
+}
+
+void Channel::handle_period_lap( void * context, DMA::Completion completion ) noexcept
+{
+    auto & channel = *static_cast<Channel *>( context );
+
+    if ( completion == DMA::Completion::TRANSFER_COMPLETE ) {
+        channel.m_periods.laps = channel.m_periods.laps + 1;
+    } // if
+}
+
+void Channel::handle_pulse_width_lap(
+    void *          context,
+    DMA::Completion completion ) noexcept
+{
+    auto & channel = *static_cast<Channel *>( context );
+
+    if ( completion == DMA::Completion::TRANSFER_COMPLETE ) {
+        channel.m_pulse_widths.laps = channel.m_pulse_widths.laps + 1;
+    } // if
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Capture
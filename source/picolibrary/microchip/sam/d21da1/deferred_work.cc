@@ -0,0 +1,144 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Deferred_Work implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/deferred_work.h"
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral.h"
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Deferred_Work {
+
+void Dispatcher::configure_pendsv() noexcept
+{
+    using ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB;
+
+    // only the most significant priority bits are implemented, so setting every bit
+    // selects the lowest priority
+    m_scb->shpr3 |= SCB::SHPR3::Mask::PRI_14;
+}
+
+auto Dispatcher::post(
+    std::uint_fast8_t priority,
+    Function          function,
+    std::uint32_t     argument ) noexcept -> bool
+{
+    using ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB;
+
+    PICOLIBRARY_EXPECT( priority < PRIORITIES, Generic_Error::INVALID_ARGUMENT );
+
+    auto & queue = m_queues[ priority ];
+
+    std::uint8_t const tail  = queue.tail;
+    auto const         depth = static_cast<std::uint8_t>( tail - queue.head );
+
+    if ( depth >= QUEUE_CAPACITY ) {
+        queue.dropped = queue.dropped + 1;
+
+        return false;
+    } // if
+
+    queue.work[ tail % QUEUE_CAPACITY ] = Work{ function,
+                                                argument,
+                                                m_clock ? m_clock() : std::uint32_t{} };
+
+    // the work item must be written before it is published
+    asm volatile( "" : : : "memory" );
+
+    queue.tail = tail + 1;
+
+    if ( depth + 1 > queue.high_water_mark ) {
+        queue.high_water_mark = depth + 1;
+    } // if
+
+    m_scb->icsr = SCB::ICSR::Mask::PENDSVSET;
+
+    return true;
+}
+
+void Dispatcher::drain() noexcept
+{
+    for ( auto & queue : m_queues ) {
+        std::uint8_t const tail = queue.tail;
+
+        // the work items must not be read before they are published
+        asm volatile( "" : : : "memory" );
+
+        for ( std::uint8_t head = queue.head; head != tail; ++head ) {
+            auto const work = queue.work[ head % QUEUE_CAPACITY ];
+
+            // the work item must be read before its slot is released
+            asm volatile( "" : : : "memory" );
+
+            queue.head = head + 1;
+
+            if ( m_clock ) {
+                auto const latency = m_clock() - work.posted;
+
+                if ( latency > queue.max_drain_latency ) {
+                    queue.max_drain_latency = latency;
+                } // if
+            }     // if
+
+            work.function( work.argument );
+        } // for
+    }     // for
+}
+
+auto Dispatcher::high_water_mark( std::uint_fast8_t priority ) const noexcept
+    -> std::uint_fast8_t
+{
+    PICOLIBRARY_EXPECT( priority < PRIORITIES, Generic_Error::INVALID_ARGUMENT );
+
+    return m_queues[ priority ].high_water_mark;
+}
+
+auto Dispatcher::dropped( std::uint_fast8_t priority ) const noexcept -> std::uint32_t
+{
+    PICOLIBRARY_EXPECT( priority < PRIORITIES, Generic_Error::INVALID_ARGUMENT );
+
+    return m_queues[ priority ].dropped;
+}
+
+auto Dispatcher::max_drain_latency( std::uint_fast8_t priority ) const noexcept
+    -> std::uint32_t
+{
+    PICOLIBRARY_EXPECT( priority < PRIORITIES, Generic_Error::INVALID_ARGUMENT );
+
+    return m_queues[ priority ].max_drain_latency;
+}
+
+void Dispatcher::reset_statistics() noexcept
+{
+    Interrupt::Critical_Section const critical_section;
+
+    for ( auto & queue : m_queues ) {
+        queue.high_water_mark   = 0;
+        queue.dropped           = 0;
+        queue.max_drain_latency = 0;
+    } // for
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Deferred_Work
@@ -0,0 +1,238 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::DMA implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/dma.h"
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/dmac.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::DMA {
+
+static_assert( LINKED_DESCRIPTORS <= 32 );
+
+void Controller::enable() noexcept
+{
+    m_dmac->baseaddr = address( m_descriptors );
+    m_dmac->wrbaddr  = address( m_write_back );
+
+    using CTRL = Peripheral::DMAC::CTRL;
+
+    m_dmac->ctrl = CTRL::Mask::DMAENABLE | CTRL::Mask::LVLEN0 | CTRL::Mask::LVLEN1
+                   | CTRL::Mask::LVLEN2 | CTRL::Mask::LVLEN3;
+}
+
+void Controller::disable() noexcept
+{
+    m_dmac->ctrl &= ~Peripheral::DMAC::CTRL::Mask::DMAENABLE;
+}
+
+auto Controller::allocate_channel() noexcept -> Channel
+{
+    auto channel = Channel{};
+    for ( ; channel < CHANNELS and allocated( channel ); ++channel ) {} // for
+
+    PICOLIBRARY_EXPECT( channel < CHANNELS, Generic_Error::INSUFFICIENT_CAPACITY );
+
+    m_allocated_channels |= std::uint32_t{ 1 } << channel;
+
+    m_descriptors[ channel ] = Descriptor{};
+    m_callback[ channel ]    = nullptr;
+    m_context[ channel ]     = nullptr;
+
+    return channel;
+}
+
+void Controller::release_channel( Channel channel ) noexcept
+{
+    PICOLIBRARY_EXPECT( allocated( channel ), Generic_Error::INVALID_ARGUMENT );
+
+    abort( channel );
+
+    m_allocated_channels &= ~( std::uint32_t{ 1 } << channel );
+}
+
+auto Controller::descriptor( Channel channel ) noexcept -> Descriptor &
+{
+    PICOLIBRARY_EXPECT( allocated( channel ), Generic_Error::INVALID_ARGUMENT );
+
+    return m_descriptors[ channel ];
+}
+
+auto Controller::allocate_descriptor() noexcept -> Descriptor &
+{
+    auto i = std::uint_fast8_t{};
+    for ( ; i < LINKED_DESCRIPTORS
+            and m_allocated_descriptors & ( std::uint32_t{ 1 } << i );
+          ++i ) {} // for
+
+    PICOLIBRARY_EXPECT( i < LINKED_DESCRIPTORS, Generic_Error::INSUFFICIENT_CAPACITY );
+
+    m_allocated_descriptors |= std::uint32_t{ 1 } << i;
+
+    m_linked_descriptors[ i ] = Descriptor{};
+
+    return m_linked_descriptors[ i ];
+}
+
+void Controller::release_descriptor( Descriptor const & descriptor ) noexcept
+{
+    auto const i = static_cast<std::uint_fast8_t>( &descriptor - m_linked_descriptors );
+
+    PICOLIBRARY_EXPECT(
+        i < LINKED_DESCRIPTORS and m_allocated_descriptors & ( std::uint32_t{ 1 } << i ),
+        Generic_Error::INVALID_ARGUMENT );
+
+    m_allocated_descriptors &= ~( std::uint32_t{ 1 } << i );
+}
+
+void Controller::configure_channel(
+    Channel       channel,
+    std::uint32_t chctrlb,
+    Callback      callback,
+    void *        context ) noexcept
+{
+    PICOLIBRARY_EXPECT( allocated( channel ), Generic_Error::INVALID_ARGUMENT );
+
+    m_callback[ channel ] = callback;
+    m_context[ channel ]  = context;
+
+    Interrupt::Critical_Section const critical_section;
+
+    m_dmac->chid    = channel;
+    m_dmac->chctrla = 0;
+    m_dmac->chctrla = Peripheral::DMAC::CHCTRLA::Mask::SWRST;
+
+    while ( m_dmac->chctrla & Peripheral::DMAC::CHCTRLA::Mask::SWRST ) {} // while
+
+    m_dmac->chctrlb = chctrlb;
+}
+
+void Controller::start( Channel channel ) noexcept
+{
+    PICOLIBRARY_EXPECT( allocated( channel ), Generic_Error::INVALID_ARGUMENT );
+
+    Interrupt::Critical_Section const critical_section;
+
+    m_dmac->chid       = channel;
+    m_dmac->chintflag  = Peripheral::DMAC::CHINTFLAG::Mask::TERR
+                        | Peripheral::DMAC::CHINTFLAG::Mask::TCMPL
+                        | Peripheral::DMAC::CHINTFLAG::Mask::SUSP;
+    m_dmac->chintenset = Peripheral::DMAC::CHINTENSET::Mask::TERR
+                         | Peripheral::DMAC::CHINTENSET::Mask::TCMPL;
+    m_dmac->chctrla    = Peripheral::DMAC::CHCTRLA::Mask::ENABLE;
+}
+
+void Controller::abort( Channel channel ) noexcept
+{
+    PICOLIBRARY_EXPECT( allocated( channel ), Generic_Error::INVALID_ARGUMENT );
+
+    Interrupt::Critical_Section const critical_section;
+
+    m_dmac->chid       = channel;
+    m_dmac->chctrla    = 0;
+    m_dmac->chintenclr = Peripheral::DMAC::CHINTENCLR::Mask::TERR
+                         | Peripheral::DMAC::CHINTENCLR::Mask::TCMPL
+                         | Peripheral::DMAC::CHINTENCLR::Mask::SUSP;
+    m_dmac->chintflag  = Peripheral::DMAC::CHINTFLAG::Mask::TERR
+                        | Peripheral::DMAC::CHINTFLAG::Mask::TCMPL
+                        | Peripheral::DMAC::CHINTFLAG::Mask::SUSP;
+}
+
+void Controller::trigger( Channel channel ) noexcept
+{
+    PICOLIBRARY_EXPECT( allocated( channel ), Generic_Error::INVALID_ARGUMENT );
+
+    Interrupt::Critical_Section const critical_section;
+
+    m_dmac->swtrigctrl |= std::uint32_t{ 1 } << channel;
+}
+
+auto Controller::busy( Channel channel ) const noexcept -> bool
+{
+    PICOLIBRARY_EXPECT( allocated( channel ), Generic_Error::INVALID_ARGUMENT );
+
+    return m_dmac->busych & ( std::uint32_t{ 1 } << channel );
+}
+
+auto Controller::remaining( Channel channel ) const noexcept -> std::uint16_t
+{
+    using ACTIVE = Peripheral::DMAC::ACTIVE;
+
+    PICOLIBRARY_EXPECT( allocated( channel ), Generic_Error::INVALID_ARGUMENT );
+
+    std::uint32_t const active = m_dmac->active;
+
+    if ( active & ACTIVE::Mask::ABUSY
+         and ( ( active & ACTIVE::Mask::ID ) >> ACTIVE::Bit::ID ) == channel ) {
+        return active >> ACTIVE::Bit::BTCNT;
+    } // if
+
+    // the write-back descriptor is written by the DMAC peripheral
+    std::uint16_t const volatile & btcnt = m_write_back[ channel ].btcnt;
+
+    return btcnt;
+}
+
+auto Controller::transfer_complete_pending( Channel channel ) const noexcept -> bool
+{
+    PICOLIBRARY_EXPECT( allocated( channel ), Generic_Error::INVALID_ARGUMENT );
+
+    Interrupt::Critical_Section const critical_section;
+
+    m_dmac->chid = channel;
+
+    return m_dmac->chintflag & Peripheral::DMAC::CHINTFLAG::Mask::TCMPL;
+}
+
+void Controller::handle_interrupt() noexcept
+{
+    using INTPEND = Peripheral::DMAC::INTPEND;
+
+    while ( m_dmac->intstatus ) {
+        std::uint16_t const intpend = m_dmac->intpend;
+
+        auto const channel = static_cast<Channel>(
+            ( intpend & INTPEND::Mask::ID ) >> INTPEND::Bit::ID );
+
+        // writing the channel ID back selects the channel, and writing the interrupt
+        // flags back clears them
+        m_dmac->intpend = intpend
+                          & ( INTPEND::Mask::ID | INTPEND::Mask::TERR
+                              | INTPEND::Mask::TCMPL | INTPEND::Mask::SUSP );
+
+        if ( channel >= CHANNELS or not m_callback[ channel ] ) {
+            continue;
+        } // if
+
+        if ( intpend & INTPEND::Mask::TERR ) {
+            m_callback[ channel ]( m_context[ channel ], Completion::TRANSFER_ERROR );
+        } else if ( intpend & INTPEND::Mask::TCMPL ) {
+            m_callback[ channel ]( m_context[ channel ], Completion::TRANSFER_COMPLETE );
+        } // else if
+    }     // while
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::DMA
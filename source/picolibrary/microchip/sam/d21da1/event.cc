@@ -0,0 +1,42 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Event implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/event.h"
+
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/peripheral/evsys.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Event {
+
+void Graph::configure( Peripheral::EVSYS & evsys ) const noexcept
+{
+    for ( auto i = std::uint_fast8_t{}; i < m_users; ++i ) {
+        evsys.user = m_user[ i ];
+    } // for
+
+    for ( auto i = std::uint_fast8_t{}; i < m_channels; ++i ) {
+        evsys.channel = m_channel[ i ];
+    } // for
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Event
@@ -0,0 +1,456 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::I2C implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/i2c.h"
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/sercom.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::I2C {
+
+namespace {
+
+/**
+ * \brief The maximum Fast-mode SCL frequency, in Hz.
+ */
+constexpr auto FAST_MODE_SCL_FREQUENCY_MAX = std::uint32_t{ 400000 };
+
+/**
+ * \brief The maximum Fast-mode Plus SCL frequency, in Hz.
+ */
+constexpr auto FASTPLUS_MODE_SCL_FREQUENCY_MAX = std::uint32_t{ 1000000 };
+
+} // namespace
+
+auto baud(
+    std::uint32_t gclk_frequency,
+    std::uint32_t scl_frequency,
+    std::uint32_t rise_time ) noexcept -> std::uint32_t
+{
+    PICOLIBRARY_EXPECT(
+        scl_frequency and scl_frequency <= FASTPLUS_MODE_SCL_FREQUENCY_MAX,
+        Generic_Error::INVALID_ARGUMENT );
+
+    // the SCL period (in GCLK cycles) is rounded up, and the rise time is rounded down,
+    // so that f_SCL does not exceed the desired SCL frequency
+    auto const period = ( std::uint64_t{ gclk_frequency } + scl_frequency - 1 )
+                        / scl_frequency;
+    auto const rise   = std::uint64_t{ gclk_frequency } * rise_time / 1000000000;
+
+    PICOLIBRARY_EXPECT( period >= 10 + rise, Generic_Error::INVALID_ARGUMENT );
+
+    auto const baud = ( period - 10 - rise + 1 ) / 2;
+
+    PICOLIBRARY_EXPECT( baud <= 255, Generic_Error::INVALID_ARGUMENT );
+
+    return baud;
+}
+
+void Master::enable(
+    std::uint32_t gclk_frequency,
+    std::uint32_t scl_frequency,
+    std::uint32_t rise_time ) noexcept
+{
+    using I2CM = Peripheral::SERCOM::I2CM;
+
+    auto & i2cm = m_sercom->i2cm;
+
+    i2cm.ctrla = I2CM::CTRLA::Mask::SWRST;
+
+    while ( i2cm.syncbusy & I2CM::SYNCBUSY::Mask::SWRST ) {} // while
+
+    i2cm.ctrla = I2CM::CTRLA::MODE_I2C_MASTER
+                 | ( scl_frequency > FAST_MODE_SCL_FREQUENCY_MAX
+                         ? I2CM::CTRLA::SPEED_FASTPLUS_MODE
+                         : I2CM::CTRLA::SPEED_STANDARD_AND_FAST_MODE )
+                 | I2CM::CTRLA::SDAHOLD_450NS | I2CM::CTRLA::INACTOUT_205US
+                 | I2CM::CTRLA::Mask::LOWTOUTEN;
+    i2cm.baud  = baud( gclk_frequency, scl_frequency, rise_time );
+
+    command( I2CM::CTRLB::ACKACT_ACK );
+
+    i2cm.ctrla |= I2CM::CTRLA::Mask::ENABLE;
+
+    while ( i2cm.syncbusy & I2CM::SYNCBUSY::Mask::ENABLE ) {} // while
+
+    // the bus state is unknown until a stop condition is detected or the bus state is
+    // forced to idle
+    i2cm.status = I2CM::STATUS::BUSSTATE_IDLE;
+
+    while ( i2cm.syncbusy & I2CM::SYNCBUSY::Mask::SYSOP ) {} // while
+
+    i2cm.intenset = I2CM::INTENSET::Mask::MB | I2CM::INTENSET::Mask::SB
+                    | I2CM::INTENSET::Mask::ERROR;
+}
+
+auto Master::submit( Transaction const & transaction ) noexcept -> bool
+{
+    std::uint8_t const tail = m_tail;
+
+    if ( static_cast<std::uint8_t>( tail - m_head ) >= QUEUE_CAPACITY ) {
+        return false;
+    } // if
+
+    m_queue[ tail % QUEUE_CAPACITY ] = transaction;
+
+    Interrupt::Critical_Section const critical_section;
+
+    m_tail = tail + 1;
+
+    if ( not m_busy ) {
+        m_busy = true;
+
+        start();
+    } // if
+
+    return true;
+}
+
+void Master::handle_interrupt() noexcept
+{
+    using I2CM = Peripheral::SERCOM::I2CM;
+
+    auto & i2cm = m_sercom->i2cm;
+
+    std::uint8_t const  intflag = i2cm.intflag;
+    std::uint16_t const status  = i2cm.status;
+
+    if ( not m_busy ) {
+        i2cm.intflag = I2CM::INTFLAG::Mask::MB | I2CM::INTFLAG::Mask::SB
+                       | I2CM::INTFLAG::Mask::ERROR;
+
+        return;
+    } // if
+
+    if ( status & I2CM::STATUS::Mask::BUSERR
+         or ( intflag & I2CM::INTFLAG::Mask::ERROR
+              and not( status & I2CM::STATUS::Mask::ARBLOST ) ) ) {
+        // abort the transaction and force the bus state to idle so that the next
+        // transaction can be started
+        i2cm.status = I2CM::STATUS::Mask::BUSERR | I2CM::STATUS::Mask::ARBLOST
+                      | I2CM::STATUS::Mask::LOWTOUT | I2CM::STATUS::Mask::MEXTTOUT
+                      | I2CM::STATUS::Mask::SEXTTOUT | I2CM::STATUS::BUSSTATE_IDLE;
+
+        while ( i2cm.syncbusy & I2CM::SYNCBUSY::Mask::SYSOP ) {} // while
+
+        i2cm.intflag = I2CM::INTFLAG::Mask::MB | I2CM::INTFLAG::Mask::SB
+                       | I2CM::INTFLAG::Mask::ERROR;
+
+        complete( Result::BUS_ERROR );
+
+        return;
+    } // if
+
+    if ( status & I2CM::STATUS::Mask::ARBLOST ) {
+        // another master owns the bus, which releases it when its transaction is done,
+        // so the transaction is restarted (writing ADDR waits for the bus to be idle)
+        i2cm.intflag = I2CM::INTFLAG::Mask::MB | I2CM::INTFLAG::Mask::ERROR;
+
+        if ( m_retries < ARBITRATION_RETRIES ) {
+            ++m_retries;
+
+            start();
+        } else {
+            complete( Result::ARBITRATION_LOST );
+        } // else
+
+        return;
+    } // if
+
+    auto const & transaction = m_queue[ m_head % QUEUE_CAPACITY ];
+
+    if ( intflag & I2CM::INTFLAG::Mask::MB ) {
+        if ( status & I2CM::STATUS::Mask::RXNACK ) {
+            command( I2CM::CTRLB::CMD_STOP );
+
+            complete( Result::NACK );
+
+            return;
+        } // if
+
+        if ( m_transferred < transaction.write_size ) {
+            i2cm.data = transaction.write_data[ m_transferred ];
+
+            ++m_transferred;
+
+            while ( i2cm.syncbusy & I2CM::SYNCBUSY::Mask::SYSOP ) {} // while
+
+            return;
+        } // if
+
+        if ( transaction.read_size ) {
+            m_transferred = 0;
+
+            i2cm.addr = ( transaction.address << 1 ) | 0b1;
+
+            while ( i2cm.syncbusy & I2CM::SYNCBUSY::Mask::SYSOP ) {} // while
+
+            return;
+        } // if
+
+        command( I2CM::CTRLB::CMD_STOP );
+
+        complete( Result::COMPLETE );
+
+        return;
+    } // if
+
+    if ( intflag & I2CM::INTFLAG::Mask::SB ) {
+        auto const last = m_transferred + 1 >= transaction.read_size;
+
+        // in Smart Mode, reading DATA executes the acknowledge action and, unless the
+        // stop condition has been issued, starts the reception of the next byte
+        if ( last ) {
+            command( I2CM::CTRLB::ACKACT_NACK | I2CM::CTRLB::CMD_STOP );
+        } // if
+
+        transaction.read_data[ m_transferred ] = i2cm.data;
+
+        ++m_transferred;
+
+        while ( i2cm.syncbusy & I2CM::SYNCBUSY::Mask::SYSOP ) {} // while
+
+        if ( last ) {
+            complete( Result::COMPLETE );
+        } // if
+    }     // if
+}
+
+void Master::start() noexcept
+{
+    using I2CM = Peripheral::SERCOM::I2CM;
+
+    auto & i2cm = m_sercom->i2cm;
+
+    auto const & transaction = m_queue[ m_head % QUEUE_CAPACITY ];
+
+    m_transferred = 0;
+
+    // the previous read may have left the acknowledge action set to not acknowledge
+    command( I2CM::CTRLB::ACKACT_ACK );
+
+    // a transaction that neither writes nor reads probes the device with a write
+    // address
+    i2cm.addr = ( transaction.address << 1 )
+                | ( transaction.write_size or not transaction.read_size ? 0b0 : 0b1 );
+
+    while ( i2cm.syncbusy & I2CM::SYNCBUSY::Mask::SYSOP ) {} // while
+}
+
+void Master::command( std::uint32_t ctrlb ) noexcept
+{
+    using I2CM = Peripheral::SERCOM::I2CM;
+
+    auto & i2cm = m_sercom->i2cm;
+
+    i2cm.ctrlb = I2CM::CTRLB::Mask::SMEN | ctrlb;
+
+    while ( i2cm.syncbusy & I2CM::SYNCBUSY::Mask::SYSOP ) {} // while
+}
+
+void Master::complete( Result result ) noexcept
+{
+    auto const & transaction = m_queue[ m_head % QUEUE_CAPACITY ];
+
+    auto const callback = transaction.callback;
+    auto const context  = transaction.context;
+
+    m_head    = m_head + 1;
+    m_retries = 0;
+
+    if ( m_head != m_tail ) {
+        start();
+    } else {
+        m_busy = false;
+    } // else
+
+    if ( callback ) {
+        callback( context, result );
+    } // if
+}
+
+Client::Client(
+    Peripheral::SERCOM & sercom,
+    std::uint8_t *       registers,
+    std::uint16_t        size,
+    Write_Callback       write_callback,
+    void *               context ) noexcept :
+    m_sercom{ &sercom },
+    m_registers{ registers },
+    m_size{ size },
+    m_write_callback{ write_callback },
+    m_context{ context }
+{
+    PICOLIBRARY_EXPECT(
+        size > 0 and size <= REGISTER_FILE_SIZE_MAX, Generic_Error::INVALID_ARGUMENT );
+}
+
+void Client::enable(
+    std::uint8_t                           address,
+    Peripheral::SERCOM::I2CS::CTRLA::SPEED speed ) noexcept
+{
+    using I2CS = Peripheral::SERCOM::I2CS;
+
+    auto & i2cs = m_sercom->i2cs;
+
+    i2cs.ctrla = I2CS::CTRLA::Mask::SWRST;
+
+    while ( i2cs.syncbusy & I2CS::SYNCBUSY::Mask::SWRST ) {} // while
+
+    i2cs.ctrla = I2CS::CTRLA::MODE_I2C_SLAVE | speed | I2CS::CTRLA::SDAHOLD_450NS
+                 | I2CS::CTRLA::Mask::LOWTOUTEN;
+    i2cs.addr  = ( std::uint32_t{ address } << I2CS::ADDR::Bit::ADDR )
+                & I2CS::ADDR::Mask::ADDR;
+
+    command( I2CS::CTRLB::ACKACT_ACK );
+
+    i2cs.intenset = I2CS::INTENSET::Mask::PREC | I2CS::INTENSET::Mask::AMATCH
+                    | I2CS::INTENSET::Mask::DRDY | I2CS::INTENSET::Mask::ERROR;
+
+    i2cs.ctrla |= I2CS::CTRLA::Mask::ENABLE;
+
+    while ( i2cs.syncbusy & I2CS::SYNCBUSY::Mask::ENABLE ) {} // while
+}
+
+void Client::handle_interrupt() noexcept
+{
+    using I2CS = Peripheral::SERCOM::I2CS;
+
+    auto & i2cs = m_sercom->i2cs;
+
+    std::uint8_t const  intflag = i2cs.intflag;
+    std::uint16_t const status  = i2cs.status;
+
+    if ( intflag & I2CS::INTFLAG::Mask::ERROR ) {
+        i2cs.status  = I2CS::STATUS::Mask::BUSERR | I2CS::STATUS::Mask::COLL
+                      | I2CS::STATUS::Mask::LOWTOUT | I2CS::STATUS::Mask::SEXTTOUT;
+        i2cs.intflag = I2CS::INTFLAG::Mask::ERROR;
+
+        m_pointer_pending = false;
+
+        notify();
+
+        return;
+    } // if
+
+    if ( intflag & I2CS::INTFLAG::Mask::PREC ) {
+        i2cs.intflag = I2CS::INTFLAG::Mask::PREC;
+
+        notify();
+    } // if
+
+    if ( intflag & I2CS::INTFLAG::Mask::AMATCH ) {
+        m_pointer_pending = not( status & I2CS::STATUS::Mask::DIR );
+        m_transmitted     = false;
+
+        command( I2CS::CTRLB::ACKACT_ACK | I2CS::CTRLB::CMD_RESPONSE );
+
+        return;
+    } // if
+
+    if ( not( intflag & I2CS::INTFLAG::Mask::DRDY ) ) {
+        return;
+    } // if
+
+    // in Smart Mode, accessing DATA executes the acknowledge action and starts the
+    // transfer of the next byte
+    if ( status & I2CS::STATUS::Mask::DIR ) {
+        if ( m_transmitted and status & I2CS::STATUS::Mask::RXNACK ) {
+            command( I2CS::CTRLB::CMD_COMPLETE );
+
+            return;
+        } // if
+
+        m_transmitted = true;
+
+        std::uint16_t const pointer = m_pointer;
+
+        if ( pointer < m_size ) {
+            i2cs.data = m_registers[ pointer ];
+
+            m_pointer = pointer + 1;
+        } else {
+            i2cs.data = 0xFF;
+        } // else
+
+        return;
+    } // if
+
+    if ( m_pointer_pending ) {
+        m_pointer_pending = false;
+
+        m_pointer = i2cs.data;
+
+        return;
+    } // if
+
+    std::uint16_t const pointer = m_pointer;
+
+    if ( pointer >= m_size ) {
+        command( I2CS::CTRLB::ACKACT_NACK );
+
+        std::uint8_t const discarded = i2cs.data;
+        static_cast<void>( discarded );
+
+        return;
+    } // if
+
+    m_registers[ pointer ] = i2cs.data;
+
+    m_pointer = pointer + 1;
+
+    if ( not m_written_end ) {
+        m_written_first = pointer;
+        m_written_end   = pointer + 1;
+    } else if ( pointer < m_written_first ) {
+        m_written_first = pointer;
+    } else if ( pointer >= m_written_end ) {
+        m_written_end = pointer + 1;
+    } // else if
+}
+
+void Client::command( std::uint32_t ctrlb ) noexcept
+{
+    m_sercom->i2cs.ctrlb = Peripheral::SERCOM::I2CS::CTRLB::Mask::SMEN | ctrlb;
+}
+
+void Client::notify() noexcept
+{
+    if ( not m_written_end ) {
+        return;
+    } // if
+
+    auto const offset = static_cast<std::uint8_t>( m_written_first );
+    auto const size   = static_cast<std::uint16_t>( m_written_end - m_written_first );
+
+    m_written_end = 0;
+
+    if ( m_write_callback ) {
+        m_write_callback( m_context, offset, size );
+    } // if
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::I2C
@@ -21,3 +21,74 @@
  */
 
 #include "picolibrary/microchip/sam/d21da1/interrupt.h"
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
+
+static_assert( sizeof( Exception_Frame ) == 8 * sizeof( std::uint32_t ) );
+
+namespace {
+
+/**
+ * \brief Hard fault record signature.
+ */
+constexpr auto HARD_FAULT_SIGNATURE = std::uint32_t{ 0x48464C54 };
+
+/**
+ * \brief Hard fault record.
+ */
+struct Hard_Fault_Record {
+    /**
+     * \brief The record signature (HARD_FAULT_SIGNATURE if the record is present).
+     */
+    std::uint32_t signature;
+
+    /**
+     * \brief The exception stack frame of the faulting context.
+     */
+    Exception_Frame frame;
+};
+
+/**
+ * \brief The hard fault record.
+ */
+__attribute__( ( section( ".noinit" ) ) ) Hard_Fault_Record hard_fault;
+
+} // namespace
+
+auto hard_fault_record() noexcept -> Exception_Frame const *
+{
+    return hard_fault.signature == HARD_FAULT_SIGNATURE ? &hard_fault.frame : nullptr;
+}
+
+void clear_hard_fault_record() noexcept
+{
+    hard_fault.signature = 0;
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
+
+extern "C" void picolibrary_microchip_sam_d21da1_interrupt_record_hard_fault(
+    ::picolibrary::Microchip::SAM::D21DA1::Interrupt::Exception_Frame const *
+        frame ) noexcept
+{
+    using ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB;
+    using ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB0;
+    using namespace ::picolibrary::Microchip::SAM::D21DA1::Interrupt;
+
+    hard_fault.frame     = *frame;
+    hard_fault.signature = HARD_FAULT_SIGNATURE;
+
+    // the record must be written before the reset is requested
+    asm volatile( "dsb\n" : : : "memory" );
+
+    SCB0::instance().aircr = ( std::uint32_t{ 0x05FA } << SCB::AIRCR::Bit::VECTKEY )
+                             | SCB::AIRCR::Mask::SYSRESETREQ;
+
+    asm volatile( "dsb\n" : : : "memory" );
+
+    for ( ;; ) {} // for
+}
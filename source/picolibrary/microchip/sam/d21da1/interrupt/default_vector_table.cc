@@ -27,6 +27,8 @@
 
 #include "picolibrary/arm/cortex/m0plus/interrupt.h"
 #include "picolibrary/arm/cortex/m0plus/peripheral.h"
+#include "picolibrary/microchip/sam/d21da1/boot_profiler.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt/instrumentation.h"
 #include "picolibrary/microchip/sam/d21da1/peripheral.h"
 #include "picolibrary/microchip/sam/d21da1/peripheral/nvmctrl.h"
 
@@ -35,8 +37,120 @@ extern std::uint32_t _data_start;
 extern std::uint32_t _data_end;
 extern std::uint32_t _bss_start;
 extern std::uint32_t _bss_end;
+#ifdef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_BSS_NOCLEAR
+extern std::uint32_t _bss_noclear_start;
+extern std::uint32_t _bss_noclear_end;
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_BSS_NOCLEAR
 extern std::uint32_t _vector_table;
 
+#ifdef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_RAM_VECTOR_TABLE
+namespace {
+
+/**
+ * \brief SRAM vector table.
+ *
+ * \attention VTOR requires the vector table to be aligned to the next power of two that
+ *            is greater than or equal to the vector table size.
+ */
+alignas( 256 ) ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table
+    ram_vector_table;
+
+static_assert( sizeof( ram_vector_table ) <= 256 );
+
+} // namespace
+
+namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
+
+void install_handler( Vector entry, Handler handler ) noexcept
+{
+    ram_vector_table.*entry = handler;
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_RAM_VECTOR_TABLE
+
+namespace {
+
+/**
+ * \brief Copy words from flash to SRAM.
+ *
+ * Four words are copied per iteration so that the copy can be performed using multiple
+ * register loads and stores (LDM/STM).
+ *
+ * \param[in] destination The start of the SRAM region to copy to.
+ * \param[in] destination_end The end of the SRAM region to copy to.
+ * \param[in] source The start of the flash region to copy from.
+ */
+__attribute__( ( always_inline ) ) inline void copy_words(
+    std::uint32_t *             destination,
+    std::uint32_t const * const destination_end,
+    std::uint32_t const *       source ) noexcept
+{
+    if ( destination == source ) {
+        return;
+    } // if
+
+    for ( ; destination_end - destination >= 4; destination += 4, source += 4 ) {
+        auto const word_0 = source[ 0 ];
+        auto const word_1 = source[ 1 ];
+        auto const word_2 = source[ 2 ];
+        auto const word_3 = source[ 3 ];
+
+        destination[ 0 ] = word_0;
+        destination[ 1 ] = word_1;
+        destination[ 2 ] = word_2;
+        destination[ 3 ] = word_3;
+    } // for
+
+    for ( ; destination != destination_end; ++destination, ++source ) {
+        *destination = *source;
+    } // for
+}
+
+/**
+ * \brief Zero words in SRAM.
+ *
+ * Four words are zeroed per iteration so that the zeroing can be performed using multiple
+ * register stores (STM).
+ *
+ * \param[in] destination The start of the SRAM region to zero.
+ * \param[in] destination_end The end of the SRAM region to zero.
+ */
+__attribute__( ( always_inline ) ) inline void zero_words(
+    std::uint32_t *             destination,
+    std::uint32_t const * const destination_end ) noexcept
+{
+    for ( ; destination_end - destination >= 4; destination += 4 ) {
+        destination[ 0 ] = 0;
+        destination[ 1 ] = 0;
+        destination[ 2 ] = 0;
+        destination[ 3 ] = 0;
+    } // for
+
+    for ( ; destination != destination_end; ++destination ) { *destination = 0; } // for
+}
+
+/**
+ * \brief Record a boot phase checkpoint if boot profiling is enabled.
+ *
+ * \param[in] phase The boot phase.
+ */
+__attribute__( ( always_inline ) ) inline void profile_boot_phase(
+    ::picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::Phase phase ) noexcept
+{
+#ifdef PICOLIBRARY_MICROCHIP_SAM_D21DA1_BOOT_PROFILER
+    if ( phase == ::picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::Phase::RESET ) {
+        ::picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::start();
+    } else {
+        ::picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::stamp( phase );
+    } // else
+#else  // PICOLIBRARY_MICROCHIP_SAM_D21DA1_BOOT_PROFILER
+    static_cast<void>( phase );
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_BOOT_PROFILER
+}
+
+} // namespace
+
 void __libc_init_array();
 
 int main();
@@ -45,35 +159,50 @@ extern "C" void picolibrary_microchip_sam_d21da1_interrupt_handle_reset_default(
 {
     // #lizard forgives the length
 
-    {
-        auto const *       data_flash_start = &_data_flash_start;
-        auto *             data_start       = &_data_start;
-        auto const * const data_end         = &_data_end;
-
-        if ( data_start != data_flash_start ) {
-            for ( ; data_start != data_end; ++data_flash_start, ++data_start ) {
-                *data_start = *data_flash_start;
-            } // if
-        }     // if
-    }
+    using ::picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::Phase;
+
+    profile_boot_phase( Phase::RESET );
+
+    copy_words( &_data_start, &_data_end, &_data_flash_start );
 
+    profile_boot_phase( Phase::DATA_COPIED );
+
+#ifdef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_BSS_NOCLEAR
+    zero_words( &_bss_start, &_bss_noclear_start );
+    zero_words( &_bss_noclear_end, &_bss_end );
+#else  // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_BSS_NOCLEAR
+    zero_words( &_bss_start, &_bss_end );
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_BSS_NOCLEAR
+
+    profile_boot_phase( Phase::BSS_ZEROED );
+
+    static_assert( sizeof( std::uint32_t * ) == sizeof( std::uint32_t ) );
+#ifdef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_RAM_VECTOR_TABLE
     {
-        auto *             bss_start = &_bss_start;
-        auto const * const bss_end   = &_bss_end;
+        using ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table;
 
-        for ( ; bss_start != bss_end; ++bss_start ) { *bss_start = 0; } // for
+        ram_vector_table = *reinterpret_cast<Vector_Table const *>( &_vector_table );
     }
 
-    static_assert( sizeof( std::uint32_t * ) == sizeof( std::uint32_t ) );
+    ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB0::instance().vtor =
+        reinterpret_cast<std::uint32_t>( &ram_vector_table );
+#else  // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_RAM_VECTOR_TABLE
     ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB0::instance().vtor =
         reinterpret_cast<std::uint32_t>( &_vector_table );
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_RAM_VECTOR_TABLE
+
+    profile_boot_phase( Phase::VTOR_SET );
 
     // Silicon errata workaround ("Spurious Writes")
     ::picolibrary::Microchip::SAM::D21DA1::Peripheral::NVMCTRL0::instance().ctrlb |=
         ::picolibrary::Microchip::SAM::D21DA1::Peripheral::NVMCTRL::CTRLB::Mask::MANW;
 
+    profile_boot_phase( Phase::NVM_ERRATA_APPLIED );
+
     __libc_init_array();
 
+    profile_boot_phase( Phase::MAIN );
+
     main();
 
     for ( ;; ) {} // for
@@ -174,61 +303,76 @@ void handle_tcc3() HANDLE_INTERRUPT_DEFAULT_WEAK_ALIAS;
 
 } // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
 
-extern std::uint32_t _stack_end;
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_OMIT_DEFAULT_VECTOR_TABLE
+#ifdef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_INSTRUMENTATION
+namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
+namespace {
+
+/**
+ * \brief Generate the instrumented default vector table.
+ *
+ * \return The instrumented default vector table.
+ */
+constexpr auto instrumented_default_vector_table() noexcept
+    -> ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table
+{
+    using ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table;
+
+    // the WDT early warning handler is naked (it reads the interrupted context's
+    // exception frame), so it must be entered directly from the vector table
+    return make_vector_table<
+        Binding<&Vector_Table::pendsv_handler, Instrumented_Handler<handle_pendsv, 0>>,
+        Binding<
+            &Vector_Table::systick0_handler,
+            Instrumented_Handler<handle_systick0, 1>>,
+        Binding<&Vector_Table::pm0_handler, Instrumented_Handler<handle_pm0, 2>>,
+        Binding<
+            &Vector_Table::sysctrl0_handler,
+            Instrumented_Handler<handle_sysctrl0, 3>>,
+        Binding<&Vector_Table::rtc0_handler, Instrumented_Handler<handle_rtc0, 5>>,
+        Binding<&Vector_Table::eic0_handler, Instrumented_Handler<handle_eic0, 6>>,
+        Binding<
+            &Vector_Table::nvmctrl0_handler,
+            Instrumented_Handler<handle_nvmctrl0, 7>>,
+        Binding<&Vector_Table::dmac0_handler, Instrumented_Handler<handle_dmac0, 8>>,
+        Binding<&Vector_Table::usb0_handler, Instrumented_Handler<handle_usb0, 9>>,
+        Binding<&Vector_Table::evsys0_handler, Instrumented_Handler<handle_evsys0, 10>>,
+        Binding<&Vector_Table::sercom0_handler, Instrumented_Handler<handle_sercom0, 11>>,
+        Binding<&Vector_Table::sercom1_handler, Instrumented_Handler<handle_sercom1, 12>>,
+        Binding<&Vector_Table::sercom2_handler, Instrumented_Handler<handle_sercom2, 13>>,
+        Binding<&Vector_Table::sercom3_handler, Instrumented_Handler<handle_sercom3, 14>>,
+        Binding<&Vector_Table::sercom4_handler, Instrumented_Handler<handle_sercom4, 15>>,
+        Binding<&Vector_Table::sercom5_handler, Instrumented_Handler<handle_sercom5, 16>>,
+        Binding<&Vector_Table::tcc0_handler, Instrumented_Handler<handle_tcc0, 17>>,
+        Binding<&Vector_Table::tcc1_handler, Instrumented_Handler<handle_tcc1, 18>>,
+        Binding<&Vector_Table::tcc2_handler, Instrumented_Handler<handle_tcc2, 19>>,
+        Binding<&Vector_Table::tc3_handler, Instrumented_Handler<handle_tc3, 20>>,
+        Binding<&Vector_Table::tc4_handler, Instrumented_Handler<handle_tc4, 21>>,
+        Binding<&Vector_Table::tc5_handler, Instrumented_Handler<handle_tc5, 22>>,
+        Binding<&Vector_Table::tc6_handler, Instrumented_Handler<handle_tc6, 23>>,
+        Binding<&Vector_Table::tc7_handler, Instrumented_Handler<handle_tc7, 24>>,
+        Binding<&Vector_Table::adc0_handler, Instrumented_Handler<handle_adc0, 25>>,
+        Binding<&Vector_Table::ac0_handler, Instrumented_Handler<handle_ac0, 26>>,
+        Binding<&Vector_Table::dac0_handler, Instrumented_Handler<handle_dac0, 27>>,
+        Binding<&Vector_Table::ptc0_handler, Instrumented_Handler<handle_ptc0, 28>>,
+        Binding<&Vector_Table::i2s0_handler, Instrumented_Handler<handle_i2s0, 29>>,
+        Binding<&Vector_Table::ac1_handler, Instrumented_Handler<handle_ac1, 30>>,
+        Binding<&Vector_Table::tcc3_handler, Instrumented_Handler<handle_tcc3, 31>>>(
+        default_vector_table() );
+}
+
+} // namespace
+} // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_INSTRUMENTATION
 
 namespace {
 
-auto const VECTOR_TABLE __attribute__( (
-    section( ".vectors" ) ) ) = ::picolibrary::Arm::Cortex::M0PLUS::Interrupt::Vector_Table{
-    .stack = &_stack_end,
-
-    .reset_handler = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_reset,
-
-    .nmi_handler        = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_nmi,
-    .hard_fault_handler = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_hard_fault,
-    .reserved_n12       = nullptr,
-    .reserved_n11       = nullptr,
-    .reserved_n10       = nullptr,
-    .reserved_n9        = nullptr,
-    .reserved_n8        = nullptr,
-    .reserved_n7        = nullptr,
-    .reserved_n6        = nullptr,
-    .svcall_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_svcall,
-    .reserved_n4        = nullptr,
-    .reserved_n3        = nullptr,
-    .pendsv_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_pendsv,
-    .systick0_handler = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_systick0,
-
-    .pm0_handler      = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_pm0,
-    .sysctrl0_handler = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_sysctrl0,
-    .wdt0_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_wdt0,
-    .rtc0_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_rtc0,
-    .eic0_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_eic0,
-    .nvmctrl0_handler = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_nvmctrl0,
-    .dmac0_handler    = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_dmac0,
-    .usb0_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_usb0,
-    .evsys0_handler   = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_evsys0,
-    .sercom0_handler  = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_sercom0,
-    .sercom1_handler  = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_sercom1,
-    .sercom2_handler  = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_sercom2,
-    .sercom3_handler  = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_sercom3,
-    .sercom4_handler  = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_sercom4,
-    .sercom5_handler  = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_sercom5,
-    .tcc0_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_tcc0,
-    .tcc1_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_tcc1,
-    .tcc2_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_tcc2,
-    .tc3_handler      = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_tc3,
-    .tc4_handler      = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_tc4,
-    .tc5_handler      = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_tc5,
-    .tc6_handler      = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_tc6,
-    .tc7_handler      = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_tc7,
-    .adc0_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_adc0,
-    .ac0_handler      = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_ac0,
-    .dac0_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_dac0,
-    .ptc0_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_ptc0,
-    .i2s0_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_i2s0,
-    .ac1_handler      = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_ac1,
-    .tcc3_handler     = ::picolibrary::Microchip::SAM::D21DA1::Interrupt::handle_tcc3,
-};
+auto const VECTOR_TABLE __attribute__( ( section( ".vectors" ) ) ) =
+#ifdef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_INSTRUMENTATION
+    ::picolibrary::Microchip::SAM::D21DA1::Interrupt::instrumented_default_vector_table();
+#else  // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_INSTRUMENTATION
+    ::picolibrary::Microchip::SAM::D21DA1::Interrupt::default_vector_table();
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_INSTRUMENTATION
 
 } // namespace
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_OMIT_DEFAULT_VECTOR_TABLE
@@ -0,0 +1,51 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Interrupt hard fault handler
+ *        implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt/default_vector_table.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
+
+/**
+ * \brief Handle hard fault (record the hard fault and reset the system).
+ *
+ * The exception stack frame of the faulting context is located using EXC_RETURN bit 2
+ * (set if the faulting context was using the process stack) and passed to
+ * picolibrary_microchip_sam_d21da1_interrupt_record_hard_fault(), which does not return.
+ */
+__attribute__( ( naked ) ) void handle_hard_fault() noexcept
+{
+    asm volatile(
+        "movs r0, #4\n"
+        "mov r1, lr\n"
+        "tst r0, r1\n"
+        "beq 1f\n"
+        "mrs r0, psp\n"
+        "b 2f\n"
+        "1:\n"
+        "mrs r0, msp\n"
+        "2:\n"
+        "bl picolibrary_microchip_sam_d21da1_interrupt_record_hard_fault\n" );
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
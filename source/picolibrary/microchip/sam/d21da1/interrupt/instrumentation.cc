@@ -0,0 +1,151 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Interrupt instrumentation implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/interrupt/instrumentation.h"
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral.h"
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/stream.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
+
+namespace {
+
+/**
+ * \brief Instrumented vector names.
+ */
+char const * const VECTOR_NAMES[ INSTRUMENTED_VECTORS ] = {
+    "PENDSV",  "SYSTICK", "PM",      "SYSCTRL", "WDT",     "RTC",     "EIC",
+    "NVMCTRL", "DMAC",    "USB",     "EVSYS",   "SERCOM0", "SERCOM1", "SERCOM2",
+    "SERCOM3", "SERCOM4", "SERCOM5", "TCC0",    "TCC1",    "TCC2",    "TC3",
+    "TC4",     "TC5",     "TC6",     "TC7",     "ADC",     "AC",      "DAC",
+    "PTC",     "I2S",     "AC1",     "TCC3",
+};
+
+/**
+ * \brief Handler statistics.
+ */
+Handler_Statistics statistics[ INSTRUMENTED_VECTORS ];
+
+/**
+ * \brief Write an unsigned integer to a stream in decimal.
+ *
+ * \param[in] stream The stream to write the unsigned integer to.
+ * \param[in] value The unsigned integer to write.
+ */
+void put_decimal( Reliable_Output_Stream & stream, std::uint64_t value ) noexcept
+{
+    char digits[ 20 ];
+    auto n = std::uint_fast8_t{};
+
+    do {
+        digits[ n ] = static_cast<char>( '0' + value % 10 );
+        ++n;
+        value /= 10;
+    } while ( value );
+
+    while ( n ) {
+        --n;
+        stream.put( digits[ n ] );
+    } // while
+}
+
+} // namespace
+
+void start_instrumentation(
+    ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SYSTICK & systick ) noexcept
+{
+    using ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SYSTICK;
+
+    if ( systick.csr & SYSTICK::CSR::Mask::ENABLE ) {
+        return;
+    } // if
+
+    systick.rvr = SYSTICK::RVR::Mask::RELOAD;
+    systick.cvr = 0;
+    systick.csr = SYSTICK::CSR::Mask::CLKSOURCE | SYSTICK::CSR::Mask::ENABLE;
+}
+
+void record_handler_execution( Instrumented_Vector vector, std::uint32_t start ) noexcept
+{
+    auto & systick = ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SYSTICK0::instance();
+
+    std::uint32_t const end    = systick.cvr;
+    std::uint32_t const period = systick.rvr + 1;
+
+    // SysTick counts down
+    auto const cycles = start >= end ? start - end : start + period - end;
+
+    Critical_Section const critical_section;
+
+    auto & vector_statistics = statistics[ vector ];
+
+    ++vector_statistics.count;
+    vector_statistics.cycles += cycles;
+    if ( cycles > vector_statistics.max_cycles ) {
+        vector_statistics.max_cycles = cycles;
+    } // if
+}
+
+auto handler_statistics( Instrumented_Vector vector ) noexcept -> Handler_Statistics
+{
+    PICOLIBRARY_EXPECT( vector < INSTRUMENTED_VECTORS, Generic_Error::INVALID_ARGUMENT );
+
+    Critical_Section const critical_section;
+
+    return statistics[ vector ];
+}
+
+void reset_handler_statistics() noexcept
+{
+    Critical_Section const critical_section;
+
+    for ( auto & vector_statistics : statistics ) {
+        vector_statistics = Handler_Statistics{};
+    } // for
+}
+
+void dump_handler_statistics( Reliable_Output_Stream & stream ) noexcept
+{
+    for ( auto vector = Instrumented_Vector{}; vector < INSTRUMENTED_VECTORS; ++vector ) {
+        auto const vector_statistics = handler_statistics( vector );
+
+        if ( not vector_statistics.count ) {
+            continue;
+        } // if
+
+        stream.put( VECTOR_NAMES[ vector ] );
+        stream.put( ' ' );
+        put_decimal( stream, vector_statistics.count );
+        stream.put( ' ' );
+        put_decimal( stream, vector_statistics.cycles );
+        stream.put( ' ' );
+        put_decimal( stream, vector_statistics.max_cycles );
+        stream.put( '\n' );
+    } // for
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
@@ -0,0 +1,139 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::NVM implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/nvm.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/nvmctrl.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::NVM {
+
+namespace {
+
+/**
+ * \brief Wait for an NVMCTRL peripheral to be ready to accept a new command.
+ *
+ * \param[in] nvmctrl The NVMCTRL peripheral.
+ */
+void wait_for_ready( Peripheral::NVMCTRL const & nvmctrl ) noexcept
+{
+    while ( not( nvmctrl.intflag & Peripheral::NVMCTRL::INTFLAG::Mask::READY ) ) {
+    } // while
+}
+
+/**
+ * \brief Execute an NVMCTRL peripheral command.
+ *
+ * \param[in] nvmctrl The NVMCTRL peripheral.
+ * \param[in] cmd The command to execute.
+ */
+void execute(
+    Peripheral::NVMCTRL & nvmctrl, Peripheral::NVMCTRL::CTRLA::CMD cmd ) noexcept
+{
+    nvmctrl.ctrla = cmd | Peripheral::NVMCTRL::CTRLA::CMDEX_KEY;
+
+    wait_for_ready( nvmctrl );
+}
+
+/**
+ * \brief Execute an NVMCTRL peripheral command that operates on an address.
+ *
+ * \param[in] nvmctrl The NVMCTRL peripheral.
+ * \param[in] cmd The command to execute.
+ * \param[in] address The address the command operates on.
+ */
+void execute(
+    Peripheral::NVMCTRL &           nvmctrl,
+    Peripheral::NVMCTRL::CTRLA::CMD cmd,
+    std::uint32_t                   address ) noexcept
+{
+    // the ADDR register holds a 16-bit word address
+    nvmctrl.addr = address / 2;
+
+    execute( nvmctrl, cmd );
+}
+
+} // namespace
+
+void erase_row( Peripheral::NVMCTRL & nvmctrl, std::uint32_t address ) noexcept
+{
+    PICOLIBRARY_EXPECT( address % ROW_SIZE == 0, Generic_Error::INVALID_ARGUMENT );
+
+    wait_for_ready( nvmctrl );
+
+    execute(
+        nvmctrl,
+        address >= RWWEE_ADDRESS ? Peripheral::NVMCTRL::CTRLA::CMD_RWWEEER
+                                 : Peripheral::NVMCTRL::CTRLA::CMD_ER,
+        address );
+}
+
+void write(
+    Peripheral::NVMCTRL & nvmctrl,
+    std::uint32_t         address,
+    void const *          data,
+    std::size_t           size ) noexcept
+{
+    PICOLIBRARY_EXPECT( address % PAGE_SIZE == 0, Generic_Error::INVALID_ARGUMENT );
+
+    auto const   cmd = address >= RWWEE_ADDRESS ? Peripheral::NVMCTRL::CTRLA::CMD_RWWEEWP
+                                                : Peripheral::NVMCTRL::CTRLA::CMD_WP;
+    auto const * byte = static_cast<std::uint8_t const *>( data );
+
+    wait_for_ready( nvmctrl );
+
+    while ( size ) {
+        execute( nvmctrl, Peripheral::NVMCTRL::CTRLA::CMD_PBC );
+
+        // the page buffer must be written using 16-bit or 32-bit accesses
+        auto * page_buffer = reinterpret_cast<std::uint16_t volatile *>( address );
+        for ( auto word = std::size_t{}; word < PAGE_SIZE / 2; ++word ) {
+            auto value = std::uint16_t{ 0xFFFF };
+
+            if ( size ) {
+                value = ( value & 0xFF00 ) | *byte;
+                ++byte;
+                --size;
+            } // if
+
+            if ( size ) {
+                value = ( value & 0x00FF ) | ( *byte << 8 );
+                ++byte;
+                --size;
+            } // if
+
+            page_buffer[ word ] = value;
+        } // for
+
+        execute( nvmctrl, cmd, address );
+
+        address += PAGE_SIZE;
+    } // while
+
+    execute( nvmctrl, Peripheral::NVMCTRL::CTRLA::CMD_INVALL );
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::NVM
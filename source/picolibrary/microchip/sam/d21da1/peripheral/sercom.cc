@@ -0,0 +1,35 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Peripheral::SERCOM implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/peripheral/sercom.h"
+
+#include "picolibrary/algorithm.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Peripheral {
+
+static_assert( sizeof( SERCOM::USART ) == 0x30 + 1 );
+static_assert( sizeof( SERCOM::SPI ) == 0x30 + 1 );
+static_assert( sizeof( SERCOM::I2CM ) == 0x30 + 1 );
+static_assert( sizeof( SERCOM::I2CS ) == 0x28 + 1 );
+static_assert( sizeof( SERCOM ) == max( max( max( sizeof( SERCOM::USART ), sizeof( SERCOM::SPI ) ), sizeof( SERCOM::I2CM ) ), sizeof( SERCOM::I2CS ) ) );
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Peripheral
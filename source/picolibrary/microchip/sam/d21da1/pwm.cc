@@ -0,0 +1,159 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::PWM implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/pwm.h"
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/dma.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/dmac.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/tcc.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::PWM {
+
+Engine::Engine( Peripheral::TCC & tcc, std::uint_fast8_t channels ) noexcept :
+    m_tcc{ &tcc },
+    m_channels{ channels }
+{
+    PICOLIBRARY_EXPECT( channels > 0 and channels <= 4, Generic_Error::INVALID_ARGUMENT );
+}
+
+void Engine::enable(
+    Peripheral::TCC::CTRLA::PRESCALER  prescaler,
+    Peripheral::TCC::CTRLA::RESOLUTION resolution,
+    Peripheral::TCC::WAVE::WAVEGEN     wavegen,
+    std::uint32_t                      period ) noexcept
+{
+    using TCC = Peripheral::TCC;
+
+    m_tcc->ctrla = TCC::CTRLA::Mask::SWRST;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::SWRST ) {} // while
+
+    // DITH4, DITH5, and DITH6 use 4, 5, and 6 dithering bits
+    m_dither_bits = resolution == TCC::CTRLA::RESOLUTION_NONE
+                        ? 0
+                        : 3 + ( resolution >> TCC::CTRLA::Bit::RESOLUTION );
+
+    m_tcc->ctrla = resolution | prescaler | TCC::CTRLA::PRESCSYNC_PRESC;
+    m_tcc->wave  = wavegen;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::WAVE ) {} // while
+
+    m_tcc->per = period;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::PER ) {} // while
+
+    m_tcc->ctrla |= TCC::CTRLA::Mask::ENABLE;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::ENABLE ) {} // while
+}
+
+void Engine::disable() noexcept
+{
+    using TCC = Peripheral::TCC;
+
+    m_tcc->ctrla &= ~TCC::CTRLA::Mask::ENABLE;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::ENABLE ) {} // while
+}
+
+void Engine::set_period( std::uint32_t period ) noexcept
+{
+    using TCC = Peripheral::TCC;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::PERB ) {} // while
+
+    m_tcc->perb = period;
+}
+
+void Engine::set_compare( std::uint_fast8_t channel, std::uint32_t compare ) noexcept
+{
+    using TCC = Peripheral::TCC;
+
+    PICOLIBRARY_EXPECT( channel < m_channels, Generic_Error::INVALID_ARGUMENT );
+
+    while ( m_tcc->syncbusy & ( TCC::SYNCBUSY::Mask::CCB0 << channel ) ) {} // while
+
+    m_tcc->ccb[ channel ] = compare;
+}
+
+void Engine::set_compare( std::uint32_t const * compare ) noexcept
+{
+    using TCC = Peripheral::TCC;
+
+    // the buffer registers are not copied while the update is locked, so the new compare
+    // values cannot be split across PWM periods
+    m_tcc->ctrlbset = TCC::CTRLBSET::Mask::LUPD;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::CTRLB ) {} // while
+
+    for ( auto channel = std::uint_fast8_t{}; channel < m_channels; ++channel ) {
+        while ( m_tcc->syncbusy & ( TCC::SYNCBUSY::Mask::CCB0 << channel ) ) {} // while
+
+        m_tcc->ccb[ channel ] = compare[ channel ];
+    } // for
+
+    m_tcc->ctrlbclr = TCC::CTRLBCLR::Mask::LUPD;
+
+    while ( m_tcc->syncbusy & TCC::SYNCBUSY::Mask::CTRLB ) {} // while
+}
+
+auto Engine::stream(
+    DMA::Controller &                  dma,
+    Peripheral::DMAC::CHCTRLB::TRIGSRC overflow_trigger,
+    std::uint_fast8_t                  channel,
+    std::uint32_t const *              waveform,
+    std::uint16_t                      size ) noexcept -> DMA::Channel
+{
+    using DMAC       = Peripheral::DMAC;
+    using Descriptor = DMA::Descriptor;
+
+    PICOLIBRARY_EXPECT( channel < m_channels, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT( size > 0, Generic_Error::INVALID_ARGUMENT );
+
+    auto const dma_channel = dma.allocate_channel();
+
+    auto & descriptor = dma.descriptor( dma_channel );
+
+    descriptor.btctrl  = Descriptor::BTCTRL::Mask::VALID
+                        | Descriptor::BTCTRL::BLOCKACT_NOACT
+                        | Descriptor::BTCTRL::BEATSIZE_WORD
+                        | Descriptor::BTCTRL::Mask::SRCINC;
+    descriptor.btcnt   = size;
+    descriptor.srcaddr = DMA::address( waveform + size );
+    descriptor.dstaddr = DMA::address( &m_tcc->ccb[ channel ] );
+    DMA::link( descriptor, descriptor );
+
+    dma.configure_channel(
+        dma_channel,
+        overflow_trigger | DMAC::CHCTRLB::LVL_LVL2 | DMAC::CHCTRLB::TRIGACT_BEAT,
+        nullptr,
+        nullptr );
+    dma.start( dma_channel );
+
+    return dma_channel;
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::PWM
@@ -0,0 +1,175 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Reset_Cause implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/reset_cause.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/nvm.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/nvmctrl.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/pm.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Reset_Cause {
+
+namespace {
+
+/**
+ * \brief Erased NVM word.
+ */
+constexpr auto ERASED = std::uint32_t{ 0xFFFFFFFF };
+
+/**
+ * \brief Compute a log record check value.
+ *
+ * \param[in] words The log record's words (excluding the check value).
+ * \param[in] size The number of words.
+ *
+ * \return The log record check value.
+ */
+auto check( std::uint32_t const * words, std::uint_fast8_t size ) noexcept
+    -> std::uint32_t
+{
+    auto value = std::uint32_t{ 0x52435355 };
+
+    for ( auto word = std::uint_fast8_t{}; word < size; ++word ) {
+        value = ( ( value << 5 ) | ( value >> 27 ) ) ^ words[ word ];
+    } // for
+
+    return value;
+}
+
+} // namespace
+
+auto decode( std::uint8_t rcause ) noexcept -> Cause
+{
+    using Peripheral::PM;
+
+    if ( rcause & PM::RCAUSE::Mask::POR ) {
+        return Cause::POR;
+    } // if
+
+    if ( rcause & PM::RCAUSE::Mask::BOD12 ) {
+        return Cause::BOD12;
+    } // if
+
+    if ( rcause & PM::RCAUSE::Mask::BOD33 ) {
+        return Cause::BOD33;
+    } // if
+
+    if ( rcause & PM::RCAUSE::Mask::EXT ) {
+        return Cause::EXT;
+    } // if
+
+    if ( rcause & PM::RCAUSE::Mask::WDT ) {
+        return Cause::WDT;
+    } // if
+
+    if ( rcause & PM::RCAUSE::Mask::SYST ) {
+        return Cause::SYST;
+    } // if
+
+    return Cause::UNKNOWN;
+}
+
+Telemetry::Telemetry(
+    Peripheral::NVMCTRL & nvmctrl,
+    std::uint32_t         address,
+    std::uint_fast8_t     rows ) noexcept :
+    m_nvmctrl{ &nvmctrl },
+    m_address{ address },
+    m_pages{ static_cast<std::uint_fast16_t>( rows * NVM::ROW_SIZE / NVM::PAGE_SIZE ) }
+{
+    PICOLIBRARY_EXPECT( address % NVM::ROW_SIZE == 0, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT( rows >= 2, Generic_Error::INVALID_ARGUMENT );
+
+    m_record.history = ERASED;
+}
+
+auto Telemetry::record( std::uint8_t rcause ) noexcept -> Cause
+{
+    static_assert( sizeof( Record ) <= NVM::PAGE_SIZE );
+    static_assert( sizeof( Record ) % sizeof( std::uint32_t ) == 0 );
+
+    constexpr auto RECORD_WORDS  = sizeof( Record ) / sizeof( std::uint32_t );
+    constexpr auto PAGES_PER_ROW = NVM::ROW_SIZE / NVM::PAGE_SIZE;
+
+    auto latest_page = m_pages;
+
+    for ( auto page = std::uint_fast16_t{}; page < m_pages; ++page ) {
+        auto record = Record{};
+        std::memcpy(
+            &record,
+            reinterpret_cast<void const *>( m_address + page * NVM::PAGE_SIZE ),
+            sizeof( Record ) );
+
+        if ( record.sequence == ERASED
+             or record.check != check( &record.sequence, RECORD_WORDS - 1 ) ) {
+            continue;
+        } // if
+
+        if ( latest_page == m_pages or record.sequence > m_record.sequence ) {
+            m_record    = record;
+            latest_page = page;
+        } // if
+    }     // for
+
+    auto const cause       = decode( rcause );
+    auto const cause_index = static_cast<std::uint_fast8_t>( cause );
+
+    ++m_record.sequence;
+    ++m_record.count[ cause_index ];
+    m_record.history = ( m_record.history << 4 ) | cause_index;
+    m_record.check   = check( &m_record.sequence, RECORD_WORDS - 1 );
+
+    auto page = latest_page == m_pages ? std::uint_fast16_t{}
+                                       : ( latest_page + 1 ) % m_pages;
+
+    // a page that is not blank (e.g. following an interrupted update) cannot be written,
+    // so the record is written to the start of the following row instead (which is never
+    // the row that holds the most recent record)
+    if ( page % PAGES_PER_ROW ) {
+        auto const * next = reinterpret_cast<std::uint32_t const *>(
+            m_address + page * NVM::PAGE_SIZE );
+        for ( auto word = std::uint_fast8_t{}; word < RECORD_WORDS; ++word ) {
+            if ( next[ word ] != ERASED ) {
+                page = ( ( page / PAGES_PER_ROW + 1 ) * PAGES_PER_ROW ) % m_pages;
+
+                break;
+            } // if
+        }     // for
+    }         // if
+
+    auto const address = m_address + page * NVM::PAGE_SIZE;
+
+    if ( page % PAGES_PER_ROW == 0 ) {
+        NVM::erase_row( *m_nvmctrl, address );
+    } // if
+
+    NVM::write( *m_nvmctrl, address, &m_record, sizeof( Record ) );
+
+    return cause;
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Reset_Cause
@@ -0,0 +1,121 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Sleep implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/sleep.h"
+
+#include <cstdint>
+
+#include "picolibrary/arm/cortex/m0plus/peripheral.h"
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/pm.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Sleep {
+
+void Controller::vote( Level level ) noexcept
+{
+    Interrupt::Critical_Section const critical_section;
+
+    auto & votes = m_votes[ static_cast<std::uint_fast8_t>( level ) ];
+
+    PICOLIBRARY_EXPECT( votes != 0xFF, Generic_Error::INSUFFICIENT_CAPACITY );
+
+    ++votes;
+}
+
+void Controller::withdraw( Level level ) noexcept
+{
+    Interrupt::Critical_Section const critical_section;
+
+    auto & votes = m_votes[ static_cast<std::uint_fast8_t>( level ) ];
+
+    PICOLIBRARY_EXPECT( votes, Generic_Error::INVALID_ARGUMENT );
+
+    --votes;
+}
+
+auto Controller::allowed_level() const noexcept -> Level
+{
+    for ( auto level = std::uint_fast8_t{}; level < LEVELS - 1; ++level ) {
+        if ( m_votes[ level ] ) {
+            return static_cast<Level>( level );
+        } // if
+    }     // for
+
+    return Level::STANDBY;
+}
+
+auto Controller::idle() noexcept -> Level
+{
+    using ::picolibrary::Arm::Cortex::M0PLUS::Peripheral::SCB;
+
+    auto level = Level{};
+
+    {
+        Interrupt::Critical_Section const critical_section;
+
+        level = allowed_level();
+
+        switch ( level ) {
+            case Level::IDLE0: m_pm->sleep = Peripheral::PM::SLEEP::IDLE_CPU; break;
+            case Level::IDLE1: m_pm->sleep = Peripheral::PM::SLEEP::IDLE_AHB; break;
+            case Level::IDLE2: m_pm->sleep = Peripheral::PM::SLEEP::IDLE_APB; break;
+            case Level::STANDBY: break;
+        } // switch
+
+        if ( level == Level::STANDBY ) {
+            m_scb->scr |= SCB::SCR::Mask::SLEEPDEEP;
+        } else {
+            m_scb->scr &= ~SCB::SCR::Mask::SLEEPDEEP;
+        } // else
+
+        auto const start = m_clock ? m_clock() : std::uint32_t{};
+
+        // a pending interrupt wakes the CPU even though interrupts are disabled, and is
+        // handled once the critical section ends
+        asm volatile(
+            "dsb\n"
+            "wfi\n"
+            :
+            :
+            : "memory" );
+
+        if ( m_clock ) {
+            m_time[ static_cast<std::uint_fast8_t>( level ) ] += m_clock() - start;
+        } // if
+
+        ++m_wakes[ static_cast<std::uint_fast8_t>( level ) ];
+    }
+
+    return level;
+}
+
+void Controller::reset_statistics() noexcept
+{
+    for ( auto level = std::uint_fast8_t{}; level < LEVELS; ++level ) {
+        m_wakes[ level ] = 0;
+        m_time[ level ]  = 0;
+    } // for
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Sleep
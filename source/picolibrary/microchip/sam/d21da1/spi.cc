@@ -0,0 +1,45 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::SPI implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/spi.h"
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::SPI {
+
+auto baud( std::uint32_t gclk_frequency, std::uint32_t bit_rate ) noexcept -> std::uint8_t
+{
+    PICOLIBRARY_EXPECT(
+        bit_rate and std::uint64_t{ bit_rate } * 2 <= gclk_frequency,
+        Generic_Error::INVALID_ARGUMENT );
+
+    // f_BAUD = f_REF / ( 2 * ( BAUD + 1 ) ), rounded so that f_BAUD does not exceed the
+    // desired bit rate
+    auto const divisor = ( gclk_frequency + 2 * bit_rate - 1 ) / ( 2 * bit_rate );
+
+    return divisor > 256 ? 255 : divisor - 1;
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::SPI
@@ -0,0 +1,66 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::USART implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/usart.h"
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/sercom.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::USART {
+
+auto baud_configuration( std::uint32_t gclk_frequency, std::uint32_t baud_rate ) noexcept
+    -> Baud_Configuration
+{
+    using CTRLA = Peripheral::SERCOM::USART::CTRLA;
+
+    PICOLIBRARY_EXPECT(
+        baud_rate and std::uint64_t{ baud_rate } * 3 <= gclk_frequency,
+        Generic_Error::INVALID_ARGUMENT );
+
+    struct Over_Sampling {
+        std::uint32_t samples;
+        CTRLA::SAMPR  sampr;
+    };
+
+    constexpr Over_Sampling over_sampling[]{
+        { 16, CTRLA::SAMPR_16X_ARITHMETIC },
+        { 8, CTRLA::SAMPR_8X_ARITHMETIC },
+        { 3, CTRLA::SAMPR_3X_ARITHMETIC },
+    };
+
+    auto i = std::uint_fast8_t{};
+    for ( ; std::uint64_t{ over_sampling[ i ].samples } * baud_rate > gclk_frequency;
+          ++i ) {} // for
+
+    // BAUD = 65536 * ( 1 - S * f_BAUD / f_REF ), rounded to nearest
+    auto const ratio = ( ( std::uint64_t{ over_sampling[ i ].samples } * baud_rate << 16 )
+                         + gclk_frequency / 2 )
+                       / gclk_frequency;
+
+    return { over_sampling[ i ].sampr,
+             static_cast<std::uint16_t>( ratio ? 65536 - ratio : 65535 ) };
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::USART
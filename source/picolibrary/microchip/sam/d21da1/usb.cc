@@ -0,0 +1,775 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::USB implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/usb.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/nvm.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/sysctrl.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/usb.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::USB {
+
+namespace {
+
+/**
+ * \brief Setup packet request type fields.
+ */
+struct Request_Type {
+    static constexpr auto DEVICE_TO_HOST = std::uint8_t{ 0x80 }; ///< Direction.
+    static constexpr auto TYPE           = std::uint8_t{ 0x60 }; ///< Type.
+    static constexpr auto RECIPIENT      = std::uint8_t{ 0x1F }; ///< Recipient.
+
+    static constexpr auto STANDARD = std::uint8_t{ 0x00 }; ///< Standard type.
+
+    static constexpr auto DEVICE    = std::uint8_t{ 0x00 }; ///< Device recipient.
+    static constexpr auto INTERFACE = std::uint8_t{ 0x01 }; ///< Interface recipient.
+    static constexpr auto ENDPOINT  = std::uint8_t{ 0x02 }; ///< Endpoint recipient.
+};
+
+/**
+ * \brief Standard requests.
+ */
+enum Request : std::uint8_t {
+    GET_STATUS        = 0,  ///< GET_STATUS.
+    CLEAR_FEATURE     = 1,  ///< CLEAR_FEATURE.
+    SET_FEATURE       = 3,  ///< SET_FEATURE.
+    SET_ADDRESS       = 5,  ///< SET_ADDRESS.
+    GET_CONFIGURATION = 8,  ///< GET_CONFIGURATION.
+    SET_CONFIGURATION = 9,  ///< SET_CONFIGURATION.
+    GET_INTERFACE     = 10, ///< GET_INTERFACE.
+    SET_INTERFACE     = 11, ///< SET_INTERFACE.
+};
+
+static_assert( sizeof( Setup_Packet ) == 8 );
+
+/**
+ * \brief The ENDPOINT_HALT feature selector.
+ */
+constexpr auto ENDPOINT_HALT = std::uint16_t{ 0 };
+
+/**
+ * \brief Get an address in the form expected by the USB peripheral.
+ *
+ * \param[in] pointer The pointer to convert.
+ *
+ * \return The address.
+ */
+auto address( void const volatile * pointer ) noexcept -> std::uint32_t
+{
+    return static_cast<std::uint32_t>( reinterpret_cast<std::uintptr_t>( pointer ) );
+}
+
+/**
+ * \brief Wait for the DFLL48M to be ready to accept a register write.
+ *
+ * \param[in] sysctrl The SYSCTRL peripheral.
+ */
+void wait_for_dfll( Peripheral::SYSCTRL const & sysctrl ) noexcept
+{
+    using SYSCTRL = Peripheral::SYSCTRL;
+
+    while ( not( sysctrl.pclksr & SYSCTRL::PCLKSR::Mask::DFLLRDY ) ) {} // while
+}
+
+} // namespace
+
+void enable_clock_recovery( Peripheral::SYSCTRL & sysctrl ) noexcept
+{
+    using SYSCTRL = Peripheral::SYSCTRL;
+
+    auto const calibration = reinterpret_cast<std::uint32_t const volatile *>(
+        NVM::SOFTWARE_CALIBRATION_ADDRESS );
+
+    // the DFLL48M coarse calibration value occupies bits 63:58 of the software
+    // calibration area (all ones if it has not been programmed)
+    auto coarse = calibration[ 1 ] >> 26;
+
+    if ( coarse == 0x3F ) {
+        coarse = 0x1F;
+    } // if
+
+    // writes to the DFLL48M's registers are ignored while ONDEMAND is set and the
+    // DFLL48M is not requested, so it is enabled (without ONDEMAND) first
+    sysctrl.dfllctrl = SYSCTRL::DFLLCTRL::Mask::ENABLE;
+    wait_for_dfll( sysctrl );
+
+    sysctrl.dfllval = ( coarse << SYSCTRL::DFLLVAL::Bit::COARSE )
+                      | ( 512 << SYSCTRL::DFLLVAL::Bit::FINE );
+    wait_for_dfll( sysctrl );
+
+    // the 1 kHz start-of-frame packets are the reference clock, and the coarse lock is
+    // skipped (the coarse calibration value is already within range)
+    sysctrl.dfllmul = ( 48000 << SYSCTRL::DFLLMUL::Bit::MUL )
+                      | ( 1 << SYSCTRL::DFLLMUL::Bit::FSTEP )
+                      | ( 1 << SYSCTRL::DFLLMUL::Bit::CSTEP );
+    wait_for_dfll( sysctrl );
+
+    sysctrl.dfllctrl = SYSCTRL::DFLLCTRL::Mask::ENABLE | SYSCTRL::DFLLCTRL::Mask::USBCRM
+                       | SYSCTRL::DFLLCTRL::Mask::CCDIS;
+    wait_for_dfll( sysctrl );
+
+    sysctrl.dfllctrl |= SYSCTRL::DFLLCTRL::Mask::MODE;
+    wait_for_dfll( sysctrl );
+}
+
+void load_calibration( Peripheral::USB & usb ) noexcept
+{
+    using PADCAL = Peripheral::USB::DEVICE::PADCAL;
+
+    auto const calibration = reinterpret_cast<std::uint32_t const volatile *>(
+        NVM::SOFTWARE_CALIBRATION_ADDRESS );
+
+    // the TRANSN calibration value occupies bits 49:45, the TRANSP calibration value
+    // occupies bits 54:50, and the TRIM calibration value occupies bits 57:55 of the
+    // software calibration area (all ones if they have not been programmed)
+    auto transn = ( calibration[ 1 ] >> 13 ) & 0x1F;
+    auto transp = ( calibration[ 1 ] >> 18 ) & 0x1F;
+    auto trim   = ( calibration[ 1 ] >> 23 ) & 0x7;
+
+    if ( transn == 0x1F ) {
+        transn = 5;
+    } // if
+
+    if ( transp == 0x1F ) {
+        transp = 29;
+    } // if
+
+    if ( trim == 0x7 ) {
+        trim = 3;
+    } // if
+
+    usb.device.padcal = static_cast<std::uint16_t>(
+        ( transn << PADCAL::Bit::TRANSN ) | ( transp << PADCAL::Bit::TRANSP )
+        | ( trim << PADCAL::Bit::TRIM ) );
+}
+
+void Device::enable() noexcept
+{
+    using DEVICE = Peripheral::USB::DEVICE;
+
+    auto & device = m_usb->device;
+
+    device.ctrla = DEVICE::CTRLA::Mask::SWRST;
+
+    while ( device.syncbusy & DEVICE::SYNCBUSY::Mask::SWRST ) {} // while
+
+    load_calibration( *m_usb );
+
+    device.descadd = address( m_descriptors );
+    device.ctrlb   = DEVICE::CTRLB::SPDCONF_FS | DEVICE::CTRLB::Mask::DETACH;
+    device.ctrla   = DEVICE::CTRLA::MODE_DEVICE | DEVICE::CTRLA::Mask::ENABLE;
+
+    while ( device.syncbusy & DEVICE::SYNCBUSY::Mask::ENABLE ) {} // while
+
+    // the control endpoint is configured when the host resets the bus
+    device.intenset = DEVICE::INTENSET::Mask::EORST;
+
+    device.ctrlb &= ~DEVICE::CTRLB::Mask::DETACH;
+}
+
+void Device::disable() noexcept
+{
+    using DEVICE = Peripheral::USB::DEVICE;
+
+    auto & device = m_usb->device;
+
+    device.ctrlb |= DEVICE::CTRLB::Mask::DETACH;
+
+    device.intenclr = DEVICE::INTENCLR::Mask::EORST;
+
+    device.ctrla &= ~DEVICE::CTRLA::Mask::ENABLE;
+
+    while ( device.syncbusy & DEVICE::SYNCBUSY::Mask::ENABLE ) {} // while
+
+    reset_endpoints();
+
+    m_configuration = 0;
+}
+
+void Device::configure_endpoint(
+    std::uint8_t  address,
+    Endpoint_Type type,
+    Buffering     buffering ) noexcept
+{
+    using ENDPOINT = Peripheral::USB::DEVICE::ENDPOINT;
+
+    auto const number = address & 0x0F;
+    auto const in     = static_cast<bool>( address & 0x80 );
+
+    PICOLIBRARY_EXPECT(
+        number > 0 and number < ENDPOINTS, Generic_Error::INVALID_ARGUMENT );
+
+    auto & state    = m_endpoints[ number ];
+    auto & endpoint = m_usb->device.endpoint[ number ];
+
+    // a single buffered IN endpoint uses bank 1 and a single buffered OUT endpoint uses
+    // bank 0, and a double buffered endpoint uses both banks (starting with bank 0)
+    state         = Endpoint{};
+    state.address = address;
+    state.banks   = buffering == Buffering::DOUBLE ? 0b11 : in ? 0b10 : 0b01;
+    state.next    = in and buffering == Buffering::SINGLE ? 1 : 0;
+
+    // EPTYPE0 configures bank 0 and EPTYPE1 configures bank 1, and a double buffered
+    // endpoint's second bank is configured as a dual bank
+    auto const eptype = std::uint8_t{ type == Endpoint_Type::BULK
+                                          ? ENDPOINT::EPCFG::EPTYPE0_BULK
+                                          : ENDPOINT::EPCFG::EPTYPE0_INTERRUPT };
+    auto const second = std::uint8_t{ buffering == Buffering::DOUBLE
+                                          ? ENDPOINT::EPCFG::EPTYPE0_DUAL_BANK
+                                          : ENDPOINT::EPCFG::EPTYPE0_DISABLED };
+    auto const shift = ENDPOINT::EPCFG::Bit::EPTYPE1 - ENDPOINT::EPCFG::Bit::EPTYPE0;
+
+    endpoint.epcfg = in ? ( eptype << shift ) | second : eptype | ( second << shift );
+
+    // the hardware's current bank must start at bank 0 to match the bank bookkeeping (a
+    // previous configuration may have left it at bank 1)
+    if ( in ) {
+        // an IN bank is not ready until a transfer has been queued in it
+        endpoint.epstatusclr = ENDPOINT::EPSTATUSCLR::Mask::BK0RDY
+                               | ENDPOINT::EPSTATUSCLR::Mask::BK1RDY
+                               | ENDPOINT::EPSTATUSCLR::Mask::DTGLIN
+                               | ENDPOINT::EPSTATUSCLR::Mask::CURBK;
+    } else {
+        // an OUT bank is "ready" (full, so OUT packets are NAKed) until a transfer has
+        // been queued in it
+        endpoint.epstatusset = ENDPOINT::EPSTATUSSET::Mask::BK0RDY
+                               | ENDPOINT::EPSTATUSSET::Mask::BK1RDY;
+        endpoint.epstatusclr = ENDPOINT::EPSTATUSCLR::Mask::DTGLOUT
+                               | ENDPOINT::EPSTATUSCLR::Mask::CURBK;
+    } // else
+
+    endpoint.epstatusclr = ENDPOINT::EPSTATUSCLR::Mask::STALLRQ0
+                           | ENDPOINT::EPSTATUSCLR::Mask::STALLRQ1;
+    endpoint.epintflag   = ENDPOINT::EPINTFLAG::Mask::TRCPT0
+                         | ENDPOINT::EPINTFLAG::Mask::TRCPT1
+                         | ENDPOINT::EPINTFLAG::Mask::TRFAIL0
+                         | ENDPOINT::EPINTFLAG::Mask::TRFAIL1;
+    endpoint.epintenset = state.banks << ENDPOINT::EPINTENSET::Bit::TRCPT0;
+}
+
+auto Device::submit(
+    std::uint8_t      address,
+    void *            buffer,
+    std::uint16_t     size,
+    Transfer_Callback callback,
+    void *            context ) noexcept -> bool
+{
+    using ENDPOINT   = Peripheral::USB::DEVICE::ENDPOINT;
+    using Descriptor = Peripheral::USB::DEVICE::Descriptor;
+
+    auto * const state = endpoint( address );
+    auto const   in    = static_cast<bool>( address & 0x80 );
+
+    PICOLIBRARY_EXPECT( state, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT(
+        not( USB::address( buffer ) & 0x3 ), Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT( size <= TRANSFER_SIZE_MAX, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT(
+        in or ( size and not( size % PACKET_SIZE ) ), Generic_Error::INVALID_ARGUMENT );
+
+    auto const number = address & 0x0F;
+
+    Interrupt::Critical_Section const critical_section;
+
+    auto const bank = state->next;
+
+    if ( state->busy & ( 1 << bank ) ) {
+        return false;
+    } // if
+
+    state->transfer[ bank ] = Transfer{ callback, context };
+    state->busy             = state->busy | ( 1 << bank );
+    state->next             = state->banks == 0b11 ? bank ^ 1 : bank;
+
+    auto & descriptor = m_descriptors[ number ][ bank ];
+
+    descriptor.addr = USB::address( buffer );
+
+    // the USB peripheral splits an IN transfer of BYTE_COUNT bytes into packets, and
+    // reassembles an OUT transfer of up to MULTI_PACKET_SIZE bytes from packets
+    if ( in ) {
+        descriptor.pcksize = Descriptor::PCKSIZE::SIZE_64
+                             | ( std::uint32_t{ size }
+                                 << Descriptor::PCKSIZE::Bit::BYTE_COUNT );
+
+        m_usb->device.endpoint[ number ].epstatusset = ENDPOINT::EPSTATUSSET::Mask::BK0RDY
+                                                       << bank;
+    } else {
+        descriptor.pcksize = Descriptor::PCKSIZE::SIZE_64
+                             | ( std::uint32_t{ size }
+                                 << Descriptor::PCKSIZE::Bit::MULTI_PACKET_SIZE );
+
+        m_usb->device.endpoint[ number ].epstatusclr = ENDPOINT::EPSTATUSCLR::Mask::BK0RDY
+                                                       << bank;
+    } // else
+
+    return true;
+}
+
+void Device::stall( std::uint8_t address ) noexcept
+{
+    auto const * const state = endpoint( address );
+
+    PICOLIBRARY_EXPECT( state, Generic_Error::INVALID_ARGUMENT );
+
+    m_usb->device.endpoint[ address & 0x0F ].epstatusset = stall_mask( *state );
+}
+
+void Device::clear_stall( std::uint8_t address ) noexcept
+{
+    using ENDPOINT = Peripheral::USB::DEVICE::ENDPOINT;
+
+    auto const * const state = endpoint( address );
+
+    PICOLIBRARY_EXPECT( state, Generic_Error::INVALID_ARGUMENT );
+
+    m_usb->device.endpoint[ address & 0x0F ].epstatusclr =
+        stall_mask( *state )
+        | ( address & 0x80 ? ENDPOINT::EPSTATUSCLR::Mask::DTGLIN
+                           : ENDPOINT::EPSTATUSCLR::Mask::DTGLOUT );
+}
+
+void Device::control_send( void const * data, std::uint16_t size ) noexcept
+{
+    using ENDPOINT   = Peripheral::USB::DEVICE::ENDPOINT;
+    using Descriptor = Peripheral::USB::DEVICE::Descriptor;
+
+    PICOLIBRARY_EXPECT( size <= CONTROL_BUFFER_SIZE, Generic_Error::INVALID_ARGUMENT );
+
+    size = std::min( size, m_setup.length );
+
+    std::memcpy( m_control_in, data, size );
+
+    // if less data than the host requested is sent, and the last packet is a full
+    // packet, a zero length packet must end the data stage
+    m_descriptors[ 0 ][ 1 ].pcksize = Descriptor::PCKSIZE::SIZE_64
+                                      | ( std::uint32_t{ size }
+                                          << Descriptor::PCKSIZE::Bit::BYTE_COUNT )
+                                      | ( size < m_setup.length
+                                              ? Descriptor::PCKSIZE::Mask::AUTO_ZLP
+                                              : 0 );
+
+    m_control_state = Control_State::DATA_IN;
+
+    m_usb->device.endpoint[ 0 ].epstatusset = ENDPOINT::EPSTATUSSET::Mask::BK1RDY;
+
+    // the host acknowledges the data stage with a zero length OUT packet
+    arm_control_out( 0 );
+}
+
+void Device::handle_interrupt() noexcept
+{
+    using DEVICE = Peripheral::USB::DEVICE;
+
+    auto & device = m_usb->device;
+
+    std::uint16_t const flags = device.intflag & device.intenset;
+
+    if ( flags & DEVICE::INTFLAG::Mask::EORST ) {
+        device.intflag = DEVICE::INTFLAG::Mask::EORST;
+
+        handle_reset();
+
+        return;
+    } // if
+
+    std::uint16_t const summary = device.epintsmry;
+
+    if ( summary & DEVICE::EPINTSMRY::Mask::EPINT0 ) {
+        handle_control();
+    } // if
+
+    for ( auto number = std::uint_fast8_t{ 1 }; number < ENDPOINTS; ++number ) {
+        if ( summary & ( DEVICE::EPINTSMRY::Mask::EPINT0 << number ) ) {
+            handle_endpoint( number );
+        } // if
+    }     // for
+}
+
+void Device::handle_reset() noexcept
+{
+    using ENDPOINT   = Peripheral::USB::DEVICE::ENDPOINT;
+    using Descriptor = Peripheral::USB::DEVICE::Descriptor;
+
+    reset_endpoints();
+
+    m_configuration = 0;
+    m_address       = 0;
+    m_control_state = Control_State::SETUP;
+
+    m_usb->device.dadd = 0;
+
+    // bank 0 receives setup packets and OUT data stages, and bank 1 sends IN data stages
+    m_descriptors[ 0 ][ 0 ].addr    = address( m_control_out );
+    m_descriptors[ 0 ][ 0 ].pcksize = Descriptor::PCKSIZE::SIZE_64;
+    m_descriptors[ 0 ][ 1 ].addr    = address( m_control_in );
+    m_descriptors[ 0 ][ 1 ].pcksize = Descriptor::PCKSIZE::SIZE_64;
+
+    auto & endpoint = m_usb->device.endpoint[ 0 ];
+
+    endpoint.epcfg = ENDPOINT::EPCFG::EPTYPE0_CONTROL | ENDPOINT::EPCFG::EPTYPE1_CONTROL;
+
+    // setup packets are received even if bank 0 is "ready" (full), so OUT packets are
+    // NAKed until an OUT data or status stage is expected
+    endpoint.epstatusset = ENDPOINT::EPSTATUSSET::Mask::BK0RDY;
+    endpoint.epstatusclr = ENDPOINT::EPSTATUSCLR::Mask::BK1RDY;
+    endpoint.epintenset  = ENDPOINT::EPINTENSET::Mask::RXSTP
+                          | ENDPOINT::EPINTENSET::Mask::TRCPT0
+                          | ENDPOINT::EPINTENSET::Mask::TRCPT1;
+}
+
+void Device::handle_control() noexcept
+{
+    using DEVICE   = Peripheral::USB::DEVICE;
+    using ENDPOINT = DEVICE::ENDPOINT;
+
+    auto & endpoint = m_usb->device.endpoint[ 0 ];
+
+    std::uint8_t const flags = endpoint.epintflag;
+
+    // a setup packet aborts the current control transfer
+    if ( flags & ENDPOINT::EPINTFLAG::Mask::RXSTP ) {
+        endpoint.epintflag = ENDPOINT::EPINTFLAG::Mask::RXSTP
+                             | ENDPOINT::EPINTFLAG::Mask::TRCPT0
+                             | ENDPOINT::EPINTFLAG::Mask::TRCPT1;
+
+        handle_setup();
+
+        return;
+    } // if
+
+    if ( flags & ENDPOINT::EPINTFLAG::Mask::TRCPT1 ) {
+        endpoint.epintflag = ENDPOINT::EPINTFLAG::Mask::TRCPT1;
+
+        if ( m_control_state == Control_State::STATUS_IN ) {
+            // the new address must not be used until the SET_ADDRESS request's status
+            // stage has completed
+            if ( m_address ) {
+                m_usb->device.dadd = DEVICE::DADD::Mask::ADDEN | m_address;
+                m_address          = 0;
+            } // if
+
+            m_control_state = Control_State::SETUP;
+        } // if
+    }     // if
+
+    if ( flags & ENDPOINT::EPINTFLAG::Mask::TRCPT0 ) {
+        endpoint.epintflag = ENDPOINT::EPINTFLAG::Mask::TRCPT0;
+
+        if ( m_control_state == Control_State::DATA_OUT ) {
+            auto const received = static_cast<std::uint16_t>(
+                m_descriptors[ 0 ][ 0 ].pcksize
+                & Peripheral::USB::DEVICE::Descriptor::PCKSIZE::Mask::BYTE_COUNT );
+
+            if ( received < m_setup.length ) {
+                stall_control();
+
+                return;
+            } // if
+
+            dispatch( m_control_out );
+        } else {
+            // the DATA_IN status stage has completed
+            m_control_state = Control_State::SETUP;
+        } // else
+    }     // if
+}
+
+void Device::handle_setup() noexcept
+{
+    using ENDPOINT = Peripheral::USB::DEVICE::ENDPOINT;
+
+    auto & endpoint = m_usb->device.endpoint[ 0 ];
+
+    std::memcpy( &m_setup, m_control_out, sizeof( m_setup ) );
+
+    endpoint.epstatusclr = ENDPOINT::EPSTATUSCLR::Mask::STALLRQ0
+                           | ENDPOINT::EPSTATUSCLR::Mask::STALLRQ1
+                           | ENDPOINT::EPSTATUSCLR::Mask::BK1RDY;
+    endpoint.epstatusset = ENDPOINT::EPSTATUSSET::Mask::BK0RDY;
+
+    if ( not( m_setup.request_type & Request_Type::DEVICE_TO_HOST ) and m_setup.length ) {
+        if ( m_setup.length > CONTROL_BUFFER_SIZE ) {
+            stall_control();
+
+            return;
+        } // if
+
+        m_control_state = Control_State::DATA_OUT;
+
+        arm_control_out( m_setup.length );
+
+        return;
+    } // if
+
+    dispatch( nullptr );
+}
+
+void Device::dispatch( std::uint8_t const * data ) noexcept
+{
+    m_control_state = Control_State::SETUP;
+
+    auto const handled = handle_standard_request()
+                         or ( m_request_handler
+                              and m_request_handler( m_context, m_setup, data ) );
+
+    if ( not handled ) {
+        stall_control();
+
+        return;
+    } // if
+
+    if ( m_setup.request_type & Request_Type::DEVICE_TO_HOST ) {
+        if ( m_control_state != Control_State::DATA_IN ) {
+            stall_control();
+        } // if
+
+        return;
+    } // if
+
+    send_status();
+}
+
+auto Device::handle_standard_request() noexcept -> bool
+{
+    if ( ( m_setup.request_type & Request_Type::TYPE ) != Request_Type::STANDARD ) {
+        return false;
+    } // if
+
+    auto const recipient = m_setup.request_type & Request_Type::RECIPIENT;
+
+    switch ( m_setup.request ) {
+        case GET_STATUS: {
+            std::uint8_t status[ 2 ]{};
+
+            if ( recipient == Request_Type::ENDPOINT ) {
+                auto const * const state = endpoint(
+                    static_cast<std::uint8_t>( m_setup.index ) );
+
+                if ( not state ) {
+                    return false;
+                } // if
+
+                status[ 0 ] = static_cast<bool>(
+                    m_usb->device.endpoint[ m_setup.index & 0x0F ].epstatus
+                    & stall_mask( *state ) );
+            } // if
+
+            control_send( status, sizeof( status ) );
+
+            return true;
+        }
+
+        case CLEAR_FEATURE:
+        case SET_FEATURE: {
+            if ( recipient != Request_Type::ENDPOINT or m_setup.value != ENDPOINT_HALT
+                 or not endpoint( static_cast<std::uint8_t>( m_setup.index ) ) ) {
+                return false;
+            } // if
+
+            auto const address = static_cast<std::uint8_t>( m_setup.index );
+
+            if ( m_setup.request == SET_FEATURE ) {
+                stall( address );
+            } else {
+                clear_stall( address );
+            } // else
+
+            return true;
+        }
+
+        case SET_ADDRESS:
+            if ( recipient != Request_Type::DEVICE ) {
+                return false;
+            } // if
+
+            m_address = m_setup.value & Peripheral::USB::DEVICE::DADD::Mask::DADD;
+
+            return true;
+
+        case GET_CONFIGURATION: {
+            std::uint8_t const configuration = m_configuration;
+
+            control_send( &configuration, sizeof( configuration ) );
+
+            return true;
+        }
+
+        case SET_CONFIGURATION:
+            reset_endpoints();
+
+            m_configuration = m_setup.value;
+
+            if ( m_configuration_handler ) {
+                m_configuration_handler( m_context, m_configuration );
+            } // if
+
+            return true;
+
+        case GET_INTERFACE: {
+            if ( recipient != Request_Type::INTERFACE or not m_configuration ) {
+                return false;
+            } // if
+
+            std::uint8_t const alternate_setting = 0;
+
+            control_send( &alternate_setting, sizeof( alternate_setting ) );
+
+            return true;
+        }
+
+        case SET_INTERFACE:
+            return recipient == Request_Type::INTERFACE and m_configuration
+                   and m_setup.value == 0;
+
+        default: return false;
+    } // switch
+}
+
+void Device::handle_endpoint( std::uint_fast8_t number ) noexcept
+{
+    using ENDPOINT   = Peripheral::USB::DEVICE::ENDPOINT;
+    using Descriptor = Peripheral::USB::DEVICE::Descriptor;
+
+    auto & endpoint = m_usb->device.endpoint[ number ];
+    auto & state    = m_endpoints[ number ];
+
+    std::uint8_t const flags = endpoint.epintflag
+                               & ( ENDPOINT::EPINTFLAG::Mask::TRCPT0
+                                   | ENDPOINT::EPINTFLAG::Mask::TRCPT1 );
+
+    // transfer failures (an IN packet requested from a bank that is not ready, or an OUT
+    // packet sent to a bank that is full) are NAKed and retried by the host, so they only
+    // need to be cleared
+    endpoint.epintflag = flags | ENDPOINT::EPINTFLAG::Mask::TRFAIL0
+                         | ENDPOINT::EPINTFLAG::Mask::TRFAIL1;
+
+    auto const in = static_cast<bool>( state.address & 0x80 );
+
+    // if both banks of a double buffered endpoint have completed, the bank the next
+    // transfer will be queued in holds the older transfer
+    auto bank = state.next;
+    for ( auto i = 0; i < 2; ++i, bank ^= 1 ) {
+        if ( not( flags & ( ENDPOINT::EPINTFLAG::Mask::TRCPT0 << bank ) )
+             or not( state.busy & ( 1 << bank ) ) ) {
+            continue;
+        } // if
+
+        std::uint32_t const pcksize = m_descriptors[ number ][ bank ].pcksize;
+
+        // the USB peripheral counts the bytes sent in MULTI_PACKET_SIZE, and the bytes
+        // received in BYTE_COUNT
+        auto const size = static_cast<std::uint16_t>(
+            in ? ( pcksize & Descriptor::PCKSIZE::Mask::MULTI_PACKET_SIZE )
+                     >> Descriptor::PCKSIZE::Bit::MULTI_PACKET_SIZE
+               : pcksize & Descriptor::PCKSIZE::Mask::BYTE_COUNT );
+
+        auto const transfer = state.transfer[ bank ];
+
+        state.busy = state.busy & ~( 1 << bank );
+
+        if ( transfer.callback ) {
+            transfer.callback( transfer.context, size );
+        } // if
+    }     // for
+}
+
+void Device::arm_control_out( std::uint16_t size ) noexcept
+{
+    using ENDPOINT   = Peripheral::USB::DEVICE::ENDPOINT;
+    using Descriptor = Peripheral::USB::DEVICE::Descriptor;
+
+    // a multi-packet OUT transfer's size must be a multiple of the packet size
+    auto const packets = ( size + PACKET_SIZE - 1u ) / PACKET_SIZE;
+
+    m_descriptors[ 0 ][ 0 ].pcksize =
+        Descriptor::PCKSIZE::SIZE_64
+        | ( packets * PACKET_SIZE << Descriptor::PCKSIZE::Bit::MULTI_PACKET_SIZE );
+
+    m_usb->device.endpoint[ 0 ].epstatusclr = ENDPOINT::EPSTATUSCLR::Mask::BK0RDY;
+}
+
+void Device::send_status() noexcept
+{
+    using ENDPOINT   = Peripheral::USB::DEVICE::ENDPOINT;
+    using Descriptor = Peripheral::USB::DEVICE::Descriptor;
+
+    m_descriptors[ 0 ][ 1 ].pcksize = Descriptor::PCKSIZE::SIZE_64;
+
+    m_control_state = Control_State::STATUS_IN;
+
+    m_usb->device.endpoint[ 0 ].epstatusset = ENDPOINT::EPSTATUSSET::Mask::BK1RDY;
+}
+
+void Device::stall_control() noexcept
+{
+    using ENDPOINT = Peripheral::USB::DEVICE::ENDPOINT;
+
+    m_control_state = Control_State::SETUP;
+
+    m_usb->device.endpoint[ 0 ].epstatusset = ENDPOINT::EPSTATUSSET::Mask::STALLRQ0
+                                              | ENDPOINT::EPSTATUSSET::Mask::STALLRQ1;
+}
+
+void Device::reset_endpoints() noexcept
+{
+    using ENDPOINT = Peripheral::USB::DEVICE::ENDPOINT;
+
+    for ( auto number = std::uint_fast8_t{ 1 }; number < ENDPOINTS; ++number ) {
+        auto & endpoint = m_usb->device.endpoint[ number ];
+
+        endpoint.epintenclr = ENDPOINT::EPINTENCLR::Mask::TRCPT0
+                              | ENDPOINT::EPINTENCLR::Mask::TRCPT1;
+        endpoint.epcfg      = 0;
+
+        m_endpoints[ number ] = Endpoint{};
+    } // for
+}
+
+auto Device::endpoint( std::uint8_t address ) noexcept -> Endpoint *
+{
+    auto const number = address & 0x0F;
+
+    if ( not number or number >= ENDPOINTS or m_endpoints[ number ].address != address ) {
+        return nullptr;
+    } // if
+
+    return &m_endpoints[ number ];
+}
+
+auto Device::stall_mask( Endpoint const & endpoint ) noexcept -> std::uint8_t
+{
+    using ENDPOINT = Peripheral::USB::DEVICE::ENDPOINT;
+
+    // STALLRQn requests a stall of bank n
+    return static_cast<std::uint8_t>(
+        endpoint.banks << ENDPOINT::EPSTATUSSET::Bit::STALLRQ0 );
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::USB
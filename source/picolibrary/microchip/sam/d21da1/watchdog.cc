@@ -0,0 +1,226 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Watchdog implementation.
+ */
+
+#include "picolibrary/microchip/sam/d21da1/watchdog.h"
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/sam/d21da1/interrupt.h"
+#include "picolibrary/microchip/sam/d21da1/nvm.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/nvmctrl.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/pm.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/wdt.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary::Microchip::SAM::D21DA1::Watchdog {
+
+namespace {
+
+/**
+ * \brief Crash snapshot signature.
+ */
+constexpr auto SIGNATURE = std::uint32_t{ 0x57445443 };
+
+/**
+ * \brief Crash snapshot captured flag value.
+ */
+constexpr auto CAPTURED = std::uint32_t{ 0xC0FFEE00 };
+
+/**
+ * \brief The crash snapshot.
+ */
+__attribute__( ( section( ".noinit" ) ) ) Crash_Snapshot snapshot;
+
+/**
+ * \brief The WDT peripheral whose early warning interrupt captures the crash snapshot.
+ */
+Peripheral::WDT * early_warning_wdt;
+
+/**
+ * \brief The supervisor whose task state is captured in the crash snapshot.
+ */
+Supervisor const * early_warning_supervisor;
+
+} // namespace
+
+void Supervisor::enable(
+    Peripheral::WDT::CONFIG::PER    per,
+    Peripheral::WDT::CONFIG::WINDOW window ) noexcept
+{
+    m_wdt->config = per | window;
+
+    m_wdt->ctrl = Peripheral::WDT::CTRL::Mask::WEN | Peripheral::WDT::CTRL::Mask::ENABLE;
+
+    while ( m_wdt->status & Peripheral::WDT::STATUS::Mask::SYNCBUSY ) {} // while
+}
+
+auto Supervisor::register_task( std::uint_fast8_t deadline ) noexcept -> Task
+{
+    PICOLIBRARY_EXPECT( deadline > 0, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT(
+        m_live != ~std::uint32_t{}, Generic_Error::INSUFFICIENT_CAPACITY );
+
+    auto task = Task{};
+    for ( ; m_live & ( std::uint32_t{ 1 } << task ); ++task ) {} // for
+
+    m_deadline[ task ]  = deadline;
+    m_remaining[ task ] = deadline;
+    m_check_in[ task ]  = 0;
+
+    m_live |= std::uint32_t{ 1 } << task;
+
+    return task;
+}
+
+void Supervisor::retire_task( Task task ) noexcept
+{
+    PICOLIBRARY_EXPECT( task < TASKS_MAX, Generic_Error::INVALID_ARGUMENT );
+    PICOLIBRARY_EXPECT(
+        m_live & ( std::uint32_t{ 1 } << task ), Generic_Error::INVALID_ARGUMENT );
+
+    m_live &= ~( std::uint32_t{ 1 } << task );
+}
+
+auto Supervisor::checked_in_tasks() const noexcept -> std::uint32_t
+{
+    auto checked_in_tasks = std::uint32_t{};
+
+    for ( auto task = Task{}; task < TASKS_MAX; ++task ) {
+        if ( m_check_in[ task ] ) {
+            checked_in_tasks |= std::uint32_t{ 1 } << task;
+        } // if
+    }     // for
+
+    return checked_in_tasks & m_live;
+}
+
+auto Supervisor::service() noexcept -> bool
+{
+    for ( auto task = Task{}; task < TASKS_MAX; ++task ) {
+        auto const task_mask = std::uint32_t{ 1 } << task;
+
+        if ( not( m_live & task_mask ) ) {
+            continue;
+        } // if
+
+        if ( m_check_in[ task ] ) {
+            m_check_in[ task ]  = 0;
+            m_remaining[ task ] = m_deadline[ task ];
+        } else if ( m_remaining[ task ] == 0 or --m_remaining[ task ] == 0 ) {
+            m_stalled |= task_mask;
+        } // else if
+    }     // for
+
+    if ( m_stalled ) {
+        return false;
+    } // if
+
+    m_wdt->clear = CLEAR_KEY;
+
+    return true;
+}
+
+void record_reset_cause( std::uint8_t rcause ) noexcept
+{
+    if ( snapshot.signature != SIGNATURE ) {
+        snapshot = Crash_Snapshot{};
+
+        snapshot.signature = SIGNATURE;
+    } // if
+
+    for ( auto i = Crash_Snapshot::RESET_CAUSE_HISTORY_SIZE - 1; i > 0; --i ) {
+        snapshot.reset_cause_history[ i ] = snapshot.reset_cause_history[ i - 1 ];
+    } // for
+
+    snapshot.reset_cause_history[ 0 ] = rcause;
+}
+
+void trace( std::uint32_t value ) noexcept
+{
+    snapshot.trace[ snapshot.trace_head % Crash_Snapshot::TRACE_SIZE ] = value;
+
+    ++snapshot.trace_head;
+}
+
+void enable_early_warning(
+    Peripheral::WDT &                 wdt,
+    Peripheral::WDT::EWCTRL::EWOFFSET ewoffset,
+    Supervisor const &                supervisor ) noexcept
+{
+    early_warning_wdt        = &wdt;
+    early_warning_supervisor = &supervisor;
+
+    wdt.ewctrl   = ewoffset;
+    wdt.intflag  = Peripheral::WDT::INTFLAG::Mask::EW;
+    wdt.intenset = Peripheral::WDT::INTENSET::Mask::EW;
+}
+
+auto crash_snapshot() noexcept -> Crash_Snapshot const &
+{
+    return snapshot;
+}
+
+auto store_crash_snapshot( Peripheral::NVMCTRL & nvmctrl, std::uint32_t address ) noexcept
+    -> bool
+{
+    auto const watchdog_reset = snapshot.reset_cause_history[ 0 ]
+                                & Peripheral::PM::RCAUSE::Mask::WDT;
+
+    if ( snapshot.captured != CAPTURED or not watchdog_reset ) {
+        return false;
+    } // if
+
+    for ( auto row = std::uint32_t{}; row < sizeof( Crash_Snapshot );
+          row += NVM::ROW_SIZE ) {
+        NVM::erase_row( nvmctrl, address + row );
+    } // for
+
+    NVM::write( nvmctrl, address, &snapshot, sizeof( Crash_Snapshot ) );
+
+    snapshot.captured = 0;
+
+    return true;
+}
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Watchdog
+
+extern "C" void picolibrary_microchip_sam_d21da1_watchdog_capture_crash_snapshot(
+    ::picolibrary::Microchip::SAM::D21DA1::Interrupt::Exception_Frame const *
+        frame ) noexcept
+{
+    using namespace ::picolibrary::Microchip::SAM::D21DA1;
+    using namespace ::picolibrary::Microchip::SAM::D21DA1::Watchdog;
+
+    snapshot.pc = frame->pc;
+    snapshot.lr = frame->lr;
+
+    if ( early_warning_supervisor ) {
+        snapshot.live_tasks       = early_warning_supervisor->live_tasks();
+        snapshot.checked_in_tasks = early_warning_supervisor->checked_in_tasks();
+        snapshot.stalled_tasks    = early_warning_supervisor->stalled_tasks();
+    } // if
+
+    snapshot.captured = CAPTURED;
+
+    early_warning_wdt->intflag = Peripheral::WDT::INTFLAG::Mask::EW;
+}
@@ -0,0 +1,64 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Interrupt host test double interface.
+ *
+ * Host tests call interrupt handlers synchronously from the test thread, so critical
+ * sections do not need to disable anything.
+ */
+
+#ifndef PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_H
+#define PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_H
+
+/**
+ * \brief Microchip SAM D21/DA1 interrupt facilities.
+ */
+namespace picolibrary::Microchip::SAM::D21DA1::Interrupt {
+
+/**
+ * \brief Critical section.
+ */
+class Critical_Section {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Critical_Section() noexcept
+    {
+    }
+
+    Critical_Section( Critical_Section && ) = delete;
+
+    Critical_Section( Critical_Section const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Critical_Section() noexcept
+    {
+    }
+
+    auto operator=( Critical_Section && ) = delete;
+
+    auto operator=( Critical_Section const & ) = delete;
+};
+
+} // namespace picolibrary::Microchip::SAM::D21DA1::Interrupt
+
+#endif // PICOLIBRARY_MICROCHIP_SAM_D21DA1_INTERRUPT_H
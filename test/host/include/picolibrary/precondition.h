@@ -0,0 +1,53 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary precondition host test double interface.
+ *
+ * A precondition violation in a host test is a test bug, so the violated expectation is
+ * reported, and the test is aborted.
+ */
+
+#ifndef PICOLIBRARY_PRECONDITION_H
+#define PICOLIBRARY_PRECONDITION_H
+
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * \brief Check a precondition's expectation, and abort the test if the expectation is
+ *        not met.
+ *
+ * \param[in] expectation The expectation to check.
+ * \param[in] error The error to report if the expectation is not met.
+ */
+#define PICOLIBRARY_EXPECT( expectation, error )                                        \
+    do {                                                                                \
+        if ( not( expectation ) ) {                                                     \
+            static_cast<void>( error );                                                 \
+            std::fprintf(                                                               \
+                stderr,                                                                 \
+                "%s:%d: expectation not met: %s\n",                                     \
+                __FILE__,                                                               \
+                __LINE__,                                                               \
+                #expectation );                                                         \
+            std::abort();                                                               \
+        } /* if */                                                                      \
+    } while ( false )
+
+#endif // PICOLIBRARY_PRECONDITION_H
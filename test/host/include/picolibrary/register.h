@@ -0,0 +1,200 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Register host test double interface.
+ *
+ * Host tests build drivers against simulated peripherals that live in ordinary memory.
+ * This header replaces picolibrary's register facilities so that a simulated peripheral
+ * can observe register writes (e.g. to implement write one to set and write one to clear
+ * registers).
+ */
+
+#ifndef PICOLIBRARY_REGISTER_H
+#define PICOLIBRARY_REGISTER_H
+
+#include <cstdint>
+
+namespace picolibrary {
+
+/**
+ * \brief Host testing facilities.
+ */
+namespace Testing::Host {
+
+/**
+ * \brief Register write handler.
+ *
+ * \param[in] address The address of the register being written.
+ * \param[in] value The value being written.
+ *
+ * \return true if the write has been handled.
+ * \return false if the value should be stored in the register.
+ */
+using Register_Write_Handler =
+    bool ( * )( void const volatile * address, std::uint32_t value );
+
+/**
+ * \brief The register write handler (nullptr if register writes are not observed).
+ */
+inline Register_Write_Handler register_write_handler{};
+
+} // namespace Testing::Host
+
+/**
+ * \brief Register.
+ *
+ * \tparam T The register's underlying integer type.
+ */
+template<typename T>
+class Register {
+  public:
+    /**
+     * \brief The register's underlying integer type.
+     */
+    using Type = T;
+
+    Register() = delete;
+
+    Register( Register && ) = delete;
+
+    Register( Register const & ) = delete;
+
+    ~Register() = delete;
+
+    auto operator=( Register && ) = delete;
+
+    auto operator=( Register const & ) = delete;
+
+    /**
+     * \brief Read the register.
+     *
+     * \return The register's value.
+     */
+    operator Type() const noexcept
+    {
+        return m_value;
+    }
+
+    /**
+     * \brief Write the register.
+     *
+     * \param[in] value The value to write.
+     *
+     * \return The register.
+     */
+    auto operator=( Type value ) noexcept -> Register &
+    {
+        write( value );
+
+        return *this;
+    }
+
+    /**
+     * \brief Set bits in the register (read-modify-write).
+     *
+     * \param[in] mask The mask identifying the bits to set.
+     *
+     * \return The register.
+     */
+    auto operator|=( Type mask ) noexcept -> Register &
+    {
+        write( m_value | mask );
+
+        return *this;
+    }
+
+    /**
+     * \brief Clear bits in the register (read-modify-write).
+     *
+     * \param[in] mask The mask identifying the bits to keep.
+     *
+     * \return The register.
+     */
+    auto operator&=( Type mask ) noexcept -> Register &
+    {
+        write( m_value & mask );
+
+        return *this;
+    }
+
+    /**
+     * \brief Toggle bits in the register (read-modify-write).
+     *
+     * \param[in] mask The mask identifying the bits to toggle.
+     *
+     * \return The register.
+     */
+    auto operator^=( Type mask ) noexcept -> Register &
+    {
+        write( m_value ^ mask );
+
+        return *this;
+    }
+
+  private:
+    /**
+     * \brief The register's value.
+     */
+    Type volatile m_value;
+
+    /**
+     * \brief Write the register.
+     *
+     * \param[in] value The value to write.
+     */
+    void write( Type value ) noexcept
+    {
+        auto const handler = Testing::Host::register_write_handler;
+
+        if ( not handler or not handler( &m_value, value ) ) {
+            m_value = value;
+        } // if
+    }
+};
+
+/**
+ * \brief Reserved register.
+ *
+ * \tparam T The register's underlying integer type.
+ */
+template<typename T>
+class Reserved_Register {
+  public:
+    Reserved_Register() = delete;
+
+    Reserved_Register( Reserved_Register && ) = delete;
+
+    Reserved_Register( Reserved_Register const & ) = delete;
+
+    ~Reserved_Register() = delete;
+
+    auto operator=( Reserved_Register && ) = delete;
+
+    auto operator=( Reserved_Register const & ) = delete;
+
+  private:
+    /**
+     * \brief The register's value.
+     */
+    T volatile m_value;
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_REGISTER_H
@@ -0,0 +1,323 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Ring_Buffer host test program.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "picolibrary/microchip/sam/d21da1/ring_buffer.h"
+
+namespace {
+
+using ::picolibrary::Microchip::SAM::D21DA1::Ring_Buffer;
+
+/**
+ * \brief The number of elements transferred by each stress test.
+ */
+constexpr auto ELEMENTS = std::uint32_t{ 1 } << 20;
+
+/**
+ * \brief The maximum number of elements transferred by a single bulk operation.
+ */
+constexpr auto BULK_SIZE = std::uint32_t{ 7 };
+
+/**
+ * \brief Ring buffer element.
+ *
+ * The complement of the element's sequence number is stored with the sequence number so
+ * that an element that is popped before it is completely written can be detected.
+ */
+struct Element {
+    /**
+     * \brief The element's sequence number.
+     */
+    std::uint32_t sequence;
+
+    /**
+     * \brief The complement of the element's sequence number.
+     */
+    std::uint32_t complement;
+};
+
+/**
+ * \brief The ring buffer under test.
+ *
+ * The capacity is small (and not a multiple of the bulk operation size) so that the ring
+ * buffer is frequently full, frequently empty, and frequently wraps in the middle of a
+ * bulk operation.
+ */
+using Buffer = Ring_Buffer<Element, 16>;
+
+/**
+ * \brief Stress test context.
+ */
+struct Context {
+    /**
+     * \brief The ring buffer under test.
+     */
+    Buffer buffer;
+
+    /**
+     * \brief The consumer has detected a failure (the producer must stop, or it will wait
+     *        for free space forever).
+     */
+    std::atomic<bool> abandoned{};
+};
+
+/**
+ * \brief Producer/consumer operation style.
+ */
+enum class Operation {
+    SINGLE, ///< Single element push/pop.
+    BULK,   ///< Bulk push/pop.
+    SPAN,   ///< write_span()/commit() and read_span()/consume().
+};
+
+/**
+ * \brief Make an element.
+ *
+ * \param[in] sequence The element's sequence number.
+ *
+ * \return The element.
+ */
+auto make_element( std::uint32_t sequence ) noexcept -> Element
+{
+    return { sequence, ~sequence };
+}
+
+/**
+ * \brief Pin a thread to the first CPU the process is allowed to run on.
+ *
+ * The ring buffer only uses compiler barriers, which are sufficient on a single core (the
+ * ring buffer's target) and on x86 (whose memory model does not reorder the ring buffer's
+ * loads and stores). On other hosts, the producer and consumer must share a CPU.
+ *
+ * \param[in] thread The thread to pin.
+ */
+void pin( [[maybe_unused]] std::thread & thread ) noexcept
+{
+#if not defined( __x86_64__ ) and not defined( __i386__ )
+    cpu_set_t allowed;
+    ASSERT_EQ( sched_getaffinity( 0, sizeof( allowed ), &allowed ), 0 );
+
+    auto cpu = 0;
+    while ( not CPU_ISSET( cpu, &allowed ) ) {
+        ++cpu;
+    } // while
+
+    cpu_set_t pinned;
+    CPU_ZERO( &pinned );
+    CPU_SET( cpu, &pinned );
+
+    ASSERT_EQ(
+        pthread_setaffinity_np( thread.native_handle(), sizeof( pinned ), &pinned ), 0 );
+#endif // not defined( __x86_64__ ) and not defined( __i386__ )
+}
+
+/**
+ * \brief Push every element into the ring buffer under test.
+ *
+ * \param[in] context The stress test context.
+ * \param[in] operation The operation style to use.
+ */
+void produce( Context & context, Operation operation ) noexcept
+{
+    auto & buffer   = context.buffer;
+    auto   sequence = std::uint32_t{};
+
+    while ( sequence < ELEMENTS and not context.abandoned ) {
+        auto pushed = std::uint32_t{};
+
+        switch ( operation ) {
+            case Operation::SINGLE:
+                pushed = buffer.push( make_element( sequence ) );
+                break;
+            case Operation::BULK: {
+                Element elements[ BULK_SIZE ];
+
+                // vary the bulk operation size so that every wrap offset is exercised
+                auto const n = std::min( 1 + sequence % BULK_SIZE, ELEMENTS - sequence );
+
+                for ( auto i = std::uint32_t{}; i < n; ++i ) {
+                    elements[ i ] = make_element( sequence + i );
+                } // for
+
+                pushed = buffer.push( elements, n );
+            } break;
+            case Operation::SPAN: {
+                auto const span = buffer.write_span();
+                auto const n    = std::min( span.size, ELEMENTS - sequence );
+
+                for ( auto i = std::uint32_t{}; i < n; ++i ) {
+                    span.data[ i ] = make_element( sequence + i );
+                } // for
+
+                buffer.commit( n );
+
+                pushed = n;
+            } break;
+        } // switch
+
+        if ( not pushed ) {
+            std::this_thread::yield();
+        } // if
+
+        sequence += pushed;
+    } // while
+}
+
+/**
+ * \brief Pop every element from the ring buffer under test, and verify that the elements
+ *        were popped in order and were completely written before they were popped.
+ *
+ * \param[in] context The stress test context.
+ * \param[in] operation The operation style to use.
+ */
+void consume( Context & context, Operation operation ) noexcept
+{
+    auto & buffer   = context.buffer;
+    auto   sequence = std::uint32_t{};
+
+    while ( sequence < ELEMENTS ) {
+        Element         elements[ BULK_SIZE ];
+        Element const * popped_elements = elements;
+        auto            popped          = std::uint32_t{};
+
+        EXPECT_LE( buffer.size(), Buffer::capacity() );
+
+        switch ( operation ) {
+            case Operation::SINGLE: popped = buffer.pop( elements[ 0 ] ); break;
+            case Operation::BULK:
+                popped = buffer.pop( elements, 1 + sequence % BULK_SIZE );
+                break;
+            case Operation::SPAN: {
+                auto const span = buffer.read_span();
+
+                popped_elements = span.data;
+                popped          = span.size;
+            } break;
+        } // switch
+
+        if ( not popped ) {
+            std::this_thread::yield();
+        } // if
+
+        for ( auto i = std::uint32_t{}; i < popped; ++i ) {
+            auto const element = popped_elements[ i ];
+
+            if ( element.sequence != sequence + i
+                 or element.complement != ~element.sequence ) {
+                context.abandoned = true;
+
+                FAIL() << "expected element " << sequence + i << ", popped element "
+                       << element.sequence << " (complement " << element.complement
+                       << ")";
+            } // if
+        } // for
+
+        if ( operation == Operation::SPAN ) {
+            buffer.consume( popped );
+        } // if
+
+        sequence += popped;
+    } // while
+
+    EXPECT_TRUE( buffer.empty() );
+}
+
+/**
+ * \brief Transfer every element from a producer thread to a consumer thread.
+ *
+ * \param[in] producer_operation The producer's operation style.
+ * \param[in] consumer_operation The consumer's operation style.
+ */
+void stress( Operation producer_operation, Operation consumer_operation )
+{
+    Context context;
+
+    auto consumer = std::thread{ [ & ] { consume( context, consumer_operation ); } };
+    auto producer = std::thread{ [ & ] { produce( context, producer_operation ); } };
+
+    pin( consumer );
+    pin( producer );
+
+    producer.join();
+    consumer.join();
+}
+
+} // namespace
+
+/**
+ * \brief Verify elements pushed using single element pushes are popped in order using
+ *        single element pops.
+ */
+TEST( twoThreadStress, singlePushSinglePop )
+{
+    stress( Operation::SINGLE, Operation::SINGLE );
+}
+
+/**
+ * \brief Verify elements pushed using bulk pushes are popped in order using bulk pops.
+ */
+TEST( twoThreadStress, bulkPushBulkPop )
+{
+    stress( Operation::BULK, Operation::BULK );
+}
+
+/**
+ * \brief Verify elements written to write spans are read in order from read spans.
+ */
+TEST( twoThreadStress, writeSpanReadSpan )
+{
+    stress( Operation::SPAN, Operation::SPAN );
+}
+
+/**
+ * \brief Verify elements pushed using single element pushes are popped in order using
+ *        bulk pops.
+ */
+TEST( twoThreadStress, singlePushBulkPop )
+{
+    stress( Operation::SINGLE, Operation::BULK );
+}
+
+/**
+ * \brief Verify elements pushed using bulk pushes are read in order from read spans.
+ */
+TEST( twoThreadStress, bulkPushReadSpan )
+{
+    stress( Operation::BULK, Operation::SPAN );
+}
+
+/**
+ * \brief Verify elements written to write spans are popped in order using single element
+ *        pops.
+ */
+TEST( twoThreadStress, writeSpanSinglePop )
+{
+    stress( Operation::SPAN, Operation::SINGLE );
+}
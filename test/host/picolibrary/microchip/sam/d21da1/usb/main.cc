@@ -0,0 +1,1260 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::USB host test program.
+ */
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "picolibrary/microchip/sam/d21da1/nvm.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral/usb.h"
+#include "picolibrary/microchip/sam/d21da1/usb.h"
+#include "picolibrary/register.h"
+
+namespace {
+
+namespace NVM        = ::picolibrary::Microchip::SAM::D21DA1::NVM;
+namespace Peripheral = ::picolibrary::Microchip::SAM::D21DA1::Peripheral;
+
+using ::picolibrary::Microchip::SAM::D21DA1::USB::Buffering;
+using ::picolibrary::Microchip::SAM::D21DA1::USB::Configuration_Handler;
+using ::picolibrary::Microchip::SAM::D21DA1::USB::Device;
+using ::picolibrary::Microchip::SAM::D21DA1::USB::Endpoint_Type;
+using ::picolibrary::Microchip::SAM::D21DA1::USB::PACKET_SIZE;
+using ::picolibrary::Microchip::SAM::D21DA1::USB::Request_Handler;
+using ::picolibrary::Microchip::SAM::D21DA1::USB::Setup_Packet;
+
+using DEVICE     = Peripheral::USB::DEVICE;
+using ENDPOINT   = DEVICE::ENDPOINT;
+using Descriptor = DEVICE::Descriptor;
+
+/**
+ * \brief The simulated SRAM's address.
+ *
+ * The simulated memory is mapped at the SAM D21/DA1's addresses, so that the 32-bit
+ * descriptor and buffer addresses used by the USB peripheral are valid host addresses.
+ */
+constexpr auto SRAM_ADDRESS = std::uintptr_t{ 0x2000'0000 };
+
+/**
+ * \brief The simulated SRAM's size.
+ */
+constexpr auto SRAM_SIZE = std::size_t{ 0x8000 };
+
+/**
+ * \brief The simulated USB peripheral's address.
+ */
+constexpr auto USB_ADDRESS = std::uintptr_t{ 0x4100'5000 };
+
+/**
+ * \brief The size of a simulated memory page.
+ */
+constexpr auto PAGE_SIZE = std::size_t{ 0x1000 };
+
+/**
+ * \brief Simulated memory.
+ */
+struct Memory {
+    /**
+     * \brief The simulated SRAM.
+     */
+    std::uint8_t * sram;
+
+    /**
+     * \brief The simulated USB peripheral.
+     */
+    Peripheral::USB * usb;
+};
+
+/**
+ * \brief Map simulated memory.
+ *
+ * \param[in] address The address to map the simulated memory at.
+ * \param[in] size The size of the simulated memory.
+ *
+ * \return The simulated memory.
+ */
+auto map( std::uintptr_t address, std::size_t size ) noexcept -> void *
+{
+    auto * const memory = mmap(
+        reinterpret_cast<void *>( address ),
+        size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+        -1,
+        0 );
+
+    if ( memory != reinterpret_cast<void *>( address ) ) {
+        std::fprintf( stderr, "simulated memory could not be mapped at %#lx\n", address );
+        std::abort();
+    } // if
+
+    return memory;
+}
+
+/**
+ * \brief Get the simulated memory (mapped the first time it is requested).
+ *
+ * \return The simulated memory.
+ */
+auto simulated_memory() noexcept -> Memory const &
+{
+    static auto const memory = [] {
+        // the NVM software calibration area has not been programmed (all ones), so the
+        // USB peripheral's default pad calibration values are used
+        auto * const calibration = map(
+            NVM::SOFTWARE_CALIBRATION_ADDRESS & ~( PAGE_SIZE - 1 ), PAGE_SIZE );
+
+        std::memset( calibration, 0xFF, PAGE_SIZE );
+
+        return Memory{ static_cast<std::uint8_t *>( map( SRAM_ADDRESS, SRAM_SIZE ) ),
+                       static_cast<Peripheral::USB *>( map( USB_ADDRESS, PAGE_SIZE ) ) };
+    }();
+
+    return memory;
+}
+
+/**
+ * \brief Access a register's value without triggering the register's write side
+ *        effects.
+ *
+ * \tparam T The register's underlying integer type.
+ *
+ * \param[in] reg The register.
+ *
+ * \return The register's value.
+ */
+template<typename T>
+auto raw( ::picolibrary::Register<T> const & reg ) noexcept -> T volatile &
+{
+    return *reinterpret_cast<T volatile *>(
+        const_cast<::picolibrary::Register<T> *>( &reg ) );
+}
+
+/**
+ * \brief Handshake (the USB peripheral's response to a transaction).
+ */
+enum class Handshake {
+    NONE,  ///< No response (the endpoint is not enabled in the transaction's direction).
+    ACK,   ///< ACK.
+    NAK,   ///< NAK.
+    STALL, ///< STALL.
+};
+
+/**
+ * \brief Simulated USB peripheral and USB host.
+ *
+ * The driver under test, its descriptor table, and every transfer buffer live in
+ * simulated SRAM (the endpoint RAM), and the USB peripheral's registers live in
+ * simulated peripheral memory. Register writes are observed so that write one to set and
+ * write one to clear registers behave like the USB peripheral's registers. The simulated
+ * USB host's transactions read and write the endpoint RAM, and update the bank
+ * descriptors, bank status, and interrupt flags the way the USB peripheral does. The USB
+ * interrupt is serviced (the driver's interrupt handler is called) after each
+ * transaction unless it has been masked.
+ */
+class Simulator {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * The driver is constructed and enabled.
+     *
+     * \param[in] request_handler The driver's request handler.
+     * \param[in] configuration_handler The driver's configuration handler.
+     * \param[in] context The driver's request and configuration handler context.
+     */
+    Simulator(
+        Request_Handler       request_handler,
+        Configuration_Handler configuration_handler,
+        void *                context ) noexcept :
+        m_usb{ simulated_memory().usb }
+    {
+        auto * const sram = simulated_memory().sram;
+
+        std::memset( sram, 0, SRAM_SIZE );
+        std::memset( static_cast<void *>( m_usb ), 0, PAGE_SIZE );
+
+        m_device = new ( sram )
+            Device{ *m_usb, request_handler, configuration_handler, context };
+        m_free = sram + ( ( sizeof( Device ) + 3 ) & ~std::size_t{ 3 } );
+
+        s_simulator = this;
+
+        ::picolibrary::Testing::Host::register_write_handler = handle_register_write;
+
+        m_device->enable();
+    }
+
+    Simulator( Simulator && ) = delete;
+
+    Simulator( Simulator const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Simulator() noexcept
+    {
+        m_device->~Device();
+
+        ::picolibrary::Testing::Host::register_write_handler = nullptr;
+
+        s_simulator = nullptr;
+    }
+
+    auto operator=( Simulator && ) = delete;
+
+    auto operator=( Simulator const & ) = delete;
+
+    /**
+     * \brief Get the driver under test.
+     *
+     * \return The driver under test.
+     */
+    auto device() noexcept -> Device &
+    {
+        return *m_device;
+    }
+
+    /**
+     * \brief Allocate a 32-bit aligned buffer in simulated SRAM.
+     *
+     * \param[in] size The size of the buffer.
+     *
+     * \return The buffer.
+     */
+    auto allocate( std::size_t size ) noexcept -> std::uint8_t *
+    {
+        auto * const buffer = m_free;
+
+        m_free += ( size + 3 ) & ~std::size_t{ 3 };
+
+        if ( m_free > simulated_memory().sram + SRAM_SIZE ) {
+            std::fprintf( stderr, "simulated SRAM exhausted\n" );
+            std::abort();
+        } // if
+
+        return buffer;
+    }
+
+    /**
+     * \brief Get the device address the USB peripheral responds to.
+     *
+     * \return The DADD register's value.
+     */
+    auto address() const noexcept -> std::uint8_t
+    {
+        return raw( m_usb->device.dadd );
+    }
+
+    /**
+     * \brief Mask the USB interrupt (the USB interrupt is not serviced until it is
+     *        unmasked).
+     */
+    void mask_interrupt() noexcept
+    {
+        m_interrupt_masked = true;
+    }
+
+    /**
+     * \brief Unmask the USB interrupt, and service it if it is pending.
+     */
+    void unmask_interrupt() noexcept
+    {
+        m_interrupt_masked = false;
+
+        service();
+    }
+
+    /**
+     * \brief Reset the bus.
+     */
+    void reset() noexcept
+    {
+        auto & device = m_usb->device;
+
+        raw( device.dadd ) = 0;
+
+        for ( auto & endpoint : device.endpoint ) {
+            raw( endpoint.epcfg )     = 0;
+            raw( endpoint.epstatus )  = 0;
+            raw( endpoint.epintflag ) = 0;
+        } // for
+
+        raw( device.intflag ) |= DEVICE::INTFLAG::Mask::EORST;
+
+        update_summary();
+        service();
+    }
+
+    /**
+     * \brief Send a setup packet to the control endpoint.
+     *
+     * \param[in] setup The setup packet.
+     *
+     * \return The USB peripheral's handshake.
+     */
+    auto setup( Setup_Packet const & setup ) noexcept -> Handshake
+    {
+        if ( not bank( 0, false ) ) {
+            return Handshake::NONE;
+        } // if
+
+        auto & endpoint   = m_usb->device.endpoint[ 0 ];
+        auto & descriptor = this->descriptor( 0, 0 );
+
+        // setup packets are always received in bank 0 (even if it is full or stalled)
+        std::memcpy( buffer( descriptor ), &setup, sizeof( setup ) );
+
+        descriptor.pcksize = ( descriptor.pcksize
+                               & ~Descriptor::PCKSIZE::Mask::BYTE_COUNT )
+                             | sizeof( setup );
+
+        raw( endpoint.epstatus ) |= ENDPOINT::EPSTATUS::Mask::BK0RDY;
+        raw( endpoint.epintflag ) |= ENDPOINT::EPINTFLAG::Mask::RXSTP;
+
+        update_summary();
+        service();
+
+        return Handshake::ACK;
+    }
+
+    /**
+     * \brief Request an IN packet from an endpoint.
+     *
+     * \param[in] number The endpoint number.
+     * \param[out] packet The packet sent by the USB peripheral (empty if the USB
+     *             peripheral did not ACK the transaction).
+     *
+     * \return The USB peripheral's handshake.
+     */
+    auto in( std::uint_fast8_t number, std::vector<std::uint8_t> & packet ) -> Handshake
+    {
+        using PCKSIZE = Descriptor::PCKSIZE;
+
+        packet.clear();
+
+        auto const bank = this->bank( number, true );
+
+        if ( not bank ) {
+            return Handshake::NONE;
+        } // if
+
+        std::uint8_t const status = raw( m_usb->device.endpoint[ number ].epstatus );
+
+        if ( status & ( ENDPOINT::EPSTATUS::Mask::STALLRQ0 << *bank ) ) {
+            return Handshake::STALL;
+        } // if
+
+        if ( not( status & ( ENDPOINT::EPSTATUS::Mask::BK0RDY << *bank ) ) ) {
+            return Handshake::NAK;
+        } // if
+
+        auto &              descriptor = this->descriptor( number, *bank );
+        std::uint32_t const pcksize    = descriptor.pcksize;
+
+        // MULTI_PACKET_SIZE counts the bytes of the BYTE_COUNT byte transfer that have
+        // been sent
+        auto const byte_count = pcksize & PCKSIZE::Mask::BYTE_COUNT;
+        auto const sent       = ( pcksize & PCKSIZE::Mask::MULTI_PACKET_SIZE )
+                          >> PCKSIZE::Bit::MULTI_PACKET_SIZE;
+        auto const size = std::min<std::uint32_t>( byte_count - sent, PACKET_SIZE );
+
+        packet.assign( buffer( descriptor ) + sent, buffer( descriptor ) + sent + size );
+
+        descriptor.pcksize = ( pcksize & ~PCKSIZE::Mask::MULTI_PACKET_SIZE )
+                             | ( ( sent + size ) << PCKSIZE::Bit::MULTI_PACKET_SIZE );
+
+        // a transfer ends with a short packet, or with a full packet if an automatic zero
+        // length packet has not been requested
+        if ( size < PACKET_SIZE
+             or ( sent + size == byte_count
+                  and not( pcksize & PCKSIZE::Mask::AUTO_ZLP ) ) ) {
+            complete( number, *bank, true );
+        } // if
+
+        return Handshake::ACK;
+    }
+
+    /**
+     * \brief Send an OUT packet to an endpoint.
+     *
+     * \param[in] number The endpoint number.
+     * \param[in] packet The packet.
+     *
+     * \return The USB peripheral's handshake.
+     */
+    auto out( std::uint_fast8_t number, std::vector<std::uint8_t> const & packet )
+        -> Handshake
+    {
+        using PCKSIZE = Descriptor::PCKSIZE;
+
+        auto const bank = this->bank( number, false );
+
+        if ( not bank ) {
+            return Handshake::NONE;
+        } // if
+
+        std::uint8_t const status = raw( m_usb->device.endpoint[ number ].epstatus );
+
+        if ( status & ( ENDPOINT::EPSTATUS::Mask::STALLRQ0 << *bank ) ) {
+            return Handshake::STALL;
+        } // if
+
+        // a "ready" OUT bank is full
+        if ( status & ( ENDPOINT::EPSTATUS::Mask::BK0RDY << *bank ) ) {
+            return Handshake::NAK;
+        } // if
+
+        auto &              descriptor = this->descriptor( number, *bank );
+        std::uint32_t const pcksize    = descriptor.pcksize;
+
+        // BYTE_COUNT counts the bytes of the MULTI_PACKET_SIZE byte transfer that have
+        // been received (a MULTI_PACKET_SIZE of 0 receives a single packet)
+        auto const received = pcksize & PCKSIZE::Mask::BYTE_COUNT;
+        auto const capacity = ( pcksize & PCKSIZE::Mask::MULTI_PACKET_SIZE )
+                              >> PCKSIZE::Bit::MULTI_PACKET_SIZE;
+
+        std::copy( packet.begin(), packet.end(), buffer( descriptor ) + received );
+
+        descriptor.pcksize = ( pcksize & ~PCKSIZE::Mask::BYTE_COUNT )
+                             | ( received + packet.size() );
+
+        if ( packet.size() < PACKET_SIZE or received + packet.size() >= capacity ) {
+            complete( number, *bank, false );
+        } // if
+
+        return Handshake::ACK;
+    }
+
+  private:
+    /**
+     * \brief The simulator whose USB peripheral is observing register writes.
+     */
+    inline static Simulator * s_simulator{};
+
+    /**
+     * \brief The simulated USB peripheral.
+     */
+    Peripheral::USB * m_usb;
+
+    /**
+     * \brief The driver under test.
+     */
+    Device * m_device{};
+
+    /**
+     * \brief The first free byte of simulated SRAM.
+     */
+    std::uint8_t * m_free{};
+
+    /**
+     * \brief The USB interrupt is masked.
+     */
+    bool m_interrupt_masked{};
+
+    /**
+     * \brief Handle a register write.
+     *
+     * \param[in] address The address of the register being written.
+     * \param[in] value The value being written.
+     *
+     * \return true if the write has been handled.
+     * \return false if the value should be stored in the register.
+     */
+    static auto handle_register_write(
+        void const volatile * address,
+        std::uint32_t         value ) noexcept -> bool
+    {
+        return s_simulator->write( address, value );
+    }
+
+    /**
+     * \brief Apply a register write's side effects.
+     *
+     * \param[in] address The address of the register being written.
+     * \param[in] value The value being written.
+     *
+     * \return true if the write has been handled.
+     * \return false if the value should be stored in the register.
+     */
+    auto write( void const volatile * address, std::uint32_t value ) noexcept -> bool
+    {
+        auto & device = m_usb->device;
+
+        if ( address == &device.intflag ) {
+            raw( device.intflag ) &= ~value;
+
+            return true;
+        } // if
+
+        if ( address == &device.intenset or address == &device.intenclr ) {
+            raw( device.intenset ) = address == &device.intenset
+                                         ? raw( device.intenset ) | value
+                                         : raw( device.intenset ) & ~value;
+            raw( device.intenclr ) = raw( device.intenset );
+
+            return true;
+        } // if
+
+        for ( auto & endpoint : device.endpoint ) {
+            if ( address == &endpoint.epstatusset ) {
+                raw( endpoint.epstatus ) |= value;
+
+                return true;
+            } // if
+
+            if ( address == &endpoint.epstatusclr ) {
+                raw( endpoint.epstatus ) &= ~value;
+
+                return true;
+            } // if
+
+            if ( address == &endpoint.epintflag ) {
+                raw( endpoint.epintflag ) &= ~value;
+
+                update_summary();
+
+                return true;
+            } // if
+
+            if ( address == &endpoint.epintenset or address == &endpoint.epintenclr ) {
+                raw( endpoint.epintenset ) = address == &endpoint.epintenset
+                                                 ? raw( endpoint.epintenset ) | value
+                                                 : raw( endpoint.epintenset ) & ~value;
+                raw( endpoint.epintenclr ) = raw( endpoint.epintenset );
+
+                update_summary();
+
+                return true;
+            } // if
+        }     // for
+
+        return false;
+    }
+
+    /**
+     * \brief Update the endpoint interrupt summary.
+     */
+    void update_summary() noexcept
+    {
+        auto summary = std::uint16_t{};
+
+        for ( auto number = std::uint_fast8_t{}; number < 8; ++number ) {
+            auto const & endpoint = m_usb->device.endpoint[ number ];
+
+            if ( raw( endpoint.epintflag ) & raw( endpoint.epintenset ) ) {
+                summary |= 1 << number;
+            } // if
+        }     // for
+
+        raw( m_usb->device.epintsmry ) = summary;
+    }
+
+    /**
+     * \brief Service the USB interrupt while it is pending and not masked.
+     */
+    void service() noexcept
+    {
+        auto const & device = m_usb->device;
+
+        for ( auto i = 0; not m_interrupt_masked
+                          and ( ( raw( device.intflag ) & raw( device.intenset ) )
+                                or raw( device.epintsmry ) );
+              ++i ) {
+            if ( i == 8 ) {
+                ADD_FAILURE() << "the USB interrupt is not being cleared";
+
+                return;
+            } // if
+
+            m_device->handle_interrupt();
+        } // for
+    }
+
+    /**
+     * \brief Get an endpoint bank's type.
+     *
+     * \param[in] number The endpoint number.
+     * \param[in] bank The bank.
+     *
+     * \return The endpoint bank's type (EPCFG.EPTYPEn).
+     */
+    auto type( std::uint_fast8_t number, std::uint_fast8_t bank ) const noexcept
+        -> std::uint_fast8_t
+    {
+        using EPCFG = ENDPOINT::EPCFG;
+
+        std::uint8_t const epcfg = raw( m_usb->device.endpoint[ number ].epcfg );
+
+        return bank ? ( epcfg & EPCFG::Mask::EPTYPE1 ) >> EPCFG::Bit::EPTYPE1
+                    : ( epcfg & EPCFG::Mask::EPTYPE0 ) >> EPCFG::Bit::EPTYPE0;
+    }
+
+    /**
+     * \brief Check if an endpoint's banks alternate in a direction.
+     *
+     * \param[in] number The endpoint number.
+     * \param[in] in true if the direction is IN.
+     *
+     * \return true if the endpoint's other bank is a dual bank.
+     * \return false if the endpoint's other bank is not a dual bank.
+     */
+    auto dual_bank( std::uint_fast8_t number, bool in ) const noexcept -> bool
+    {
+        using EPCFG = ENDPOINT::EPCFG;
+
+        return type( number, in ? 0 : 1 )
+               == EPCFG::EPTYPE0_DUAL_BANK >> EPCFG::Bit::EPTYPE0;
+    }
+
+    /**
+     * \brief Get the bank that handles an endpoint's next transaction in a direction.
+     *
+     * \param[in] number The endpoint number.
+     * \param[in] in true if the transaction is an IN transaction.
+     *
+     * \return The bank (nullopt if the endpoint is not enabled in the transaction's
+     *         direction).
+     */
+    auto bank( std::uint_fast8_t number, bool in ) const noexcept
+        -> std::optional<std::uint_fast8_t>
+    {
+        // bank 0 handles OUT transactions and bank 1 handles IN transactions, unless the
+        // other bank is a dual bank, in which case the current bank alternates
+        if ( not type( number, in ? 1 : 0 ) or dual_bank( number, not in ) ) {
+            return {};
+        } // if
+
+        if ( dual_bank( number, in ) ) {
+            return static_cast<bool>(
+                raw( m_usb->device.endpoint[ number ].epstatus )
+                & ENDPOINT::EPSTATUS::Mask::CURBK );
+        } // if
+
+        return in ? 1 : 0;
+    }
+
+    /**
+     * \brief Get an endpoint bank's descriptor.
+     *
+     * \param[in] number The endpoint number.
+     * \param[in] bank The bank.
+     *
+     * \return The endpoint bank's descriptor.
+     */
+    auto descriptor( std::uint_fast8_t number, std::uint_fast8_t bank ) const noexcept
+        -> Descriptor volatile &
+    {
+        auto * const descriptors = reinterpret_cast<Descriptor volatile *>(
+            static_cast<std::uintptr_t>( raw( m_usb->device.descadd ) ) );
+
+        return descriptors[ 2 * number + bank ];
+    }
+
+    /**
+     * \brief Get an endpoint bank's buffer.
+     *
+     * \param[in] descriptor The endpoint bank's descriptor.
+     *
+     * \return The endpoint bank's buffer.
+     */
+    static auto buffer( Descriptor volatile const & descriptor ) noexcept
+        -> std::uint8_t *
+    {
+        return reinterpret_cast<std::uint8_t *>(
+            static_cast<std::uintptr_t>( descriptor.addr ) );
+    }
+
+    /**
+     * \brief Complete an endpoint bank's transfer.
+     *
+     * \param[in] number The endpoint number.
+     * \param[in] bank The bank.
+     * \param[in] in true if the transfer is an IN transfer.
+     */
+    void complete( std::uint_fast8_t number, std::uint_fast8_t bank, bool in ) noexcept
+    {
+        using EPSTATUS = ENDPOINT::EPSTATUS;
+
+        auto & endpoint = m_usb->device.endpoint[ number ];
+
+        // an IN bank is no longer ready once it has been sent, and an OUT bank is ready
+        // (full) once it has been received
+        if ( in ) {
+            raw( endpoint.epstatus ) &= ~( EPSTATUS::Mask::BK0RDY << bank );
+        } else {
+            raw( endpoint.epstatus ) |= EPSTATUS::Mask::BK0RDY << bank;
+        } // else
+
+        if ( dual_bank( number, in ) ) {
+            raw( endpoint.epstatus ) ^= EPSTATUS::Mask::CURBK;
+        } // if
+
+        raw( endpoint.epintflag ) |= ENDPOINT::EPINTFLAG::Mask::TRCPT0 << bank;
+
+        update_summary();
+        service();
+    }
+};
+
+/**
+ * \brief GET_DESCRIPTOR( DEVICE ) setup packet request type and request.
+ */
+constexpr auto GET_DESCRIPTOR = std::pair<std::uint8_t, std::uint8_t>{ 0x80, 6 };
+
+/**
+ * \brief Vendor host-to-device setup packet request type.
+ */
+constexpr auto VENDOR_OUT = std::uint8_t{ 0x40 };
+
+/**
+ * \brief Request and configuration handler context.
+ */
+struct Handlers {
+    /**
+     * \brief The driver under test.
+     */
+    Device * device;
+
+    /**
+     * \brief The setup packets of the requests that have been passed to the request
+     *        handler.
+     */
+    std::vector<Setup_Packet> requests;
+
+    /**
+     * \brief The data received in the data stages of the host-to-device requests that
+     *        have been passed to the request handler.
+     */
+    std::vector<std::vector<std::uint8_t>> data;
+
+    /**
+     * \brief The reply to GET_DESCRIPTOR requests.
+     */
+    std::vector<std::uint8_t> descriptor;
+};
+
+/**
+ * \brief Request handler (handles GET_DESCRIPTOR( DEVICE ) and vendor host-to-device
+ *        requests).
+ */
+auto handle_request(
+    void *               context,
+    Setup_Packet const & setup,
+    std::uint8_t const * data ) -> bool
+{
+    auto & handlers = *static_cast<Handlers *>( context );
+
+    handlers.requests.push_back( setup );
+
+    if ( std::make_pair( setup.request_type, setup.request ) == GET_DESCRIPTOR ) {
+        handlers.device->control_send(
+            handlers.descriptor.data(),
+            static_cast<std::uint16_t>( handlers.descriptor.size() ) );
+
+        return true;
+    } // if
+
+    if ( setup.request_type == VENDOR_OUT ) {
+        handlers.data.emplace_back( data, data + ( data ? setup.length : 0 ) );
+
+        return true;
+    } // if
+
+    return false;
+}
+
+/**
+ * \brief Configuration handler (configuration 1 has a double buffered bulk IN endpoint 1,
+ *        and a double buffered bulk OUT endpoint 2).
+ */
+void handle_configuration( void * context, std::uint8_t configuration )
+{
+    auto & handlers = *static_cast<Handlers *>( context );
+
+    if ( configuration == 1 ) {
+        auto & device = *handlers.device;
+
+        device.configure_endpoint( 0x81, Endpoint_Type::BULK, Buffering::DOUBLE );
+        device.configure_endpoint( 0x02, Endpoint_Type::BULK, Buffering::DOUBLE );
+    } // if
+}
+
+/**
+ * \brief Transfer completions (transfer name and size).
+ */
+using Completions = std::vector<std::pair<char, std::uint16_t>>;
+
+/**
+ * \brief Transfer completion callback context.
+ */
+struct Transfer {
+    /**
+     * \brief The completions the transfer's completion is recorded in.
+     */
+    Completions * completions;
+
+    /**
+     * \brief The transfer's name.
+     */
+    char name;
+};
+
+/**
+ * \brief Record a transfer's completion.
+ */
+void record_completion( void * context, std::uint16_t size )
+{
+    auto const & transfer = *static_cast<Transfer const *>( context );
+
+    transfer.completions->emplace_back( transfer.name, size );
+}
+
+/**
+ * \brief Generate a packet.
+ *
+ * \param[in] size The size of the packet.
+ * \param[in] first The value of the packet's first byte.
+ *
+ * \return The packet.
+ */
+auto make_packet( std::size_t size, std::uint8_t first ) -> std::vector<std::uint8_t>
+{
+    auto packet = std::vector<std::uint8_t>( size );
+
+    for ( auto i = std::size_t{}; i < size; ++i ) {
+        packet[ i ] = static_cast<std::uint8_t>( first + i );
+    } // for
+
+    return packet;
+}
+
+/**
+ * \brief Get a buffer's contents.
+ *
+ * \param[in] buffer The buffer.
+ * \param[in] size The number of bytes to get.
+ *
+ * \return The buffer's contents.
+ */
+auto contents( std::uint8_t const * buffer, std::size_t size )
+    -> std::vector<std::uint8_t>
+{
+    return std::vector<std::uint8_t>( buffer, buffer + size );
+}
+
+/**
+ * \brief Select configuration 1.
+ *
+ * \param[in] simulator The simulator.
+ */
+void configure( Simulator & simulator )
+{
+    auto packet = std::vector<std::uint8_t>{};
+
+    ASSERT_EQ( simulator.setup( { 0x00, 9, 1, 0, 0 } ), Handshake::ACK );
+    ASSERT_EQ( simulator.in( 0, packet ), Handshake::ACK );
+    ASSERT_EQ( simulator.device().configuration(), 1 );
+}
+
+} // namespace
+
+/**
+ * \brief Verify a device-to-host control transfer is sequenced properly (SETUP, IN data
+ *        stage, OUT status stage).
+ */
+TEST( controlTransfer, sequencesDeviceToHostRequest )
+{
+    auto handlers  = Handlers{};
+    auto simulator = Simulator{ handle_request, handle_configuration, &handlers };
+
+    handlers.device     = &simulator.device();
+    handlers.descriptor = make_packet( 18, 0x12 );
+
+    simulator.reset();
+
+    auto packet = std::vector<std::uint8_t>{};
+
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::NAK );
+
+    EXPECT_EQ( simulator.setup( { 0x80, 6, 0x0100, 0, 64 } ), Handshake::ACK );
+    ASSERT_EQ( handlers.requests.size(), 1u );
+    EXPECT_EQ( handlers.requests[ 0 ].value, 0x0100 );
+    EXPECT_EQ( handlers.requests[ 0 ].length, 64 );
+
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::ACK );
+    EXPECT_EQ( packet, handlers.descriptor );
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::NAK );
+
+    EXPECT_EQ( simulator.out( 0, {} ), Handshake::ACK );
+    EXPECT_EQ( simulator.out( 0, {} ), Handshake::NAK );
+}
+
+/**
+ * \brief Verify a device-to-host control transfer's data stage is terminated by a zero
+ *        length packet if less data than requested is sent, and the last packet is full.
+ */
+TEST( controlTransfer, terminatesShortDataStageWithZeroLengthPacket )
+{
+    auto handlers  = Handlers{};
+    auto simulator = Simulator{ handle_request, handle_configuration, &handlers };
+
+    handlers.device     = &simulator.device();
+    handlers.descriptor = make_packet( 64, 0x40 );
+
+    simulator.reset();
+
+    auto packet = std::vector<std::uint8_t>{};
+
+    EXPECT_EQ( simulator.setup( { 0x80, 6, 0x0200, 0, 255 } ), Handshake::ACK );
+
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::ACK );
+    EXPECT_EQ( packet, handlers.descriptor );
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::ACK );
+    EXPECT_TRUE( packet.empty() );
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::NAK );
+
+    EXPECT_EQ( simulator.out( 0, {} ), Handshake::ACK );
+}
+
+/**
+ * \brief Verify a device-to-host control transfer's data stage is truncated to the length
+ *        requested by the host.
+ */
+TEST( controlTransfer, truncatesDataStageToRequestedLength )
+{
+    auto handlers  = Handlers{};
+    auto simulator = Simulator{ handle_request, handle_configuration, &handlers };
+
+    handlers.device     = &simulator.device();
+    handlers.descriptor = make_packet( 100, 0x00 );
+
+    simulator.reset();
+
+    auto packet = std::vector<std::uint8_t>{};
+
+    EXPECT_EQ( simulator.setup( { 0x80, 6, 0x0200, 0, 70 } ), Handshake::ACK );
+
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::ACK );
+    EXPECT_EQ( packet, make_packet( 64, 0x00 ) );
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::ACK );
+    EXPECT_EQ( packet, make_packet( 6, 64 ) );
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::NAK );
+
+    EXPECT_EQ( simulator.out( 0, {} ), Handshake::ACK );
+}
+
+/**
+ * \brief Verify a host-to-device control transfer is sequenced properly (SETUP, OUT data
+ *        stage, IN status stage), and the request is not passed to the request handler
+ *        until its data stage has been received.
+ */
+TEST( controlTransfer, sequencesHostToDeviceRequest )
+{
+    auto handlers  = Handlers{};
+    auto simulator = Simulator{ handle_request, handle_configuration, &handlers };
+
+    handlers.device = &simulator.device();
+
+    simulator.reset();
+
+    auto packet = std::vector<std::uint8_t>{};
+
+    EXPECT_EQ( simulator.setup( { VENDOR_OUT, 1, 0, 0, 100 } ), Handshake::ACK );
+    EXPECT_TRUE( handlers.requests.empty() );
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::NAK );
+
+    EXPECT_EQ( simulator.out( 0, make_packet( 64, 0 ) ), Handshake::ACK );
+    EXPECT_TRUE( handlers.requests.empty() );
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::NAK );
+
+    EXPECT_EQ( simulator.out( 0, make_packet( 36, 64 ) ), Handshake::ACK );
+    ASSERT_EQ( handlers.data.size(), 1u );
+    EXPECT_EQ( handlers.data[ 0 ], make_packet( 100, 0 ) );
+
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::ACK );
+    EXPECT_TRUE( packet.empty() );
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::NAK );
+}
+
+/**
+ * \brief Verify a request that is not handled is stalled until the next setup packet is
+ *        received.
+ */
+TEST( controlTransfer, stallsUnhandledRequest )
+{
+    auto handlers  = Handlers{};
+    auto simulator = Simulator{ handle_request, handle_configuration, &handlers };
+
+    handlers.device     = &simulator.device();
+    handlers.descriptor = make_packet( 18, 0x12 );
+
+    simulator.reset();
+
+    auto packet = std::vector<std::uint8_t>{};
+
+    EXPECT_EQ( simulator.setup( { 0xA1, 1, 0, 0, 8 } ), Handshake::ACK );
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::STALL );
+    EXPECT_EQ( simulator.out( 0, {} ), Handshake::STALL );
+
+    EXPECT_EQ( simulator.setup( { 0x80, 6, 0x0100, 0, 64 } ), Handshake::ACK );
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::ACK );
+    EXPECT_EQ( packet, handlers.descriptor );
+}
+
+/**
+ * \brief Verify SET_ADDRESS does not change the device's address until the request's
+ *        status stage has completed.
+ */
+TEST( setAddress, defersAddressUntilStatusStageCompletes )
+{
+    auto handlers  = Handlers{};
+    auto simulator = Simulator{ handle_request, handle_configuration, &handlers };
+
+    handlers.device = &simulator.device();
+
+    simulator.reset();
+
+    auto packet = std::vector<std::uint8_t>{};
+
+    EXPECT_EQ( simulator.setup( { 0x00, 5, 0x2A, 0, 0 } ), Handshake::ACK );
+    EXPECT_EQ( simulator.address(), 0 );
+
+    EXPECT_EQ( simulator.in( 0, packet ), Handshake::ACK );
+    EXPECT_TRUE( packet.empty() );
+    EXPECT_EQ( simulator.address(), DEVICE::DADD::Mask::ADDEN | 0x2A );
+
+    simulator.reset();
+
+    EXPECT_EQ( simulator.address(), 0 );
+}
+
+/**
+ * \brief Verify a double buffered IN endpoint's transfers complete in the order they
+ *        were queued.
+ */
+TEST( doubleBufferedEndpoint, completesInTransfersInOrder )
+{
+    auto handlers  = Handlers{};
+    auto simulator = Simulator{ handle_request, handle_configuration, &handlers };
+
+    handlers.device = &simulator.device();
+
+    simulator.reset();
+    configure( simulator );
+
+    auto completions = Completions{};
+    auto a           = Transfer{ &completions, 'a' };
+    auto b           = Transfer{ &completions, 'b' };
+    auto c           = Transfer{ &completions, 'c' };
+    auto packet      = std::vector<std::uint8_t>{};
+
+    auto * const buffer_a = simulator.allocate( 64 );
+    auto * const buffer_b = simulator.allocate( 64 );
+    auto * const buffer_c = simulator.allocate( 64 );
+
+    std::fill_n( buffer_a, 64, 'a' );
+    std::fill_n( buffer_b, 64, 'b' );
+    std::fill_n( buffer_c, 64, 'c' );
+
+    auto & device = simulator.device();
+
+    EXPECT_TRUE( device.submit( 0x81, buffer_a, 10, record_completion, &a ) );
+    EXPECT_TRUE( device.submit( 0x81, buffer_b, 20, record_completion, &b ) );
+    EXPECT_FALSE( device.submit( 0x81, buffer_c, 30, record_completion, &c ) );
+
+    // both banks complete before the USB interrupt is serviced
+    simulator.mask_interrupt();
+
+    EXPECT_EQ( simulator.in( 1, packet ), Handshake::ACK );
+    EXPECT_EQ( packet, std::vector<std::uint8_t>( 10, 'a' ) );
+    EXPECT_EQ( simulator.in( 1, packet ), Handshake::ACK );
+    EXPECT_EQ( packet, std::vector<std::uint8_t>( 20, 'b' ) );
+    EXPECT_EQ( simulator.in( 1, packet ), Handshake::NAK );
+
+    simulator.unmask_interrupt();
+
+    EXPECT_EQ( completions, ( Completions{ { 'a', 10 }, { 'b', 20 } } ) );
+
+    // bank 0 is refilled first, so bank 1 holds the older transfer
+    completions.clear();
+
+    EXPECT_TRUE( device.submit( 0x81, buffer_a, 1, record_completion, &a ) );
+    EXPECT_TRUE( device.submit( 0x81, buffer_b, 2, record_completion, &b ) );
+
+    EXPECT_EQ( simulator.in( 1, packet ), Handshake::ACK );
+    EXPECT_EQ( completions, ( Completions{ { 'a', 1 } } ) );
+
+    EXPECT_TRUE( device.submit( 0x81, buffer_c, 3, record_completion, &c ) );
+
+    simulator.mask_interrupt();
+
+    EXPECT_EQ( simulator.in( 1, packet ), Handshake::ACK );
+    EXPECT_EQ( packet, std::vector<std::uint8_t>( 2, 'b' ) );
+    EXPECT_EQ( simulator.in( 1, packet ), Handshake::ACK );
+    EXPECT_EQ( packet, std::vector<std::uint8_t>( 3, 'c' ) );
+
+    simulator.unmask_interrupt();
+
+    EXPECT_EQ( completions, ( Completions{ { 'a', 1 }, { 'b', 2 }, { 'c', 3 } } ) );
+}
+
+/**
+ * \brief Verify a double buffered OUT endpoint's transfers complete in the order they
+ *        were queued.
+ */
+TEST( doubleBufferedEndpoint, completesOutTransfersInOrder )
+{
+    auto handlers  = Handlers{};
+    auto simulator = Simulator{ handle_request, handle_configuration, &handlers };
+
+    handlers.device = &simulator.device();
+
+    simulator.reset();
+    configure( simulator );
+
+    auto completions = Completions{};
+    auto a           = Transfer{ &completions, 'a' };
+    auto b           = Transfer{ &completions, 'b' };
+    auto c           = Transfer{ &completions, 'c' };
+
+    auto * const buffer_a = simulator.allocate( 64 );
+    auto * const buffer_b = simulator.allocate( 64 );
+    auto * const buffer_c = simulator.allocate( 64 );
+
+    auto & device = simulator.device();
+
+    EXPECT_EQ( simulator.out( 2, make_packet( 1, 0 ) ), Handshake::NAK );
+
+    EXPECT_TRUE( device.submit( 0x02, buffer_a, 64, record_completion, &a ) );
+    EXPECT_TRUE( device.submit( 0x02, buffer_b, 64, record_completion, &b ) );
+    EXPECT_FALSE( device.submit( 0x02, buffer_c, 64, record_completion, &c ) );
+
+    // both banks complete before the USB interrupt is serviced
+    simulator.mask_interrupt();
+
+    EXPECT_EQ( simulator.out( 2, make_packet( 10, 0x10 ) ), Handshake::ACK );
+    EXPECT_EQ( simulator.out( 2, make_packet( 64, 0x20 ) ), Handshake::ACK );
+    EXPECT_EQ( simulator.out( 2, make_packet( 1, 0x30 ) ), Handshake::NAK );
+
+    simulator.unmask_interrupt();
+
+    EXPECT_EQ( completions, ( Completions{ { 'a', 10 }, { 'b', 64 } } ) );
+    EXPECT_EQ( contents( buffer_a, 10 ), make_packet( 10, 0x10 ) );
+    EXPECT_EQ( contents( buffer_b, 64 ), make_packet( 64, 0x20 ) );
+
+    // bank 0 is refilled first, so bank 1 holds the older transfer
+    completions.clear();
+
+    EXPECT_TRUE( device.submit( 0x02, buffer_a, 64, record_completion, &a ) );
+    EXPECT_TRUE( device.submit( 0x02, buffer_b, 64, record_completion, &b ) );
+
+    EXPECT_EQ( simulator.out( 2, make_packet( 1, 0x40 ) ), Handshake::ACK );
+    EXPECT_EQ( completions, ( Completions{ { 'a', 1 } } ) );
+
+    EXPECT_TRUE( device.submit( 0x02, buffer_c, 64, record_completion, &c ) );
+
+    simulator.mask_interrupt();
+
+    EXPECT_EQ( simulator.out( 2, make_packet( 2, 0x50 ) ), Handshake::ACK );
+    EXPECT_EQ( simulator.out( 2, make_packet( 3, 0x60 ) ), Handshake::ACK );
+
+    simulator.unmask_interrupt();
+
+    EXPECT_EQ( completions, ( Completions{ { 'a', 1 }, { 'b', 2 }, { 'c', 3 } } ) );
+    EXPECT_EQ( contents( buffer_b, 2 ), make_packet( 2, 0x50 ) );
+    EXPECT_EQ( contents( buffer_c, 3 ), make_packet( 3, 0x60 ) );
+}
+
+/**
+ * \brief Verify a double buffered endpoint's banks restart at bank 0 when the endpoint is
+ *        reconfigured.
+ */
+TEST( doubleBufferedEndpoint, restartsAtBankZeroWhenReconfigured )
+{
+    auto handlers  = Handlers{};
+    auto simulator = Simulator{ handle_request, handle_configuration, &handlers };
+
+    handlers.device = &simulator.device();
+
+    simulator.reset();
+    configure( simulator );
+
+    auto completions = Completions{};
+    auto a           = Transfer{ &completions, 'a' };
+    auto b           = Transfer{ &completions, 'b' };
+
+    auto * const buffer_a = simulator.allocate( 64 );
+    auto * const buffer_b = simulator.allocate( 64 );
+
+    auto & device = simulator.device();
+
+    // leave the USB peripheral's current bank at bank 1
+    EXPECT_TRUE( device.submit( 0x02, buffer_a, 64, record_completion, &a ) );
+    EXPECT_EQ( simulator.out( 2, make_packet( 1, 0 ) ), Handshake::ACK );
+
+    configure( simulator );
+
+    completions.clear();
+
+    EXPECT_TRUE( device.submit( 0x02, buffer_b, 64, record_completion, &b ) );
+    EXPECT_EQ( simulator.out( 2, make_packet( 4, 0 ) ), Handshake::ACK );
+
+    EXPECT_EQ( completions, ( Completions{ { 'b', 4 } } ) );
+}
+
+/**
+ * \brief Verify a bus reset deconfigures the device, and abandons queued transfers.
+ */
+TEST( busReset, abandonsQueuedTransfers )
+{
+    auto handlers  = Handlers{};
+    auto simulator = Simulator{ handle_request, handle_configuration, &handlers };
+
+    handlers.device = &simulator.device();
+
+    simulator.reset();
+    configure( simulator );
+
+    auto completions = Completions{};
+    auto a           = Transfer{ &completions, 'a' };
+    auto packet      = std::vector<std::uint8_t>{};
+
+    EXPECT_TRUE( simulator.device().submit(
+        0x81, simulator.allocate( 64 ), 10, record_completion, &a ) );
+
+    simulator.reset();
+
+    EXPECT_EQ( simulator.device().configuration(), 0 );
+    EXPECT_EQ( simulator.in( 1, packet ), Handshake::NONE );
+    EXPECT_TRUE( completions.empty() );
+}
@@ -0,0 +1,209 @@
+/**
+ * picolibrary-microchip-sam-d21da1
+ *
+ * Copyright 2023-2024, Andrew Countryman <apcountryman@gmail.com> and the
+ * picolibrary-microchip-sam-d21da1 contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::SAM::D21DA1::Boot_Profiler interactive test program.
+ *
+ * The default reset handler's boot phase checkpoints are written to the Arduino Zero's
+ * EDBG virtual COM port (SERCOM5, PB22 TX, PB23 RX, 9600 baud, 8N1), followed by the
+ * total number of processor clock cycles from reset to main().
+ */
+
+#include <cstdint>
+
+#include "picolibrary/microchip/sam/d21da1/boot_profiler.h"
+#include "picolibrary/microchip/sam/d21da1/peripheral.h"
+#include "picolibrary/microchip/sam/d21da1/usart.h"
+
+namespace {
+
+using ::picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::checkpoint_record;
+using ::picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::checkpoints;
+using ::picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::elapsed_us;
+using ::picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::Phase;
+using ::picolibrary::Microchip::SAM::D21DA1::Boot_Profiler::RESET_FREQUENCY;
+using ::picolibrary::Microchip::SAM::D21DA1::Peripheral::GCLK;
+using ::picolibrary::Microchip::SAM::D21DA1::Peripheral::GCLK0;
+using ::picolibrary::Microchip::SAM::D21DA1::Peripheral::PM;
+using ::picolibrary::Microchip::SAM::D21DA1::Peripheral::PM0;
+using ::picolibrary::Microchip::SAM::D21DA1::Peripheral::PORT;
+using ::picolibrary::Microchip::SAM::D21DA1::Peripheral::PORT0;
+using ::picolibrary::Microchip::SAM::D21DA1::Peripheral::SERCOM;
+using ::picolibrary::Microchip::SAM::D21DA1::Peripheral::SERCOM5;
+using ::picolibrary::Microchip::SAM::D21DA1::USART::baud_configuration;
+
+/**
+ * \brief The console baud rate.
+ */
+constexpr auto BAUD_RATE = std::uint32_t{ 9600 };
+
+/**
+ * \brief Configure the console (SERCOM5 clocked by GCLK generator 0, which runs at the
+ *        reset processor clock frequency).
+ */
+void configure_console() noexcept
+{
+    using USART = SERCOM::USART;
+
+    PM0::instance().apbcmask |= PM::APBCMASK::Mask::SERCOM5;
+
+    auto & gclk = GCLK0::instance();
+
+    gclk.clkctrl = GCLK::CLKCTRL::ID_GCLK_SERCOM5_CORE | GCLK::CLKCTRL::GEN_GCLKGEN0
+                   | GCLK::CLKCTRL::Mask::CLKEN;
+
+    while ( gclk.status & GCLK::STATUS::Mask::SYNCBUSY ) {} // while
+
+    // PB22: SERCOM5 PAD[2] (TX), PB23: SERCOM5 PAD[3] (RX)
+    using GROUP = PORT::GROUP;
+
+    auto & group = PORT0::instance().group[ 1 ];
+
+    group.pmux[ 11 ]   = GROUP::PMUX::PMUXE_D | GROUP::PMUX::PMUXO_D;
+    group.pincfg[ 22 ] = GROUP::PINCFG::Mask::PMUXEN;
+    group.pincfg[ 23 ] = GROUP::PINCFG::Mask::PMUXEN | GROUP::PINCFG::Mask::INEN;
+
+    auto & usart = SERCOM5::instance().usart;
+
+    usart.ctrla = USART::CTRLA::Mask::SWRST;
+
+    while ( usart.syncbusy & USART::SYNCBUSY::Mask::SWRST ) {} // while
+
+    auto const configuration = baud_configuration( RESET_FREQUENCY, BAUD_RATE );
+
+    usart.ctrla = USART::CTRLA::MODE_USART_INT_CLK | configuration.sampr
+                  | USART::CTRLA::TXPO_PAD2 | USART::CTRLA::RXPO_PAD3
+                  | USART::CTRLA::DORD_LSB;
+    usart.baud  = configuration.baud;
+    usart.ctrlb = USART::CTRLB::Mask::TXEN;
+
+    while ( usart.syncbusy & USART::SYNCBUSY::Mask::CTRLB ) {} // while
+
+    usart.ctrla |= USART::CTRLA::Mask::ENABLE;
+
+    while ( usart.syncbusy & USART::SYNCBUSY::Mask::ENABLE ) {} // while
+}
+
+/**
+ * \brief Write a character to the console.
+ *
+ * \param[in] character The character to write.
+ */
+void put( char character ) noexcept
+{
+    auto & usart = SERCOM5::instance().usart;
+
+    while ( not( usart.intflag & SERCOM::USART::INTFLAG::Mask::DRE ) ) {} // while
+
+    usart.data = static_cast<std::uint8_t>( character );
+}
+
+/**
+ * \brief Write a string to the console.
+ *
+ * \param[in] string The string to write.
+ */
+void put( char const * string ) noexcept
+{
+    while ( *string ) {
+        put( *string );
+        ++string;
+    } // while
+}
+
+/**
+ * \brief Write an unsigned integer to the console in decimal.
+ *
+ * \param[in] value The unsigned integer to write.
+ */
+void put_decimal( std::uint32_t value ) noexcept
+{
+    char digits[ 10 ];
+    auto n = std::uint_fast8_t{};
+
+    do {
+        digits[ n ] = static_cast<char>( '0' + value % 10 );
+        ++n;
+        value /= 10;
+    } while ( value );
+
+    while ( n ) {
+        --n;
+        put( digits[ n ] );
+    } // while
+}
+
+/**
+ * \brief Get a boot phase's name.
+ *
+ * \param[in] phase The boot phase.
+ *
+ * \return The boot phase's name.
+ */
+auto name( Phase phase ) noexcept -> char const *
+{
+    switch ( phase ) {
+        case Phase::RESET: return "RESET";
+        case Phase::DATA_COPIED: return "DATA_COPIED";
+        case Phase::BSS_ZEROED: return "BSS_ZEROED";
+        case Phase::VTOR_SET: return "VTOR_SET";
+        case Phase::NVM_ERRATA_APPLIED: return "NVM_ERRATA_APPLIED";
+        case Phase::MAIN: return "MAIN";
+        case Phase::CLOCK_CHANGED: return "CLOCK_CHANGED";
+        case Phase::CHECKPOINT: return "CHECKPOINT";
+    } // switch
+
+    return "UNKNOWN";
+}
+
+} // namespace
+
+/**
+ * \brief Execute the picolibrary::Microchip::SAM::D21DA1::Boot_Profiler interactive test.
+ *
+ * Each checkpoint is written on its own line ("<phase> <cycles> <elapsed us>"), followed
+ * by a "STARTUP <cycles>" line with the total number of processor clock cycles from
+ * reset to main().
+ *
+ * \return N/A
+ */
+int main()
+{
+    configure_console();
+
+    auto startup_cycles = std::uint32_t{};
+
+    for ( auto i = std::uint_fast8_t{}; i < checkpoints(); ++i ) {
+        auto const record = checkpoint_record( i );
+
+        put( name( record.phase ) );
+        put( ' ' );
+        put_decimal( record.cycles );
+        put( ' ' );
+        put_decimal( elapsed_us( i ) );
+        put( '\n' );
+
+        startup_cycles += record.cycles;
+    } // for
+
+    put( "STARTUP " );
+    put_decimal( startup_cycles );
+    put( '\n' );
+
+    for ( ;; ) {} // for
+}